@@ -1,6 +1,7 @@
 #include "ActionExecutor.h"
 #include "core/action/util/Logger.h"
 #include "interfaces/IEventBus.h"
+#include "util/EventPool.h"
 #include "dto/ActionEvents.h"
 #include <thread>
 
@@ -124,7 +125,7 @@ std::string ActionExecutor::executeAsync(
                  actionId, action->getType(), timeout.count());
 
     // 이벤트 발행: ACTION_STARTED
-    publishEvent(std::make_shared<mxrc::core::event::ActionStartedEvent>(
+    publishEvent(event::EventPool<event::ActionStartedEvent>::make(
         actionId, action->getType()));
 
     // 비동기로 액션 실행
@@ -142,7 +143,7 @@ std::string ActionExecutor::executeAsync(
             // 이벤트 발행: ACTION_COMPLETED
             auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
                 std::chrono::steady_clock::now() - startTime);
-            self->publishEvent(std::make_shared<mxrc::core::event::ActionCompletedEvent>(
+            self->publishEvent(event::EventPool<event::ActionCompletedEvent>::make(
                 actionId, action->getType(), elapsed.count()));
 
         } catch (const std::exception& e) {
@@ -161,7 +162,7 @@ std::string ActionExecutor::executeAsync(
             // 이벤트 발행: ACTION_FAILED
             auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
                 std::chrono::steady_clock::now() - startTime);
-            self->publishEvent(std::make_shared<mxrc::core::event::ActionFailedEvent>(
+            self->publishEvent(event::EventPool<event::ActionFailedEvent>::make(
                 actionId, action->getType(), e.what(), elapsed.count()));
         }
     });
@@ -218,7 +219,7 @@ std::string ActionExecutor::executeAsync(
                             // 이벤트 발행: ACTION_TIMEOUT
                             auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
                                 std::chrono::steady_clock::now() - startTime);
-                            self->publishEvent(std::make_shared<mxrc::core::event::ActionTimeoutEvent>(
+                            self->publishEvent(event::EventPool<event::ActionTimeoutEvent>::make(
                                 actionId, "", timeout.count(), elapsed.count()));
 
                             self->cancel(actionId);
@@ -258,7 +259,7 @@ void ActionExecutor::cancel(const std::string& actionId) {
         logger->info("[ActionExecutor] Action {} cancel request processed", actionId);
 
         // 이벤트 발행: ACTION_CANCELLED
-        publishEvent(std::make_shared<mxrc::core::event::ActionCancelledEvent>(
+        publishEvent(event::EventPool<event::ActionCancelledEvent>::make(
             actionId, actionToCancel->getType(), 0));
     }
 }
@@ -2,12 +2,14 @@
 #include "MapNotifier.h"
 #include "interfaces/IRobotStateAccessor.h"
 #include "interfaces/ITaskStatusAccessor.h"
+#include <deque>
 #include <mutex>
 #include <stdexcept>
 #include <fstream>
 #include <nlohmann/json.hpp>
 #include <filesystem>
 #include <spdlog/spdlog.h>
+#include <thread>
 
 DataStore::DataStore()
     : expiration_manager_(std::make_unique<mxrc::core::datastore::ExpirationManager>()),
@@ -64,6 +66,69 @@ void DataStore::unsubscribe(const std::string& id, std::shared_ptr<Observer> obs
     }
 }
 
+namespace {
+
+// 탭 구간 슬롯 목록 (deque: 주소 고정). thread_local 소멸자보다 오래 살도록 해제하지 않음
+struct WriteTapReaderRegistry {
+    std::mutex mutex;
+    std::deque<WriteTapReaderSlot> slots;
+};
+
+WriteTapReaderRegistry& writeTapReaderRegistry() {
+    static auto* registry = new WriteTapReaderRegistry();
+    return *registry;
+}
+
+// 스레드 종료 시 슬롯 반납 (구간 밖이므로 seq는 짝수)
+struct WriteTapReaderHandle {
+    WriteTapReaderSlot* slot = nullptr;
+    ~WriteTapReaderHandle() {
+        if (slot) {
+            slot->in_use.store(false, std::memory_order_release);
+        }
+    }
+};
+
+} // namespace
+
+WriteTapReaderSlot& DataStore::writeTapReaderSlot() {
+    thread_local WriteTapReaderHandle handle;
+    if (!handle.slot) {
+        auto& registry = writeTapReaderRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (auto& slot : registry.slots) {
+            if (!slot.in_use.load(std::memory_order_acquire)) {
+                handle.slot = &slot;
+                break;
+            }
+        }
+        if (!handle.slot) {
+            handle.slot = &registry.slots.emplace_back();
+        }
+        handle.slot->in_use.store(true, std::memory_order_relaxed);
+    }
+    return *handle.slot;
+}
+
+void DataStore::setWriteTap(WriteTap* tap) {
+    write_tap_.store(tap, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // 교체 시점에 탭 구간 안에 있던 스레드만 빠져나올 때까지 대기 (탭 호출은 memcpy 수준)
+    // 그 뒤에 구간에 들어온 쓰기는 새 탭을 읽으므로 기다리지 않음
+    auto& registry = writeTapReaderRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (auto& slot : registry.slots) {
+        uint64_t seen = slot.seq.load(std::memory_order_acquire);
+        if ((seen & 1) == 0) {
+            continue;
+        }
+        while (slot.seq.load(std::memory_order_acquire) == seen) {
+            std::this_thread::yield();
+        }
+    }
+}
+
 void DataStore::notifySubscribers(const SharedData& changed_data) {
     // shared_ptr 복사로 안전한 생명주기 관리
     std::shared_ptr<Notifier> notifier;
@@ -365,7 +430,8 @@ void DataStore::setVersioned(const std::string& id, const T& value, DataType typ
         ver_acc->second.fetch_add(1, std::memory_order_acq_rel);
     }
 
-    // 3. Notify subscribers (reuse existing notification logic)
+    // 3. Capture raw value, then notify subscribers (reuse existing notification logic)
+    captureWrite(id, value, type, new_data.timestamp);
     notifySubscribers(new_data);
 
     // 4. Update metrics (TODO: Add recordWrite() to MetricsCollector)
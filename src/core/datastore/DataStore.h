@@ -12,6 +12,7 @@
 #include <atomic>
 #include <shared_mutex>
 #include <stdexcept>
+#include <type_traits>
 #include <tbb/concurrent_hash_map.h>
 
 #include "managers/ExpirationManager.h"
@@ -80,6 +81,49 @@ public:
     virtual void onDataChanged(const SharedData& changed_data) = 0;
 };
 
+/// @brief 쓰기 탭으로 전달되는 값의 원시 표현
+enum class CapturedValueKind : uint8_t {
+    Int32,
+    Int64,
+    UInt32,
+    UInt64,
+    Float,
+    Double,
+    Bool,
+    String,        ///< 문자 바이트 (null 종료 없음)
+    DoubleArray,   ///< std::vector<double> 요소 바이트
+    Bytes,         ///< 그 외 trivially copyable 타입의 객체 바이트
+};
+
+/**
+ * @brief DataStore 쓰기 탭 (기록용 캡처 훅)
+ *
+ * set()/setVersioned()마다 저장된 값의 원시 바이트를 그대로 전달받습니다.
+ * Observer와 달리 SharedData/std::any를 만들거나 문자열로 변환하지 않으므로,
+ * 구현체는 전달받은 바이트를 미리 할당된 버퍼로 복사만 하고 즉시 반환해야 합니다.
+ * data는 호출 중에만 유효합니다.
+ */
+class WriteTap {
+public:
+    virtual ~WriteTap() = default;
+    virtual void onWrite(const std::string& id, DataType type, CapturedValueKind kind,
+                         const void* data, size_t size,
+                         std::chrono::system_clock::time_point timestamp) noexcept = 0;
+};
+
+/**
+ * @brief 쓰기 탭 호출 구간 카운터 (스레드별, DataStore 내부용)
+ *
+ * 쓰기 스레드는 자기 슬롯만 갱신하므로 탭이 설치된 동안에도 스레드 간
+ * 공유 atomic을 두고 경합하지 않습니다. setWriteTap()은 탭 교체 시점에
+ * 탭 구간 안에 있던 슬롯이 빠져나올 때까지만 기다립니다 (grace period).
+ */
+struct alignas(64) WriteTapReaderSlot {
+    std::atomic<uint64_t> seq{0};        ///< 홀수 = 탭 호출 구간 안
+    uint32_t depth = 0;                  ///< 중첩 깊이 (소유 스레드만 접근)
+    std::atomic<bool> in_use{false};     ///< 스레드에 할당됨 (스레드 종료 시 재사용)
+};
+
 /**
  * @brief 스레드 안전한 중앙 데이터 저장소 (Facade 패턴)
  *
@@ -133,6 +177,10 @@ public:
     /// @brief 구독 해제
     void unsubscribe(const std::string& id, std::shared_ptr<Observer> observer);
 
+    /// @brief 쓰기 탭 설정 (nullptr이면 해제)
+    /// @note 반환 후에는 이전 탭이 더 이상 호출되지 않으므로 안전하게 파괴할 수 있음
+    void setWriteTap(WriteTap* tap);
+
     /// @brief 만료 정책 적용
     void applyExpirationPolicy(const std::string& id, const DataExpirationPolicy& policy);
 
@@ -196,6 +244,17 @@ private:
     /// @brief 내부 헬퍼: Observer 알림 발행
     void notifySubscribers(const SharedData& changed_data);
 
+    /// @brief 내부 헬퍼: 쓰기 탭으로 원시 값 전달 (탭이 없으면 atomic load 한 번)
+    template<typename T>
+    void captureWrite(const std::string& id, const T& value, DataType type,
+                      std::chrono::system_clock::time_point timestamp);
+
+    /// @brief 쓰기 탭 (Observer 경로를 거치지 않는 기록용 캡처)
+    std::atomic<WriteTap*> write_tap_{nullptr};
+
+    /// @brief 현재 스레드의 탭 구간 슬롯 (최초 호출 시 등록)
+    static WriteTapReaderSlot& writeTapReaderSlot();
+
     /// @brief Notifier 보호용 뮤텍스 (data_map_은 내부 락 사용)
     mutable std::mutex mutex_;
 };
@@ -263,6 +322,7 @@ void DataStore::set(const std::string& id, const T& data, DataType type,
             expiration_manager_->applyLRUPolicy(id, capacity);
         }
 
+        captureWrite(id, data, type, new_data.timestamp);
         notifySubscribers(new_data);
     } catch (const std::exception& e) {
         log_manager_->logError("set_failed", e.what(), "id=" + id);
@@ -270,6 +330,52 @@ void DataStore::set(const std::string& id, const T& data, DataType type,
     }
 }
 
+template<typename T>
+void DataStore::captureWrite(const std::string& id, const T& value, DataType type,
+                             std::chrono::system_clock::time_point timestamp) {
+    if (!write_tap_.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    // 자기 슬롯에 구간 진입 표시 후 탭 로드. setWriteTap()과 seq_cst fence로 맞물림:
+    // 교체 후 대기가 끝나면 이전 탭을 읽은 쓰기는 남아 있지 않음
+    WriteTapReaderSlot& slot = writeTapReaderSlot();
+    if (slot.depth++ == 0) {
+        slot.seq.store(slot.seq.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+    if (WriteTap* tap = write_tap_.load(std::memory_order_relaxed)) {
+        auto emit = [&](CapturedValueKind kind, const void* data, size_t size) {
+            tap->onWrite(id, type, kind, data, size, timestamp);
+        };
+
+        if constexpr (std::is_same_v<T, std::string>) {
+            emit(CapturedValueKind::String, value.data(), value.size());
+        } else if constexpr (std::is_same_v<T, std::vector<double>>) {
+            emit(CapturedValueKind::DoubleArray, value.data(), value.size() * sizeof(double));
+        } else if constexpr (std::is_same_v<T, bool>) {
+            emit(CapturedValueKind::Bool, &value, sizeof(T));
+        } else if constexpr (std::is_same_v<T, float>) {
+            emit(CapturedValueKind::Float, &value, sizeof(T));
+        } else if constexpr (std::is_same_v<T, double>) {
+            emit(CapturedValueKind::Double, &value, sizeof(T));
+        } else if constexpr (std::is_integral_v<T> && (sizeof(T) == 4 || sizeof(T) == 8)) {
+            constexpr bool wide = sizeof(T) == 8;
+            if constexpr (std::is_signed_v<T>) {
+                emit(wide ? CapturedValueKind::Int64 : CapturedValueKind::Int32, &value, sizeof(T));
+            } else {
+                emit(wide ? CapturedValueKind::UInt64 : CapturedValueKind::UInt32, &value, sizeof(T));
+            }
+        } else if constexpr (std::is_trivially_copyable_v<T>) {
+            emit(CapturedValueKind::Bytes, &value, sizeof(T));
+        }
+        // 그 외 타입(컨테이너, 포인터 소유 객체)은 원시 바이트로 기록할 수 없으므로 건너뜀
+    }
+    if (--slot.depth == 0) {
+        slot.seq.store(slot.seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+}
+
 template<typename T>
 T DataStore::get(const std::string& id) {
     try {
@@ -1,4 +1,7 @@
 #include "RTEtherCATCycle.h"
+#include "../../rt/util/TimeUtils.h"
+#include "../../event/util/EventPool.h"
+#include "../../logging/Log.h"
 #include <spdlog/spdlog.h>
 
 namespace mxrc {
@@ -19,14 +22,41 @@ RTEtherCATCycle::RTEtherCATCycle(
     , error_count_(0)
     , read_success_count_(0)
     , write_success_count_(0)
-    , motor_command_count_(0) {
+    , motor_command_count_(0)
+    , plan_dirty_(true)
+    , image_store_(nullptr)
+    , image_external_(false)
+    , send_pending_(false)
+    , send_time_ns_(0)
+    , receive_delay_ns_(0)
+    , last_wire_time_ns_(0)
+    , error_burst_(false) {
+    pending_error_events_.reserve(ERROR_EVENT_BATCH);
+}
+
+RTEtherCATCycle::~RTEtherCATCycle() {
+    flushErrorEvents();
 }
 
 void RTEtherCATCycle::execute(core::rt::RTContext& ctx) {
+    if (executeSend(ctx) != 0) {
+        return;
+    }
+    executeReceive(ctx);
+}
+
+int RTEtherCATCycle::executeSend(core::rt::RTContext& ctx) {
+    send_pending_ = false;
+
     // 0. RTDataStore 유효성 체크
     if (!ctx.data_store) {
         handleEtherCATError(EtherCATErrorType::INITIALIZATION_ERROR, "RTDataStore 없음");
-        return;
+        return -1;
+    }
+
+    // 0b. 등록 변경 후 첫 cycle: PDO 접근 계획 컴파일
+    if (plan_dirty_) {
+        activate();
     }
 
     // 1. 출력 데이터 준비 (RTDataStore → PDO domain)
@@ -40,23 +70,182 @@ void RTEtherCATCycle::execute(core::rt::RTContext& ctx) {
     }
 
     // 2. EtherCAT 프레임 전송 (출력 명령 + 모터 명령 포함)
+    //    DC application time은 실제 송신 시각이 아닌 cycle 예정 시작 시각
+    master_->setApplicationTime(ctx.timestamp_ns);
     if (master_->send() != 0) {
         handleEtherCATError(EtherCATErrorType::SEND_FAILURE, "EtherCAT send 실패");
-        return;
+        return -1;
     }
 
+    send_time_ns_ = core::rt::util::getMonotonicTimeNs();
+    send_pending_ = true;
+    return 0;
+}
+
+int RTEtherCATCycle::executeReceive(core::rt::RTContext& ctx) {
+    // 이번 cycle에 송신한 프레임이 없으면 수신하지 않음 (send 실패는 이미 보고됨)
+    if (!send_pending_) {
+        return -1;
+    }
+    send_pending_ = false;
+
+    if (!ctx.data_store) {
+        handleEtherCATError(EtherCATErrorType::INITIALIZATION_ERROR, "RTDataStore 없음");
+        return -1;
+    }
+
+    // 최소 수신 지연 전이면 프레임 복귀까지 대기 (너무 이른 receive는 빈 datagram 처리)
+    uint64_t now_ns = core::rt::util::getMonotonicTimeNs();
+    if (receive_delay_ns_ > 0) {
+        uint64_t ready_ns = send_time_ns_ + receive_delay_ns_;
+        while (now_ns < ready_ns) {
+            now_ns = core::rt::util::getMonotonicTimeNs();
+        }
+    }
+    last_wire_time_ns_.store(now_ns - send_time_ns_, std::memory_order_relaxed);
+
     // 3. EtherCAT 프레임 수신 (센서 데이터)
-    if (master_->receive() != 0) {
+    // zero-copy 모드: domain이 store image에 직접 쓰므로 수신 구간을 seqlock으로 보호
+    if (image_store_ && image_external_) {
+        image_store_->beginImageUpdate();
+    }
+    int receive_result = master_->receive();
+    if (image_store_) {
+        if (image_external_) {
+            image_store_->endImageUpdate();
+        } else if (receive_result == 0) {
+            image_store_->publishImage(master_->getProcessImage(),
+                                       master_->getProcessImageSize());
+        }
+    }
+
+    if (receive_result != 0) {
         handleEtherCATError(EtherCATErrorType::RECEIVE_FAILURE, "EtherCAT receive 실패");
-        return;
+        return -1;
     }
 
-    // 4. 등록된 모든 센서 읽기 및 RTDataStore에 저장
+    // 4. 등록된 센서 읽기 및 RTDataStore에 저장 (뷰로 제공되는 센서는 image에서 직접 읽힘)
     for (const auto& sensor : sensors_) {
+        if (sensor.image_view) {
+            continue;
+        }
         readAndStoreSensor(sensor, ctx.data_store);
     }
 
     total_cycles_.fetch_add(1, std::memory_order_relaxed);
+
+    // 에러 구간 종료: 남은 에러 이벤트 발행
+    if (error_burst_) {
+        flushErrorEvents();
+        error_burst_ = false;
+    }
+    return 0;
+}
+
+int RTEtherCATCycle::activate() {
+    std::vector<uint16_t> io_slaves;
+    io_slaves.reserve(sensors_.size() + outputs_.size());
+    for (const auto& sensor : sensors_) {
+        io_slaves.push_back(sensor.slave_id);
+    }
+    for (const auto& output : outputs_) {
+        io_slaves.push_back(output.slave_id);
+    }
+
+    std::vector<uint16_t> motor_slaves;
+    motor_slaves.reserve(motors_.size());
+    for (const auto& motor : motors_) {
+        motor_slaves.push_back(motor.slave_id);
+    }
+
+    int result = 0;
+    if (sensor_manager_ && sensor_manager_->compileAccessPlan(io_slaves) != 0) {
+        spdlog::error("센서 PDO 접근 계획 컴파일 실패");
+        result = -1;
+    }
+    if (motor_manager_ && motor_manager_->compileAccessPlan(motor_slaves) != 0) {
+        spdlog::error("모터 PDO 접근 계획 컴파일 실패");
+        result = -1;
+    }
+
+    if (image_store_ && sensor_manager_) {
+        sensor_manager_->bindInputViews(*image_store_);
+        bindSensorViews();
+    }
+
+    plan_dirty_ = false;
+
+    spdlog::info("EtherCAT cycle 활성화: sensors={}, outputs={}, motors={}",
+                 sensors_.size(), outputs_.size(), motors_.size());
+
+    return result;
+}
+
+int RTEtherCATCycle::attachProcessImage(core::rt::RTDataStore& store) {
+    size_t image_size = master_->getProcessImageSize();
+    if (image_size == 0 || image_size > core::rt::RTDataStore::PROCESS_IMAGE_SIZE) {
+        spdlog::error("Process image 연결 실패: domain size={}, 최대={}",
+                      image_size, core::rt::RTDataStore::PROCESS_IMAGE_SIZE);
+        return -1;
+    }
+
+    image_external_ = master_->useExternalProcessImage(
+        store.processImage(), core::rt::RTDataStore::PROCESS_IMAGE_SIZE) == 0;
+    if (!image_external_ && !master_->getProcessImage()) {
+        spdlog::error("Process image 연결 실패: domain 포인터 없음");
+        return -1;
+    }
+
+    image_store_ = &store;
+
+    // 뷰 바인딩은 접근 계획 컴파일 시 수행
+    plan_dirty_ = true;
+    activate();
+
+    spdlog::info("Process image 연결: size={}, mode={}", image_size,
+                 image_external_ ? "zero-copy" : "copy");
+
+    return image_external_ ? 0 : 1;
+}
+
+int RTEtherCATCycle::bindSensorViews() {
+    int bound = 0;
+
+    for (auto& sensor : sensors_) {
+        sensor.image_view = false;
+
+        uint16_t index = 0;
+        uint8_t subindex = 0x01;
+        switch (sensor.type) {
+            case SensorType::POSITION: index = 0x1A00; break;
+            case SensorType::VELOCITY: index = 0x1A01; break;
+            case SensorType::TORQUE:   index = 0x1A02; subindex = 0x06; break;  // torque_z
+            case SensorType::AI:       index = 0x1A04; subindex = 0x01 + sensor.channel; break;
+            case SensorType::DI:       continue;  // 비트맵의 한 비트: 뷰로 표현 불가
+        }
+
+        double scale = sensor.type == SensorType::POSITION ? sensor.scale_factor : 1.0;
+        if (sensor_manager_->bindInputView(*image_store_, sensor.slave_id, index, subindex,
+                                           sensor.data_key, scale) != 0) {
+            image_store_->unbindView(sensor.data_key);
+            continue;
+        }
+
+        // position 센서의 velocity (0x1A00:02)도 함께 바인딩, 실패 시 둘 다 기존 경로
+        if (sensor.type == SensorType::POSITION && sensor.data_key2 != sensor.data_key &&
+            sensor_manager_->bindInputView(*image_store_, sensor.slave_id, 0x1A00, 0x02,
+                                           sensor.data_key2, scale) != 0) {
+            image_store_->unbindView(sensor.data_key);
+            image_store_->unbindView(sensor.data_key2);
+            continue;
+        }
+
+        sensor.image_view = true;
+        bound++;
+    }
+
+    spdlog::info("센서 process image 뷰 바인딩: {}/{}개", bound, sensors_.size());
+    return bound;
 }
 
 int RTEtherCATCycle::registerPositionSensor(uint16_t slave_id,
@@ -67,11 +256,13 @@ int RTEtherCATCycle::registerPositionSensor(uint16_t slave_id,
     info.slave_id = slave_id;
     info.data_key = position_key;
     info.data_key2 = velocity_key;
-    info.sensor_type = "POSITION";
+    info.type = SensorType::POSITION;
     info.channel = 0;
     info.scale_factor = scale_factor;
+    info.image_view = false;
 
     sensors_.push_back(info);
+    plan_dirty_ = true;
 
     spdlog::info("Position 센서 등록: slave_id={}, pos_key={}, vel_key={}, scale={}",
                  slave_id, static_cast<int>(position_key),
@@ -82,88 +273,135 @@ int RTEtherCATCycle::registerPositionSensor(uint16_t slave_id,
 
 int RTEtherCATCycle::registerSensor(uint16_t slave_id, core::rt::DataKey data_key,
                                      const std::string& sensor_type) {
+    SensorType type;
+    if (parseSensorType(sensor_type, type) != 0) {
+        spdlog::error("알 수 없는 센서 타입: {} (slave_id={})", sensor_type, slave_id);
+        return -1;
+    }
+
+    return registerSensor(slave_id, data_key, type);
+}
+
+int RTEtherCATCycle::registerSensor(uint16_t slave_id, core::rt::DataKey data_key,
+                                     SensorType sensor_type) {
     SensorInfo info;
     info.slave_id = slave_id;
     info.data_key = data_key;
     info.data_key2 = data_key;  // 단일 센서는 동일하게 설정
-    info.sensor_type = sensor_type;
+    info.type = sensor_type;
     info.channel = 0;  // 기본값, DI/AI는 별도 설정 필요
     info.scale_factor = 1.0;  // 기본 스케일
+    info.image_view = false;
 
     sensors_.push_back(info);
+    plan_dirty_ = true;
 
     spdlog::info("센서 등록: slave_id={}, type={}, data_key={}",
-                 slave_id, sensor_type, static_cast<int>(data_key));
+                 slave_id, sensorTypeName(sensor_type), static_cast<int>(data_key));
 
     return 0;
 }
 
+int RTEtherCATCycle::parseSensorType(const std::string& name, SensorType& out_type) {
+    static constexpr SensorType TYPES[] = {
+        SensorType::POSITION, SensorType::VELOCITY, SensorType::TORQUE,
+        SensorType::DI, SensorType::AI,
+    };
+
+    for (SensorType type : TYPES) {
+        if (name == sensorTypeName(type)) {
+            out_type = type;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+const char* RTEtherCATCycle::sensorTypeName(SensorType type) {
+    switch (type) {
+        case SensorType::POSITION: return "POSITION";
+        case SensorType::VELOCITY: return "VELOCITY";
+        case SensorType::TORQUE:   return "TORQUE";
+        case SensorType::DI:       return "DI";
+        case SensorType::AI:       return "AI";
+    }
+    return "UNKNOWN";
+}
+
 void RTEtherCATCycle::readAndStoreSensor(const SensorInfo& sensor,
                                           core::rt::RTDataStore* data_store) {
     // MVP: RTDataStore는 간단한 primitive 타입만 지원
     // 센서 데이터의 주요 값만 저장
 
-    if (sensor.sensor_type == "POSITION") {
-        PositionSensorData data;
-        if (sensor_manager_->readPositionSensor(sensor.slave_id, data) == 0 && data.valid) {
-            // 스케일 팩터 적용: 엔코더 카운트 → 실제 단위 (mm, rad 등)
-            double scaled_position = static_cast<double>(data.position) * sensor.scale_factor;
-            data_store->setDouble(sensor.data_key, scaled_position);
-
-            // velocity도 동일하게 스케일 적용 (data_key2가 설정된 경우)
-            if (sensor.data_key2 != sensor.data_key) {
-                double scaled_velocity = static_cast<double>(data.velocity) * sensor.scale_factor;
-                data_store->setDouble(sensor.data_key2, scaled_velocity);
+    switch (sensor.type) {
+        case SensorType::POSITION: {
+            PositionSensorData data;
+            if (sensor_manager_->readPositionSensor(sensor.slave_id, data) == 0 && data.valid) {
+                // 스케일 팩터 적용: 엔코더 카운트 → 실제 단위 (mm, rad 등)
+                double scaled_position = static_cast<double>(data.position) * sensor.scale_factor;
+                data_store->setDouble(sensor.data_key, scaled_position);
+
+                // velocity도 동일하게 스케일 적용 (data_key2가 설정된 경우)
+                if (sensor.data_key2 != sensor.data_key) {
+                    double scaled_velocity = static_cast<double>(data.velocity) * sensor.scale_factor;
+                    data_store->setDouble(sensor.data_key2, scaled_velocity);
+                }
+                read_success_count_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                MXRC_LOG_DEBUG("Position 센서 읽기 실패: slave_id={}", sensor.slave_id);
             }
-            read_success_count_.fetch_add(1, std::memory_order_relaxed);
-        } else {
-            spdlog::debug("Position 센서 읽기 실패: slave_id={}", sensor.slave_id);
+            break;
         }
 
-    } else if (sensor.sensor_type == "VELOCITY") {
-        VelocitySensorData data;
-        if (sensor_manager_->readVelocitySensor(sensor.slave_id, data) == 0 && data.valid) {
-            // velocity를 DOUBLE로 저장
-            data_store->setDouble(sensor.data_key, data.velocity);
-            read_success_count_.fetch_add(1, std::memory_order_relaxed);
-        } else {
-            spdlog::debug("Velocity 센서 읽기 실패: slave_id={}", sensor.slave_id);
+        case SensorType::VELOCITY: {
+            VelocitySensorData data;
+            if (sensor_manager_->readVelocitySensor(sensor.slave_id, data) == 0 && data.valid) {
+                // velocity를 DOUBLE로 저장
+                data_store->setDouble(sensor.data_key, data.velocity);
+                read_success_count_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                MXRC_LOG_DEBUG("Velocity 센서 읽기 실패: slave_id={}", sensor.slave_id);
+            }
+            break;
         }
 
-    } else if (sensor.sensor_type == "TORQUE") {
-        TorqueSensorData data;
-        if (sensor_manager_->readTorqueSensor(sensor.slave_id, data) == 0 && data.valid) {
-            // torque_z를 DOUBLE로 저장 (MVP: 단일 축)
-            data_store->setDouble(sensor.data_key, data.torque_z);
-            read_success_count_.fetch_add(1, std::memory_order_relaxed);
-        } else {
-            spdlog::debug("Torque 센서 읽기 실패: slave_id={}", sensor.slave_id);
+        case SensorType::TORQUE: {
+            TorqueSensorData data;
+            if (sensor_manager_->readTorqueSensor(sensor.slave_id, data) == 0 && data.valid) {
+                // torque_z를 DOUBLE로 저장 (MVP: 단일 축)
+                data_store->setDouble(sensor.data_key, data.torque_z);
+                read_success_count_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                MXRC_LOG_DEBUG("Torque 센서 읽기 실패: slave_id={}", sensor.slave_id);
+            }
+            break;
         }
 
-    } else if (sensor.sensor_type == "DI") {
-        DigitalInputData data;
-        if (sensor_manager_->readDigitalInput(sensor.slave_id, sensor.channel, data) == 0 && data.valid) {
-            // bool을 INT32로 저장
-            data_store->setInt32(sensor.data_key, data.value ? 1 : 0);
-            read_success_count_.fetch_add(1, std::memory_order_relaxed);
-        } else {
-            spdlog::debug("Digital Input 읽기 실패: slave_id={}, channel={}",
-                         sensor.slave_id, sensor.channel);
+        case SensorType::DI: {
+            DigitalInputData data;
+            if (sensor_manager_->readDigitalInput(sensor.slave_id, sensor.channel, data) == 0 && data.valid) {
+                // bool을 INT32로 저장
+                data_store->setInt32(sensor.data_key, data.value ? 1 : 0);
+                read_success_count_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                MXRC_LOG_DEBUG("Digital Input 읽기 실패: slave_id={}, channel={}",
+                               sensor.slave_id, sensor.channel);
+            }
+            break;
         }
 
-    } else if (sensor.sensor_type == "AI") {
-        AnalogInputData data;
-        if (sensor_manager_->readAnalogInput(sensor.slave_id, sensor.channel, data) == 0 && data.valid) {
-            // value를 DOUBLE로 저장
-            data_store->setDouble(sensor.data_key, data.value);
-            read_success_count_.fetch_add(1, std::memory_order_relaxed);
-        } else {
-            spdlog::debug("Analog Input 읽기 실패: slave_id={}, channel={}",
-                         sensor.slave_id, sensor.channel);
+        case SensorType::AI: {
+            AnalogInputData data;
+            if (sensor_manager_->readAnalogInput(sensor.slave_id, sensor.channel, data) == 0 && data.valid) {
+                // value를 DOUBLE로 저장
+                data_store->setDouble(sensor.data_key, data.value);
+                read_success_count_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                MXRC_LOG_DEBUG("Analog Input 읽기 실패: slave_id={}, channel={}",
+                               sensor.slave_id, sensor.channel);
+            }
+            break;
         }
-
-    } else {
-        spdlog::warn("알 수 없는 센서 타입: {}", sensor.sensor_type);
     }
 }
 
@@ -173,11 +411,12 @@ int RTEtherCATCycle::registerDigitalOutput(uint16_t slave_id, uint8_t channel,
     info.slave_id = slave_id;
     info.channel = channel;
     info.data_key = data_key;
-    info.output_type = "DO";
+    info.type = OutputType::DO;
     info.min_value = 0.0;
     info.max_value = 1.0;
 
     outputs_.push_back(info);
+    plan_dirty_ = true;
 
     spdlog::info("Digital Output 등록: slave_id={}, channel={}, data_key={}",
                  slave_id, channel, static_cast<int>(data_key));
@@ -192,11 +431,12 @@ int RTEtherCATCycle::registerAnalogOutput(uint16_t slave_id, uint8_t channel,
     info.slave_id = slave_id;
     info.channel = channel;
     info.data_key = data_key;
-    info.output_type = "AO";
+    info.type = OutputType::AO;
     info.min_value = min_value;
     info.max_value = max_value;
 
     outputs_.push_back(info);
+    plan_dirty_ = true;
 
     spdlog::info("Analog Output 등록: slave_id={}, channel={}, data_key={}, range=[{}, {}]",
                  slave_id, channel, static_cast<int>(data_key), min_value, max_value);
@@ -206,58 +446,60 @@ int RTEtherCATCycle::registerAnalogOutput(uint16_t slave_id, uint8_t channel,
 
 void RTEtherCATCycle::readAndWriteOutput(const OutputInfo& output,
                                           core::rt::RTDataStore* data_store) {
-    if (output.output_type == "DO") {
-        // RTDataStore에서 값 읽기 (INT32로 저장됨)
-        int32_t value_int = 0;
-        if (data_store->getInt32(output.data_key, value_int) != 0) {
-            spdlog::debug("Digital Output 데이터 읽기 실패: data_key={}",
-                         static_cast<int>(output.data_key));
-            return;
-        }
+    switch (output.type) {
+        case OutputType::DO: {
+            // RTDataStore에서 값 읽기 (INT32로 저장됨)
+            int32_t value_int = 0;
+            if (data_store->getInt32(output.data_key, value_int) != 0) {
+                MXRC_LOG_DEBUG("Digital Output 데이터 읽기 실패: data_key={}",
+                               static_cast<int>(output.data_key));
+                return;
+            }
 
-        // DigitalOutputData 구성
-        DigitalOutputData data;
-        data.slave_id = output.slave_id;
-        data.channel = output.channel;
-        data.value = (value_int != 0);
-        data.valid = true;
-
-        // EtherCAT으로 쓰기
-        if (sensor_manager_->writeDigitalOutput(output.slave_id, output.channel, data) == 0) {
-            write_success_count_.fetch_add(1, std::memory_order_relaxed);
-        } else {
-            spdlog::debug("Digital Output 쓰기 실패: slave_id={}, channel={}",
-                         output.slave_id, output.channel);
+            // DigitalOutputData 구성
+            DigitalOutputData data;
+            data.slave_id = output.slave_id;
+            data.channel = output.channel;
+            data.value = (value_int != 0);
+            data.valid = true;
+
+            // EtherCAT으로 쓰기
+            if (sensor_manager_->writeDigitalOutput(output.slave_id, output.channel, data) == 0) {
+                write_success_count_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                MXRC_LOG_DEBUG("Digital Output 쓰기 실패: slave_id={}, channel={}",
+                               output.slave_id, output.channel);
+            }
+            break;
         }
 
-    } else if (output.output_type == "AO") {
-        // RTDataStore에서 값 읽기 (DOUBLE로 저장됨)
-        double value = 0.0;
-        if (data_store->getDouble(output.data_key, value) != 0) {
-            spdlog::debug("Analog Output 데이터 읽기 실패: data_key={}",
-                         static_cast<int>(output.data_key));
-            return;
-        }
+        case OutputType::AO: {
+            // RTDataStore에서 값 읽기 (DOUBLE로 저장됨)
+            double value = 0.0;
+            if (data_store->getDouble(output.data_key, value) != 0) {
+                MXRC_LOG_DEBUG("Analog Output 데이터 읽기 실패: data_key={}",
+                               static_cast<int>(output.data_key));
+                return;
+            }
 
-        // AnalogOutputData 구성
-        AnalogOutputData data;
-        data.slave_id = output.slave_id;
-        data.channel = output.channel;
-        data.value = value;
-        data.min_value = output.min_value;
-        data.max_value = output.max_value;
-        data.valid = true;
-
-        // EtherCAT으로 쓰기
-        if (sensor_manager_->writeAnalogOutput(output.slave_id, output.channel, data) == 0) {
-            write_success_count_.fetch_add(1, std::memory_order_relaxed);
-        } else {
-            spdlog::debug("Analog Output 쓰기 실패: slave_id={}, channel={}",
-                         output.slave_id, output.channel);
+            // AnalogOutputData 구성
+            AnalogOutputData data;
+            data.slave_id = output.slave_id;
+            data.channel = output.channel;
+            data.value = value;
+            data.min_value = output.min_value;
+            data.max_value = output.max_value;
+            data.valid = true;
+
+            // EtherCAT으로 쓰기
+            if (sensor_manager_->writeAnalogOutput(output.slave_id, output.channel, data) == 0) {
+                write_success_count_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                MXRC_LOG_DEBUG("Analog Output 쓰기 실패: slave_id={}, channel={}",
+                               output.slave_id, output.channel);
+            }
+            break;
         }
-
-    } else {
-        spdlog::warn("알 수 없는 출력 타입: {}", output.output_type);
     }
 }
 
@@ -268,7 +510,7 @@ int RTEtherCATCycle::registerBLDCMotor(uint16_t slave_id,
                                         core::rt::DataKey enable_key) {
     MotorInfo info;
     info.slave_id = slave_id;
-    info.motor_type = "BLDC";
+    info.type = MotorType::BLDC;
     info.position_key = velocity_key;  // BLDC는 position 모드 없음 (더미 값)
     info.velocity_key = velocity_key;
     info.torque_key = torque_key;
@@ -278,6 +520,7 @@ int RTEtherCATCycle::registerBLDCMotor(uint16_t slave_id,
     info.max_torque = 100.0;      // BLDC 기본 최대 토크
 
     motors_.push_back(info);
+    plan_dirty_ = true;
 
     spdlog::info("BLDC 모터 등록: slave_id={}, vel_key={}, torque_key={}, mode_key={}, enable_key={}",
                  slave_id, static_cast<int>(velocity_key), static_cast<int>(torque_key),
@@ -296,7 +539,7 @@ int RTEtherCATCycle::registerServoMotor(uint16_t slave_id,
                                          double max_torque) {
     MotorInfo info;
     info.slave_id = slave_id;
-    info.motor_type = "SERVO";
+    info.type = MotorType::SERVO;
     info.position_key = position_key;
     info.velocity_key = velocity_key;
     info.torque_key = torque_key;
@@ -306,6 +549,7 @@ int RTEtherCATCycle::registerServoMotor(uint16_t slave_id,
     info.max_torque = max_torque;
 
     motors_.push_back(info);
+    plan_dirty_ = true;
 
     spdlog::info("Servo 모터 등록: slave_id={}, pos_key={}, vel_key={}, torque_key={}, mode_key={}, enable_key={}, max_vel={}, max_torque={}",
                  slave_id, static_cast<int>(position_key), static_cast<int>(velocity_key),
@@ -325,83 +569,88 @@ void RTEtherCATCycle::readAndWriteMotorCommand(const MotorInfo& motor,
     // Control mode 읽기 (INT32: 0=DISABLED, 1=POSITION, 2=VELOCITY, 3=TORQUE)
     int32_t mode_int = 0;
     if (data_store->getInt32(motor.control_mode_key, mode_int) != 0) {
-        spdlog::debug("Control mode 읽기 실패: motor slave_id={}", motor.slave_id);
+        MXRC_LOG_DEBUG("Control mode 읽기 실패: motor slave_id={}", motor.slave_id);
         return;
     }
 
     // Enable 플래그 읽기 (INT32: 0=false, 1=true)
     int32_t enable_int = 0;
     if (data_store->getInt32(motor.enable_key, enable_int) != 0) {
-        spdlog::debug("Enable 플래그 읽기 실패: motor slave_id={}", motor.slave_id);
+        MXRC_LOG_DEBUG("Enable 플래그 읽기 실패: motor slave_id={}", motor.slave_id);
         return;
     }
 
     ControlMode control_mode = static_cast<ControlMode>(mode_int);
     bool enable = (enable_int != 0);
 
-    if (motor.motor_type == "BLDC") {
-        // BLDC 명령 구성
-        BLDCMotorCommand cmd;
-        cmd.slave_id = motor.slave_id;
-        cmd.control_mode = control_mode;
-        cmd.enable = enable;
-        cmd.timestamp = 0;  // TODO: 타임스탬프 추가
-
-        if (enable && control_mode == ControlMode::VELOCITY) {
-            if (data_store->getDouble(motor.velocity_key, cmd.target_velocity) != 0) {
-                spdlog::debug("BLDC velocity 읽기 실패: slave_id={}", motor.slave_id);
-                return;
+    switch (motor.type) {
+        case MotorType::BLDC: {
+            // BLDC 명령 구성
+            BLDCMotorCommand cmd;
+            cmd.slave_id = motor.slave_id;
+            cmd.control_mode = control_mode;
+            cmd.enable = enable;
+            cmd.timestamp = 0;  // TODO: 타임스탬프 추가
+
+            if (enable && control_mode == ControlMode::VELOCITY) {
+                if (data_store->getDouble(motor.velocity_key, cmd.target_velocity) != 0) {
+                    MXRC_LOG_DEBUG("BLDC velocity 읽기 실패: slave_id={}", motor.slave_id);
+                    return;
+                }
+            } else if (enable && control_mode == ControlMode::TORQUE) {
+                if (data_store->getDouble(motor.torque_key, cmd.target_torque) != 0) {
+                    MXRC_LOG_DEBUG("BLDC torque 읽기 실패: slave_id={}", motor.slave_id);
+                    return;
+                }
             }
-        } else if (enable && control_mode == ControlMode::TORQUE) {
-            if (data_store->getDouble(motor.torque_key, cmd.target_torque) != 0) {
-                spdlog::debug("BLDC torque 읽기 실패: slave_id={}", motor.slave_id);
-                return;
-            }
-        }
 
-        // 명령 전송
-        if (motor_manager_->writeBLDCCommand(cmd) == 0) {
-            motor_command_count_.fetch_add(1, std::memory_order_relaxed);
-        } else {
-            spdlog::debug("BLDC 명령 전송 실패: slave_id={}", motor.slave_id);
+            // 명령 전송
+            if (motor_manager_->writeBLDCCommand(cmd) == 0) {
+                motor_command_count_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                MXRC_LOG_DEBUG("BLDC 명령 전송 실패: slave_id={}", motor.slave_id);
+            }
+            break;
         }
 
-    } else if (motor.motor_type == "SERVO") {
-        // Servo 명령 구성
-        ServoDriverCommand cmd;
-        cmd.slave_id = motor.slave_id;
-        cmd.control_mode = control_mode;
-        cmd.enable = enable;
-        cmd.max_velocity = motor.max_velocity;
-        cmd.max_torque = motor.max_torque;
-        cmd.timestamp = 0;  // TODO: 타임스탬프 추가
-
-        if (enable && control_mode == ControlMode::POSITION) {
-            if (data_store->getDouble(motor.position_key, cmd.target_position) != 0) {
-                spdlog::debug("Servo position 읽기 실패: slave_id={}", motor.slave_id);
-                return;
-            }
-            // Position 모드에서는 velocity도 필요 (프로파일 속도)
-            if (data_store->getDouble(motor.velocity_key, cmd.target_velocity) != 0) {
-                cmd.target_velocity = 0.0;  // 기본값
-            }
-        } else if (enable && control_mode == ControlMode::VELOCITY) {
-            if (data_store->getDouble(motor.velocity_key, cmd.target_velocity) != 0) {
-                spdlog::debug("Servo velocity 읽기 실패: slave_id={}", motor.slave_id);
-                return;
+        case MotorType::SERVO: {
+            // Servo 명령 구성
+            ServoDriverCommand cmd;
+            cmd.slave_id = motor.slave_id;
+            cmd.control_mode = control_mode;
+            cmd.enable = enable;
+            cmd.max_velocity = motor.max_velocity;
+            cmd.max_torque = motor.max_torque;
+            cmd.timestamp = 0;  // TODO: 타임스탬프 추가
+
+            if (enable && control_mode == ControlMode::POSITION) {
+                if (data_store->getDouble(motor.position_key, cmd.target_position) != 0) {
+                    MXRC_LOG_DEBUG("Servo position 읽기 실패: slave_id={}", motor.slave_id);
+                    return;
+                }
+                // Position 모드에서는 velocity도 필요 (프로파일 속도)
+                if (data_store->getDouble(motor.velocity_key, cmd.target_velocity) != 0) {
+                    cmd.target_velocity = 0.0;  // 기본값
+                }
+            } else if (enable && control_mode == ControlMode::VELOCITY) {
+                if (data_store->getDouble(motor.velocity_key, cmd.target_velocity) != 0) {
+                    MXRC_LOG_DEBUG("Servo velocity 읽기 실패: slave_id={}", motor.slave_id);
+                    return;
+                }
+            } else if (enable && control_mode == ControlMode::TORQUE) {
+                if (data_store->getDouble(motor.torque_key, cmd.target_torque) != 0) {
+                    MXRC_LOG_DEBUG("Servo torque 읽기 실패: slave_id={}", motor.slave_id);
+                    return;
+                }
             }
-        } else if (enable && control_mode == ControlMode::TORQUE) {
-            if (data_store->getDouble(motor.torque_key, cmd.target_torque) != 0) {
-                spdlog::debug("Servo torque 읽기 실패: slave_id={}", motor.slave_id);
-                return;
-            }
-        }
 
-        // 명령 전송
-        if (motor_manager_->writeServoCommand(cmd) == 0) {
-            motor_command_count_.fetch_add(1, std::memory_order_relaxed);
-        } else {
-            spdlog::debug("Servo 명령 전송 실패: slave_id={}", motor.slave_id);
+            // 명령 전송
+            if (motor_manager_->writeServoCommand(cmd) == 0) {
+                motor_command_count_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                MXRC_LOG_DEBUG("Servo 명령 전송 실패: slave_id={}", motor.slave_id);
+            }
+            break;
         }
     }
 }
@@ -422,21 +671,38 @@ int32_t RTEtherCATCycle::getDCSystemTimeOffset() const {
 
 void RTEtherCATCycle::handleEtherCATError(EtherCATErrorType error_type,
                                            const std::string& message) {
-    spdlog::error("{}", message);
+    MXRC_LOG_ERROR("{}", message);
     error_count_.fetch_add(1, std::memory_order_relaxed);
 
     // EventBus로 에러 이벤트 발행
+    // 연속 에러(매 cycle 실패) 동안은 모아서 publishBatch()로 발행하여 RT 스레드의
+    // EventBus lock 획득을 줄임. 에러 구간의 첫 이벤트는 지연 없이 바로 발행
     if (event_bus_) {
-        auto error_event = std::make_shared<EtherCATErrorEvent>(error_type, message);
-        event_bus_->publish(error_event);
+        pending_error_events_.push_back(
+            core::event::EventPool<EtherCATErrorEvent>::make(error_type, message));
+        if (!error_burst_ || pending_error_events_.size() >= ERROR_EVENT_BATCH) {
+            flushErrorEvents();
+        }
     }
+    error_burst_ = true;
 
     // State Machine을 SAFE_MODE로 전환 (ERROR_THRESHOLD 초과 시)
     if (state_machine_ && error_count_.load(std::memory_order_relaxed) > ERROR_THRESHOLD) {
         state_machine_->handleEvent(mxrc::core::rt::RTEvent::SAFE_MODE_ENTER);
-        spdlog::warn("EtherCAT 연속 에러({})로 SAFE_MODE 진입", error_count_.load());
+        MXRC_LOG_WARN("EtherCAT 연속 에러({})로 SAFE_MODE 진입", error_count_.load());
     }
 }
 
+void RTEtherCATCycle::flushErrorEvents() {
+    if (!event_bus_ || pending_error_events_.empty()) {
+        return;
+    }
+
+    std::vector<std::shared_ptr<mxrc::core::event::IEvent>> batch;
+    batch.reserve(ERROR_EVENT_BATCH);
+    batch.swap(pending_error_events_);
+    event_bus_->publishBatch(std::move(batch));
+}
+
 } // namespace ethercat
 } // namespace mxrc
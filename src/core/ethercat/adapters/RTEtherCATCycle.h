@@ -18,8 +18,35 @@ namespace ethercat {
 
 // RT Executive의 주기적 실행에 통합되는 EtherCAT Cycle 어댑터
 // 매 RT cycle마다 EtherCAT 통신 수행 (send → receive → 센서 읽기 + 모터 명령 쓰기)
+//
+// 분할 실행: 프레임이 wire에 있는 동안 다른 RT action을 실행하려면 execute() 대신
+// 같은 slot에 executeSend()와 executeReceive()를 나눠 등록 (slot 내 등록 순서대로 실행)
+//   exec.registerAction("ethercat_send", 1, [&](RTContext& c) { cycle.executeSend(c); });
+//   exec.registerAction("control", 1, control);   // 이전 cycle 센서 값 사용
+//   exec.registerAction("ethercat_receive", 1, [&](RTContext& c) { cycle.executeReceive(c); });
 class RTEtherCATCycle {
 public:
+    // 센서 타입 (등록 시 결정, cycle에서는 switch 분기)
+    enum class SensorType : uint8_t {
+        POSITION,
+        VELOCITY,
+        TORQUE,
+        DI,
+        AI
+    };
+
+    // 출력 타입
+    enum class OutputType : uint8_t {
+        DO,
+        AO
+    };
+
+    // 모터 타입
+    enum class MotorType : uint8_t {
+        BLDC,
+        SERVO
+    };
+
     // 생성자: EtherCAT Master, 센서 데이터 매니저, 모터 명령 매니저 주입
     RTEtherCATCycle(
         std::shared_ptr<IEtherCATMaster> master,
@@ -28,12 +55,48 @@ public:
         std::shared_ptr<mxrc::core::event::IEventBus> event_bus = nullptr,
         std::shared_ptr<mxrc::core::rt::RTStateMachine> state_machine = nullptr);
 
-    ~RTEtherCATCycle() = default;
+    // 미발행 에러 이벤트는 소멸 시 발행
+    ~RTEtherCATCycle();
 
     // RT Cycle에서 호출되는 메인 함수
     // RTContext를 통해 RTDataStore 접근
+    // executeSend() 직후 executeReceive()와 동일
     void execute(core::rt::RTContext& ctx);
 
+    // 분할 실행 1단계: 출력/모터 명령 준비 후 프레임 송신
+    // 반환: 0 송신, -1 실패 (에러 보고됨, 이번 cycle의 executeReceive()는 수행하지 않음)
+    int executeSend(core::rt::RTContext& ctx);
+
+    // 분할 실행 2단계: 프레임 수신 후 센서 값 저장
+    // 송신 후 최소 수신 지연(setReceiveDelay) 전이면 남은 시간만큼 busy-wait
+    // 반환: 0 수신, -1 송신 없음 또는 수신 실패
+    int executeReceive(core::rt::RTContext& ctx);
+
+    // 송신 → 수신 최소 간격 (예상 wire round-trip, 0이면 대기 없음)
+    // master cycle 통계의 수신 지연에 포함되므로 late threshold는 이보다 크게 설정
+    void setReceiveDelay(uint64_t delay_ns) { receive_delay_ns_ = delay_ns; }
+    uint64_t getReceiveDelay() const { return receive_delay_ns_; }
+
+    // 마지막 cycle의 송신 → 수신 시작 간격 (ns)
+    uint64_t getLastWireTimeNs() const { return last_wire_time_ns_.load(std::memory_order_relaxed); }
+
+    // PDO 접근 계획 컴파일 (cycle 활성화)
+    // 등록된 센서/출력/모터 slave의 PDO offset/타입을 한 번 해석하여
+    // 이후 cycle에서 slave 설정 검색을 제거
+    // 등록 후 첫 execute()에서 자동 호출되며, RT 시작 전에 직접 호출 권장
+    // 반환: 0 성공, -1 실패
+    int activate();
+
+    // 현재 등록 상태로 접근 계획이 컴파일되었는지 여부
+    bool isActivated() const { return !plan_dirty_; }
+
+    // PDO domain을 RTDataStore process image에 연결하고 등록된 센서/입력 채널을 뷰로 바인딩
+    // - master가 외부 메모리를 지원하면 domain이 store의 image에 직접 송수신 (복사 없음,
+    //   master activate() 전에 호출해야 함)
+    // - 아니면 receive() 후 domain 전체를 한 번 복사 (채널별 변환/저장 없음)
+    // 반환: 0 zero-copy, 1 복사 모드, -1 실패
+    int attachProcessImage(core::rt::RTDataStore& store);
+
     // 센서 읽기를 수행할 slave 등록
     // slave_id: EtherCAT slave 주소
     // position_key: Position 저장 키 (DOUBLE)
@@ -45,8 +108,17 @@ public:
                                double scale_factor = 1.0);
 
     // 범용 센서 등록 (이전 호환성)
+    // sensor_type: "POSITION", "VELOCITY", "TORQUE", "DI", "AI" (그 외 -1 반환)
     int registerSensor(uint16_t slave_id, core::rt::DataKey data_key, const std::string& sensor_type);
 
+    // 범용 센서 등록 (타입 지정)
+    int registerSensor(uint16_t slave_id, core::rt::DataKey data_key, SensorType sensor_type);
+
+    // 센서 타입 이름 변환
+    // 반환: 0 성공, -1 알 수 없는 이름
+    static int parseSensorType(const std::string& name, SensorType& out_type);
+    static const char* sensorTypeName(SensorType type);
+
     // Digital Output 등록
     // slave_id: EtherCAT slave 주소
     // channel: 출력 채널 번호
@@ -94,6 +166,9 @@ public:
     // 통계 조회
     uint64_t getTotalCycles() const { return total_cycles_.load(std::memory_order_relaxed); }
     uint64_t getErrorCount() const { return error_count_.load(std::memory_order_relaxed); }
+
+    // 모아 둔 에러 이벤트를 EventBus에 한 배치로 발행 (정상 cycle 종료 시 자동 호출)
+    void flushErrorEvents();
     uint64_t getReadSuccessCount() const { return read_success_count_.load(std::memory_order_relaxed); }
     uint64_t getWriteSuccessCount() const { return write_success_count_.load(std::memory_order_relaxed); }
     uint64_t getMotorCommandCount() const { return motor_command_count_.load(std::memory_order_relaxed); }
@@ -108,9 +183,10 @@ private:
         uint16_t slave_id;
         core::rt::DataKey data_key;
         core::rt::DataKey data_key2;  // 2축용 (position의 velocity)
-        std::string sensor_type;      // "POSITION", "VELOCITY", "TORQUE", "DI", "AI"
+        SensorType type;              // 센서 타입
         uint8_t channel;              // DI/AI의 경우 채널 번호
         double scale_factor;          // 스케일 팩터 (엔코더 → 실제 단위)
+        bool image_view;              // process image 뷰로 제공 (cycle마다 읽지 않음)
     };
 
     // 의존성
@@ -125,7 +201,7 @@ private:
         uint16_t slave_id;
         uint8_t channel;
         core::rt::DataKey data_key;
-        std::string output_type;  // "DO", "AO"
+        OutputType type;          // 출력 타입
         double min_value;         // AO용 범위 제한
         double max_value;
     };
@@ -133,7 +209,7 @@ private:
     // 모터 정보 구조체
     struct MotorInfo {
         uint16_t slave_id;
-        std::string motor_type;      // "BLDC", "SERVO"
+        MotorType type;              // 모터 타입
         core::rt::DataKey position_key;      // Servo POSITION 모드용
         core::rt::DataKey velocity_key;      // VELOCITY 모드용
         core::rt::DataKey torque_key;        // TORQUE 모드용
@@ -159,12 +235,34 @@ private:
     std::atomic<uint64_t> write_success_count_;
     std::atomic<uint64_t> motor_command_count_;
 
+    // 등록 변경 후 접근 계획 재컴파일 필요 여부
+    bool plan_dirty_;
+
+    // Process image 연결 상태
+    core::rt::RTDataStore* image_store_;
+    bool image_external_;  // domain이 store image를 직접 사용
+
+    // 분할 실행 상태
+    bool send_pending_;                         // 이번 cycle 송신 완료, 수신 대기
+    uint64_t send_time_ns_;                     // 마지막 송신 시각 (monotonic)
+    uint64_t receive_delay_ns_;                 // 송신 → 수신 최소 간격
+    std::atomic<uint64_t> last_wire_time_ns_;   // 마지막 송신 → 수신 시작 간격
+
+    // 에러 이벤트 배치: 연속 에러의 첫 이벤트는 즉시, 이후는 ERROR_EVENT_BATCH개씩 발행
+    std::vector<std::shared_ptr<mxrc::core::event::IEvent>> pending_error_events_;
+    bool error_burst_;                          // 직전 정상 cycle 이후 에러 발생
+
     // 에러 임계값 상수
     static constexpr uint64_t ERROR_THRESHOLD = 10;
+    static constexpr size_t ERROR_EVENT_BATCH = 16;
 
     // 헬퍼: 센서 데이터 읽고 RTDataStore에 저장
     void readAndStoreSensor(const SensorInfo& sensor, core::rt::RTDataStore* data_store);
 
+    // 등록된 센서 PDO를 process image 뷰로 바인딩 (DI 비트맵은 제외, 기존 경로로 읽음)
+    // 반환: 뷰로 제공되는 센서 수
+    int bindSensorViews();
+
     // 헬퍼: RTDataStore에서 읽고 출력 쓰기
     void readAndWriteOutput(const OutputInfo& output, core::rt::RTDataStore* data_store);
 
@@ -0,0 +1,228 @@
+#include "EtherCATCycleStats.h"
+#include <spdlog/spdlog.h>
+#include <new>
+
+namespace mxrc {
+namespace ethercat {
+
+EtherCATCycleStats::EtherCATCycleStats()
+    : seq(0)
+    , late_threshold_ns(DEFAULT_LATE_THRESHOLD_NS) {
+    reset();
+}
+
+void EtherCATCycleStats::reset() {
+    beginUpdate();
+    cycles.store(0, std::memory_order_relaxed);
+    wkc_mismatches.store(0, std::memory_order_relaxed);
+    lost_frames.store(0, std::memory_order_relaxed);
+    late_receives.store(0, std::memory_order_relaxed);
+    send_errors.store(0, std::memory_order_relaxed);
+    receive_errors.store(0, std::memory_order_relaxed);
+    last_wkc.store(0, std::memory_order_relaxed);
+    expected_wkc.store(0, std::memory_order_relaxed);
+    last_receive_latency_ns.store(0, std::memory_order_relaxed);
+    max_receive_latency_ns.store(0, std::memory_order_relaxed);
+    for (size_t i = 0; i < SLAVE_BITMAP_WORDS; ++i) {
+        slave_error_current[i].store(0, std::memory_order_relaxed);
+        slave_error_sticky[i].store(0, std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < MAX_SLAVES; ++i) {
+        slave_error_counts[i].store(0, std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < LATENCY_BUCKETS; ++i) {
+        latency_histogram[i].store(0, std::memory_order_relaxed);
+    }
+    endUpdate();
+}
+
+void EtherCATCycleStats::setLateThreshold(uint64_t threshold_ns) {
+    late_threshold_ns.store(threshold_ns, std::memory_order_relaxed);
+}
+
+void EtherCATCycleStats::recordSendError() {
+    beginUpdate();
+    send_errors.store(send_errors.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    endUpdate();
+}
+
+void EtherCATCycleStats::recordFrameLoss(uint64_t latency_ns) {
+    beginUpdate();
+    cycles.store(cycles.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    lost_frames.store(lost_frames.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    last_wkc.store(0, std::memory_order_relaxed);
+    recordLatency(latency_ns);
+    endUpdate();
+}
+
+void EtherCATCycleStats::recordReceiveError(uint64_t latency_ns) {
+    beginUpdate();
+    cycles.store(cycles.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    receive_errors.store(receive_errors.load(std::memory_order_relaxed) + 1,
+                         std::memory_order_relaxed);
+    last_wkc.store(0, std::memory_order_relaxed);
+    recordLatency(latency_ns);
+    endUpdate();
+}
+
+void EtherCATCycleStats::recordReceive(uint32_t wkc, uint32_t expected, uint64_t latency_ns,
+                                       const uint64_t* slave_errors) {
+    beginUpdate();
+    cycles.store(cycles.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    last_wkc.store(wkc, std::memory_order_relaxed);
+    expected_wkc.store(expected, std::memory_order_relaxed);
+    if (wkc != expected) {
+        wkc_mismatches.store(wkc_mismatches.load(std::memory_order_relaxed) + 1,
+                             std::memory_order_relaxed);
+    }
+    recordLatency(latency_ns);
+
+    for (size_t word = 0; word < SLAVE_BITMAP_WORDS; ++word) {
+        uint64_t bits = slave_errors ? slave_errors[word] : 0;
+        slave_error_current[word].store(bits, std::memory_order_relaxed);
+        if (bits == 0) {
+            continue;
+        }
+        slave_error_sticky[word].store(
+            slave_error_sticky[word].load(std::memory_order_relaxed) | bits,
+            std::memory_order_relaxed);
+        while (bits) {
+            size_t slave = word * 64 + static_cast<size_t>(__builtin_ctzll(bits));
+            slave_error_counts[slave].store(
+                slave_error_counts[slave].load(std::memory_order_relaxed) + 1,
+                std::memory_order_relaxed);
+            bits &= bits - 1;
+        }
+    }
+    endUpdate();
+}
+
+bool EtherCATCycleStats::readSnapshot(EtherCATCycleStatsSnapshot& out, int max_retries) const {
+    for (int attempt = 0; attempt < max_retries; ++attempt) {
+        uint64_t before = seq.load(std::memory_order_acquire);
+        if (before & 1ULL) {
+            continue;  // writer 갱신 중
+        }
+
+        out.cycles = cycles.load(std::memory_order_relaxed);
+        out.wkc_mismatches = wkc_mismatches.load(std::memory_order_relaxed);
+        out.lost_frames = lost_frames.load(std::memory_order_relaxed);
+        out.late_receives = late_receives.load(std::memory_order_relaxed);
+        out.send_errors = send_errors.load(std::memory_order_relaxed);
+        out.receive_errors = receive_errors.load(std::memory_order_relaxed);
+        out.last_wkc = last_wkc.load(std::memory_order_relaxed);
+        out.expected_wkc = expected_wkc.load(std::memory_order_relaxed);
+        out.last_receive_latency_ns = last_receive_latency_ns.load(std::memory_order_relaxed);
+        out.max_receive_latency_ns = max_receive_latency_ns.load(std::memory_order_relaxed);
+        out.late_threshold_ns = late_threshold_ns.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < SLAVE_BITMAP_WORDS; ++i) {
+            out.slave_error_current[i] = slave_error_current[i].load(std::memory_order_relaxed);
+            out.slave_error_sticky[i] = slave_error_sticky[i].load(std::memory_order_relaxed);
+        }
+        for (size_t i = 0; i < MAX_SLAVES; ++i) {
+            out.slave_error_counts[i] = slave_error_counts[i].load(std::memory_order_relaxed);
+        }
+        for (size_t i = 0; i < LATENCY_BUCKETS; ++i) {
+            out.latency_histogram[i] = latency_histogram[i].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (seq.load(std::memory_order_relaxed) == before) {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t EtherCATCycleStats::latencyBucket(uint64_t latency_ns) {
+    uint64_t us = latency_ns / 1000;
+    if (us == 0) {
+        return 0;
+    }
+    size_t bucket = 64 - static_cast<size_t>(__builtin_clzll(us));  // us의 비트 폭
+    return bucket < LATENCY_BUCKETS ? bucket : LATENCY_BUCKETS - 1;
+}
+
+void EtherCATCycleStats::beginUpdate() {
+    // 단일 writer: 홀수로 전환 후 데이터 store가 그 뒤에 보이도록 release fence
+    seq.store(seq.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+void EtherCATCycleStats::endUpdate() {
+    seq.store(seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void EtherCATCycleStats::recordLatency(uint64_t latency_ns) {
+    last_receive_latency_ns.store(latency_ns, std::memory_order_relaxed);
+    if (latency_ns > max_receive_latency_ns.load(std::memory_order_relaxed)) {
+        max_receive_latency_ns.store(latency_ns, std::memory_order_relaxed);
+    }
+    if (latency_ns > late_threshold_ns.load(std::memory_order_relaxed)) {
+        late_receives.store(late_receives.load(std::memory_order_relaxed) + 1,
+                            std::memory_order_relaxed);
+    }
+    size_t bucket = latencyBucket(latency_ns);
+    latency_histogram[bucket].store(latency_histogram[bucket].load(std::memory_order_relaxed) + 1,
+                                    std::memory_order_relaxed);
+}
+
+EtherCATCycleStatsShared::EtherCATCycleStatsShared()
+    : shm_(std::make_unique<core::rt::ipc::SharedMemoryRegion>())
+    , stats_(nullptr)
+    , owner_(false) {}
+
+EtherCATCycleStatsShared::~EtherCATCycleStatsShared() {
+    // 생성 측만 placement new 객체 소멸자 호출
+    if (stats_ != nullptr && owner_) {
+        stats_->~EtherCATCycleStats();
+    }
+    stats_ = nullptr;
+}
+
+int EtherCATCycleStatsShared::createShared(const std::string& name) {
+    if (stats_ != nullptr) {
+        spdlog::warn("EtherCATCycleStatsShared already created");
+        return -1;
+    }
+
+    if (shm_->create(name, sizeof(EtherCATCycleStats)) != 0) {
+        return -1;
+    }
+
+    stats_ = new (shm_->getPtr()) EtherCATCycleStats();
+    owner_ = true;
+
+    spdlog::info("EtherCATCycleStatsShared created in shared memory: {}", name);
+    return 0;
+}
+
+int EtherCATCycleStatsShared::openShared(const std::string& name) {
+    if (stats_ != nullptr) {
+        spdlog::warn("EtherCATCycleStatsShared already opened");
+        return -1;
+    }
+
+    if (shm_->open(name) != 0) {
+        return -1;
+    }
+
+    if (shm_->getSize() < sizeof(EtherCATCycleStats)) {
+        spdlog::error("Shared memory size mismatch: expected={}, actual={}",
+                      sizeof(EtherCATCycleStats), shm_->getSize());
+        return -1;
+    }
+
+    stats_ = reinterpret_cast<EtherCATCycleStats*>(shm_->getPtr());
+    owner_ = false;
+
+    spdlog::info("EtherCATCycleStatsShared opened from shared memory: {}", name);
+    return 0;
+}
+
+int EtherCATCycleStatsShared::unlinkShared(const std::string& name) {
+    return core::rt::ipc::SharedMemoryRegion::unlink(name);
+}
+
+} // namespace ethercat
+} // namespace mxrc
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "../../rt/ipc/SharedMemory.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace mxrc {
+namespace ethercat {
+
+// EtherCATCycleStats 읽기 결과 (일관된 시점의 복사본)
+struct EtherCATCycleStatsSnapshot {
+    static constexpr size_t MAX_SLAVES = 256;
+    static constexpr size_t SLAVE_BITMAP_WORDS = MAX_SLAVES / 64;
+    static constexpr size_t LATENCY_BUCKETS = 16;
+
+    uint64_t cycles;                // receive 처리 cycle 수 (프레임 손실, receive 에러 포함)
+    uint64_t wkc_mismatches;        // WKC != 기대값
+    uint64_t lost_frames;           // 프레임 손실 (domain WKC 0: 응답 datagram 없음)
+    uint64_t late_receives;         // 수신 지연 > late_threshold_ns
+    uint64_t send_errors;           // send 실패
+    uint64_t receive_errors;        // receive 호출 실패 (master 수준 에러)
+    uint32_t last_wkc;
+    uint32_t expected_wkc;
+    uint64_t last_receive_latency_ns;
+    uint64_t max_receive_latency_ns;
+    uint64_t late_threshold_ns;
+
+    uint64_t slave_error_current[SLAVE_BITMAP_WORDS];  // 마지막 cycle 에러 slave
+    uint64_t slave_error_sticky[SLAVE_BITMAP_WORDS];   // reset 이후 한 번이라도 에러난 slave
+    uint32_t slave_error_counts[MAX_SLAVES];           // slave별 에러 cycle 수
+    uint64_t latency_histogram[LATENCY_BUCKETS];       // 수신 지연 분포 (latencyBucket 참조)
+
+    bool isSlaveInError(uint16_t slave_id) const {
+        return slave_id < MAX_SLAVES &&
+               (slave_error_current[slave_id / 64] >> (slave_id % 64)) & 1ULL;
+    }
+    bool hasSlaveEverFailed(uint16_t slave_id) const {
+        return slave_id < MAX_SLAVES &&
+               (slave_error_sticky[slave_id / 64] >> (slave_id % 64)) & 1ULL;
+    }
+};
+
+// EtherCAT cycle 통계 블록
+// RT 스레드(master send/receive)가 단일 writer로 갱신하고 Non-RT가 readSnapshot()으로 읽음
+// - 모든 필드는 lock-free atomic, 갱신 구간은 seqlock으로 묶어 일관된 snapshot 제공
+// - 포인터 없음: 공유 메모리에 placement new로 배치 가능 (EtherCATCycleStatsShared)
+// 수신 지연 = master send() 완료 → receive()까지의 host 경과 시간 (wire 지연이 아님,
+// RTEtherCATCycle 분할 실행 시 send/receive 사이 action과 setReceiveDelay() 대기 포함)
+// 수신 지연 히스토그램: bucket 0 = 1us 미만, bucket k = [2^(k-1), 2^k) us,
+// 마지막 bucket = 2^(LATENCY_BUCKETS-2) us 이상
+struct alignas(64) EtherCATCycleStats {
+    static constexpr size_t MAX_SLAVES = EtherCATCycleStatsSnapshot::MAX_SLAVES;
+    static constexpr size_t SLAVE_BITMAP_WORDS = EtherCATCycleStatsSnapshot::SLAVE_BITMAP_WORDS;
+    static constexpr size_t LATENCY_BUCKETS = EtherCATCycleStatsSnapshot::LATENCY_BUCKETS;
+    static constexpr uint64_t DEFAULT_LATE_THRESHOLD_NS = 500000;  // 500us
+
+    EtherCATCycleStats();
+
+    // 전체 초기화 (late_threshold_ns 유지)
+    void reset();
+
+    // 지연 수신 판정 기준 (수신 지연 기준, 분할 실행 시 receive delay보다 크게)
+    void setLateThreshold(uint64_t threshold_ns);
+
+    // RT writer: send 실패
+    void recordSendError();
+
+    // RT writer: 프레임 손실 (domain WKC 0, cycle로 집계)
+    void recordFrameLoss(uint64_t latency_ns);
+
+    // RT writer: receive 호출 실패 (cycle로 집계)
+    void recordReceiveError(uint64_t latency_ns);
+
+    // RT writer: 수신 완료 cycle
+    // slave_errors: SLAVE_BITMAP_WORDS 크기 bitmap (에러 slave 비트 = 1), nullptr이면 에러 없음
+    void recordReceive(uint32_t wkc, uint32_t expected_wkc, uint64_t latency_ns,
+                       const uint64_t* slave_errors);
+
+    // Non-RT reader: 일관된 snapshot 복사
+    // 반환: 성공 true, writer 갱신이 계속 겹쳐 max_retries 내 실패 시 false
+    bool readSnapshot(EtherCATCycleStatsSnapshot& out, int max_retries = 100) const;
+
+    // 수신 지연 → 히스토그램 bucket
+    static size_t latencyBucket(uint64_t latency_ns);
+
+    // 데이터 (seqlock: 홀수 = 갱신 중)
+    std::atomic<uint64_t> seq;
+    std::atomic<uint64_t> cycles;
+    std::atomic<uint64_t> wkc_mismatches;
+    std::atomic<uint64_t> lost_frames;
+    std::atomic<uint64_t> late_receives;
+    std::atomic<uint64_t> send_errors;
+    std::atomic<uint64_t> receive_errors;
+    std::atomic<uint32_t> last_wkc;
+    std::atomic<uint32_t> expected_wkc;
+    std::atomic<uint64_t> last_receive_latency_ns;
+    std::atomic<uint64_t> max_receive_latency_ns;
+    std::atomic<uint64_t> late_threshold_ns;
+
+    std::atomic<uint64_t> slave_error_current[SLAVE_BITMAP_WORDS];
+    std::atomic<uint64_t> slave_error_sticky[SLAVE_BITMAP_WORDS];
+    std::atomic<uint32_t> slave_error_counts[MAX_SLAVES];
+    std::atomic<uint64_t> latency_histogram[LATENCY_BUCKETS];
+
+private:
+    void beginUpdate();
+    void endUpdate();
+    void recordLatency(uint64_t latency_ns);
+};
+
+// 공유 메모리 기반 EtherCATCycleStats
+// RT 프로세스가 생성하여 IEtherCATMaster::useExternalCycleStats()로 연결, Non-RT는 열어서 읽기
+class EtherCATCycleStatsShared {
+public:
+    EtherCATCycleStatsShared();
+    ~EtherCATCycleStatsShared();
+
+    // 서버 측 (RT 프로세스): 공유 메모리 생성 및 통계 블록 초기화
+    // 반환: 성공 0, 실패 -1
+    int createShared(const std::string& name);
+
+    // 클라이언트 측 (Non-RT 프로세스): 공유 메모리 열기
+    // 반환: 성공 0, 실패 -1
+    int openShared(const std::string& name);
+
+    EtherCATCycleStats* getStats() { return stats_; }
+    const EtherCATCycleStats* getStats() const { return stats_; }
+
+    bool isValid() const { return stats_ != nullptr; }
+
+    // 공유 메모리 삭제 (정리 시)
+    static int unlinkShared(const std::string& name);
+
+private:
+    std::unique_ptr<core::rt::ipc::SharedMemoryRegion> shm_;
+    EtherCATCycleStats* stats_;
+    bool owner_;  // placement new로 생성한 측
+};
+
+} // namespace ethercat
+} // namespace mxrc
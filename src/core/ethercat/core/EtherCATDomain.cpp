@@ -20,9 +20,39 @@ EtherCATDomain::~EtherCATDomain() {
 }
 
 uint8_t* EtherCATDomain::getData() {
+#ifdef ETHERCAT_ENABLE
+    // 활성화 전에 생성된 경우 data 포인터가 늦게 확정됨
+    if (!domain_data_ && domain_) {
+        domain_data_ = ecrt_domain_data(domain_);
+    }
+#endif
     return domain_data_;
 }
 
+size_t EtherCATDomain::getSize() const {
+#ifdef ETHERCAT_ENABLE
+    if (domain_) {
+        return ecrt_domain_size(domain_);
+    }
+#endif
+    return 0;
+}
+
+int EtherCATDomain::useExternalMemory(uint8_t* memory, size_t size) {
+#ifdef ETHERCAT_ENABLE
+    if (!domain_ || !memory || size < ecrt_domain_size(domain_)) {
+        return -1;
+    }
+    ecrt_domain_external_memory(domain_, memory);
+    domain_data_ = memory;
+    return 0;
+#else
+    (void)memory;
+    (void)size;
+    return -1;
+#endif
+}
+
 void EtherCATDomain::process() {
 #ifdef ETHERCAT_ENABLE
     if (domain_) {
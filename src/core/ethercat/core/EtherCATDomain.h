@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 
@@ -31,6 +32,14 @@ public:
     // PDO domain data 포인터 조회
     uint8_t* getData();
 
+    // PDO domain 크기 (바이트)
+    size_t getSize() const;
+
+    // 외부 메모리를 domain process image로 사용 (master 활성화 전)
+    // 예: RTDataStore::processImage()에 직접 송수신하여 복사 제거
+    // 반환: 성공 0, 실패 -1
+    int useExternalMemory(uint8_t* memory, size_t size);
+
     // Domain process (입력 데이터 처리)
     void process();
 
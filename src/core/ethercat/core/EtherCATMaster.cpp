@@ -1,6 +1,10 @@
 #include "EtherCATMaster.h"
+#include "../../rt/util/TimeUtils.h"
+#include "../../logging/Log.h"
 #include <spdlog/spdlog.h>
+#include <algorithm>
 #include <cstring>
+#include <iterator>
 
 namespace mxrc {
 namespace ethercat {
@@ -17,8 +21,18 @@ EtherCATMaster::EtherCATMaster(uint32_t master_index,
     , total_cycles_(0)
     , send_error_count_(0)
     , receive_error_count_(0)
+    , owned_stats_(std::make_unique<EtherCATCycleStats>())
+    , stats_(owned_stats_.get())
+    , send_time_ns_(0)
+    , expected_wkc_(0)
+    , slave_errors_{}
     , dc_enabled_(false)
-    , dc_system_time_offset_(0) {
+    , dc_system_time_offset_(0)
+    , dc_cycle_time_ns_(0)
+    , application_time_ns_(0)
+    , application_time_pending_(false)
+    , reference_clock_ns_(0)
+    , reference_clock_valid_(false) {
 }
 
 EtherCATMaster::~EtherCATMaster() {
@@ -135,6 +149,15 @@ int EtherCATMaster::configureSlaves() {
         const auto& pdo_mappings = config_->getPDOMappings(static_cast<uint16_t>(i));
         spdlog::info("Slave {}: {} PDO 매핑 등록", i, pdo_mappings.size());
 
+        // 기대 WKC: LRW datagram에서 입력 slave +1, 출력 slave +2
+        bool has_input = false;
+        bool has_output = false;
+        for (const auto& mapping : pdo_mappings) {
+            has_input |= mapping.direction == PDODirection::INPUT;
+            has_output |= mapping.direction == PDODirection::OUTPUT;
+        }
+        expected_wkc_ += (has_input ? 1 : 0) + (has_output ? 2 : 0);
+
         // PDO entry 등록은 domain_reg를 통해 수행
         // (실제로는 ecrt_slave_config_pdos를 사용하여 더 복잡한 설정 가능)
     }
@@ -214,6 +237,12 @@ int EtherCATMaster::activate() {
         return -1;
     }
 
+    // DC: 활성화 시 SYNC0 시작 시각 계산에 application time 필요
+    if (dc_enabled_) {
+        application_time_ns_ = core::rt::util::getMonotonicTimeNs();
+        ecrt_master_application_time(master_, application_time_ns_);
+    }
+
     // Master 활성화
     if (ecrt_master_activate(master_) < 0) {
         spdlog::error("Master 활성화 실패");
@@ -229,9 +258,10 @@ int EtherCATMaster::activate() {
         return -1;
     }
 
+    stats_->reset();
     active_ = true;
     state_ = MasterState::ACTIVATED;
-    spdlog::info("EtherCAT Master 활성화 완료 (OP 상태)");
+    spdlog::info("EtherCAT Master 활성화 완료 (OP 상태), expected WKC={}", expected_wkc_);
     return 0;
 #else
     spdlog::info("시뮬레이션 모드: Master 활성화 스킵");
@@ -262,20 +292,35 @@ int EtherCATMaster::deactivate() {
 int EtherCATMaster::send() {
 #ifdef ETHERCAT_ENABLE
     if (!active_) {
-        spdlog::error("Master가 활성화되지 않았습니다.");
+        MXRC_LOG_ERROR("Master가 활성화되지 않았습니다.");
         return -1;
     }
 
     // Domain 큐 (출력 데이터 준비)
     ecrt_domain_queue(domain_);
 
+    // DC: application time = 이번 cycle의 예정 시작 시각 (송신 시각이 아님)
+    // reference clock은 자유 진행 (sync_reference_clock 미호출 → host 송신 jitter가 DC에 전달되지 않음),
+    // slave clock만 reference clock에 동기화하고 host cycle은 DCPhaseTracker로 reference clock에 맞춤
+    if (dc_enabled_) {
+        if (!application_time_pending_) {
+            application_time_ns_ = nextApplicationTime(application_time_ns_, dc_cycle_time_ns_,
+                                                       core::rt::util::getMonotonicTimeNs());
+        }
+        application_time_pending_ = false;
+        ecrt_master_application_time(master_, application_time_ns_);
+        ecrt_master_sync_slave_clocks(master_);
+    }
+
     // Master 전송
     if (ecrt_master_send(master_) < 0) {
         send_error_count_++;
         error_count_++;
+        stats_->recordSendError();
         return -1;
     }
 
+    send_time_ns_ = core::rt::util::getMonotonicTimeNs();
     total_cycles_++;
     return 0;
 #else
@@ -287,19 +332,26 @@ int EtherCATMaster::send() {
 int EtherCATMaster::receive() {
 #ifdef ETHERCAT_ENABLE
     if (!active_) {
-        spdlog::error("Master가 활성화되지 않았습니다.");
+        MXRC_LOG_ERROR("Master가 활성화되지 않았습니다.");
         return -1;
     }
 
     // Master 수신
+    uint64_t latency_ns = core::rt::util::getMonotonicTimeNs() - send_time_ns_;
     if (ecrt_master_receive(master_) < 0) {
         receive_error_count_++;
         error_count_++;
+        stats_->recordReceiveError(latency_ns);
         return -1;
     }
 
     // Domain 처리 (입력 데이터 처리)
     ecrt_domain_process(domain_);
+    if (recordCycleStats(latency_ns) != 0) {
+        // 프레임 손실: 응답 datagram 없음, 입력 갱신 없음
+        error_count_++;
+        return -1;
+    }
 
     // DC 동기화가 활성화된 경우, offset 모니터링
     if (dc_enabled_) {
@@ -311,6 +363,16 @@ int EtherCATMaster::receive() {
             // 여기서는 예시로 0으로 설정
             dc_system_time_offset_ = 0;  // 실제로는 ecrt_master_sync_reference_clock 등 사용
         }
+
+        // Reference clock 시간 (하위 32비트, sync datagram이 reference slave를 지날 때 latch)
+        // → 64비트 확장 후 송신까지의 host 지연을 빼서 cycle 시작 시점 값으로 환산
+        uint32_t reference_time = 0;
+        if (ecrt_master_reference_clock_time(master_, &reference_time) == 0) {
+            reference_clock_ns_ = alignReferenceClock(
+                extendReferenceClock(reference_time, application_time_ns_),
+                application_time_ns_, send_time_ns_);
+            reference_clock_valid_ = true;
+        }
     }
 
     return 0;
@@ -327,6 +389,53 @@ uint32_t EtherCATMaster::getErrorCount() const {
     return error_count_;
 }
 
+int EtherCATMaster::useExternalCycleStats(EtherCATCycleStats* stats) {
+    if (!stats || active_) {
+        spdlog::error("외부 cycle 통계 블록은 Master 활성화 전에만 설정 가능");
+        return -1;
+    }
+    stats->setLateThreshold(stats_->late_threshold_ns.load(std::memory_order_relaxed));
+    stats_ = stats;
+    return 0;
+}
+
+int EtherCATMaster::recordCycleStats(uint64_t latency_ns) {
+#ifdef ETHERCAT_ENABLE
+    ec_domain_state_t domain_state;
+    ecrt_domain_state(domain_, &domain_state);
+    uint32_t wkc = domain_state.working_counter;
+
+    // 어떤 slave도 datagram을 처리하지 않음 = 프레임 손실 (WKC 불일치와 구분)
+    if (domain_state.wc_state == EC_WC_ZERO) {
+        stats_->recordFrameLoss(latency_ns);
+        return -1;
+    }
+
+    // WKC가 맞으면 slave별 조회 생략 (정상 cycle 비용 최소화)
+    bool slave_error = false;
+    if (wkc != expected_wkc_) {
+        size_t count = std::min(slave_configs_.size(), EtherCATCycleStats::MAX_SLAVES);
+        for (size_t i = 0; i < count; ++i) {
+            ec_slave_config_state_t slave_state;
+            ecrt_slave_config_state(slave_configs_[i], &slave_state);
+            if (!slave_state.online || !slave_state.operational) {
+                slave_errors_[i / 64] |= 1ULL << (i % 64);
+                slave_error = true;
+            }
+        }
+    }
+
+    stats_->recordReceive(wkc, expected_wkc_, latency_ns, slave_error ? slave_errors_ : nullptr);
+    if (slave_error) {
+        std::fill(std::begin(slave_errors_), std::end(slave_errors_), 0);
+    }
+    return 0;
+#else
+    (void)latency_ns;
+    return 0;
+#endif
+}
+
 uint8_t* EtherCATMaster::getDomainData() {
 #ifdef ETHERCAT_ENABLE
     if (!domain_) {
@@ -338,6 +447,81 @@ uint8_t* EtherCATMaster::getDomainData() {
 #endif
 }
 
+size_t EtherCATMaster::getProcessImageSize() const {
+#ifdef ETHERCAT_ENABLE
+    if (!domain_) {
+        return 0;
+    }
+    return ecrt_domain_size(domain_);
+#else
+    return 0;
+#endif
+}
+
+int EtherCATMaster::useExternalProcessImage(uint8_t* memory, size_t size) {
+#ifdef ETHERCAT_ENABLE
+    if (!domain_ || !memory || active_) {
+        spdlog::error("외부 process image는 Master 활성화 전에만 설정 가능");
+        return -1;
+    }
+
+    size_t domain_size = ecrt_domain_size(domain_);
+    if (size < domain_size) {
+        spdlog::error("외부 process image 크기 부족: {} < {}", size, domain_size);
+        return -1;
+    }
+
+    // 이후 domain 데이터는 memory에 직접 송수신됨 (ecrt_domain_data() == memory)
+    ecrt_domain_external_memory(domain_, memory);
+    spdlog::info("EtherCAT domain 외부 process image 사용: size={}", domain_size);
+    return 0;
+#else
+    (void)memory;
+    (void)size;
+    return -1;
+#endif
+}
+
+uint64_t EtherCATMaster::extendReferenceClock(uint32_t reference_low,
+                                              uint64_t application_time_ns) {
+    // 하위 32비트 차이를 부호 있는 값으로 해석 → application time에 가장 가까운 후보
+    int32_t delta = static_cast<int32_t>(reference_low - static_cast<uint32_t>(application_time_ns));
+    return application_time_ns + static_cast<int64_t>(delta);
+}
+
+uint64_t EtherCATMaster::nextApplicationTime(uint64_t previous_ns, uint64_t cycle_ns,
+                                             uint64_t now_ns) {
+    if (cycle_ns == 0 || previous_ns == 0) {
+        return now_ns;
+    }
+    uint64_t next_ns = previous_ns + cycle_ns;
+    if (now_ns > next_ns) {
+        next_ns += (now_ns - next_ns) / cycle_ns * cycle_ns;
+    }
+    return next_ns;
+}
+
+uint64_t EtherCATMaster::alignReferenceClock(uint64_t reference_ns, uint64_t application_time_ns,
+                                             uint64_t latch_time_ns) {
+    if (latch_time_ns <= application_time_ns) {
+        return reference_ns;
+    }
+    return reference_ns - (latch_time_ns - application_time_ns);
+}
+
+void EtherCATMaster::setApplicationTime(uint64_t cycle_start_ns) {
+    application_time_ns_ = cycle_start_ns;
+    application_time_pending_ = true;
+}
+
+int EtherCATMaster::getReferenceClockTime(uint64_t& out_time_ns) const {
+    if (!dc_enabled_ || !reference_clock_valid_) {
+        return -1;
+    }
+    out_time_ns = reference_clock_ns_;
+    return 0;
+}
+
 int EtherCATMaster::configureDC(const DCConfiguration& dc_config) {
 #ifdef ETHERCAT_ENABLE
     if (!dc_config.enable) {
@@ -365,12 +549,14 @@ int EtherCATMaster::configureDC(const DCConfiguration& dc_config) {
     );
 
     dc_enabled_ = true;
+    dc_cycle_time_ns_ = dc_config.sync0_cycle_time;
     spdlog::info("DC 동기화 설정 완료: ref_slave={}, sync0_cycle={}ns",
                  dc_config.reference_slave, dc_config.sync0_cycle_time);
     return 0;
 #else
     spdlog::info("시뮬레이션 모드: DC 설정 스킵");
     dc_enabled_ = dc_config.enable;
+    dc_cycle_time_ns_ = dc_config.sync0_cycle_time;
     return 0;
 #endif
 }
@@ -5,6 +5,7 @@
 #include "../dto/SlaveConfig.h"
 #include "../dto/PDOMapping.h"
 #include "../dto/DCConfiguration.h"
+#include "EtherCATCycleStats.h"
 #include <memory>
 #include <vector>
 #include <cstdint>
@@ -53,6 +54,18 @@ public:
     int receive() override;
     bool isActive() const override;
     uint32_t getErrorCount() const override;
+    uint8_t* getProcessImage() override { return getDomainData(); }
+    size_t getProcessImageSize() const override;
+    int useExternalProcessImage(uint8_t* memory, size_t size) override;
+    void setApplicationTime(uint64_t cycle_start_ns) override;
+    int getReferenceClockTime(uint64_t& out_time_ns) const override;
+    const EtherCATCycleStats* getCycleStats() const override { return stats_; }
+    int useExternalCycleStats(EtherCATCycleStats* stats) override;
+
+    // 지연 수신 판정 기준: send() 완료 → receive() 호출까지의 host 경과 시간 (wire 지연 아님)
+    // 분할 실행에서는 사이에 실행된 action과 RTEtherCATCycle::setReceiveDelay() 대기가 포함되므로
+    // 그 합보다 크게 설정
+    void setLateReceiveThreshold(uint64_t threshold_ns) { stats_->setLateThreshold(threshold_ns); }
 
     // User Story 3 추가 기능
 
@@ -89,6 +102,21 @@ public:
     int32_t getDCSystemTimeOffset() const { return dc_system_time_offset_; }
     bool isDCEnabled() const { return dc_enabled_; }
 
+    // 32비트 reference clock 시각을 같은 cycle의 64비트 application time 기준으로 확장
+    // reference clock의 system time은 activate() 시 application time 기준으로 맞춰지고
+    // host cycle이 DCPhaseTracker로 reference clock을 추종하므로 차이가 ±2^31ns 이내인
+    // 값을 선택 (2^32 wrap을 넘어도 상위 비트 유지)
+    static uint64_t extendReferenceClock(uint32_t reference_low, uint64_t application_time_ns);
+
+    // setApplicationTime() 없이 send()한 cycle의 application time: 이전 값에서 SYNC0 주기만큼 진행
+    // (놓친 cycle은 주기 단위로 건너뜀, 송신 시각 jitter 미반영)
+    static uint64_t nextApplicationTime(uint64_t previous_ns, uint64_t cycle_ns, uint64_t now_ns);
+
+    // 프레임 통과 시 latch된 reference clock을 cycle 시작(application time) 시점으로 환산
+    // latch_time_ns: 프레임 송신 host 시각 (application time 이전이면 보정 없음)
+    static uint64_t alignReferenceClock(uint64_t reference_ns, uint64_t application_time_ns,
+                                        uint64_t latch_time_ns);
+
 private:
     // 설정
     uint32_t master_index_;
@@ -111,9 +139,21 @@ private:
     uint64_t send_error_count_;
     uint64_t receive_error_count_;
 
+    // cycle 통계 (기본 내부 블록, useExternalCycleStats()로 공유 메모리 교체)
+    std::unique_ptr<EtherCATCycleStats> owned_stats_;
+    EtherCATCycleStats* stats_;
+    uint64_t send_time_ns_;
+    uint32_t expected_wkc_;  // configureSlaves()에서 PDO 방향으로 계산 (LRW: 입력 +1, 출력 +2)
+    uint64_t slave_errors_[EtherCATCycleStats::SLAVE_BITMAP_WORDS];
+
     // DC 통계
     bool dc_enabled_;
     int32_t dc_system_time_offset_;  // DC system time offset (nanoseconds)
+    uint64_t dc_cycle_time_ns_;      // SYNC0 주기 (configureDC)
+    uint64_t application_time_ns_;   // 마지막 send()에서 master에 전달한 application time
+    bool application_time_pending_;  // setApplicationTime()으로 다음 send()의 값이 지정됨
+    uint64_t reference_clock_ns_;    // reference clock 시간 (64비트 확장, cycle 시작 기준)
+    bool reference_clock_valid_;
 
     // 헬퍼: 상태 전환 (INIT → PREOP)
     int transitionToPreOp();
@@ -124,6 +164,10 @@ private:
     // 헬퍼: 상태 전환 (SAFEOP → OP)
     int transitionToOp();
 
+    // 헬퍼: WKC 불일치 시 응답하지 않는 slave 조사 후 통계 기록
+    // 반환: 0 정상 수신, -1 프레임 손실 (domain WKC 0)
+    int recordCycleStats(uint64_t latency_ns);
+
     // 헬퍼: PDO entry 등록
     int registerPDOEntry(uint16_t slave_id, const PDOMapping& mapping,
                          ec_pdo_entry_reg_t* reg);
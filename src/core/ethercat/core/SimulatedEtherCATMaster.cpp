@@ -0,0 +1,409 @@
+#include "SimulatedEtherCATMaster.h"
+#include "../util/PDOBulk.h"
+#include "../util/YAMLConfigParser.h"
+#include "../../rt/util/TimeUtils.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstring>
+
+namespace mxrc {
+namespace ethercat {
+
+using core::rt::util::getMonotonicTimeNs;
+
+SimulatedEtherCATMaster::SimulatedEtherCATMaster(const SimulationConfig& sim_config)
+    : sim_config_(sim_config)
+    , domain_(nullptr)
+    , domain_size_(0)
+    , external_image_(false)
+    , initialized_(false)
+    , active_(false)
+    , frame_in_flight_(false)
+    , start_time_ns_(0)
+    , virtual_time_ns_(0)
+    , reference_clock_ns_(0)
+    , reference_clock_valid_(false)
+    , expected_wkc_(0)
+    , working_counter_(0)
+    , error_count_(0)
+    , total_cycles_(0)
+    , wkc_error_count_(0)
+    , frame_loss_count_(0)
+    , owned_stats_(std::make_unique<EtherCATCycleStats>())
+    , stats_(owned_stats_.get())
+    , send_time_ns_(0)
+    , slave_errors_{}
+    , rng_state_(sim_config.seed ? sim_config.seed : 1) {
+}
+
+int SimulatedEtherCATMaster::loadFromFile(const std::string& file_path, size_t slave_count) {
+    if (active_) {
+        spdlog::error("시뮬레이션 Master 활성화 중에는 slave 네트워크 변경 불가");
+        return -1;
+    }
+
+    YAMLConfigParser parser;
+    if (parser.loadFromFile(file_path) != 0) {
+        return -1;
+    }
+
+    size_t template_count = parser.getSlaveCount();
+    if (template_count == 0) {
+        spdlog::error("시뮬레이션 slave 없음: {}", file_path);
+        return -1;
+    }
+
+    slaves_.clear();
+    owned_domain_.clear();
+    domain_ = nullptr;
+    domain_size_ = 0;
+    external_image_ = false;
+    expected_wkc_ = 0;
+
+    size_t total = slave_count > 0 ? slave_count : template_count;
+    for (size_t i = 0; i < total; ++i) {
+        size_t tmpl = i % template_count;
+        SlaveConfig config = *parser.getSlaveConfig(tmpl);
+        config.alias = static_cast<uint16_t>(i);
+        config.position = static_cast<uint16_t>(i);
+        if (i >= template_count) {
+            config.device_name += "_" + std::to_string(i);
+        }
+        if (addSlave(config, parser.getPDOMappings(tmpl)) < 0) {
+            return -1;
+        }
+    }
+
+    parser.getDCConfig(dc_config_);
+
+    spdlog::info("시뮬레이션 slave 네트워크 로드: {} (template={}, slaves={}, domain={} bytes)",
+                 file_path, template_count, slaves_.size(), domain_size_);
+
+    return 0;
+}
+
+int SimulatedEtherCATMaster::addSlave(const SlaveConfig& config,
+                                      const std::vector<PDOMapping>& mappings) {
+    if (active_ || external_image_) {
+        spdlog::error("시뮬레이션 slave 추가 불가 (활성화 또는 외부 process image 사용 중)");
+        return -1;
+    }
+    if (slaves_.size() > UINT16_MAX) {
+        return -1;
+    }
+
+    // slave 기준 offset으로 방향별 영역 크기 계산
+    uint32_t output_size = 0;
+    uint32_t input_size = 0;
+    for (const auto& mapping : mappings) {
+        uint32_t end = mapping.offset + static_cast<uint32_t>(PDOBulk::typeSize(mapping.data_type));
+        if (mapping.direction == PDODirection::OUTPUT) {
+            output_size = std::max(output_size, end);
+        } else {
+            input_size = std::max(input_size, end);
+        }
+    }
+
+    SimSlave slave;
+    slave.config = config;
+    slave.output_offset = static_cast<uint32_t>(domain_size_);
+    slave.output_size = output_size;
+    slave.input_offset = slave.output_offset + output_size;
+    slave.input_size = input_size;
+    slave.wkc = static_cast<uint8_t>((input_size > 0 ? 1 : 0) + (output_size > 0 ? 2 : 0));
+
+    // domain offset으로 재배치
+    slave.mappings = mappings;
+    for (auto& mapping : slave.mappings) {
+        mapping.offset += mapping.direction == PDODirection::OUTPUT
+            ? slave.output_offset : slave.input_offset;
+        if (mapping.bit_length == 0) {
+            mapping.bit_length = static_cast<uint8_t>(PDOBulk::typeSize(mapping.data_type) * 8);
+        }
+    }
+
+    domain_size_ += output_size + input_size;
+    expected_wkc_ += slave.wkc;
+    slaves_.push_back(std::move(slave));
+
+    owned_domain_.resize(domain_size_, 0);
+    domain_ = owned_domain_.data();
+
+    return static_cast<int>(slaves_.size() - 1);
+}
+
+int SimulatedEtherCATMaster::initialize() {
+    if (slaves_.empty()) {
+        spdlog::error("시뮬레이션 Master 초기화 실패: slave 없음");
+        return -1;
+    }
+    initialized_ = true;
+    return 0;
+}
+
+int SimulatedEtherCATMaster::activate() {
+    if (active_) {
+        return 0;
+    }
+    if (!initialized_ && initialize() != 0) {
+        return -1;
+    }
+
+    // 할당은 모두 여기서 (이후 send/receive는 할당 없음)
+    latched_outputs_.assign(domain_size_, 0);
+    buildChannels();
+
+    start_time_ns_ = getMonotonicTimeNs();
+    virtual_time_ns_ = 0;
+    reference_clock_valid_ = false;
+    frame_in_flight_ = false;
+    stats_->reset();
+    active_ = true;
+
+    spdlog::info("시뮬레이션 EtherCAT Master 활성화: slaves={}, domain={} bytes, expected WKC={}",
+                 slaves_.size(), domain_size_, expected_wkc_);
+
+    return 0;
+}
+
+int SimulatedEtherCATMaster::deactivate() {
+    active_ = false;
+    frame_in_flight_ = false;
+    return 0;
+}
+
+int SimulatedEtherCATMaster::useExternalProcessImage(uint8_t* memory, size_t size) {
+    if (!memory || active_ || domain_size_ == 0 || size < domain_size_) {
+        spdlog::error("외부 process image 설정 실패: size={}, domain={}", size, domain_size_);
+        return -1;
+    }
+
+    std::memcpy(memory, domain_, domain_size_);
+    domain_ = memory;
+    external_image_ = true;
+    return 0;
+}
+
+int SimulatedEtherCATMaster::useExternalCycleStats(EtherCATCycleStats* stats) {
+    if (!stats || active_) {
+        spdlog::error("외부 cycle 통계 블록은 Master 활성화 전에만 설정 가능");
+        return -1;
+    }
+    stats->setLateThreshold(stats_->late_threshold_ns.load(std::memory_order_relaxed));
+    stats_ = stats;
+    return 0;
+}
+
+void SimulatedEtherCATMaster::setSimulationConfig(const SimulationConfig& sim_config) {
+    sim_config_ = sim_config;
+    rng_state_ = sim_config.seed ? sim_config.seed : 1;
+}
+
+int SimulatedEtherCATMaster::send() {
+    if (!active_) {
+        return -1;
+    }
+
+    spinFor(sim_config_.send_latency_ns);
+
+    // slave가 프레임 통과 시점의 출력을 latch
+    std::memcpy(latched_outputs_.data(), domain_, domain_size_);
+
+    if (sim_config_.virtual_time) {
+        virtual_time_ns_ += sim_config_.cycle_time_ns;
+    }
+
+    frame_in_flight_ = true;
+    send_time_ns_ = getMonotonicTimeNs();
+    total_cycles_++;
+    return 0;
+}
+
+int SimulatedEtherCATMaster::receive() {
+    if (!active_) {
+        return -1;
+    }
+
+    spinFor(sim_config_.receive_latency_ns);
+
+    // 송신한 프레임이 없으면 갱신할 데이터 없음 (IgH에서 queue 없이 receive한 경우와 동일)
+    if (!frame_in_flight_) {
+        working_counter_ = 0;
+        return 0;
+    }
+    frame_in_flight_ = false;
+    uint64_t latency_ns = getMonotonicTimeNs() - send_time_ns_;
+
+    // 프레임 손실: 입력 갱신 없음
+    if (sim_config_.frame_loss_rate > 0.0 && nextUniform() < sim_config_.frame_loss_rate) {
+        working_counter_ = 0;
+        frame_loss_count_++;
+        error_count_++;
+        stats_->recordFrameLoss(latency_ns);
+        return -1;
+    }
+
+    // WKC 불일치: 임의 slave 하나가 응답하지 않음
+    int32_t skip_slave = -1;
+    if (sim_config_.wkc_error_rate > 0.0 && nextUniform() < sim_config_.wkc_error_rate) {
+        skip_slave = static_cast<int32_t>(nextRandom() % slaves_.size());
+        wkc_error_count_++;
+        error_count_++;
+    }
+
+    updateInputs(skip_slave);
+    working_counter_ = expected_wkc_ - (skip_slave >= 0 ? slaves_[skip_slave].wkc : 0);
+
+    bool slave_error = skip_slave >= 0 &&
+                       static_cast<size_t>(skip_slave) < EtherCATCycleStats::MAX_SLAVES;
+    if (slave_error) {
+        slave_errors_[skip_slave / 64] = 1ULL << (skip_slave % 64);
+    }
+    stats_->recordReceive(working_counter_, expected_wkc_, latency_ns,
+                          slave_error ? slave_errors_ : nullptr);
+    if (slave_error) {
+        slave_errors_[skip_slave / 64] = 0;
+    }
+
+    // DC reference clock (프레임이 reference slave를 지난 시점의 slave 시간)
+    if (dc_config_.enable && skip_slave != static_cast<int32_t>(dc_config_.reference_slave)) {
+        uint64_t host_ns = getSimulationTimeNs();
+        int64_t drift_ns = static_cast<int64_t>(
+            static_cast<double>(host_ns) * sim_config_.dc_drift_ppm * 1e-6);
+        // 0을 중심으로 대칭 ([-J, J]): dc_initial_offset_ns가 그대로 평균 offset
+        int64_t jitter_ns = 0;
+        if (sim_config_.dc_jitter_ns > 0) {
+            uint64_t span = 2 * static_cast<uint64_t>(sim_config_.dc_jitter_ns) + 1;
+            jitter_ns = static_cast<int64_t>(nextRandom() % span) -
+                        static_cast<int64_t>(sim_config_.dc_jitter_ns);
+        }
+        reference_clock_ns_ = static_cast<uint64_t>(static_cast<int64_t>(host_ns) + drift_ns +
+                                                    sim_config_.dc_initial_offset_ns + jitter_ns);
+        reference_clock_valid_ = true;
+    }
+
+    return 0;
+}
+
+int SimulatedEtherCATMaster::getReferenceClockTime(uint64_t& out_time_ns) const {
+    if (!dc_config_.enable || !reference_clock_valid_) {
+        return -1;
+    }
+    out_time_ns = reference_clock_ns_;
+    return 0;
+}
+
+const SlaveConfig* SimulatedEtherCATMaster::getSlaveConfig(uint16_t slave_id) const {
+    if (slave_id >= slaves_.size()) {
+        return nullptr;
+    }
+    return &slaves_[slave_id].config;
+}
+
+const std::vector<PDOMapping>& SimulatedEtherCATMaster::getPDOMappings(uint16_t slave_id) const {
+    static const std::vector<PDOMapping> empty;
+    if (slave_id >= slaves_.size()) {
+        return empty;
+    }
+    return slaves_[slave_id].mappings;
+}
+
+uint64_t SimulatedEtherCATMaster::getSimulationTimeNs() const {
+    if (sim_config_.virtual_time) {
+        return virtual_time_ns_;
+    }
+    return active_ ? getMonotonicTimeNs() - start_time_ns_ : 0;
+}
+
+void SimulatedEtherCATMaster::buildChannels() {
+    channels_.clear();
+
+    for (size_t id = 0; id < slaves_.size(); ++id) {
+        const auto& mappings = slaves_[id].mappings;
+        for (const auto& input : mappings) {
+            if (input.direction != PDODirection::INPUT) {
+                continue;
+            }
+
+            SimChannel channel;
+            channel.offset = input.offset;
+            channel.size = static_cast<uint32_t>(PDOBulk::typeSize(input.data_type));
+            channel.data_type = input.data_type;
+            channel.slave_id = static_cast<uint16_t>(id);
+            channel.echo_offset = -1;
+
+            // 0x1Axx:n ↔ 0x16xx:n 동일 타입 출력이 있으면 loopback
+            for (const auto& output : mappings) {
+                if (output.direction == PDODirection::OUTPUT &&
+                    output.index + 0x0400 == input.index &&
+                    output.subindex == input.subindex &&
+                    output.data_type == input.data_type) {
+                    channel.echo_offset = output.offset;
+                    break;
+                }
+            }
+
+            // 톱니파: 채널마다 다른 기울기, 타입 범위 안에서 순환
+            switch (input.data_type) {
+                case PDODataType::INT8:
+                case PDODataType::UINT8:  channel.range = 100.0; break;
+                case PDODataType::INT16:
+                case PDODataType::UINT16: channel.range = 10000.0; break;
+                default:                  channel.range = 1000000.0; break;
+            }
+            channel.step = static_cast<double>(1 + (id + input.subindex) % 10);
+            channel.value = 0.0;
+
+            channels_.push_back(channel);
+        }
+    }
+}
+
+void SimulatedEtherCATMaster::updateInputs(int32_t skip_slave) {
+    for (auto& channel : channels_) {
+        if (static_cast<int32_t>(channel.slave_id) == skip_slave) {
+            continue;  // 무응답 slave: 이전 입력 유지
+        }
+
+        if (channel.echo_offset >= 0) {
+            std::memcpy(domain_ + channel.offset,
+                        latched_outputs_.data() + channel.echo_offset, channel.size);
+            continue;
+        }
+
+        channel.value += channel.step;
+        if (channel.value >= channel.range) {
+            channel.value -= channel.range;
+        }
+        PDOBulk::encode(channel.data_type, &channel.value, 1, 1.0, domain_ + channel.offset);
+    }
+}
+
+void SimulatedEtherCATMaster::spinFor(uint32_t latency_ns) {
+    uint64_t total_ns = latency_ns;
+    if (sim_config_.latency_jitter_ns > 0) {
+        total_ns += nextRandom() % sim_config_.latency_jitter_ns;
+    }
+    if (total_ns == 0) {
+        return;
+    }
+
+    // sleep은 분해능이 부족하므로 busy-wait (실제 wire 대기와 동일하게 CPU 점유)
+    uint64_t deadline = getMonotonicTimeNs() + total_ns;
+    while (getMonotonicTimeNs() < deadline) {
+    }
+}
+
+uint64_t SimulatedEtherCATMaster::nextRandom() {
+    rng_state_ ^= rng_state_ >> 12;
+    rng_state_ ^= rng_state_ << 25;
+    rng_state_ ^= rng_state_ >> 27;
+    return rng_state_ * 0x2545F4914F6CDD1DULL;
+}
+
+double SimulatedEtherCATMaster::nextUniform() {
+    return static_cast<double>(nextRandom() >> 11) * (1.0 / 9007199254740992.0);  // 2^53
+}
+
+} // namespace ethercat
+} // namespace mxrc
@@ -0,0 +1,191 @@
+#pragma once
+
+#include "../interfaces/IEtherCATMaster.h"
+#include "../interfaces/ISlaveConfig.h"
+#include "../dto/SlaveConfig.h"
+#include "../dto/PDOMapping.h"
+#include "../dto/DCConfiguration.h"
+#include "EtherCATCycleStats.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mxrc {
+namespace ethercat {
+
+// 시뮬레이션 파라미터
+struct SimulationConfig {
+    uint32_t send_latency_ns;       // send() 소요 시간 (busy-wait)
+    uint32_t receive_latency_ns;    // receive() 소요 시간 (wire round-trip, busy-wait)
+    uint32_t latency_jitter_ns;     // 지연에 더해지는 균등 분포 jitter [0, jitter)
+    double wkc_error_rate;          // cycle당 slave 하나가 응답하지 않을 확률 (WKC 불일치)
+    double frame_loss_rate;         // cycle당 프레임 손실 확률 (receive() -1)
+    double dc_drift_ppm;            // reference clock 드리프트 (ppm, 양수 = slave clock이 빠름)
+    int64_t dc_initial_offset_ns;   // reference clock 초기 offset
+    uint32_t dc_jitter_ns;          // reference clock 읽기 jitter [-jitter, jitter] (평균 0)
+    uint32_t cycle_time_ns;         // 가상 시간 모드의 cycle 주기
+    bool virtual_time;              // true: send()마다 cycle_time_ns 진행 (결정적), false: CLOCK_MONOTONIC
+    uint64_t seed;                  // 난수 seed (동일 seed = 동일 에러 패턴)
+
+    SimulationConfig()
+        : send_latency_ns(0)
+        , receive_latency_ns(0)
+        , latency_jitter_ns(0)
+        , wkc_error_rate(0.0)
+        , frame_loss_rate(0.0)
+        , dc_drift_ppm(0.0)
+        , dc_initial_offset_ns(0)
+        , dc_jitter_ns(0)
+        , cycle_time_ns(1000000)    // 기본 1ms
+        , virtual_time(true)
+        , seed(1) {}
+};
+
+// 하드웨어 없이 slave 네트워크를 시뮬레이션하는 in-process EtherCAT Master
+// - YAML(config/ethercat/slaves_sample.yaml 형식)의 slave 목록을 필요한 개수까지 복제
+// - slave별 PDO(slave 기준 offset)를 IgH처럼 하나의 domain에 재배치 (slave 순서, 출력 → 입력)
+//   재배치된 offset은 ISlaveConfig로 노출하므로 Sensor/Motor 매니저에 그대로 주입
+// - send(): 출력 영역을 slave에 latch, receive(): slave 입력을 domain에 기록
+//   입력 PDO(0x1Axx)와 같은 subindex/타입의 출력 PDO(0x16xx)가 있으면 latch된 출력을 반영
+//   (드라이브가 목표값을 따라가는 loopback), 없으면 채널별 톱니파 신호 생성
+// - WKC 불일치(무응답 slave의 입력은 갱신되지 않음), 프레임 손실, DC drift, 송수신 지연 시뮬레이션
+// RT 스레드 전용 (send/receive는 할당 없음)
+class SimulatedEtherCATMaster : public IEtherCATMaster, public ISlaveConfig {
+public:
+    explicit SimulatedEtherCATMaster(const SimulationConfig& sim_config = SimulationConfig());
+    ~SimulatedEtherCATMaster() override = default;
+
+    // YAML에서 slave 네트워크 로드 (기존 slave 목록은 교체)
+    // slave_count: 0이면 YAML 그대로, 크면 YAML slave 목록을 순환 복제하여 slave_count개 구성
+    // 반환: 성공 0, 파일 오류 또는 slave 없음 시 -1
+    int loadFromFile(const std::string& file_path, size_t slave_count = 0);
+
+    // slave 추가 (mappings의 offset은 slave 기준, activate() 전에만 가능)
+    // 반환: slave ID (네트워크 상 position), 실패 시 -1
+    int addSlave(const SlaveConfig& config, const std::vector<PDOMapping>& mappings);
+
+    // IEtherCATMaster 인터페이스 구현
+    int initialize() override;
+    int activate() override;
+    int deactivate() override;
+    int send() override;
+    int receive() override;
+    bool isActive() const override { return active_; }
+    uint32_t getErrorCount() const override { return error_count_; }
+    uint8_t* getProcessImage() override { return domain_; }
+    size_t getProcessImageSize() const override { return domain_size_; }
+    int useExternalProcessImage(uint8_t* memory, size_t size) override;
+    int getReferenceClockTime(uint64_t& out_time_ns) const override;
+    const EtherCATCycleStats* getCycleStats() const override { return stats_; }
+    int useExternalCycleStats(EtherCATCycleStats* stats) override;
+
+    // 지연 수신 판정 기준: send() 완료 → receive() 완료까지의 실제 경과 시간
+    // (receive_latency_ns 포함, 분할 실행 시 사이 action과 수신 대기도 포함)
+    void setLateReceiveThreshold(uint64_t threshold_ns) { stats_->setLateThreshold(threshold_ns); }
+
+    // ISlaveConfig 인터페이스 구현 (offset은 domain 기준)
+    const SlaveConfig* getSlaveConfig(uint16_t slave_id) const override;
+    const std::vector<PDOMapping>& getPDOMappings(uint16_t slave_id) const override;
+    size_t getSlaveCount() const override { return slaves_.size(); }
+
+    // DC 설정 (YAML dc_config 또는 직접 지정)
+    const DCConfiguration& getDCConfig() const { return dc_config_; }
+    void setDCConfig(const DCConfiguration& dc_config) { dc_config_ = dc_config; }
+
+    // 시뮬레이션 파라미터 (activate() 후 변경 시 다음 cycle부터 반영)
+    const SimulationConfig& getSimulationConfig() const { return sim_config_; }
+    void setSimulationConfig(const SimulationConfig& sim_config);
+
+    // 마지막 receive()의 working counter / 기대값
+    uint32_t getWorkingCounter() const { return working_counter_; }
+    uint32_t getExpectedWorkingCounter() const { return expected_wkc_; }
+
+    // 통계
+    uint64_t getTotalCycles() const { return total_cycles_; }
+    uint64_t getWKCErrorCount() const { return wkc_error_count_; }
+    uint64_t getFrameLossCount() const { return frame_loss_count_; }
+
+    // 시뮬레이션 시간 (master 기준, nanoseconds)
+    uint64_t getSimulationTimeNs() const;
+
+private:
+    // slave별 domain 배치
+    struct SimSlave {
+        SlaveConfig config;
+        std::vector<PDOMapping> mappings;   // domain offset으로 재배치된 매핑
+        uint32_t output_offset;             // 출력 영역 시작
+        uint32_t output_size;
+        uint32_t input_offset;              // 입력 영역 시작
+        uint32_t input_size;
+        uint8_t wkc;                        // LRW 응답 시 WKC 증가량 (입력 +1, 출력 +2)
+    };
+
+    // 입력 채널 시뮬레이션 (activate() 시 구성)
+    struct SimChannel {
+        uint32_t offset;        // domain 입력 offset
+        uint32_t size;          // 바이트 크기
+        int64_t echo_offset;    // loopback할 출력 offset (-1: 신호 생성)
+        PDODataType data_type;
+        uint16_t slave_id;
+        double value;           // 생성 신호 현재 값
+        double step;            // cycle당 증가량
+        double range;           // 톱니파 범위 [0, range)
+    };
+
+    // 입력 채널 구성
+    void buildChannels();
+
+    // slave 입력 갱신 (skip_slave는 무응답 slave, -1이면 전체 응답)
+    void updateInputs(int32_t skip_slave);
+
+    // busy-wait 지연 (jitter 포함)
+    void spinFor(uint32_t latency_ns);
+
+    // 난수 (xorshift64*, 할당 없음)
+    uint64_t nextRandom();
+    double nextUniform();  // [0, 1)
+
+    SimulationConfig sim_config_;
+    DCConfiguration dc_config_;
+
+    std::vector<SimSlave> slaves_;
+    std::vector<SimChannel> channels_;
+
+    // Process image
+    std::vector<uint8_t> owned_domain_;
+    uint8_t* domain_;
+    size_t domain_size_;
+    bool external_image_;                   // domain_이 외부 메모리
+    std::vector<uint8_t> latched_outputs_;  // send() 시점 출력 (slave 측 latch)
+
+    // 상태
+    bool initialized_;
+    bool active_;
+    bool frame_in_flight_;  // send() 후 receive() 전
+
+    // 시간
+    uint64_t start_time_ns_;
+    uint64_t virtual_time_ns_;
+    uint64_t reference_clock_ns_;
+    bool reference_clock_valid_;
+
+    // WKC / 통계
+    uint32_t expected_wkc_;
+    uint32_t working_counter_;
+    uint32_t error_count_;
+    uint64_t total_cycles_;
+    uint64_t wkc_error_count_;
+    uint64_t frame_loss_count_;
+
+    // cycle 통계 (무응답 slave를 bitmap으로 기록)
+    std::unique_ptr<EtherCATCycleStats> owned_stats_;
+    EtherCATCycleStats* stats_;
+    uint64_t send_time_ns_;
+    uint64_t slave_errors_[EtherCATCycleStats::SLAVE_BITMAP_WORDS];
+
+    uint64_t rng_state_;
+};
+
+} // namespace ethercat
+} // namespace mxrc
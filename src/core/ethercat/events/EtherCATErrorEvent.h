@@ -1,10 +1,9 @@
 #pragma once
 
 #include "../../event/interfaces/IEvent.h"
+#include "../../event/util/EventIdGenerator.h"
 #include <string>
 #include <chrono>
-#include <sstream>
-#include <iomanip>
 
 namespace mxrc {
 namespace ethercat {
@@ -31,12 +30,12 @@ public:
         , description_(description)
         , slave_id_(slave_id)
         , timestamp_(std::chrono::system_clock::now())
-        , event_id_(generateEventId()) {
+        , event_id_(mxrc::core::event::EventIdGenerator::next()) {
     }
 
     // IEvent 인터페이스 구현
     std::string getEventId() const override {
-        return event_id_;
+        return mxrc::core::event::EventIdGenerator::toString(event_id_);
     }
 
     mxrc::core::event::EventType getType() const override {
@@ -57,6 +56,15 @@ public:
         return "ETHERCAT_ERROR";
     }
 
+    // ipc-schema.yaml EtherCATErrorEvent: priority HIGH, ttl_ms 10000
+    mxrc::core::event::EventPriority getPriority() const override {
+        return mxrc::core::event::EventPriority::HIGH;
+    }
+
+    std::optional<std::chrono::milliseconds> getTtl() const override {
+        return std::chrono::milliseconds(10000);
+    }
+
     // EtherCAT 전용 정보
     EtherCATErrorType getErrorType() const { return error_type_; }
     std::string getDescription() const { return description_; }
@@ -86,23 +94,11 @@ public:
     }
 
 private:
-    std::string generateEventId() const {
-        // 간단한 이벤트 ID 생성 (timestamp + error type)
-        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-            timestamp_.time_since_epoch()).count();
-
-        std::ostringstream oss;
-        oss << "ethercat_error_"
-            << ms << "_"
-            << static_cast<int>(error_type_);
-        return oss.str();
-    }
-
     EtherCATErrorType error_type_;
     std::string description_;
     uint16_t slave_id_;
     std::chrono::system_clock::time_point timestamp_;
-    std::string event_id_;
+    uint64_t event_id_;
 };
 
 } // namespace ethercat
@@ -5,12 +5,23 @@
 namespace mxrc {
 namespace ethercat {
 
+namespace {
+
+// 모터 관리자가 사용하는 표준 PDO 그룹
+const std::vector<PDOGroup> MOTOR_PDO_GROUPS = {
+    {PDODirection::OUTPUT, 0x1602, 3},  // BLDC: control word, velocity, torque
+    {PDODirection::OUTPUT, 0x1603, 5},  // Servo: control word, position, max vel, velocity, torque
+};
+
+} // namespace
+
 MotorCommandManager::MotorCommandManager(
     std::shared_ptr<IEtherCATMaster> master,
     std::shared_ptr<ISlaveConfig> config)
     : master_(master)
     , config_(config)
-    , domain_ptr_(nullptr) {
+    , domain_ptr_(nullptr)
+    , slots_(MOTOR_PDO_GROUPS) {
 }
 
 int MotorCommandManager::writeBLDCCommand(const BLDCMotorCommand& command) {
@@ -27,8 +38,8 @@ int MotorCommandManager::writeBLDCCommand(const BLDCMotorCommand& command) {
         return -1;
     }
 
-    const auto& mappings = config_->getPDOMappings(command.slave_id);
-    if (mappings.empty()) {
+    if (!slots_.isCompiled(command.slave_id) &&
+        config_->getPDOMappings(command.slave_id).empty()) {
         spdlog::error("Slave {} PDO 매핑 없음", command.slave_id);
         return -1;
     }
@@ -106,8 +117,8 @@ int MotorCommandManager::writeServoCommand(const ServoDriverCommand& command) {
         return -1;
     }
 
-    const auto& mappings = config_->getPDOMappings(command.slave_id);
-    if (mappings.empty()) {
+    if (!slots_.isCompiled(command.slave_id) &&
+        config_->getPDOMappings(command.slave_id).empty()) {
         spdlog::error("Slave {} PDO 매핑 없음", command.slave_id);
         return -1;
     }
@@ -219,9 +230,52 @@ int MotorCommandManager::writeControlWord(uint16_t slave_id, uint16_t control_wo
     return -1;
 }
 
+int MotorCommandManager::compileAccessPlan(const std::vector<uint16_t>& slave_ids) {
+    int resolved = slots_.compile(*config_, slave_ids);
+    int unresolved_channels = channels_.compile(*config_);
+
+    if (unresolved_channels > 0) {
+        spdlog::warn("출력 채널 {}개의 PDO 매핑을 찾을 수 없음", unresolved_channels);
+    }
+
+    spdlog::debug("모터 PDO 접근 계획 컴파일: slaves={}, slots={}, channels={}",
+                 slave_ids.size(), resolved, channels_.size());
+
+    return 0;
+}
+
+int MotorCommandManager::addOutputChannel(uint16_t slave_id, uint16_t index, uint8_t subindex,
+                                          core::rt::DataKey key, double scale) {
+    return channels_.add(slave_id, PDODirection::OUTPUT, index, subindex, key, scale);
+}
+
+int MotorCommandManager::writeOutputChannels(const core::rt::RTDataStore& store) {
+    if (!domain_ptr_) {
+        return -1;
+    }
+    return channels_.writeOutputs(domain_ptr_, store);
+}
+
+int MotorCommandManager::writeOutputChannels(const double* values, size_t count) {
+    if (!domain_ptr_) {
+        return -1;
+    }
+    return channels_.encodeOutputs(domain_ptr_, values, count);
+}
+
 int MotorCommandManager::findPDOOffset(uint16_t slave_id, uint16_t index,
                                         uint8_t subindex, uint32_t& out_offset,
-                                        PDODataType& out_type) {
+                                        PDODataType& out_type) const {
+    const PDOAccessEntry* entry = nullptr;
+    if (slots_.lookup(slave_id, PDODirection::OUTPUT, index, subindex, entry)) {
+        if (!entry) {
+            return -1;
+        }
+        out_offset = entry->offset;
+        out_type = entry->data_type;
+        return 0;
+    }
+
     const auto& mappings = config_->getPDOMappings(slave_id);
 
     for (const auto& mapping : mappings) {
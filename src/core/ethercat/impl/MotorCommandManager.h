@@ -3,6 +3,7 @@
 #include "../interfaces/IMotorCommandManager.h"
 #include "../interfaces/IEtherCATMaster.h"
 #include "../interfaces/ISlaveConfig.h"
+#include "../util/PDOAccessPlan.h"
 #include <memory>
 
 namespace mxrc {
@@ -21,6 +22,25 @@ public:
     int writeBLDCCommand(const BLDCMotorCommand& command) override;
     int writeServoCommand(const ServoDriverCommand& command) override;
 
+    // 모터 PDO(0x1602, 0x1603)와 등록된 출력 채널을 slave 설정에서 해석
+    // 컴파일되지 않은 slave는 기존처럼 호출마다 설정 검색
+    int compileAccessPlan(const std::vector<uint16_t>& slave_ids) override;
+
+    // RTDataStore에서 가져올 출력 채널 등록 (기록 값 = value * scale)
+    // compileAccessPlan() 이후부터 writeOutputChannels()에 반영
+    // 반환: 채널 handle
+    int addOutputChannel(uint16_t slave_id, uint16_t index, uint8_t subindex,
+                         core::rt::DataKey key, double scale = 1.0);
+
+    // 등록된 출력 채널을 RTDataStore에서 읽어 domain에 기록
+    // 반환: 기록한 채널 수, domain 미설정 시 -1
+    int writeOutputChannels(const core::rt::RTDataStore& store);
+
+    // values[handle]을 등록된 출력 채널에 일괄 기록 (연속 동일 타입 채널은 SIMD)
+    // 예: ethercat_target_position 배열 → 64축 목표 위치 PDO
+    // 반환: 기록한 채널 수, domain 미설정 또는 count 부족 시 -1
+    int writeOutputChannels(const double* values, size_t count);
+
     // PDO domain 포인터 설정 (테스트용)
     void setDomainPtr(uint8_t* domain_ptr) {
         domain_ptr_ = domain_ptr;
@@ -34,12 +54,16 @@ private:
     // PDO domain 포인터
     uint8_t* domain_ptr_;
 
+    // 컴파일된 모터 PDO 슬롯과 출력 채널 계획
+    PDOSlotTable slots_;
+    PDOAccessPlan channels_;
+
     // 헬퍼: Control Word 작성
     int writeControlWord(uint16_t slave_id, uint16_t control_word);
 
-    // 헬퍼: PDO 매핑 찾기
+    // 헬퍼: PDO 매핑 찾기 (컴파일된 슬롯 우선, 없으면 설정 검색)
     int findPDOOffset(uint16_t slave_id, uint16_t index, uint8_t subindex,
-                       uint32_t& out_offset, PDODataType& out_type);
+                       uint32_t& out_offset, PDODataType& out_type) const;
 };
 
 } // namespace ethercat
@@ -6,12 +6,43 @@
 namespace mxrc {
 namespace ethercat {
 
+namespace {
+
+// 센서 관리자가 사용하는 표준 PDO 그룹
+const std::vector<PDOGroup> SENSOR_PDO_GROUPS = {
+    {PDODirection::INPUT, 0x1A00, 2},   // position, velocity
+    {PDODirection::INPUT, 0x1A01, 2},   // velocity, acceleration
+    {PDODirection::INPUT, 0x1A02, 6},   // force xyz, torque xyz
+    {PDODirection::INPUT, 0x1A03, 1},   // DI bitmap
+    {PDODirection::INPUT, 0x1A04, 4},   // AI 0~3
+    {PDODirection::OUTPUT, 0x1600, 1},  // DO bitmap
+    {PDODirection::OUTPUT, 0x1601, 4},  // AO 0~3
+};
+
+// PDO 데이터 타입 → process image 뷰 형식
+core::rt::ImageFormat toImageFormat(PDODataType type) {
+    switch (type) {
+        case PDODataType::INT8:   return core::rt::ImageFormat::INT8;
+        case PDODataType::UINT8:  return core::rt::ImageFormat::UINT8;
+        case PDODataType::INT16:  return core::rt::ImageFormat::INT16;
+        case PDODataType::UINT16: return core::rt::ImageFormat::UINT16;
+        case PDODataType::INT32:  return core::rt::ImageFormat::INT32;
+        case PDODataType::UINT32: return core::rt::ImageFormat::UINT32;
+        case PDODataType::FLOAT:  return core::rt::ImageFormat::FLOAT;
+        case PDODataType::DOUBLE: return core::rt::ImageFormat::DOUBLE;
+    }
+    return core::rt::ImageFormat::UINT8;
+}
+
+} // namespace
+
 SensorDataManager::SensorDataManager(
     std::shared_ptr<IEtherCATMaster> master,
     std::shared_ptr<ISlaveConfig> config)
     : master_(master)
     , config_(config)
-    , domain_ptr_(nullptr) {
+    , domain_ptr_(nullptr)
+    , slots_(SENSOR_PDO_GROUPS) {
 }
 
 int SensorDataManager::readPositionSensor(uint16_t slave_id, PositionSensorData& data) {
@@ -20,8 +51,7 @@ int SensorDataManager::readPositionSensor(uint16_t slave_id, PositionSensorData&
         return -1;
     }
 
-    const auto& mappings = config_->getPDOMappings(slave_id);
-    if (mappings.empty()) {
+    if (!slots_.isCompiled(slave_id) && config_->getPDOMappings(slave_id).empty()) {
         spdlog::error("Slave {} PDO 매핑 없음", slave_id);
         return -1;
     }
@@ -29,20 +59,11 @@ int SensorDataManager::readPositionSensor(uint16_t slave_id, PositionSensorData&
     // 위치 센서: 0x1A00:01 (position), 0x1A00:02 (velocity)
     uint32_t pos_offset = 0;
     uint32_t vel_offset = 0;
-    bool found_pos = false;
-    bool found_vel = false;
-
-    for (const auto& mapping : mappings) {
-        if (mapping.direction == PDODirection::INPUT) {
-            if (mapping.index == 0x1A00 && mapping.subindex == 0x01) {
-                pos_offset = mapping.offset;
-                found_pos = true;
-            } else if (mapping.index == 0x1A00 && mapping.subindex == 0x02) {
-                vel_offset = mapping.offset;
-                found_vel = true;
-            }
-        }
-    }
+    PDODataType data_type;
+    bool found_pos = findPDOOffset(slave_id, PDODirection::INPUT, 0x1A00, 0x01,
+                                   pos_offset, data_type) == 0;
+    bool found_vel = findPDOOffset(slave_id, PDODirection::INPUT, 0x1A00, 0x02,
+                                   vel_offset, data_type) == 0;
 
     if (!found_pos) {
         spdlog::warn("Slave {} position PDO 매핑 없음", slave_id);
@@ -73,29 +94,15 @@ int SensorDataManager::readVelocitySensor(uint16_t slave_id, VelocitySensorData&
         return -1;
     }
 
-    const auto& mappings = config_->getPDOMappings(slave_id);
-    if (mappings.empty()) {
-        return -1;
-    }
-
     // 속도 센서: 0x1A01:01 (velocity), 0x1A01:02 (acceleration)
     // DOUBLE 타입으로 저장됨
     uint32_t vel_offset = 0;
     uint32_t acc_offset = 0;
-    bool found_vel = false;
-    bool found_acc = false;
-
-    for (const auto& mapping : mappings) {
-        if (mapping.direction == PDODirection::INPUT) {
-            if (mapping.index == 0x1A01 && mapping.subindex == 0x01) {
-                vel_offset = mapping.offset;
-                found_vel = true;
-            } else if (mapping.index == 0x1A01 && mapping.subindex == 0x02) {
-                acc_offset = mapping.offset;
-                found_acc = true;
-            }
-        }
-    }
+    PDODataType data_type;
+    bool found_vel = findPDOOffset(slave_id, PDODirection::INPUT, 0x1A01, 0x01,
+                                   vel_offset, data_type) == 0;
+    bool found_acc = findPDOOffset(slave_id, PDODirection::INPUT, 0x1A01, 0x02,
+                                   acc_offset, data_type) == 0;
 
     if (!found_vel) {
         return -1;
@@ -124,29 +131,20 @@ int SensorDataManager::readTorqueSensor(uint16_t slave_id, TorqueSensorData& dat
         return -1;
     }
 
-    const auto& mappings = config_->getPDOMappings(slave_id);
-    if (mappings.empty()) {
-        return -1;
-    }
-
     // 토크 센서 6축: 0x1A02:01~06
     // 01: force_x, 02: force_y, 03: force_z
     // 04: torque_x, 05: torque_y, 06: torque_z
+    double* const axes[] = {&data.force_x, &data.force_y, &data.force_z,
+                            &data.torque_x, &data.torque_y, &data.torque_z};
     bool found_any = false;
 
-    for (const auto& mapping : mappings) {
-        if (mapping.direction == PDODirection::INPUT && mapping.index == 0x1A02) {
+    for (uint8_t axis = 0; axis < 6; ++axis) {
+        uint32_t offset = 0;
+        PDODataType data_type;
+        if (findPDOOffset(slave_id, PDODirection::INPUT, 0x1A02, axis + 1,
+                          offset, data_type) == 0) {
             found_any = true;
-            double value = PDOHelper::readDouble(domain_ptr_, mapping.offset);
-
-            switch (mapping.subindex) {
-                case 0x01: data.force_x = value; break;
-                case 0x02: data.force_y = value; break;
-                case 0x03: data.force_z = value; break;
-                case 0x04: data.torque_x = value; break;
-                case 0x05: data.torque_y = value; break;
-                case 0x06: data.torque_z = value; break;
-            }
+            *axes[axis] = PDOHelper::readDouble(domain_ptr_, offset);
         }
     }
 
@@ -168,28 +166,12 @@ int SensorDataManager::readDigitalInput(uint16_t slave_id, uint8_t channel, Digi
         return -1;
     }
 
-    const auto& mappings = config_->getPDOMappings(slave_id);
-    if (mappings.empty()) {
-        return -1;
-    }
-
     // Digital Input: 0x1A03:01 (모든 채널이 비트맵으로 인코딩됨)
     // 예: UINT8 또는 UINT16에서 각 비트가 채널
     uint32_t di_offset = 0;
     PDODataType data_type = PDODataType::UINT8;
-    bool found = false;
-
-    for (const auto& mapping : mappings) {
-        if (mapping.direction == PDODirection::INPUT &&
-            mapping.index == 0x1A03 && mapping.subindex == 0x01) {
-            di_offset = mapping.offset;
-            data_type = mapping.data_type;
-            found = true;
-            break;
-        }
-    }
 
-    if (!found) {
+    if (findPDOOffset(slave_id, PDODirection::INPUT, 0x1A03, 0x01, di_offset, data_type) != 0) {
         return -1;
     }
 
@@ -221,29 +203,14 @@ int SensorDataManager::readAnalogInput(uint16_t slave_id, uint8_t channel, Analo
         return -1;
     }
 
-    const auto& mappings = config_->getPDOMappings(slave_id);
-    if (mappings.empty()) {
-        return -1;
-    }
-
     // Analog Input: 0x1A04:01~04 (채널별 개별 매핑)
     // subindex = 0x01 + channel
     uint8_t target_subindex = 0x01 + channel;
     uint32_t ai_offset = 0;
     PDODataType data_type = PDODataType::INT16;
-    bool found = false;
-
-    for (const auto& mapping : mappings) {
-        if (mapping.direction == PDODirection::INPUT &&
-            mapping.index == 0x1A04 && mapping.subindex == target_subindex) {
-            ai_offset = mapping.offset;
-            data_type = mapping.data_type;
-            found = true;
-            break;
-        }
-    }
 
-    if (!found) {
+    if (findPDOOffset(slave_id, PDODirection::INPUT, 0x1A04, target_subindex,
+                      ai_offset, data_type) != 0) {
         return -1;
     }
 
@@ -278,27 +245,11 @@ int SensorDataManager::writeDigitalOutput(uint16_t slave_id, uint8_t channel,
         return -1;
     }
 
-    const auto& mappings = config_->getPDOMappings(slave_id);
-    if (mappings.empty()) {
-        return -1;
-    }
-
     // Digital Output: 0x1600:01 (8bit or 16bit bitmap)
     uint32_t do_offset = 0;
     PDODataType data_type = PDODataType::UINT8;
-    bool found = false;
-
-    for (const auto& mapping : mappings) {
-        if (mapping.direction == PDODirection::OUTPUT &&
-            mapping.index == 0x1600 && mapping.subindex == 0x01) {
-            do_offset = mapping.offset;
-            data_type = mapping.data_type;
-            found = true;
-            break;
-        }
-    }
 
-    if (!found) {
+    if (findPDOOffset(slave_id, PDODirection::OUTPUT, 0x1600, 0x01, do_offset, data_type) != 0) {
         return -1;
     }
 
@@ -340,29 +291,14 @@ int SensorDataManager::writeAnalogOutput(uint16_t slave_id, uint8_t channel,
         return -1;
     }
 
-    const auto& mappings = config_->getPDOMappings(slave_id);
-    if (mappings.empty()) {
-        return -1;
-    }
-
     // Analog Output: 0x1601:01~04 (채널별 개별 매핑)
     // subindex = 0x01 + channel
     uint8_t target_subindex = 0x01 + channel;
     uint32_t ao_offset = 0;
     PDODataType pdo_data_type = PDODataType::INT16;
-    bool found = false;
 
-    for (const auto& mapping : mappings) {
-        if (mapping.direction == PDODirection::OUTPUT &&
-            mapping.index == 0x1601 && mapping.subindex == target_subindex) {
-            ao_offset = mapping.offset;
-            pdo_data_type = mapping.data_type;
-            found = true;
-            break;
-        }
-    }
-
-    if (!found) {
+    if (findPDOOffset(slave_id, PDODirection::OUTPUT, 0x1601, target_subindex,
+                      ao_offset, pdo_data_type) != 0) {
         return -1;
     }
 
@@ -393,13 +329,92 @@ int SensorDataManager::writeAnalogOutput(uint16_t slave_id, uint8_t channel,
     return 0;
 }
 
-int SensorDataManager::findPDOOffset(uint16_t slave_id, uint16_t index,
-                                      uint8_t subindex, uint32_t& out_offset) {
+int SensorDataManager::compileAccessPlan(const std::vector<uint16_t>& slave_ids) {
+    int resolved = slots_.compile(*config_, slave_ids);
+    int unresolved_channels = channels_.compile(*config_);
+
+    if (unresolved_channels > 0) {
+        spdlog::warn("입력 채널 {}개의 PDO 매핑을 찾을 수 없음", unresolved_channels);
+    }
+
+    spdlog::debug("센서 PDO 접근 계획 컴파일: slaves={}, slots={}, channels={}",
+                 slave_ids.size(), resolved, channels_.size());
+
+    return 0;
+}
+
+int SensorDataManager::addInputChannel(uint16_t slave_id, uint16_t index, uint8_t subindex,
+                                       core::rt::DataKey key, double scale) {
+    return channels_.add(slave_id, PDODirection::INPUT, index, subindex, key, scale);
+}
+
+int SensorDataManager::readInputChannels(core::rt::RTDataStore& store) const {
+    if (!domain_ptr_) {
+        return -1;
+    }
+    return channels_.readInputs(domain_ptr_, store);
+}
+
+int SensorDataManager::readInputChannels(double* out, size_t count) const {
+    if (!domain_ptr_) {
+        return -1;
+    }
+    return channels_.decodeInputs(domain_ptr_, out, count);
+}
+
+int SensorDataManager::bindInputViews(core::rt::RTDataStore& store) {
+    int bound = 0;
+
+    for (const auto& entry : channels_.entries()) {
+        if (!entry.resolved || entry.key == PDO_NO_DATA_KEY) {
+            continue;
+        }
+
+        if (store.bindView(entry.key, entry.offset, toImageFormat(entry.data_type),
+                           entry.scale) == 0) {
+            bound++;
+        } else {
+            spdlog::warn("입력 채널 뷰 바인딩 실패: slave_id={}, 0x{:04X}:{:02X}, offset={}",
+                         entry.slave_id, entry.index, entry.subindex, entry.offset);
+        }
+    }
+
+    spdlog::info("입력 채널 process image 뷰 바인딩: {}개", bound);
+    return bound;
+}
+
+int SensorDataManager::bindInputView(core::rt::RTDataStore& store, uint16_t slave_id,
+                                      uint16_t index, uint8_t subindex,
+                                      core::rt::DataKey key, double scale) {
+    uint32_t offset = 0;
+    PDODataType data_type = PDODataType::UINT8;
+    if (findPDOOffset(slave_id, PDODirection::INPUT, index, subindex, offset, data_type) != 0) {
+        return -1;
+    }
+
+    return store.bindView(key, offset, toImageFormat(data_type), scale);
+}
+
+int SensorDataManager::findPDOOffset(uint16_t slave_id, PDODirection direction,
+                                      uint16_t index, uint8_t subindex,
+                                      uint32_t& out_offset, PDODataType& out_type) const {
+    const PDOAccessEntry* entry = nullptr;
+    if (slots_.lookup(slave_id, direction, index, subindex, entry)) {
+        if (!entry) {
+            return -1;
+        }
+        out_offset = entry->offset;
+        out_type = entry->data_type;
+        return 0;
+    }
+
     const auto& mappings = config_->getPDOMappings(slave_id);
 
     for (const auto& mapping : mappings) {
-        if (mapping.index == index && mapping.subindex == subindex) {
+        if (mapping.direction == direction &&
+            mapping.index == index && mapping.subindex == subindex) {
             out_offset = mapping.offset;
+            out_type = mapping.data_type;
             return 0;
         }
     }
@@ -3,6 +3,7 @@
 #include "../interfaces/ISensorDataManager.h"
 #include "../interfaces/IEtherCATMaster.h"
 #include "../interfaces/ISlaveConfig.h"
+#include "../util/PDOAccessPlan.h"
 #include <memory>
 
 namespace mxrc {
@@ -28,6 +29,35 @@ public:
     int writeDigitalOutput(uint16_t slave_id, uint8_t channel, const DigitalOutputData& data) override;
     int writeAnalogOutput(uint16_t slave_id, uint8_t channel, const AnalogOutputData& data) override;
 
+    // 센서 PDO(0x1A00~0x1A04, 0x1600~0x1601)와 등록된 입력 채널을 slave 설정에서 해석
+    // 이후 read/write는 설정 검색 없이 해석된 offset/타입 사용
+    // 컴파일되지 않은 slave는 기존처럼 호출마다 설정 검색
+    int compileAccessPlan(const std::vector<uint16_t>& slave_ids) override;
+
+    // RTDataStore로 전달할 입력 채널 등록 (값 = raw * scale)
+    // compileAccessPlan() 이후부터 readInputChannels()에 반영
+    // 반환: 채널 handle
+    int addInputChannel(uint16_t slave_id, uint16_t index, uint8_t subindex,
+                        core::rt::DataKey key, double scale = 1.0);
+
+    // 등록된 입력 채널을 domain에서 읽어 RTDataStore에 저장
+    // 반환: 저장한 채널 수, domain 미설정 시 -1
+    int readInputChannels(core::rt::RTDataStore& store) const;
+
+    // 등록된 입력 채널을 out[handle]에 일괄 변환 (연속 동일 타입 채널은 SIMD)
+    // 예: 64축 엔코더 카운트 → ethercat_sensor_position 배열
+    // 반환: 변환한 채널 수, domain 미설정 또는 count 부족 시 -1
+    int readInputChannels(double* out, size_t count) const;
+
+    // 해석된 입력 채널을 RTDataStore process image 뷰로 바인딩
+    // 이후 채널 키는 복사 없이 image에서 직접 읽힘 (readInputChannels 불필요)
+    int bindInputViews(core::rt::RTDataStore& store) override;
+
+    // 입력 PDO 하나를 process image 뷰로 바인딩 (등록된 센서용)
+    int bindInputView(core::rt::RTDataStore& store, uint16_t slave_id,
+                      uint16_t index, uint8_t subindex,
+                      core::rt::DataKey key, double scale) override;
+
     // PDO domain 포인터 설정 (테스트용)
     void setDomainPtr(uint8_t* domain_ptr) {
         domain_ptr_ = domain_ptr;
@@ -41,8 +71,13 @@ private:
     // PDO domain 포인터
     uint8_t* domain_ptr_;
 
-    // 헬퍼: PDO 매핑에서 오프셋 찾기
-    int findPDOOffset(uint16_t slave_id, uint16_t index, uint8_t subindex, uint32_t& out_offset);
+    // 컴파일된 센서 PDO 슬롯과 입력 채널 계획
+    PDOSlotTable slots_;
+    PDOAccessPlan channels_;
+
+    // 헬퍼: PDO 매핑에서 오프셋 찾기 (컴파일된 슬롯 우선, 없으면 설정 검색)
+    int findPDOOffset(uint16_t slave_id, PDODirection direction, uint16_t index,
+                      uint8_t subindex, uint32_t& out_offset, PDODataType& out_type) const;
 };
 
 } // namespace ethercat
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace mxrc {
 namespace ethercat {
 
+struct EtherCATCycleStats;
+
 // EtherCAT Master 인터페이스
 // 테스트 가능성을 위한 추상화 (의존성 주입)
 class IEtherCATMaster {
@@ -31,6 +34,44 @@ public:
 
     // 에러 카운트 조회
     virtual uint32_t getErrorCount() const = 0;
+
+    // Process image (PDO domain 메모리) 조회
+    // 반환: domain 포인터/크기, 미지원 시 nullptr/0
+    virtual uint8_t* getProcessImage() { return nullptr; }
+    virtual size_t getProcessImageSize() const { return 0; }
+
+    // 외부 메모리를 domain process image로 사용 (activate() 전에 호출)
+    // 반환: 성공 0, 미지원 또는 크기 부족 시 -1
+    virtual int useExternalProcessImage(uint8_t* memory, size_t size) {
+        (void)memory;
+        (void)size;
+        return -1;
+    }
+
+    // 다음 send()에서 slave에 전달할 application time (이번 cycle의 예정 시작 시각, RTContext::timestamp_ns)
+    // 실제 송신 시각 대신 사용하여 송신 jitter가 DC에 전달되지 않게 함 (미지원 master는 무시)
+    virtual void setApplicationTime(uint64_t cycle_start_ns) {
+        (void)cycle_start_ns;
+    }
+
+    // 마지막 receive()에서 읽은 DC reference clock 시간 (nanoseconds)
+    // cycle 시작(application time) 시점으로 환산된 값 (송신까지의 host 지연 제외)
+    // 반환: 성공 0, DC 미사용 또는 미지원 시 -1
+    virtual int getReferenceClockTime(uint64_t& out_time_ns) const {
+        (void)out_time_ns;
+        return -1;
+    }
+
+    // cycle 통계 블록 (WKC 불일치, 프레임 손실, 지연 수신, slave 에러 bitmap, 수신 지연 히스토그램)
+    // 반환: 미지원 시 nullptr
+    virtual const EtherCATCycleStats* getCycleStats() const { return nullptr; }
+
+    // 통계 블록을 외부 메모리로 교체 (예: EtherCATCycleStatsShared, Non-RT에서 읽기, activate() 전에 호출)
+    // 반환: 성공 0, 미지원 또는 활성화 상태면 -1
+    virtual int useExternalCycleStats(EtherCATCycleStats* stats) {
+        (void)stats;
+        return -1;
+    }
 };
 
 } // namespace ethercat
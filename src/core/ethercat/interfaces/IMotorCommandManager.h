@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../dto/MotorCommand.h"
+#include <vector>
 
 namespace mxrc {
 namespace ethercat {
@@ -16,6 +17,13 @@ public:
 
     // 서보 드라이버 명령 전송
     virtual int writeServoCommand(const ServoDriverCommand& command) = 0;
+
+    // cycle 활성화 시 slave들의 PDO 접근 계획 컴파일
+    // 반환: 0 성공, -1 실패 (기본 구현: 컴파일 없이 매 호출 검색)
+    virtual int compileAccessPlan(const std::vector<uint16_t>& slave_ids) {
+        (void)slave_ids;
+        return 0;
+    }
 };
 
 } // namespace ethercat
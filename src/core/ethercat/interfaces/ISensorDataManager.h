@@ -1,8 +1,16 @@
 #pragma once
 
 #include "../dto/SensorData.h"
+#include <vector>
 
 namespace mxrc {
+namespace core {
+namespace rt {
+class RTDataStore;
+enum class DataKey : uint16_t;
+} // namespace rt
+} // namespace core
+
 namespace ethercat {
 
 // 센서 데이터 관리 인터페이스
@@ -31,6 +39,35 @@ public:
 
     // Analog Output 쓰기
     virtual int writeAnalogOutput(uint16_t slave_id, uint8_t channel, const AnalogOutputData& data) = 0;
+
+    // cycle 활성화 시 slave들의 PDO 접근 계획 컴파일
+    // 반환: 0 성공, -1 실패 (기본 구현: 컴파일 없이 매 호출 검색)
+    virtual int compileAccessPlan(const std::vector<uint16_t>& slave_ids) {
+        (void)slave_ids;
+        return 0;
+    }
+
+    // 입력 채널을 RTDataStore process image 뷰로 바인딩 (zero-copy)
+    // 반환: 바인딩한 채널 수 (기본 구현: 0)
+    virtual int bindInputViews(core::rt::RTDataStore& store) {
+        (void)store;
+        return 0;
+    }
+
+    // 입력 PDO 하나(index:subindex)를 RTDataStore process image 뷰로 바인딩
+    // 값 = raw * scale (getDouble 기준), 형식은 PDO 매핑 타입
+    // 반환: 0 성공, -1 실패 (매핑 없음 또는 범위 오류, 기본 구현: 미지원)
+    virtual int bindInputView(core::rt::RTDataStore& store, uint16_t slave_id,
+                              uint16_t index, uint8_t subindex,
+                              core::rt::DataKey key, double scale) {
+        (void)store;
+        (void)slave_id;
+        (void)index;
+        (void)subindex;
+        (void)key;
+        (void)scale;
+        return -1;
+    }
 };
 
 } // namespace ethercat
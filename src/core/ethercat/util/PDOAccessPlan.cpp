@@ -0,0 +1,236 @@
+#include "PDOAccessPlan.h"
+#include "PDOBulk.h"
+
+namespace mxrc {
+namespace ethercat {
+
+int PDOAccessPlan::add(uint16_t slave_id, PDODirection direction, uint16_t index,
+                       uint8_t subindex, core::rt::DataKey key, double scale) {
+    PDOAccessEntry entry;
+    entry.slave_id = slave_id;
+    entry.direction = direction;
+    entry.index = index;
+    entry.subindex = subindex;
+    entry.key = key;
+    entry.scale = scale;
+
+    entries_.push_back(entry);
+    compiled_ = false;
+    return static_cast<int>(entries_.size() - 1);
+}
+
+int PDOAccessPlan::compile(const ISlaveConfig& config) {
+    int unresolved = 0;
+
+    for (auto& entry : entries_) {
+        entry.resolved = false;
+        for (const auto& mapping : config.getPDOMappings(entry.slave_id)) {
+            if (mapping.direction == entry.direction &&
+                mapping.index == entry.index && mapping.subindex == entry.subindex) {
+                entry.offset = mapping.offset;
+                entry.data_type = mapping.data_type;
+                entry.resolved = true;
+                break;
+            }
+        }
+        if (!entry.resolved) {
+            unresolved++;
+        }
+    }
+
+    buildRuns();
+    scratch_.assign(entries_.size(), 0.0);
+
+    compiled_ = true;
+    return unresolved;
+}
+
+void PDOAccessPlan::buildRuns() {
+    runs_.clear();
+
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        const auto& entry = entries_[i];
+        if (!entry.resolved) {
+            continue;
+        }
+
+        if (!runs_.empty()) {
+            PDORun& run = runs_.back();
+            uint32_t next_offset = run.offset +
+                run.count * static_cast<uint32_t>(PDOBulk::typeSize(run.data_type));
+            if (run.first + run.count == i && run.direction == entry.direction &&
+                run.data_type == entry.data_type && run.scale == entry.scale &&
+                next_offset == entry.offset) {
+                run.count++;
+                continue;
+            }
+        }
+
+        PDORun run;
+        run.direction = entry.direction;
+        run.data_type = entry.data_type;
+        run.offset = entry.offset;
+        run.first = static_cast<uint32_t>(i);
+        run.count = 1;
+        run.scale = entry.scale;
+        runs_.push_back(run);
+    }
+}
+
+void PDOAccessPlan::clear() {
+    entries_.clear();
+    runs_.clear();
+    scratch_.clear();
+    compiled_ = false;
+}
+
+int PDOAccessPlan::readInputs(const uint8_t* domain, core::rt::RTDataStore& store) const {
+    if (!domain) {
+        return 0;
+    }
+
+    if (decodeInputs(domain, scratch_.data(), scratch_.size()) < 0) {
+        return 0;
+    }
+
+    int stored = 0;
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        const auto& entry = entries_[i];
+        if (!entry.resolved || entry.direction != PDODirection::INPUT ||
+            entry.key == PDO_NO_DATA_KEY) {
+            continue;
+        }
+        if (store.setDouble(entry.key, scratch_[i]) == 0) {
+            stored++;
+        }
+    }
+    return stored;
+}
+
+int PDOAccessPlan::decodeInputs(const uint8_t* domain, double* out, size_t count) const {
+    if (!domain || !out || count < entries_.size()) {
+        return -1;
+    }
+
+    int decoded = 0;
+    for (const auto& run : runs_) {
+        if (run.direction != PDODirection::INPUT) {
+            continue;
+        }
+        PDOBulk::decode(run.data_type, domain + run.offset, run.count, run.scale,
+                        out + run.first);
+        decoded += static_cast<int>(run.count);
+    }
+    return decoded;
+}
+
+int PDOAccessPlan::encodeOutputs(uint8_t* domain, const double* values, size_t count) const {
+    if (!domain || !values || count < entries_.size()) {
+        return -1;
+    }
+
+    int written = 0;
+    for (const auto& run : runs_) {
+        if (run.direction != PDODirection::OUTPUT) {
+            continue;
+        }
+        PDOBulk::encode(run.data_type, values + run.first, run.count, run.scale,
+                        domain + run.offset);
+        written += static_cast<int>(run.count);
+    }
+    return written;
+}
+
+int PDOAccessPlan::writeOutputs(uint8_t* domain, const core::rt::RTDataStore& store) const {
+    if (!domain) {
+        return 0;
+    }
+
+    int written = 0;
+    for (const auto& entry : entries_) {
+        if (!entry.resolved || entry.direction != PDODirection::OUTPUT ||
+            entry.key == PDO_NO_DATA_KEY) {
+            continue;
+        }
+        double value = 0.0;
+        if (store.getDouble(entry.key, value) != 0) {
+            continue;
+        }
+        encode(domain, entry, value * entry.scale);
+        written++;
+    }
+    return written;
+}
+
+double PDOAccessPlan::decode(const uint8_t* domain, const PDOAccessEntry& entry) {
+    double value = 0.0;
+    PDOBulk::decode(entry.data_type, domain + entry.offset, 1, 1.0, &value);
+    return value;
+}
+
+void PDOAccessPlan::encode(uint8_t* domain, const PDOAccessEntry& entry, double value) {
+    PDOBulk::encode(entry.data_type, &value, 1, 1.0, domain + entry.offset);
+}
+
+PDOSlotTable::PDOSlotTable(std::vector<PDOGroup> groups)
+    : groups_(std::move(groups)) {}
+
+int PDOSlotTable::compile(const ISlaveConfig& config, const std::vector<uint16_t>& slave_ids) {
+    plan_.clear();
+    first_handle_.clear();
+
+    for (uint16_t slave_id : slave_ids) {
+        if (slave_id >= first_handle_.size()) {
+            first_handle_.resize(static_cast<size_t>(slave_id) + 1, -1);
+        }
+        if (first_handle_[slave_id] >= 0) {
+            continue;  // 중복 slave
+        }
+
+        first_handle_[slave_id] = static_cast<int32_t>(plan_.size());
+        for (const auto& group : groups_) {
+            for (uint8_t sub = 1; sub <= group.subindex_count; ++sub) {
+                plan_.add(slave_id, group.direction, group.index, sub);
+            }
+        }
+    }
+
+    int unresolved = plan_.compile(config);
+    return static_cast<int>(plan_.size()) - unresolved;
+}
+
+bool PDOSlotTable::lookup(uint16_t slave_id, PDODirection direction, uint16_t index,
+                          uint8_t subindex, const PDOAccessEntry*& out) const {
+    out = nullptr;
+    if (!isCompiled(slave_id)) {
+        return false;
+    }
+
+    int slot = slotOf(direction, index, subindex);
+    if (slot < 0) {
+        return false;
+    }
+
+    const PDOAccessEntry* entry = plan_.entry(first_handle_[slave_id] + slot);
+    if (entry && entry->resolved) {
+        out = entry;
+    }
+    return true;
+}
+
+int PDOSlotTable::slotOf(PDODirection direction, uint16_t index, uint8_t subindex) const {
+    int base = 0;
+    for (const auto& group : groups_) {
+        if (group.direction == direction && group.index == index) {
+            if (subindex >= 1 && subindex <= group.subindex_count) {
+                return base + subindex - 1;
+            }
+            return -1;
+        }
+        base += group.subindex_count;
+    }
+    return -1;
+}
+
+} // namespace ethercat
+} // namespace mxrc
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "../dto/PDOMapping.h"
+#include "../interfaces/ISlaveConfig.h"
+#include "../../rt/RTDataStore.h"
+#include <cstdint>
+#include <vector>
+
+namespace mxrc {
+namespace ethercat {
+
+// RTDataStore 키가 없는 엔트리 (역할 조회 전용)
+constexpr core::rt::DataKey PDO_NO_DATA_KEY = core::rt::DataKey::MAX_KEYS;
+
+// PDO 접근 계획 엔트리
+// cycle 활성화 시 slave 설정에서 해석된 domain offset/타입을 보관
+struct PDOAccessEntry {
+    uint16_t slave_id;          // Slave ID
+    uint16_t index;             // PDO index
+    uint8_t subindex;           // PDO subindex
+    PDODirection direction;     // INPUT: domain → RTDataStore, OUTPUT: RTDataStore → domain
+    PDODataType data_type;      // 해석된 데이터 타입
+    uint32_t offset;            // 해석된 domain 바이트 offset
+    double scale;               // 배율 (INPUT: raw * scale 저장, OUTPUT: value * scale 기록)
+    core::rt::DataKey key;      // RTDataStore 키 (PDO_NO_DATA_KEY면 전송 대상 아님)
+    bool resolved;              // 매핑을 찾았는지 여부
+
+    PDOAccessEntry()
+        : slave_id(0)
+        , index(0)
+        , subindex(0)
+        , direction(PDODirection::INPUT)
+        , data_type(PDODataType::UINT8)
+        , offset(0)
+        , scale(1.0)
+        , key(PDO_NO_DATA_KEY)
+        , resolved(false) {}
+};
+
+// 연속 실행 구간 (handle 순서로 인접하고 domain에서도 연속인 동일 타입/방향/scale 엔트리)
+// PDOBulk로 한 번에 변환
+struct PDORun {
+    PDODirection direction;
+    PDODataType data_type;
+    uint32_t offset;    // 첫 엔트리의 domain offset
+    uint32_t first;     // 첫 엔트리 handle
+    uint32_t count;     // 엔트리 수
+    double scale;
+};
+
+// 평탄화된 PDO 접근 계획
+// - add(): 설정 단계에서 채널 등록 (handle 반환)
+// - compile(): slave 설정을 한 번 검색하여 offset/타입 해석, 연속 구간(PDORun) 구성
+// - readInputs()/writeOutputs(): 매 cycle 엔트리 배열을 순서대로 실행 (검색 없음, 할당 없음)
+// - decodeInputs()/encodeOutputs(): handle 인덱스 double 배열과 domain 간 일괄 변환 (SIMD)
+class PDOAccessPlan {
+public:
+    PDOAccessPlan() = default;
+
+    // 채널 등록 (compile 전까지 미해석 상태)
+    // 반환: handle (entry() 인덱스)
+    int add(uint16_t slave_id, PDODirection direction, uint16_t index, uint8_t subindex,
+            core::rt::DataKey key = PDO_NO_DATA_KEY, double scale = 1.0);
+
+    // 모든 엔트리를 slave 설정에서 해석
+    // 반환: 해석하지 못한 엔트리 수 (0이면 모두 성공)
+    int compile(const ISlaveConfig& config);
+
+    // 엔트리 조회 (handle 범위 밖이면 nullptr)
+    const PDOAccessEntry* entry(int handle) const {
+        if (handle < 0 || static_cast<size_t>(handle) >= entries_.size()) {
+            return nullptr;
+        }
+        return &entries_[handle];
+    }
+
+    const std::vector<PDOAccessEntry>& entries() const { return entries_; }
+    size_t size() const { return entries_.size(); }
+    bool isCompiled() const { return compiled_; }
+
+    // 모든 엔트리 제거
+    void clear();
+
+    const std::vector<PDORun>& runs() const { return runs_; }
+
+    // INPUT 엔트리: domain 값을 double로 변환, scale 적용 후 RTDataStore에 저장
+    // 내부 scratch 버퍼를 사용하므로 같은 계획에 대한 동시 호출 불가 (RT 스레드 전용)
+    // 반환: 저장한 엔트리 수
+    int readInputs(const uint8_t* domain, core::rt::RTDataStore& store) const;
+
+    // 해석된 INPUT 엔트리를 out[handle]에 일괄 decode (scale 적용)
+    // 그 외 handle 위치는 변경하지 않음
+    // 반환: decode한 엔트리 수, 인자 오류(count < size()) 시 -1
+    int decodeInputs(const uint8_t* domain, double* out, size_t count) const;
+
+    // values[handle]을 해석된 OUTPUT 엔트리에 일괄 encode (scale 적용)
+    // 반환: 기록한 엔트리 수, 인자 오류(count < size()) 시 -1
+    int encodeOutputs(uint8_t* domain, const double* values, size_t count) const;
+
+    // OUTPUT 엔트리: RTDataStore 값에 scale 적용 후 domain에 기록
+    // 반환: 기록한 엔트리 수 (키에 값이 없으면 건너뜀)
+    int writeOutputs(uint8_t* domain, const core::rt::RTDataStore& store) const;
+
+    // 엔트리 타입에 맞춰 domain 값을 double로 읽기 (scale 미적용)
+    static double decode(const uint8_t* domain, const PDOAccessEntry& entry);
+
+    // 엔트리 타입에 맞춰 double 값을 domain에 쓰기 (정수 타입은 반올림 + 범위 포화, scale 미적용)
+    static void encode(uint8_t* domain, const PDOAccessEntry& entry, double value);
+
+private:
+    // 해석된 엔트리로 연속 구간 구성
+    void buildRuns();
+
+    std::vector<PDOAccessEntry> entries_;
+    std::vector<PDORun> runs_;
+    mutable std::vector<double> scratch_;  // readInputs()용 (compile 시 크기 확정)
+    bool compiled_ = false;
+};
+
+// 고정 PDO 그룹 (index 하나, subindex 1..subindex_count)
+struct PDOGroup {
+    PDODirection direction;
+    uint16_t index;
+    uint8_t subindex_count;
+};
+
+// slave별 고정 PDO 그룹의 해석 결과
+// 매니저가 사용하는 표준 PDO(예: 0x1A00:01 위치)를 slave마다 미리 해석해 두고,
+// (slave, index, subindex) → 엔트리를 설정 검색 없이 상수 시간에 조회
+class PDOSlotTable {
+public:
+    explicit PDOSlotTable(std::vector<PDOGroup> groups);
+
+    // 지정한 slave들의 모든 그룹 슬롯 해석 (기존 결과는 교체)
+    // 반환: 해석된 슬롯 수
+    int compile(const ISlaveConfig& config, const std::vector<uint16_t>& slave_ids);
+
+    // 조회
+    // 반환: 테이블이 답할 수 있으면 true (out은 매핑이 없으면 nullptr)
+    //       slave가 컴파일되지 않았거나 그룹 밖 PDO면 false (호출자가 설정 검색)
+    bool lookup(uint16_t slave_id, PDODirection direction, uint16_t index, uint8_t subindex,
+                const PDOAccessEntry*& out) const;
+
+    bool isCompiled(uint16_t slave_id) const {
+        return slave_id < first_handle_.size() && first_handle_[slave_id] >= 0;
+    }
+
+    const PDOAccessPlan& plan() const { return plan_; }
+
+private:
+    // 그룹 내 슬롯 번호 (그룹 밖이면 -1)
+    int slotOf(PDODirection direction, uint16_t index, uint8_t subindex) const;
+
+    std::vector<PDOGroup> groups_;
+    PDOAccessPlan plan_;
+    std::vector<int32_t> first_handle_;  // slave_id → 첫 슬롯 handle (-1: 미컴파일)
+};
+
+} // namespace ethercat
+} // namespace mxrc
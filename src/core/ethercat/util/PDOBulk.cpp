@@ -0,0 +1,185 @@
+#include "PDOBulk.h"
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace mxrc {
+namespace ethercat {
+
+namespace {
+
+// 스칼라 decode (나머지 타입 및 SIMD 잔여 원소)
+template <typename T>
+void decodeScalar(const uint8_t* src, size_t count, double scale, double* out) {
+    for (size_t i = 0; i < count; ++i) {
+        T raw;
+        std::memcpy(&raw, src + i * sizeof(T), sizeof(T));
+        out[i] = static_cast<double>(raw) * scale;
+    }
+}
+
+// 정수 타입 범위로 포화 후 반올림 (NaN은 최솟값)
+// 반올림은 현재 FP 모드(기본: 짝수 반올림)를 따라 SIMD 변환과 일치
+template <typename T>
+T saturateRound(double value) {
+    constexpr double lo = static_cast<double>(std::numeric_limits<T>::min());
+    constexpr double hi = static_cast<double>(std::numeric_limits<T>::max());
+    if (!(value >= lo)) {
+        return std::numeric_limits<T>::min();
+    }
+    if (value >= hi) {
+        return std::numeric_limits<T>::max();
+    }
+    return static_cast<T>(std::nearbyint(value));
+}
+
+template <typename T>
+void encodeScalar(const double* in, size_t count, double scale, uint8_t* dst) {
+    for (size_t i = 0; i < count; ++i) {
+        T raw;
+        if constexpr (std::is_integral_v<T>) {
+            raw = saturateRound<T>(in[i] * scale);
+        } else {
+            raw = static_cast<T>(in[i] * scale);
+        }
+        std::memcpy(dst + i * sizeof(T), &raw, sizeof(T));
+    }
+}
+
+} // namespace
+
+size_t PDOBulk::typeSize(PDODataType type) {
+    switch (type) {
+        case PDODataType::INT8:
+        case PDODataType::UINT8:  return 1;
+        case PDODataType::INT16:
+        case PDODataType::UINT16: return 2;
+        case PDODataType::INT32:
+        case PDODataType::UINT32:
+        case PDODataType::FLOAT:  return 4;
+        case PDODataType::DOUBLE: return 8;
+    }
+    return 0;
+}
+
+void PDOBulk::decode(PDODataType type, const uint8_t* src, size_t count,
+                     double scale, double* out) {
+    switch (type) {
+        case PDODataType::INT8:   decodeScalar<int8_t>(src, count, scale, out); break;
+        case PDODataType::UINT8:  decodeScalar<uint8_t>(src, count, scale, out); break;
+        case PDODataType::INT16:  decodeScalar<int16_t>(src, count, scale, out); break;
+        case PDODataType::UINT16: decodeScalar<uint16_t>(src, count, scale, out); break;
+        case PDODataType::INT32:  decodeInt32(src, count, scale, out); break;
+        case PDODataType::UINT32: decodeScalar<uint32_t>(src, count, scale, out); break;
+        case PDODataType::FLOAT:  decodeScalar<float>(src, count, scale, out); break;
+        case PDODataType::DOUBLE: decodeDouble(src, count, scale, out); break;
+    }
+}
+
+void PDOBulk::encode(PDODataType type, const double* in, size_t count,
+                     double scale, uint8_t* dst) {
+    switch (type) {
+        case PDODataType::INT8:   encodeScalar<int8_t>(in, count, scale, dst); break;
+        case PDODataType::UINT8:  encodeScalar<uint8_t>(in, count, scale, dst); break;
+        case PDODataType::INT16:  encodeScalar<int16_t>(in, count, scale, dst); break;
+        case PDODataType::UINT16: encodeScalar<uint16_t>(in, count, scale, dst); break;
+        case PDODataType::INT32:  encodeInt32(in, count, scale, dst); break;
+        case PDODataType::UINT32: encodeScalar<uint32_t>(in, count, scale, dst); break;
+        case PDODataType::FLOAT:  encodeScalar<float>(in, count, scale, dst); break;
+        case PDODataType::DOUBLE: encodeDouble(in, count, scale, dst); break;
+    }
+}
+
+void PDOBulk::decodeInt32(const uint8_t* src, size_t count, double scale, double* out) {
+    size_t i = 0;
+
+#if defined(__AVX__)
+    const __m256d s4 = _mm256_set1_pd(scale);
+    for (; i + 4 <= count; i += 4) {
+        __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+        _mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_cvtepi32_pd(raw), s4));
+    }
+#elif defined(__SSE2__)
+    const __m128d s2 = _mm_set1_pd(scale);
+    for (; i + 2 <= count; i += 2) {
+        __m128i raw = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i * 4));
+        _mm_storeu_pd(out + i, _mm_mul_pd(_mm_cvtepi32_pd(raw), s2));
+    }
+#endif
+
+    decodeScalar<int32_t>(src + i * 4, count - i, scale, out + i);
+}
+
+void PDOBulk::encodeInt32(const double* in, size_t count, double scale, uint8_t* dst) {
+    size_t i = 0;
+
+#if defined(__AVX__)
+    const __m256d s4 = _mm256_set1_pd(scale);
+    const __m256d lo4 = _mm256_set1_pd(std::numeric_limits<int32_t>::min());
+    const __m256d hi4 = _mm256_set1_pd(std::numeric_limits<int32_t>::max());
+    for (; i + 4 <= count; i += 4) {
+        __m256d v = _mm256_mul_pd(_mm256_loadu_pd(in + i), s4);
+        v = _mm256_min_pd(_mm256_max_pd(v, lo4), hi4);  // NaN → lo
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), _mm256_cvtpd_epi32(v));
+    }
+#elif defined(__SSE2__)
+    const __m128d s2 = _mm_set1_pd(scale);
+    const __m128d lo2 = _mm_set1_pd(std::numeric_limits<int32_t>::min());
+    const __m128d hi2 = _mm_set1_pd(std::numeric_limits<int32_t>::max());
+    for (; i + 2 <= count; i += 2) {
+        __m128d v = _mm_mul_pd(_mm_loadu_pd(in + i), s2);
+        v = _mm_min_pd(_mm_max_pd(v, lo2), hi2);  // NaN → lo
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i * 4), _mm_cvtpd_epi32(v));
+    }
+#endif
+
+    encodeScalar<int32_t>(in + i, count - i, scale, dst + i * 4);
+}
+
+void PDOBulk::decodeDouble(const uint8_t* src, size_t count, double scale, double* out) {
+    size_t i = 0;
+
+#if defined(__AVX__)
+    const __m256d s4 = _mm256_set1_pd(scale);
+    for (; i + 4 <= count; i += 4) {
+        __m256d v = _mm256_loadu_pd(reinterpret_cast<const double*>(src + i * 8));
+        _mm256_storeu_pd(out + i, _mm256_mul_pd(v, s4));
+    }
+#elif defined(__SSE2__)
+    const __m128d s2 = _mm_set1_pd(scale);
+    for (; i + 2 <= count; i += 2) {
+        __m128d v = _mm_loadu_pd(reinterpret_cast<const double*>(src + i * 8));
+        _mm_storeu_pd(out + i, _mm_mul_pd(v, s2));
+    }
+#endif
+
+    decodeScalar<double>(src + i * 8, count - i, scale, out + i);
+}
+
+void PDOBulk::encodeDouble(const double* in, size_t count, double scale, uint8_t* dst) {
+    size_t i = 0;
+
+#if defined(__AVX__)
+    const __m256d s4 = _mm256_set1_pd(scale);
+    for (; i + 4 <= count; i += 4) {
+        _mm256_storeu_pd(reinterpret_cast<double*>(dst + i * 8),
+                         _mm256_mul_pd(_mm256_loadu_pd(in + i), s4));
+    }
+#elif defined(__SSE2__)
+    const __m128d s2 = _mm_set1_pd(scale);
+    for (; i + 2 <= count; i += 2) {
+        _mm_storeu_pd(reinterpret_cast<double*>(dst + i * 8),
+                      _mm_mul_pd(_mm_loadu_pd(in + i), s2));
+    }
+#endif
+
+    encodeScalar<double>(in + i, count - i, scale, dst + i * 8);
+}
+
+} // namespace ethercat
+} // namespace mxrc
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "../dto/PDOMapping.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace mxrc {
+namespace ethercat {
+
+// 연속된 동일 타입 PDO 채널의 일괄 변환
+// - decode: domain의 raw 값 count개 → double * scale (out[0..count))
+// - encode: double * scale → domain raw 값 count개 (정수 타입은 반올림 + 타입 범위로 포화)
+// INT32/DOUBLE은 SIMD(SSE2, 컴파일러가 AVX를 허용하면 AVX)로 처리하고,
+// 나머지 타입과 남은 원소는 스칼라로 처리
+// src/dst는 정렬되지 않아도 됨 (PDO domain offset은 임의)
+class PDOBulk {
+public:
+    // 타입별 바이트 크기
+    static size_t typeSize(PDODataType type);
+
+    // 타입 분기 일괄 decode/encode
+    static void decode(PDODataType type, const uint8_t* src, size_t count,
+                       double scale, double* out);
+    static void encode(PDODataType type, const double* in, size_t count,
+                       double scale, uint8_t* dst);
+
+    // INT32 (엔코더 카운트 등)
+    static void decodeInt32(const uint8_t* src, size_t count, double scale, double* out);
+    static void encodeInt32(const double* in, size_t count, double scale, uint8_t* dst);
+
+    // DOUBLE
+    static void decodeDouble(const uint8_t* src, size_t count, double scale, double* out);
+    static void encodeDouble(const double* in, size_t count, double scale, uint8_t* dst);
+};
+
+} // namespace ethercat
+} // namespace mxrc
@@ -4,6 +4,7 @@
 #include "DataStoreEventAdapter.h"
 #include "core/action/util/Logger.h"
 #include "dto/SequenceEvents.h"
+#include "util/EventPool.h"
 #include <sstream>
 #include <iomanip>
 
@@ -49,7 +50,7 @@ void DataStoreEventAdapter::onDataChanged(const SharedData& changed_data) {
     std::string valueStr = valueToString(changed_data);
     std::string typeStr = dataTypeToString(changed_data.type);
 
-    auto event = std::make_shared<DataStoreValueChangedEvent>(
+    auto event = EventPool<DataStoreValueChangedEvent>::make(
         changed_data.id,
         "",  // oldValue는 DataStore에서 제공하지 않음
         valueStr,
@@ -63,32 +63,71 @@ bool EventBus::isRunning() const {
     return running_.load(std::memory_order_acquire);
 }
 
+namespace {
+
+/// 현재 스레드에서 활성화된 가장 안쪽 BatchScope
+thread_local EventBus::BatchScope* tlsActiveBatch = nullptr;
+
+/// debug 로그 활성 여부. 비활성이면 로그 인자(getTypeName/getEventId 문자열 생성)를 평가하지 않음
+bool debugEnabled() {
+    return spdlog::should_log(spdlog::level::debug);
+}
+
+} // namespace
+
+PrioritizedEvent EventBus::makePrioritized(const std::shared_ptr<IEvent>& event, uint64_t sequence,
+                                           uint64_t& now_ns) const {
+    // 우선순위, TTL, coalescing 키는 이벤트 자신이 결정합니다 (IEvent / EventTypePolicy)
+    // type 문자열은 채우지 않음: IEvent payload는 getTypeName()으로 필요할 때만 조회
+    PrioritizedEvent prioritized;
+    prioritized.priority = event->getPriority();
+    prioritized.ttl = event->getTtl();
+    prioritized.coalescing_key = event->getCoalescingKey();
+    prioritized.payload = event;  // Store IEvent in variant
+    prioritized.sequence_num = sequence;
+
+    // 순서는 sequence로 결정되므로 시각은 TTL deadline 계산에만 사용
+    if (prioritized.ttl.has_value()) {
+        if (now_ns == 0) {
+            now_ns = monotonicNowNs();
+        }
+        prioritized.timestamp_ns = now_ns;
+    }
+    return prioritized;
+}
+
 bool EventBus::publish(std::shared_ptr<IEvent> event) {
     if (!event) {
         spdlog::warn("Attempted to publish null event");
         return false;
     }
 
-    spdlog::debug("[EventBus] Publishing event: type={}, id={}",
-                  event->getTypeName(), event->getEventId());
+    // 활성 BatchScope가 있으면 스코프 종료 시 한 번에 발행
+    if (tlsActiveBatch && &tlsActiveBatch->bus_ == this) {
+        tlsActiveBatch->pending_.push_back(std::move(event));
+        return true;
+    }
+
+    if (debugEnabled()) {
+        spdlog::debug("[EventBus] Publishing event: type={}, id={}",
+                      event->getTypeName(), event->getEventId());
+    }
 
     // Production readiness: Notify observers before publish
-    notifyBeforePublish(event);
+    if (hasObservers()) {
+        notifyBeforePublish(event);
+    }
 
     // Convert IEvent to PrioritizedEvent
-    // Default priority is NORMAL, but this can be extended to extract priority from event
-    PrioritizedEvent prioritized;
-    prioritized.type = event->getTypeName();
-    prioritized.priority = EventPriority::NORMAL;  // TODO: Extract from event if available
-    prioritized.payload = event;  // Store IEvent in variant
-
-    auto now = std::chrono::system_clock::now();
-    prioritized.timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
-        now.time_since_epoch()).count();
-    prioritized.sequence_num = sequenceCounter_.fetch_add(1, std::memory_order_relaxed);
-
-    spdlog::debug("[EventBus] Created PrioritizedEvent: type={}, priority={}, seq={}",
-                  prioritized.type, static_cast<int>(prioritized.priority), prioritized.sequence_num);
+    uint64_t now_ns = 0;
+    PrioritizedEvent prioritized = makePrioritized(
+        event, sequenceCounter_.fetch_add(1, std::memory_order_relaxed), now_ns);
+
+    if (debugEnabled()) {
+        spdlog::debug("[EventBus] Created PrioritizedEvent: type={}, priority={}, seq={}",
+                      event->getTypeName(), static_cast<int>(prioritized.priority),
+                      prioritized.sequence_num);
+    }
 
     // Mutex로 보호하여 여러 생산자가 안전하게 publish 가능
     std::lock_guard<std::mutex> lock(publishMutex_);
@@ -102,16 +141,90 @@ bool EventBus::publish(std::shared_ptr<IEvent> event) {
         stats_.publishedEvents.fetch_add(1, std::memory_order_relaxed);
     } else {
         stats_.droppedEvents.fetch_add(1, std::memory_order_relaxed);
-        spdlog::warn("Event queue full, dropped event: {} ({})",
+        spdlog::warn("Event queue full, dropped {} event: {} ({})",
+                    priorityToString(event->getPriority()),
                     event->getTypeName(), event->getEventId());
     }
 
     // Production readiness: Notify observers after publish
-    notifyAfterPublish(event, success);
+    if (hasObservers()) {
+        notifyAfterPublish(event, success);
+    }
 
     return success;
 }
 
+size_t EventBus::publishBatch(std::vector<std::shared_ptr<IEvent>> events) {
+    events.erase(std::remove(events.begin(), events.end(), nullptr), events.end());
+    if (events.empty()) {
+        return 0;
+    }
+
+    spdlog::debug("[EventBus] Publishing batch: {} events", events.size());
+
+    // Production readiness: Notify observers once per batch
+    const bool observed = hasObservers();
+    if (observed) {
+        notifyBeforePublishBatch(events);
+    }
+
+    // 배치 전체에 연속된 sequence 범위와 하나의 타임스탬프를 부여
+    // (시계는 TTL 이벤트가 있을 때만 한 번 읽음)
+    const uint64_t firstSeq = sequenceCounter_.fetch_add(events.size(), std::memory_order_relaxed);
+    uint64_t now_ns = 0;
+
+    std::vector<PrioritizedEvent> prioritized;
+    prioritized.reserve(events.size());
+    for (size_t i = 0; i < events.size(); ++i) {
+        prioritized.push_back(makePrioritized(events[i], firstSeq + i, now_ns));
+    }
+
+    std::vector<bool> accepted;
+    size_t acceptedCount = 0;
+    {
+        std::lock_guard<std::mutex> lock(publishMutex_);
+        // 이벤트별 수락 여부는 observer에게만 필요함
+        acceptedCount = eventQueue_->pushBatch(std::move(prioritized),
+                                               observed ? &accepted : nullptr);
+    }
+
+    const size_t droppedCount = events.size() - acceptedCount;
+    stats_.publishedEvents.fetch_add(acceptedCount, std::memory_order_relaxed);
+    if (droppedCount > 0) {
+        stats_.droppedEvents.fetch_add(droppedCount, std::memory_order_relaxed);
+        spdlog::warn("Event queue full, dropped {} of {} events in batch",
+                    droppedCount, events.size());
+    }
+
+    // Production readiness: Notify observers once per batch
+    if (observed) {
+        notifyAfterPublishBatch(events, accepted);
+    }
+
+    return acceptedCount;
+}
+
+EventBus::BatchScope::BatchScope(EventBus& bus)
+    : bus_(bus), previous_(tlsActiveBatch) {
+    tlsActiveBatch = this;
+}
+
+EventBus::BatchScope::~BatchScope() {
+    tlsActiveBatch = previous_;
+    flush();
+}
+
+size_t EventBus::BatchScope::flush() {
+    if (pending_.empty()) {
+        return 0;
+    }
+
+    // 스코프가 활성 상태여도 publishBatch()는 큐로 직접 발행함
+    std::vector<std::shared_ptr<IEvent>> events;
+    events.swap(pending_);
+    return bus_.publishBatch(std::move(events));
+}
+
 SubscriptionId EventBus::subscribe(EventFilter filter, EventCallback callback) {
     if (!callback) {
         spdlog::error("Attempted to subscribe with null callback");
@@ -146,26 +259,17 @@ bool EventBus::unsubscribe(const SubscriptionId& subscriptionId) {
 void EventBus::dispatchLoop() {
     spdlog::info("EventBus dispatch loop started (PriorityQueue mode)");
 
+    std::vector<PrioritizedEvent> batch;
+    batch.reserve(kDispatchBatchSize);
+
     while (running_.load(std::memory_order_acquire)) {
-        // 큐에서 이벤트 꺼내기 (우선순위 순서로)
-        auto prioritized = eventQueue_->pop();
-        if (prioritized.has_value()) {
-            spdlog::debug("[EventBus] Popped event from queue: type={}, priority={}",
-                          prioritized->type, static_cast<int>(prioritized->priority));
-
-            // Extract IEvent from PrioritizedEvent payload
-            try {
-                auto event = std::get<std::shared_ptr<IEvent>>(prioritized->payload);
-                if (event) {
-                    spdlog::debug("[EventBus] Extracted IEvent: type={}, id={}",
-                                  event->getTypeName(), event->getEventId());
-                    dispatchToSubscribers(event);
-                    spdlog::debug("[EventBus] Dispatched event: {}", event->getEventId());
-                } else {
-                    spdlog::error("Null IEvent extracted from PrioritizedEvent");
-                }
-            } catch (const std::bad_variant_access& e) {
-                spdlog::error("Failed to extract IEvent from PrioritizedEvent: {}", e.what());
+        // 큐에서 이벤트 꺼내기 (우선순위 순서로, 한 번의 lock으로 최대 kDispatchBatchSize개)
+        batch.clear();
+        if (eventQueue_->popBatch(batch, kDispatchBatchSize) > 0) {
+            spdlog::debug("[EventBus] Popped {} events from queue", batch.size());
+
+            for (auto& prioritized : batch) {
+                dispatchPrioritized(prioritized);
             }
         } else {
             // 큐가 비어 있으면 짧게 대기
@@ -176,39 +280,54 @@ void EventBus::dispatchLoop() {
     // 종료 시 남은 이벤트 모두 처리
     spdlog::info("Processing remaining events before shutdown...");
     while (auto prioritized = eventQueue_->pop()) {
-        try {
-            auto event = std::get<std::shared_ptr<IEvent>>(prioritized->payload);
-            if (event) {
-                dispatchToSubscribers(event);
-            } else {
-                spdlog::error("Null IEvent extracted from PrioritizedEvent during shutdown");
-            }
-        } catch (const std::bad_variant_access& e) {
-            spdlog::error("Failed to extract IEvent from PrioritizedEvent during shutdown: {}", e.what());
-        }
+        dispatchPrioritized(*prioritized);
     }
 
     spdlog::info("EventBus dispatch loop stopped");
 }
 
+void EventBus::dispatchPrioritized(PrioritizedEvent& prioritized) {
+    // Extract IEvent from PrioritizedEvent payload
+    auto* event = std::get_if<std::shared_ptr<IEvent>>(&prioritized.payload);
+    if (!event) {
+        spdlog::error("Failed to extract IEvent from PrioritizedEvent: seq={}",
+                      prioritized.sequence_num);
+        return;
+    }
+    if (!*event) {
+        spdlog::error("Null IEvent extracted from PrioritizedEvent");
+        return;
+    }
+
+    dispatchToSubscribers(std::move(*event));
+}
+
 void EventBus::dispatchToSubscribers(std::shared_ptr<IEvent> event) {
     if (!event) {
         return;
     }
 
     // Production readiness: Notify observers before dispatch
-    notifyBeforeDispatch(event);
+    if (hasObservers()) {
+        notifyBeforeDispatch(event);
+    }
 
+    const bool debug = debugEnabled();
     auto subscriptions = subscriptionManager_.getAllSubscriptions();
-    spdlog::debug("[EventBus] Dispatching to {} subscribers for event: {}",
-                  subscriptions.size(), event->getEventId());
+    if (debug) {
+        spdlog::debug("[EventBus] Dispatching to {} subscribers for event: {}",
+                      subscriptions.size(), event->getEventId());
+    }
     size_t subscriber_count = 0;
 
     for (const auto& sub : subscriptions) {
         try {
             // 필터 조건 확인
             if (sub.filter(event)) {
-                spdlog::debug("[EventBus] Calling subscriber callback for event: {}", event->getEventId());
+                if (debug) {
+                    spdlog::debug("[EventBus] Calling subscriber callback for event: {}",
+                                  event->getEventId());
+                }
                 sub.callback(event);
                 stats_.processedEvents.fetch_add(1, std::memory_order_relaxed);
                 subscriber_count++;
@@ -224,11 +343,15 @@ void EventBus::dispatchToSubscribers(std::shared_ptr<IEvent> event) {
         }
     }
 
-    spdlog::debug("[EventBus] Dispatched to {} subscribers for event: {}",
-                  subscriber_count, event->getEventId());
+    if (debug) {
+        spdlog::debug("[EventBus] Dispatched to {} subscribers for event: {}",
+                      subscriber_count, event->getEventId());
+    }
 
     // Production readiness: Notify observers after dispatch
-    notifyAfterDispatch(event, subscriber_count);
+    if (hasObservers()) {
+        notifyAfterDispatch(event, subscriber_count);
+    }
 }
 
 // Production readiness: Observer pattern implementation
@@ -240,6 +363,7 @@ void EventBus::registerObserver(std::shared_ptr<IEventObserver> observer) {
 
     std::lock_guard<std::mutex> lock(observerMutex_);
     observers_.push_back(observer);
+    observerCount_.store(observers_.size(), std::memory_order_release);
     spdlog::info("Event observer registered (total: {})", observers_.size());
 }
 
@@ -252,6 +376,7 @@ void EventBus::unregisterObserver(std::shared_ptr<IEventObserver> observer) {
     auto it = std::find(observers_.begin(), observers_.end(), observer);
     if (it != observers_.end()) {
         observers_.erase(it);
+        observerCount_.store(observers_.size(), std::memory_order_release);
         spdlog::info("Event observer unregistered (total: {})", observers_.size());
     }
 }
@@ -282,6 +407,33 @@ void EventBus::notifyAfterPublish(const std::shared_ptr<IEvent>& event, bool suc
     }
 }
 
+void EventBus::notifyBeforePublishBatch(const std::vector<std::shared_ptr<IEvent>>& events) {
+    std::lock_guard<std::mutex> lock(observerMutex_);
+    for (const auto& observer : observers_) {
+        try {
+            observer->onBeforePublishBatch(events);
+        } catch (const std::exception& e) {
+            spdlog::error("Observer exception in onBeforePublishBatch: {}", e.what());
+        } catch (...) {
+            spdlog::error("Unknown observer exception in onBeforePublishBatch");
+        }
+    }
+}
+
+void EventBus::notifyAfterPublishBatch(const std::vector<std::shared_ptr<IEvent>>& events,
+                                       const std::vector<bool>& accepted) {
+    std::lock_guard<std::mutex> lock(observerMutex_);
+    for (const auto& observer : observers_) {
+        try {
+            observer->onAfterPublishBatch(events, accepted);
+        } catch (const std::exception& e) {
+            spdlog::error("Observer exception in onAfterPublishBatch: {}", e.what());
+        } catch (...) {
+            spdlog::error("Unknown observer exception in onAfterPublishBatch");
+        }
+    }
+}
+
 void EventBus::notifyBeforeDispatch(const std::shared_ptr<IEvent>& event) {
     std::lock_guard<std::mutex> lock(observerMutex_);
     for (const auto& observer : observers_) {
@@ -61,6 +61,34 @@ public:
      * @param subscriber_count Number of subscribers that received the event
      */
     virtual void onAfterDispatch(const std::shared_ptr<IEvent>& event, size_t subscriber_count) = 0;
+
+    /**
+     * @brief Called once before a batch is published
+     *
+     * Default implementation forwards to onBeforePublish() for each event.
+     *
+     * @param events Events being published
+     */
+    virtual void onBeforePublishBatch(const std::vector<std::shared_ptr<IEvent>>& events) {
+        for (const auto& event : events) {
+            onBeforePublish(event);
+        }
+    }
+
+    /**
+     * @brief Called once after a batch is published
+     *
+     * Default implementation forwards to onAfterPublish() for each event.
+     *
+     * @param events Events that were published
+     * @param accepted Per-event result (true if queued)
+     */
+    virtual void onAfterPublishBatch(const std::vector<std::shared_ptr<IEvent>>& events,
+                                     const std::vector<bool>& accepted) {
+        for (size_t i = 0; i < events.size(); ++i) {
+            onAfterPublish(events[i], accepted[i]);
+        }
+    }
 };
 
 /**
@@ -95,6 +123,17 @@ public:
 
     // IEventBus 인터페이스 구현
     bool publish(std::shared_ptr<IEvent> event) override;
+
+    /**
+     * @brief 여러 이벤트를 한 번의 큐 연산으로 발행
+     *
+     * 이벤트마다 우선순위/backpressure 정책은 publish()와 동일하게 적용되지만,
+     * mutex 획득, 통계 갱신, observer 알림은 배치당 한 번만 수행됩니다.
+     *
+     * @param events 발행할 이벤트 목록 (null 항목은 무시)
+     * @return 큐에 추가된 이벤트 수
+     */
+    size_t publishBatch(std::vector<std::shared_ptr<IEvent>> events) override;
     SubscriptionId subscribe(EventFilter filter, EventCallback callback) override;
     bool unsubscribe(const SubscriptionId& subscriptionId) override;
     void start() override;
@@ -113,6 +152,15 @@ public:
      */
     void resetStats() { stats_.reset(); }
 
+    /**
+     * @brief 우선순위별 큐 통계 조회
+     *
+     * 우선순위별 push/drop 수, TTL 만료 수, coalescing 수를 제공합니다.
+     *
+     * @return PriorityQueue 메트릭 참조
+     */
+    const PriorityQueueMetrics& getQueueMetrics() const { return eventQueue_->metrics(); }
+
     /**
      * @brief Register event observer for tracing
      *
@@ -129,7 +177,58 @@ public:
      */
     void unregisterObserver(std::shared_ptr<IEventObserver> observer);
 
+    /**
+     * @brief 스코프 기반 배치 발행 컨텍스트
+     *
+     * 생존 기간 동안 같은 스레드에서 이 EventBus로 publish()된 이벤트를 모았다가
+     * 스코프 종료 시 publishBatch()로 한 번에 발행합니다. 이벤트를 직접 만들지 않는
+     * 호출자(예: DataStore 변경 → DataStoreEventAdapter)의 burst를 묶을 때 사용합니다.
+     *
+     * 스코프 안의 publish()는 항상 true를 반환하며, 실제 drop 여부는
+     * flush() 반환값과 EventStats로 확인합니다. 중첩 가능합니다.
+     *
+     * Usage Example:
+     * @code
+     * {
+     *     EventBus::BatchScope batch(*eventBus);
+     *     datastore->set("rt.position_x", x, DataType::RobotMode);
+     *     datastore->set("rt.position_y", y, DataType::RobotMode);
+     * }  // 두 DATASTORE_VALUE_CHANGED 이벤트가 한 배치로 발행됨
+     * @endcode
+     */
+    class BatchScope {
+    public:
+        explicit BatchScope(EventBus& bus);
+        ~BatchScope();
+
+        BatchScope(const BatchScope&) = delete;
+        BatchScope& operator=(const BatchScope&) = delete;
+
+        /**
+         * @brief 모인 이벤트를 즉시 발행
+         *
+         * @return 큐에 추가된 이벤트 수
+         */
+        size_t flush();
+
+        /**
+         * @brief 아직 발행되지 않은 이벤트 수
+         */
+        size_t pending() const { return pending_.size(); }
+
+    private:
+        friend class EventBus;
+
+        EventBus& bus_;
+        BatchScope* previous_;
+        std::vector<std::shared_ptr<IEvent>> pending_;
+    };
+
 private:
+    /// dispatch 스레드가 한 번에 꺼내는 최대 이벤트 수
+    /// (CRITICAL 이벤트가 기다리는 최대 디스패치 수이기도 하므로 작게 유지)
+    static constexpr size_t kDispatchBatchSize = 32;
+
     // Core EventBus members
     std::unique_ptr<PriorityQueue> eventQueue_;
     std::mutex publishMutex_;
@@ -144,14 +243,38 @@ private:
      */
     void dispatchLoop();
 
+    /**
+     * @brief 큐에서 꺼낸 PrioritizedEvent의 IEvent를 구독자들에게 전달
+     */
+    void dispatchPrioritized(PrioritizedEvent& prioritized);
+
     /**
      * @brief 이벤트를 구독자들에게 전달
      */
     void dispatchToSubscribers(std::shared_ptr<IEvent> event);
 
+    /**
+     * @brief IEvent를 큐 저장용 PrioritizedEvent로 변환
+     *
+     * 시각은 TTL이 있는 이벤트에만 필요하므로 그때만 읽습니다.
+     * now_ns가 0이면 시계를 읽어 채우고, 이미 채워져 있으면 재사용합니다 (배치당 1회).
+     */
+    PrioritizedEvent makePrioritized(const std::shared_ptr<IEvent>& event, uint64_t sequence,
+                                     uint64_t& now_ns) const;
+
     // Production readiness: Event observers for tracing
     std::vector<std::shared_ptr<IEventObserver>> observers_;
     std::mutex observerMutex_;  // Protects observers_ vector
+    std::atomic<size_t> observerCount_{0};  // observers_.size() 사본 (notify* fast path용, lock 없이 조회)
+
+    /**
+     * @brief 등록된 observer 존재 여부 (lock 없음)
+     *
+     * observer가 없으면 notify*는 mutex를 잡지 않고 즉시 반환합니다.
+     */
+    bool hasObservers() const {
+        return observerCount_.load(std::memory_order_acquire) != 0;
+    }
 
     /**
      * @brief Notify all observers before publish
@@ -163,6 +286,17 @@ private:
      */
     void notifyAfterPublish(const std::shared_ptr<IEvent>& event, bool success);
 
+    /**
+     * @brief Notify all observers before batch publish
+     */
+    void notifyBeforePublishBatch(const std::vector<std::shared_ptr<IEvent>>& events);
+
+    /**
+     * @brief Notify all observers after batch publish
+     */
+    void notifyAfterPublishBatch(const std::vector<std::shared_ptr<IEvent>>& events,
+                                 const std::vector<bool>& accepted);
+
     /**
      * @brief Notify all observers before dispatch
      */
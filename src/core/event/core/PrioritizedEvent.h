@@ -6,12 +6,25 @@
 #include <chrono>
 #include <memory>
 #include <optional>
+#include <limits>
 
 namespace mxrc::core::event {
 
 // Forward declaration for IEvent
 class IEvent;
 
+/**
+ * @brief Current monotonic time in nanoseconds (steady_clock)
+ *
+ * Time base for PrioritizedEvent::timestamp_ns and TTL expiry.
+ * Unlike system_clock it is unaffected by NTP steps, so a backward step
+ * cannot keep stale events alive and a forward step cannot drop fresh ones.
+ */
+inline uint64_t monotonicNowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
 /**
  * @brief Event priority levels for the priority queue
  *
@@ -104,10 +117,14 @@ struct PrioritizedEvent {
     std::variant<int, double, std::string, std::shared_ptr<IEvent>> payload;
 
     /**
-     * @brief Event timestamp in nanoseconds (since epoch)
+     * @brief Event timestamp in nanoseconds (monotonic, see monotonicNowNs())
+     *
+     * Not a wall-clock time; use IEvent::getTimestamp() for that.
+     * EventBus only reads the clock for events with a TTL (0 otherwise).
      *
      * Used for:
-     * - Event ordering within same priority
+     * - TTL deadline (deadlineNs())
+     * - Ordering tie-break when priority and sequence number are equal
      * - Coalescing window calculations
      * - Throttling interval checks
      */
@@ -116,15 +133,15 @@ struct PrioritizedEvent {
     /**
      * @brief Sequence number for FIFO ordering within same priority
      *
-     * When two events have the same priority and timestamp,
-     * the one with the lower sequence number is processed first.
+     * When two events have the same priority, the one with the lower
+     * sequence number is processed first.
      */
     uint64_t sequence_num{0};
 
     /**
      * @brief Time-To-Live in milliseconds (optional)
      *
-     * If set, the event will be discarded if (current_time - timestamp_ns) > ttl.
+     * If set, the event will be discarded once the monotonic time passes deadlineNs().
      * Used for time-sensitive events that become irrelevant after a certain period.
      * If nullopt, the event never expires.
      *
@@ -144,21 +161,37 @@ struct PrioritizedEvent {
     std::optional<std::string> coalescing_key;
 
     /**
-     * @brief Check if event has expired based on TTL
+     * @brief Monotonic deadline after which the event is expired
      *
-     * @return true if TTL is set and event has expired
+     * @return timestamp_ns + ttl, or UINT64_MAX if no TTL is set
      */
-    bool isExpired() const {
+    uint64_t deadlineNs() const {
         if (!ttl.has_value()) {
-            return false;  // No TTL, never expires
+            return std::numeric_limits<uint64_t>::max();  // No TTL, never expires
         }
+        return timestamp_ns + static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(*ttl).count());
+    }
 
-        auto now = std::chrono::system_clock::now();
-        auto current_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
-            now.time_since_epoch()).count();
+    /**
+     * @brief Check if event has expired against a caller-supplied monotonic time
+     *
+     * Lets the queue read the clock once and check many events against it.
+     *
+     * @param now_ns Current monotonic time (monotonicNowNs())
+     * @return true if TTL is set and event has expired
+     */
+    bool isExpired(uint64_t now_ns) const {
+        return now_ns > deadlineNs();
+    }
 
-        auto age_ms = (current_ns - timestamp_ns) / 1'000'000;
-        return age_ms > static_cast<uint64_t>(ttl->count());
+    /**
+     * @brief Check if event has expired based on TTL
+     *
+     * @return true if TTL is set and event has expired
+     */
+    bool isExpired() const {
+        return ttl.has_value() && isExpired(monotonicNowNs());
     }
 
     /**
@@ -166,8 +199,12 @@ struct PrioritizedEvent {
      *
      * Events are ordered by:
      * 1. Priority (CRITICAL < HIGH < NORMAL < LOW)
-     * 2. Timestamp (older first)
-     * 3. Sequence number (lower first)
+     * 2. Sequence number (lower first, i.e. publish order)
+     * 3. Timestamp (older first)
+     *
+     * Sequence numbers come before timestamps so that events published
+     * without a clock read (timestamp_ns == 0, no TTL) keep FIFO order
+     * relative to stamped events.
      *
      * Note: std::priority_queue is a max-heap, so we use > for min-heap behavior
      */
@@ -177,18 +214,18 @@ struct PrioritizedEvent {
             return priority > other.priority;  // Reversed for max-heap
         }
 
-        // Within same priority, older timestamp comes first
-        if (timestamp_ns != other.timestamp_ns) {
-            return timestamp_ns > other.timestamp_ns;  // Reversed for max-heap
+        // Within same priority, lower sequence number comes first
+        if (sequence_num != other.sequence_num) {
+            return sequence_num > other.sequence_num;  // Reversed for max-heap
         }
 
-        // Within same timestamp, lower sequence number comes first
-        return sequence_num > other.sequence_num;  // Reversed for max-heap
+        // Within same sequence number, older timestamp comes first
+        return timestamp_ns > other.timestamp_ns;  // Reversed for max-heap
     }
 };
 
 /**
- * @brief Helper function to create a prioritized event with current timestamp
+ * @brief Helper function to create a prioritized event with current monotonic timestamp
  *
  * @param type Event type string
  * @param priority Event priority level
@@ -203,15 +240,11 @@ inline PrioritizedEvent makePrioritizedEvent(
     T&& payload,
     uint64_t sequence_num = 0)
 {
-    auto now = std::chrono::system_clock::now();
-    auto timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
-        now.time_since_epoch()).count();
-
     return PrioritizedEvent{
         .type = type,
         .priority = priority,
         .payload = std::forward<T>(payload),
-        .timestamp_ns = static_cast<uint64_t>(timestamp_ns),
+        .timestamp_ns = monotonicNowNs(),
         .sequence_num = sequence_num
     };
 }
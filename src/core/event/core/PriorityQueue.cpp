@@ -11,37 +11,63 @@ PriorityQueue::PriorityQueue(size_t capacity)
 }
 
 bool PriorityQueue::push(PrioritizedEvent&& event) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pushLocked(std::move(event));
+}
+
+size_t PriorityQueue::pushBatch(std::vector<PrioritizedEvent>&& events,
+                                std::vector<bool>* accepted) {
+    if (accepted) {
+        accepted->assign(events.size(), false);
+    }
+
+    size_t acceptedCount = 0;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < events.size(); ++i) {
+        if (pushLocked(std::move(events[i]))) {
+            acceptedCount++;
+            if (accepted) {
+                (*accepted)[i] = true;
+            }
+        }
+    }
+    return acceptedCount;
+}
+
+bool PriorityQueue::pushLocked(PrioritizedEvent&& event) {
     EventPriority priority = event.priority;
 
     // Check if event should be dropped based on backpressure policy
     if (shouldDrop(priority)) {
-        updatePushMetrics(priority, true);
-        return false;  // Event dropped
+        // Reclaim slots held by expired events before dropping a fresh one
+        bool reclaimed = earliest_deadline_ns_ != std::numeric_limits<uint64_t>::max() &&
+                         discardExpiredLocked(monotonicNowNs()) > 0;
+        if (!reclaimed || shouldDrop(priority)) {
+            updatePushMetrics(priority, true);
+            return false;  // Event dropped
+        }
     }
 
-    // Lock and push event
-    {
-        std::lock_guard<std::mutex> lock(mutex_);
+    // Feature 019 - US3: Coalescing policy
+    // If event has a coalescing_key, track it for later deduplication
+    if (event.coalescing_key.has_value()) {
+        const std::string& key = event.coalescing_key.value();
 
-        // Feature 019 - US3: Coalescing policy
-        // If event has a coalescing_key, track it for later deduplication
-        if (event.coalescing_key.has_value()) {
-            const std::string& key = event.coalescing_key.value();
-
-            // Update the latest sequence number for this coalescing key
-            // Events with older sequence numbers will be skipped during pop()
-            auto it = coalescing_latest_seq_.find(key);
-            if (it != coalescing_latest_seq_.end()) {
-                // There's already an event with this key in the queue
-                // The old one will be coalesced (skipped) when popped
-                metrics_.events_coalesced.fetch_add(1, std::memory_order_relaxed);
-            }
-            coalescing_latest_seq_[key] = event.sequence_num;
+        // Update the latest sequence number for this coalescing key
+        // Events with older sequence numbers will be skipped during pop()
+        auto it = coalescing_latest_seq_.find(key);
+        if (it != coalescing_latest_seq_.end()) {
+            // There's already an event with this key in the queue
+            // The old one will be coalesced (skipped) when popped
+            metrics_.events_coalesced.fetch_add(1, std::memory_order_relaxed);
         }
-
-        queue_.push(std::move(event));
+        coalescing_latest_seq_[key] = event.sequence_num;
     }
 
+    earliest_deadline_ns_ = std::min(earliest_deadline_ns_, event.deadlineNs());
+    heap_.push_back(std::move(event));
+    std::push_heap(heap_.begin(), heap_.end());
+
     // Update metrics
     size_t new_size = size_.fetch_add(1, std::memory_order_relaxed) + 1;
     metrics_.current_size.store(new_size, std::memory_order_relaxed);
@@ -62,21 +88,95 @@ bool PriorityQueue::push(PrioritizedEvent&& event) {
 }
 
 std::optional<PrioritizedEvent> PriorityQueue::pop() {
+    const uint64_t now_ns = monotonicNowNs();
     std::lock_guard<std::mutex> lock(mutex_);
+    return popLocked(now_ns);
+}
+
+size_t PriorityQueue::popBatch(std::vector<PrioritizedEvent>& out, size_t maxEvents) {
+    // One clock read for the whole batch
+    const uint64_t now_ns = monotonicNowNs();
+    size_t popped = 0;
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Under backlog, shed stale events in one pass instead of one heap pop each
+    if (size_.load(std::memory_order_relaxed) >= drop_threshold_80_) {
+        discardExpiredLocked(now_ns);
+    }
+
+    while (popped < maxEvents) {
+        auto event = popLocked(now_ns);
+        if (!event.has_value()) {
+            break;
+        }
+        out.push_back(std::move(*event));
+        popped++;
+    }
+    return popped;
+}
+
+size_t PriorityQueue::discardExpired() {
+    const uint64_t now_ns = monotonicNowNs();
+    std::lock_guard<std::mutex> lock(mutex_);
+    return discardExpiredLocked(now_ns);
+}
+
+size_t PriorityQueue::discardExpiredLocked(uint64_t now_ns) {
+    if (now_ns <= earliest_deadline_ns_) {
+        return 0;  // Nothing can have expired yet
+    }
+
+    uint64_t earliest = std::numeric_limits<uint64_t>::max();
+    auto first_expired = std::remove_if(heap_.begin(), heap_.end(),
+        [&](const PrioritizedEvent& event) {
+            if (event.isExpired(now_ns)) {
+                forgetCoalescingKeyLocked(event);
+                return true;
+            }
+            earliest = std::min(earliest, event.deadlineNs());
+            return false;
+        });
+
+    size_t removed = static_cast<size_t>(std::distance(first_expired, heap_.end()));
+    heap_.erase(first_expired, heap_.end());
+    earliest_deadline_ns_ = earliest;
+
+    if (removed > 0) {
+        std::make_heap(heap_.begin(), heap_.end());
+        size_t new_size = size_.fetch_sub(removed, std::memory_order_relaxed) - removed;
+        metrics_.current_size.store(new_size, std::memory_order_relaxed);
+        metrics_.events_expired.fetch_add(removed, std::memory_order_relaxed);
+    }
+    return removed;
+}
+
+void PriorityQueue::forgetCoalescingKeyLocked(const PrioritizedEvent& event) {
+    if (!event.coalescing_key.has_value()) {
+        return;
+    }
+    // Only the latest event owns the entry; older ones were already superseded
+    auto it = coalescing_latest_seq_.find(event.coalescing_key.value());
+    if (it != coalescing_latest_seq_.end() && it->second == event.sequence_num) {
+        coalescing_latest_seq_.erase(it);
+    }
+}
 
+std::optional<PrioritizedEvent> PriorityQueue::popLocked(uint64_t now_ns) {
     // Feature 019 - US3: TTL expiration + Coalescing - skip expired/coalesced events
-    while (!queue_.empty()) {
+    while (!heap_.empty()) {
         // Extract top event (highest priority)
-        PrioritizedEvent event = std::move(const_cast<PrioritizedEvent&>(queue_.top()));
-        queue_.pop();
+        std::pop_heap(heap_.begin(), heap_.end());
+        PrioritizedEvent event = std::move(heap_.back());
+        heap_.pop_back();
 
         // Update size for this pop
         size_t new_size = size_.fetch_sub(1, std::memory_order_relaxed) - 1;
         metrics_.current_size.store(new_size, std::memory_order_relaxed);
 
         // Check if event has expired (TTL)
-        if (event.isExpired()) {
+        if (event.isExpired(now_ns)) {
             // Event expired, skip it and increment expired counter
+            forgetCoalescingKeyLocked(event);
             metrics_.events_expired.fetch_add(1, std::memory_order_relaxed);
             continue;  // Try next event
         }
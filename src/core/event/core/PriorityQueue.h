@@ -1,12 +1,12 @@
 #pragma once
 
 #include "PrioritizedEvent.h"
-#include <queue>
 #include <mutex>
 #include <atomic>
 #include <optional>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace mxrc::core::event {
 
@@ -47,6 +47,12 @@ struct PriorityQueueMetrics {
  * - Queue 90-100% (3686-4096): Drop LOW and NORMAL events
  * - Queue 100%: Drop LOW, NORMAL, and HIGH events (CRITICAL never dropped)
  *
+ * TTL Expiry:
+ * - Deadlines are monotonic (PrioritizedEvent::deadlineNs()), checked against one
+ *   clock read per pop()/popBatch() call rather than per event
+ * - Under backlog (>= 80%), popBatch() first sheds all expired events in a single
+ *   O(n) pass, and a push that would be dropped first reclaims expired slots
+ *
  * Usage Example:
  * @code
  * PriorityQueue queue(4096);
@@ -107,6 +113,42 @@ public:
      */
     std::optional<PrioritizedEvent> pop();
 
+    /**
+     * @brief Push multiple events under a single lock acquisition
+     *
+     * Each event is subject to the same backpressure and coalescing rules as push().
+     * Events are evaluated in order, so the queue fill level seen by later events
+     * includes the earlier events of the same batch.
+     *
+     * @param events Events to push (moved from)
+     * @param accepted Optional per-event result (true if queued), resized to events.size()
+     * @return Number of events accepted
+     */
+    size_t pushBatch(std::vector<PrioritizedEvent>&& events,
+                     std::vector<bool>* accepted = nullptr);
+
+    /**
+     * @brief Pop up to maxEvents events under a single lock acquisition
+     *
+     * Events are appended to out in the same order successive pop() calls
+     * would return them.
+     *
+     * @param out Destination vector (appended)
+     * @param maxEvents Maximum number of events to pop
+     * @return Number of events popped
+     */
+    size_t popBatch(std::vector<PrioritizedEvent>& out, size_t maxEvents);
+
+    /**
+     * @brief Remove all expired events in one pass
+     *
+     * Cheaper than skipping expired events one heap pop at a time when many
+     * have gone stale. Returns immediately if no queued event can have expired yet.
+     *
+     * @return Number of events discarded (counted in events_expired)
+     */
+    size_t discardExpired();
+
     /**
      * @brief Get current queue size
      *
@@ -116,6 +158,16 @@ public:
         return size_.load(std::memory_order_relaxed);
     }
 
+    /**
+     * @brief Get number of coalescing keys currently tracked
+     *
+     * @return Distinct coalescing keys with a queued latest event
+     */
+    size_t coalescingKeyCount() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return coalescing_latest_seq_.size();
+    }
+
     /**
      * @brief Check if queue is empty
      *
@@ -163,6 +215,32 @@ public:
     }
 
 private:
+    /**
+     * @brief push() body; caller must hold mutex_
+     */
+    bool pushLocked(PrioritizedEvent&& event);
+
+    /**
+     * @brief pop() body; caller must hold mutex_
+     *
+     * @param now_ns Monotonic time used for TTL checks
+     */
+    std::optional<PrioritizedEvent> popLocked(uint64_t now_ns);
+
+    /**
+     * @brief discardExpired() body; caller must hold mutex_
+     *
+     * @param now_ns Monotonic time used for TTL checks
+     */
+    size_t discardExpiredLocked(uint64_t now_ns);
+
+    /**
+     * @brief Drop the coalescing entry if event is the latest for its key; caller must hold mutex_
+     *
+     * Used when an event leaves the queue without being popped (TTL expiry).
+     */
+    void forgetCoalescingKeyLocked(const PrioritizedEvent& event);
+
     /**
      * @brief Check if event should be dropped based on backpressure policy
      *
@@ -185,10 +263,16 @@ private:
     const size_t drop_threshold_90_;            ///< 90% threshold (drop NORMAL)
 
     // Thread-safe priority queue
-    std::priority_queue<PrioritizedEvent> queue_;  ///< Internal priority queue
+    // Binary max-heap (std::push_heap/pop_heap with PrioritizedEvent::operator<);
+    // a plain vector so expired events can be removed in bulk
+    std::vector<PrioritizedEvent> heap_;           ///< Internal priority heap
     mutable std::mutex mutex_;                     ///< Protects queue access
     std::atomic<size_t> size_{0};                  ///< Current queue size
 
+    // Lower bound of the earliest TTL deadline in the heap (UINT64_MAX: no TTL events).
+    // Skips the bulk expiry pass while nothing can have expired.
+    uint64_t earliest_deadline_ns_{std::numeric_limits<uint64_t>::max()};
+
     // Feature 019 - US3: Coalescing support
     // Maps coalescing_key -> latest sequence_number
     // When popping, events with older sequence numbers for the same key are skipped
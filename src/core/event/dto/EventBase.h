@@ -6,12 +6,12 @@
 #define MXRC_CORE_EVENT_DTO_EVENTBASE_H
 
 #include "EventType.h"
+#include "EventTypePolicy.h"
 #include "interfaces/IEvent.h"
+#include "util/EventIdGenerator.h"
 #include <string>
 #include <chrono>
-#include <random>
-#include <sstream>
-#include <iomanip>
+#include <cstdint>
 
 namespace mxrc::core::event {
 
@@ -23,38 +23,11 @@ namespace mxrc::core::event {
  */
 class EventBase : public IEvent {
 protected:
-    std::string eventId_;                         ///< 고유 이벤트 ID
+    uint64_t eventId_;                            ///< 고유 이벤트 ID (EventIdGenerator)
     EventType type_;                              ///< 이벤트 타입
     std::chrono::system_clock::time_point timestamp_; ///< 이벤트 발생 시각
     std::string targetId_;                        ///< 대상 엔티티 ID
 
-    /**
-     * @brief 고유한 이벤트 ID 생성
-     *
-     * 간단한 UUID 스타일 문자열을 생성합니다 (타임스탬프 + 랜덤).
-     *
-     * @return 생성된 고유 ID
-     */
-    static std::string generateEventId() {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        static std::uniform_int_distribution<> dis(0, 15);
-
-        std::stringstream ss;
-        auto now = std::chrono::system_clock::now();
-        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-            now.time_since_epoch()).count();
-
-        ss << "evt_" << ms << "_";
-
-        // 랜덤 16진수 추가
-        for (int i = 0; i < 8; ++i) {
-            ss << std::hex << dis(gen);
-        }
-
-        return ss.str();
-    }
-
 public:
     /**
      * @brief EventBase 생성자
@@ -65,7 +38,7 @@ public:
      */
     EventBase(EventType type, std::string targetId,
               std::chrono::system_clock::time_point timestamp = std::chrono::system_clock::now())
-        : eventId_(generateEventId()),
+        : eventId_(EventIdGenerator::next()),
           type_(type),
           timestamp_(timestamp),
           targetId_(std::move(targetId)) {}
@@ -74,6 +47,13 @@ public:
 
     // IEvent 인터페이스 구현
     std::string getEventId() const override {
+        return EventIdGenerator::toString(eventId_);
+    }
+
+    /**
+     * @brief 64비트 이벤트 ID 반환 (문자열 변환 없음)
+     */
+    uint64_t getNumericId() const {
         return eventId_;
     }
 
@@ -92,6 +72,32 @@ public:
     std::string getTypeName() const override {
         return eventTypeToString(type_);
     }
+
+    /**
+     * @brief 이벤트 타입의 기본 우선순위 반환 (EventTypePolicy 참조)
+     */
+    EventPriority getPriority() const override {
+        return defaultPolicyOf(type_).priority;
+    }
+
+    /**
+     * @brief 이벤트 타입의 기본 TTL 반환 (EventTypePolicy 참조)
+     */
+    std::optional<std::chrono::milliseconds> getTtl() const override {
+        return defaultPolicyOf(type_).ttl;
+    }
+
+    /**
+     * @brief Coalescing 키 반환
+     *
+     * 병합 대상 타입이면 "<타입명>:<targetId>" 형식의 키를 반환합니다.
+     */
+    std::optional<std::string> getCoalescingKey() const override {
+        if (!defaultPolicyOf(type_).coalescing) {
+            return std::nullopt;
+        }
+        return getTypeName() + ":" + targetId_;
+    }
 };
 
 } // namespace mxrc::core::event
@@ -0,0 +1,72 @@
+// EventTypePolicy.h - 이벤트 타입별 기본 큐잉 정책
+// Copyright (C) 2025 MXRC Project
+// EventType마다 우선순위, TTL, coalescing 여부의 기본값을 정의
+
+#ifndef MXRC_CORE_EVENT_DTO_EVENTTYPEPOLICY_H
+#define MXRC_CORE_EVENT_DTO_EVENTTYPEPOLICY_H
+
+#include "EventType.h"
+#include "../core/PrioritizedEvent.h"
+#include <chrono>
+#include <optional>
+
+namespace mxrc::core::event {
+
+/**
+ * @brief 이벤트 타입별 기본 큐잉 정책
+ *
+ * 값은 config/ipc/ipc-schema.yaml의 eventbus_events 정의를 따르되,
+ * backpressure 상황에서 안전 관련 이벤트가 먼저 살아남도록 조정했습니다.
+ * - RT SAFE_MODE 전이: CRITICAL (절대 drop되지 않음)
+ * - RT 상태 변경, Alarm: HIGH
+ * - Action/Sequence/Task 라이프사이클: NORMAL (순서 보존을 위해 같은 레벨)
+ * - DataStore 변경, 진행률 업데이트: LOW (80%에서 가장 먼저 drop)
+ */
+struct EventTypePolicy {
+    EventPriority priority{EventPriority::NORMAL};        ///< 기본 우선순위
+    std::optional<std::chrono::milliseconds> ttl;         ///< 기본 TTL (nullopt: 만료 없음)
+    bool coalescing{false};                               ///< targetId 단위 병합 여부
+};
+
+/**
+ * @brief EventType의 기본 큐잉 정책 조회
+ *
+ * @param type 이벤트 타입
+ * @return 해당 타입의 기본 정책
+ */
+inline EventTypePolicy defaultPolicyOf(EventType type) {
+    using std::chrono::milliseconds;
+
+    switch (type) {
+        // RT Events
+        case EventType::RT_SAFE_MODE_ENTERED:
+        case EventType::RT_SAFE_MODE_EXITED:
+            return {EventPriority::CRITICAL, std::nullopt, false};
+        case EventType::RT_STATE_CHANGED:
+            return {EventPriority::HIGH, milliseconds(10000), false};
+
+        // Alarm Events
+        case EventType::ALARM_RAISED:
+        case EventType::ALARM_ESCALATED:
+        case EventType::ALARM_CLEARED:
+        case EventType::ALARM_ACKNOWLEDGED:
+            return {EventPriority::HIGH, std::nullopt, false};
+
+        // DataStore Events
+        case EventType::DATASTORE_VALUE_CHANGED:
+        case EventType::DATASTORE_VALUE_REMOVED:
+            return {EventPriority::LOW, milliseconds(5000), false};
+
+        // Progress Events (최신 값만 의미가 있음)
+        case EventType::SEQUENCE_PROGRESS_UPDATED:
+        case EventType::TASK_PROGRESS_UPDATED:
+            return {EventPriority::LOW, milliseconds(1000), true};
+
+        default:
+            return {};
+    }
+}
+
+} // namespace mxrc::core::event
+
+#endif // MXRC_CORE_EVENT_DTO_EVENTTYPEPOLICY_H
@@ -5,8 +5,10 @@
 #ifndef MXRC_CORE_EVENT_INTERFACES_IEVENT_H
 #define MXRC_CORE_EVENT_INTERFACES_IEVENT_H
 
+#include "../core/PrioritizedEvent.h"
 #include <string>
 #include <chrono>
+#include <optional>
 
 namespace mxrc::core::event {
 
@@ -56,6 +58,39 @@ public:
      * @return 이벤트 타입의 문자열 표현 (로깅 및 디버깅용)
      */
     virtual std::string getTypeName() const = 0;
+
+    /**
+     * @brief 이벤트 우선순위 반환
+     *
+     * EventBus는 이 값으로 PriorityQueue 처리 순서와 backpressure drop 정책을 결정합니다.
+     *
+     * @return 이벤트 우선순위 (기본값: NORMAL)
+     */
+    virtual EventPriority getPriority() const {
+        return EventPriority::NORMAL;
+    }
+
+    /**
+     * @brief 이벤트 유효 시간 반환
+     *
+     * 큐에서 대기한 시간이 TTL을 초과하면 디스패치되지 않고 폐기됩니다.
+     *
+     * @return TTL (std::nullopt이면 만료되지 않음)
+     */
+    virtual std::optional<std::chrono::milliseconds> getTtl() const {
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Coalescing 키 반환
+     *
+     * 같은 키를 가진 이벤트가 큐에 여러 개 있으면 가장 최근 이벤트만 디스패치됩니다.
+     *
+     * @return Coalescing 키 (std::nullopt이면 병합하지 않음)
+     */
+    virtual std::optional<std::string> getCoalescingKey() const {
+        return std::nullopt;
+    }
 };
 
 } // namespace mxrc::core::event
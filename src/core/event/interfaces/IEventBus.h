@@ -8,6 +8,7 @@
 #include "IEvent.h"
 #include <memory>
 #include <functional>
+#include <vector>
 
 namespace mxrc::core::event {
 
@@ -57,6 +58,25 @@ public:
      */
     virtual bool publish(std::shared_ptr<IEvent> event) = 0;
 
+    /**
+     * @brief 여러 이벤트를 한 번에 비동기 발행
+     *
+     * 연관된 이벤트 묶음(burst)을 한 번의 큐 연산으로 발행합니다.
+     * 기본 구현은 publish()를 순서대로 호출합니다.
+     *
+     * @param events 발행할 이벤트 목록 (null 항목은 무시)
+     * @return 큐에 추가된 이벤트 수
+     */
+    virtual size_t publishBatch(std::vector<std::shared_ptr<IEvent>> events) {
+        size_t accepted = 0;
+        for (auto& event : events) {
+            if (event && publish(std::move(event))) {
+                accepted++;
+            }
+        }
+        return accepted;
+    }
+
     /**
      * @brief 이벤트 구독 등록
      *
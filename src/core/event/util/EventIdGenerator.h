@@ -0,0 +1,71 @@
+// EventIdGenerator.h - 64비트 이벤트 ID 생성기
+// Copyright (C) 2025 MXRC Project
+// 프로세스 epoch + atomic 카운터 기반의 할당 없는 이벤트 ID 생성
+
+#ifndef MXRC_CORE_EVENT_UTIL_EVENTIDGENERATOR_H
+#define MXRC_CORE_EVENT_UTIL_EVENTIDGENERATOR_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace mxrc::core::event {
+
+/**
+ * @brief 64비트 이벤트 ID 생성기
+ *
+ * ID 구성:
+ * - 상위 24비트: 프로세스 epoch (프로세스 시작 시각, 초 단위 하위 24비트)
+ * - 하위 40비트: 프로세스 내 단조 증가 카운터
+ *
+ * 이벤트당 비용은 relaxed fetch_add 한 번이며, 문자열/난수 생성이 없습니다.
+ * 같은 프로세스 안에서는 항상 유일하고, 재시작된 프로세스와는 epoch로 구분됩니다.
+ */
+class EventIdGenerator {
+public:
+    static constexpr int kCounterBits = 40;
+    static constexpr uint64_t kCounterMask = (uint64_t{1} << kCounterBits) - 1;
+
+    /**
+     * @brief 다음 이벤트 ID 발급
+     *
+     * @return 64비트 이벤트 ID (0은 발급되지 않음)
+     */
+    static uint64_t next() {
+        static std::atomic<uint64_t> counter{1};
+        uint64_t seq = counter.fetch_add(1, std::memory_order_relaxed) & kCounterMask;
+        return (processEpoch() << kCounterBits) | seq;
+    }
+
+    /**
+     * @brief 현재 프로세스의 epoch 값
+     *
+     * @return 프로세스 시작 시각 (초)의 하위 24비트
+     */
+    static uint64_t processEpoch() {
+        static const uint64_t epoch = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::seconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count()) &
+            ((uint64_t{1} << (64 - kCounterBits)) - 1);
+        return epoch;
+    }
+
+    /**
+     * @brief 이벤트 ID를 로그/트레이싱용 문자열로 변환
+     *
+     * @param id 이벤트 ID
+     * @return "evt_<16자리 hex>" 형식 문자열
+     */
+    static std::string toString(uint64_t id) {
+        char buf[24];
+        std::snprintf(buf, sizeof(buf), "evt_%016llx",
+                      static_cast<unsigned long long>(id));
+        return std::string(buf);
+    }
+};
+
+} // namespace mxrc::core::event
+
+#endif // MXRC_CORE_EVENT_UTIL_EVENTIDGENERATOR_H
@@ -0,0 +1,176 @@
+// EventPool.h - 이벤트 객체 풀
+// Copyright (C) 2025 MXRC Project
+// 고빈도 이벤트 타입의 shared_ptr 할당을 고정 크기 블록 풀에서 재사용
+
+#ifndef MXRC_CORE_EVENT_UTIL_EVENTPOOL_H
+#define MXRC_CORE_EVENT_UTIL_EVENTPOOL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace mxrc::core::event {
+
+/**
+ * @brief 고정 크기 블록 풀
+ *
+ * 같은 크기/정렬의 블록을 slab 단위(kSlabBlocks)로 한 번에 할당하고,
+ * 해제된 블록은 재사용합니다.
+ * 각 스레드는 최대 kLocalBlocks개의 블록을 thread-local free list에 두고
+ * lock 없이 할당/해제합니다. 로컬 목록이 비거나 가득 찰 때만
+ * kTransferBlocks개씩 공유 free list(mutex)와 주고받습니다.
+ * 이벤트는 생산자 스레드에서 생성되어 dispatch 스레드에서 해제되므로
+ * 블록은 묶음 단위로 dispatch 스레드 → 공유 목록 → 생산자 스레드로 순환합니다.
+ *
+ * 인스턴스는 프로세스 종료 시까지 유지됩니다 (정적 소멸 순서 문제 방지).
+ * 스레드 종료 시 로컬 블록은 공유 목록으로 반환됩니다.
+ */
+template <std::size_t BlockSize, std::size_t BlockAlign>
+class FixedBlockPool {
+public:
+    static constexpr std::size_t kSlabBlocks = 64;
+    static constexpr std::size_t kLocalBlocks = 64;
+    static constexpr std::size_t kTransferBlocks = kLocalBlocks / 2;
+
+    static FixedBlockPool& instance() {
+        static FixedBlockPool* pool = new FixedBlockPool();
+        return *pool;
+    }
+
+    void* allocate() {
+        LocalCache& cache = localCache();
+        if (cache.count == 0) {
+            acquireShared(cache);
+        }
+        return cache.blocks[--cache.count];
+    }
+
+    void deallocate(void* block) {
+        LocalCache& cache = localCache();
+        if (cache.count == kLocalBlocks) {
+            releaseShared(cache, kTransferBlocks);
+        }
+        cache.blocks[cache.count++] = block;
+    }
+
+private:
+    static constexpr std::size_t kStride =
+        (BlockSize + BlockAlign - 1) / BlockAlign * BlockAlign;
+
+    // 스레드별 free list (lock 없음)
+    struct LocalCache {
+        void* blocks[kLocalBlocks];
+        std::size_t count = 0;
+
+        ~LocalCache() {
+            if (count > 0) {
+                FixedBlockPool::instance().releaseShared(*this, count);
+            }
+        }
+    };
+
+    FixedBlockPool() = default;
+
+    static LocalCache& localCache() {
+        static thread_local LocalCache cache;
+        return cache;
+    }
+
+    // 공유 목록에서 kTransferBlocks개를 로컬로 이동 (부족하면 slab 추가)
+    void acquireShared(LocalCache& cache) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (freeList_.size() < kTransferBlocks) {
+            refill();
+        }
+        for (std::size_t i = 0; i < kTransferBlocks; ++i) {
+            cache.blocks[cache.count++] = freeList_.back();
+            freeList_.pop_back();
+        }
+    }
+
+    // 로컬 목록 앞쪽(오래된 블록) count개를 공유 목록으로 반환
+    void releaseShared(LocalCache& cache, std::size_t count) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            freeList_.insert(freeList_.end(), cache.blocks, cache.blocks + count);
+        }
+        std::copy(cache.blocks + count, cache.blocks + cache.count, cache.blocks);
+        cache.count -= count;
+    }
+
+    void refill() {
+        auto* slab = static_cast<std::byte*>(
+            ::operator new(kStride * kSlabBlocks, std::align_val_t{BlockAlign}));
+        freeList_.reserve(freeList_.size() + kSlabBlocks);
+        for (std::size_t i = kSlabBlocks; i > 0; --i) {
+            freeList_.push_back(slab + (i - 1) * kStride);
+        }
+    }
+
+    std::mutex mutex_;
+    std::vector<void*> freeList_;
+};
+
+/**
+ * @brief FixedBlockPool 기반 STL 할당자
+ *
+ * std::allocate_shared가 제어 블록과 이벤트 객체를 한 블록에 배치하므로
+ * 이벤트당 할당은 풀에서 블록 하나를 꺼내는 비용으로 줄어듭니다.
+ */
+template <typename T>
+struct EventPoolAllocator {
+    using value_type = T;
+
+    EventPoolAllocator() noexcept = default;
+    template <typename U>
+    EventPoolAllocator(const EventPoolAllocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        if (n != 1) {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{alignof(T)}));
+        }
+        return static_cast<T*>(FixedBlockPool<sizeof(T), alignof(T)>::instance().allocate());
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+        if (n != 1) {
+            ::operator delete(p, std::align_val_t{alignof(T)});
+            return;
+        }
+        FixedBlockPool<sizeof(T), alignof(T)>::instance().deallocate(p);
+    }
+
+    template <typename U>
+    bool operator==(const EventPoolAllocator<U>&) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const EventPoolAllocator<U>&) const noexcept { return false; }
+};
+
+/**
+ * @brief 이벤트 타입별 객체 풀
+ *
+ * std::make_shared 대신 사용하면 이벤트 객체가 풀 블록에 생성되고,
+ * 마지막 shared_ptr가 해제될 때 블록이 풀로 반환됩니다.
+ *
+ * Usage Example:
+ * @code
+ * auto event = EventPool<DataStoreValueChangedEvent>::make(key, "", value, type, "datastore");
+ * eventBus->publish(event);
+ * @endcode
+ */
+template <typename EventT>
+class EventPool {
+public:
+    template <typename... Args>
+    static std::shared_ptr<EventT> make(Args&&... args) {
+        return std::allocate_shared<EventT>(EventPoolAllocator<EventT>{},
+                                            std::forward<Args>(args)...);
+    }
+};
+
+} // namespace mxrc::core::event
+
+#endif // MXRC_CORE_EVENT_UTIL_EVENTPOOL_H
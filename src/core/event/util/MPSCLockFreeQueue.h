@@ -9,6 +9,7 @@
 #include <atomic>
 #include <cstddef>
 #include <memory>
+#include <utility>
 
 namespace mxrc::core::event {
 
@@ -24,8 +25,11 @@ namespace mxrc::core::event {
  * - size: 여러 스레드에서 호출 가능 (근사값 반환)
  *
  * **메모리 순서**:
- * - push: CAS를 통한 원자적 쓰기 위치 업데이트
- * - pop: acquire semantics (writePos 읽기 시)
+ * - push: CAS로 슬롯 예약 후 데이터 기록, 슬롯 sequence를 release로 게시
+ * - pop: 슬롯 sequence를 acquire로 확인 (게시 전 슬롯은 읽지 않음)
+ *
+ * 슬롯별 sequence 번호(Vyukov bounded queue)로 예약과 게시를 분리하므로,
+ * 소비자가 생산자가 아직 기록 중인 슬롯을 읽는 일이 없습니다.
  *
  * **성능 특성**:
  * - Lock-free: 생산자들이 락 없이 동시 작업 가능
@@ -48,10 +52,42 @@ private:
         AlignedAtomic(size_t v) : value(v) {}
     };
 
-    std::vector<T> buffer_;              ///< Ring buffer
-    AlignedAtomic writePos_;             ///< 쓰기 위치 (여러 producer가 CAS로 업데이트)
-    AlignedAtomic readPos_;              ///< 읽기 위치 (consumer만 업데이트)
+    // 슬롯: sequence == pos 이면 pos 위치에 쓰기 가능, pos + 1 이면 읽기 가능
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
     size_t capacity_;                    ///< 버퍼 용량
+    std::unique_ptr<Cell[]> buffer_;     ///< Ring buffer
+    AlignedAtomic writePos_;             ///< 다음 예약 위치 (여러 producer가 CAS로 업데이트)
+    AlignedAtomic readPos_;              ///< 다음 읽기 위치 (consumer만 업데이트)
+
+    template<typename Fill>
+    bool pushImpl(Fill&& fill) {
+        size_t pos = writePos_.value.load(std::memory_order_relaxed);
+
+        while (true) {
+            Cell& cell = buffer_[pos % capacity_];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+
+            if (diff == 0) {
+                // CAS로 쓰기 위치 예약 시도 (실패 시 pos가 최신 값으로 갱신됨)
+                if (writePos_.value.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    fill(cell.data);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // Queue full (소비자가 아직 비우지 않은 슬롯)
+            } else {
+                // 다른 생산자가 먼저 예약했음, 재시도
+                pos = writePos_.value.load(std::memory_order_relaxed);
+            }
+        }
+    }
 
 public:
     /**
@@ -60,10 +96,14 @@ public:
      * @param capacity 큐의 최대 용량 (기본값: 10,000)
      */
     explicit MPSCLockFreeQueue(size_t capacity = 10000)
-        : buffer_(capacity),
+        : capacity_(capacity > 0 ? capacity : 1),
+          buffer_(new Cell[capacity_]),
           writePos_(0),
-          readPos_(0),
-          capacity_(capacity) {}
+          readPos_(0) {
+        for (size_t i = 0; i < capacity_; i++) {
+            buffer_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
 
     /**
      * @brief 큐에 요소 추가 (multi-producer 안전)
@@ -71,94 +111,75 @@ public:
      * 큐가 가득 찬 경우 false를 반환하고 요소를 추가하지 않습니다.
      * 여러 스레드가 동시에 호출해도 안전합니다.
      *
-     * **주의**: CAS 재시도로 인해 최악의 경우 성능 저하 가능
-     *
      * @param item 추가할 요소
-     * @return true이면 성공, false이면 큐가 가득 찼거나 경쟁 실패
+     * @return true이면 성공, false이면 큐가 가득 참
      */
     bool tryPush(const T& item) {
-        // CAS 루프: 여러 생산자 간 경쟁 처리
-        size_t currentWrite, nextWrite;
-
-        while (true) {
-            currentWrite = writePos_.value.load(std::memory_order_acquire);
-            nextWrite = (currentWrite + 1) % capacity_;
-
-            // 큐가 가득 찼는지 확인
-            size_t currentRead = readPos_.value.load(std::memory_order_acquire);
-            if (nextWrite == currentRead) {
-                return false;  // Queue full
-            }
-
-            // CAS로 쓰기 위치 예약 시도
-            // strong 버전 사용으로 spurious failure 방지
-            if (writePos_.value.compare_exchange_strong(
-                    currentWrite, nextWrite,
-                    std::memory_order_acq_rel,
-                    std::memory_order_acquire)) {
-                // 성공: 예약한 위치에 쓰기
-                // 버퍼에 쓰기 전에 fence 추가로 메모리 순서 보장
-                buffer_[currentWrite] = item;
-                return true;
-            }
-
-            // 실패: 다른 스레드가 먼저 예약했음, 재시도
-            // compare_exchange_strong이 currentWrite를 업데이트했으므로
-            // 다음 루프에서 새로운 값으로 재시도
-        }
+        return pushImpl([&item](T& slot) { slot = item; });
     }
 
     /**
      * @brief 큐에 요소 추가 (move 버전)
      *
      * @param item 이동할 요소
-     * @return true이면 성공, false이면 큐가 가득 찼거나 경쟁 실패
+     * @return true이면 성공, false이면 큐가 가득 참
      */
     bool tryPush(T&& item) {
-        size_t currentWrite, nextWrite;
-
-        while (true) {
-            currentWrite = writePos_.value.load(std::memory_order_acquire);
-            nextWrite = (currentWrite + 1) % capacity_;
-
-            size_t currentRead = readPos_.value.load(std::memory_order_acquire);
-            if (nextWrite == currentRead) {
-                return false;  // Queue full
-            }
+        return pushImpl([&item](T& slot) { slot = std::move(item); });
+    }
 
-            if (writePos_.value.compare_exchange_strong(
-                    currentWrite, nextWrite,
-                    std::memory_order_acq_rel,
-                    std::memory_order_acquire)) {
-                buffer_[currentWrite] = std::move(item);
-                return true;
-            }
-        }
+    /**
+     * @brief 예약한 슬롯에 직접 기록 (multi-producer 안전)
+     *
+     * 슬롯 객체는 재사용되므로 fill이 기존 값에 덮어쓰면 (예: std::string::assign)
+     * 이미 확보된 용량을 그대로 쓰고 힙 할당이 발생하지 않습니다.
+     * fill은 예외를 던지지 않아야 합니다 (슬롯이 게시되지 않은 채 남음).
+     *
+     * @param fill void(T& slot) 형태의 함수
+     * @return true이면 성공, false이면 큐가 가득 참 (fill 호출 안 함)
+     */
+    template<typename Fill>
+    bool tryPushWith(Fill&& fill) {
+        return pushImpl(std::forward<Fill>(fill));
     }
 
     /**
      * @brief 큐에서 요소 제거 (consumer 전용)
      *
-     * 큐가 비어 있는 경우 false를 반환합니다.
+     * 큐가 비어 있거나 다음 슬롯이 아직 게시되지 않은 경우 false를 반환합니다.
      *
      * **주의**: 이 함수는 단일 소비자 스레드에서만 호출해야 합니다.
      *
-     * @param item 꺼낸 요소를 저장할 참조
+     * @param item 꺼낸 요소를 저장할 참조 (move)
      * @return true이면 성공, false이면 큐가 비어 있음
      */
     bool tryPop(T& item) {
-        size_t currentRead = readPos_.value.load(std::memory_order_relaxed);
+        return tryPopWith([&item](T& slot) { item = std::move(slot); });
+    }
 
-        // 큐가 비어 있는지 확인
-        if (currentRead == writePos_.value.load(std::memory_order_acquire)) {
-            return false;  // Queue empty
+    /**
+     * @brief 슬롯을 제자리에서 읽고 제거 (consumer 전용)
+     *
+     * 요소를 이동하지 않으므로 슬롯이 확보한 버퍼가 다음 생산자에게 그대로 재사용됩니다.
+     *
+     * @param consume void(T& slot) 형태의 함수 (반환 후 슬롯은 생산자에게 반환됨)
+     * @return true이면 성공, false이면 큐가 비어 있음
+     */
+    template<typename Consume>
+    bool tryPopWith(Consume&& consume) {
+        size_t pos = readPos_.value.load(std::memory_order_relaxed);
+        Cell& cell = buffer_[pos % capacity_];
+        size_t seq = cell.sequence.load(std::memory_order_acquire);
+
+        if (seq != pos + 1) {
+            return false;  // Queue empty (또는 기록 중)
         }
 
-        // 버퍼에서 읽기
-        item = buffer_[currentRead];
+        consume(cell.data);
 
-        // 읽기 위치 업데이트 (release semantics)
-        readPos_.value.store((currentRead + 1) % capacity_, std::memory_order_release);
+        // 슬롯을 다음 바퀴의 생산자에게 반환
+        cell.sequence.store(pos + capacity_, std::memory_order_release);
+        readPos_.value.store(pos + 1, std::memory_order_release);
         return true;
     }
 
@@ -171,15 +192,29 @@ public:
      * @return 큐에 있는 요소의 대략적인 개수
      */
     size_t size() const {
-        size_t write = writePos_.value.load(std::memory_order_acquire);
         size_t read = readPos_.value.load(std::memory_order_acquire);
+        size_t write = writePos_.value.load(std::memory_order_acquire);
+        return write > read ? write - read : 0;
+    }
 
-        if (write >= read) {
-            return write - read;
-        } else {
-            // Ring buffer wrapped around
-            return capacity_ - read + write;
-        }
+    /**
+     * @brief 지금까지 예약된 push 위치 (단조 증가)
+     *
+     * readPosition()이 이 값에 도달하면 그 시점까지 push된 요소가 모두 pop된 것입니다.
+     *
+     * @return 누적 push 예약 수
+     */
+    size_t writePosition() const {
+        return writePos_.value.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief 지금까지 pop된 위치 (단조 증가)
+     *
+     * @return 누적 pop 수
+     */
+    size_t readPosition() const {
+        return readPos_.value.load(std::memory_order_acquire);
     }
 
     /**
@@ -188,8 +223,7 @@ public:
      * @return true이면 비어 있음 (근사값)
      */
     bool empty() const {
-        return readPos_.value.load(std::memory_order_acquire) ==
-               writePos_.value.load(std::memory_order_acquire);
+        return size() == 0;
     }
 
     /**
@@ -170,6 +170,10 @@ void EtherCATDriver::shutdown() {
 }
 
 bool EtherCATDriver::readSensors(std::vector<double>& data) {
+    return readSensors(std::span<double>(data));
+}
+
+bool EtherCATDriver::readSensors(std::span<double> data) {
     // RT-safe operation
     if (status_ != FieldbusStatus::RUNNING) {
         return false;
@@ -203,6 +207,10 @@ bool EtherCATDriver::readSensors(std::vector<double>& data) {
 }
 
 bool EtherCATDriver::writeActuators(const std::vector<double>& data) {
+    return writeActuators(std::span<const double>(data));
+}
+
+bool EtherCATDriver::writeActuators(std::span<const double> data) {
     // RT-safe operation
     if (status_ != FieldbusStatus::RUNNING) {
         return false;
@@ -259,6 +267,34 @@ bool EtherCATDriver::writeDigitalOutputs(const std::vector<bool>& data) {
     return true;
 }
 
+bool EtherCATDriver::readDigitalInputs(std::span<uint8_t> bits) {
+    // RT-safe operation
+    if (status_ != FieldbusStatus::RUNNING) {
+        return false;
+    }
+
+    // TODO: Copy packed digital inputs from PDO domain (single memcpy once mapped)
+    // Until PDO mapping exists, fail instead of reporting an untouched buffer as fresh data
+    (void)bits;
+    std::lock_guard<std::mutex> lock(mutex_);
+    last_error_ = "Packed digital inputs not supported: PDO mapping not implemented";
+    return false;
+}
+
+bool EtherCATDriver::writeDigitalOutputs(std::span<const uint8_t> bits) {
+    // RT-safe operation
+    if (status_ != FieldbusStatus::RUNNING) {
+        return false;
+    }
+
+    // TODO: Copy packed digital outputs into PDO domain (single memcpy once mapped)
+    // Until PDO mapping exists, fail instead of silently dropping the outputs
+    (void)bits;
+    std::lock_guard<std::mutex> lock(mutex_);
+    last_error_ = "Packed digital outputs not supported: PDO mapping not implemented";
+    return false;
+}
+
 FieldbusStatus EtherCATDriver::getStatus() const {
     return status_.load(std::memory_order_relaxed);
 }
@@ -66,6 +66,12 @@ public:
     bool readDigitalInputs(std::vector<bool>& data) override;
     bool writeDigitalOutputs(const std::vector<bool>& data) override;
 
+    // Allocation-free overloads (the vector overloads forward to these)
+    bool readSensors(std::span<double> data) override;
+    bool writeActuators(std::span<const double> data) override;
+    bool readDigitalInputs(std::span<uint8_t> bits) override;
+    bool writeDigitalOutputs(std::span<const uint8_t> bits) override;
+
     FieldbusStatus getStatus() const override;
     FieldbusStats getStatistics() const override;
     std::string getProtocolName() const override;
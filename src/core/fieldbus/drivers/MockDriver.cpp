@@ -1,17 +1,53 @@
 #include "MockDriver.h"
 #include <spdlog/spdlog.h>
+#include <yaml-cpp/yaml.h>
+#include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <numbers>
 
 namespace mxrc::core::fieldbus {
 
+namespace {
+
+// NOISE 파형용 seed 변형 (추가 노이즈 항과 독립된 값)
+constexpr uint64_t NOISE_WAVEFORM_SALT = 0xD1B54A32D192ED03ULL;
+
+// 채널별 노이즈: (seed, tick, channel) 해시 → [-1, 1) (상태 없음, 루프 벡터화 가능)
+inline double hashNoise(uint64_t seed, uint64_t tick, uint64_t channel) {
+    uint64_t x = seed ^ (tick * 0x9E3779B97F4A7C15ULL) ^ (channel * 0xBF58476D1CE4E5B9ULL);
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return static_cast<double>(x >> 11) * 0x1.0p-52 - 1.0;
+}
+
+std::optional<MockSignalType> parseSignalType(const std::string& name) {
+    if (name == "sine") return MockSignalType::SINE;
+    if (name == "square") return MockSignalType::SQUARE;
+    if (name == "ramp") return MockSignalType::RAMP;
+    if (name == "noise") return MockSignalType::NOISE;
+    if (name == "constant") return MockSignalType::CONSTANT;
+    return std::nullopt;
+}
+
+std::optional<MockLatencyDistribution> parseLatencyDistribution(const std::string& name) {
+    if (name == "none") return MockLatencyDistribution::NONE;
+    if (name == "uniform") return MockLatencyDistribution::UNIFORM;
+    if (name == "normal") return MockLatencyDistribution::NORMAL;
+    if (name == "exponential") return MockLatencyDistribution::EXPONENTIAL;
+    return std::nullopt;
+}
+
+} // namespace
+
 // Mock 드라이버 생성자
 MockDriver::MockDriver(const FieldbusConfig& config, size_t device_count)
     : config_(config),
-      device_count_(device_count),
-      sensor_data_(device_count, 0.0),
-      actuator_data_(device_count, 0.0),
-      digital_inputs_(device_count, false),
-      digital_outputs_(device_count, false) {
+      device_count_(device_count) {
+    resizeChannels(device_count);
+    setSimulationConfig(MockSimulationConfig{});
     spdlog::debug("[MockDriver] Created with {} devices", device_count);
 }
 
@@ -25,15 +61,22 @@ MockDriver::~MockDriver() {
 
 // 드라이버 초기화
 bool MockDriver::initialize() {
-    std::lock_guard<std::mutex> lock(mutex_);
-
     if (status_ != FieldbusStatus::UNINITIALIZED) {
         spdlog::warn("[MockDriver] Already initialized");
         return false;
     }
 
-    // 초기화 지연 시뮬레이션
-    spdlog::info("[MockDriver] Initializing {} devices...", device_count_);
+    // 설정 파일이 있으면 batch simulation 설정 적용 (없으면 기본 사인파 에코)
+    if (!config_.config_file.empty() && std::filesystem::exists(config_.config_file)) {
+        if (!loadSimulationConfig(config_.config_file)) {
+            return false;
+        }
+    }
+
+    spdlog::info("[MockDriver] Initializing {} devices, {} generators...",
+                 device_count_, generators_.size());
+
+    resetGenerators();
 
     // 센서 데이터를 패턴으로 초기화
     for (size_t i = 0; i < device_count_; ++i) {
@@ -47,20 +90,22 @@ bool MockDriver::initialize() {
 
 // 드라이버 시작
 bool MockDriver::start() {
-    std::lock_guard<std::mutex> lock(mutex_);
-
     // INITIALIZED 또는 STOPPED 상태에서 시작 허용
     if (status_ != FieldbusStatus::INITIALIZED &&
         status_ != FieldbusStatus::STOPPED) {
-        last_error_ = "Cannot start: not initialized or stopped";
-        spdlog::error("[MockDriver] {}", *last_error_);
+        setError("Cannot start: not initialized or stopped");
+        spdlog::error("[MockDriver] Cannot start: not initialized or stopped");
         return false;
     }
 
-    status_ = FieldbusStatus::RUNNING;
     last_cycle_time_ = std::chrono::steady_clock::now();
     simulation_tick_ = 0;
+    resetGenerators();
+    if (emergency_stopped_) {
+        clearOutputs();
+    }
     emergency_stopped_ = false;
+    status_ = FieldbusStatus::RUNNING;
 
     spdlog::info("[MockDriver] Started cyclic communication");
     return true;
@@ -68,8 +113,6 @@ bool MockDriver::start() {
 
 // 드라이버 정지
 bool MockDriver::stop() {
-    std::lock_guard<std::mutex> lock(mutex_);
-
     if (status_ != FieldbusStatus::RUNNING) {
         spdlog::warn("[MockDriver] Not running");
         return false;
@@ -82,50 +125,59 @@ bool MockDriver::stop() {
 
 // 드라이버 종료
 void MockDriver::shutdown() {
-    std::lock_guard<std::mutex> lock(mutex_);
-
     spdlog::info("[MockDriver] Shutting down...");
 
+    status_ = FieldbusStatus::UNINITIALIZED;
+
     // 모든 데이터 클리어
     std::fill(sensor_data_.begin(), sensor_data_.end(), 0.0);
     std::fill(actuator_data_.begin(), actuator_data_.end(), 0.0);
-    std::fill(digital_inputs_.begin(), digital_inputs_.end(), false);
-    std::fill(digital_outputs_.begin(), digital_outputs_.end(), false);
+    std::fill(digital_inputs_.begin(), digital_inputs_.end(), 0);
+    std::fill(digital_outputs_.begin(), digital_outputs_.end(), 0);
 
-    status_ = FieldbusStatus::UNINITIALIZED;
-    last_error_.reset();
+    {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        last_error_.reset();
+    }
     emergency_stopped_ = false;
 
     spdlog::info("[MockDriver] Shutdown complete");
 }
 
-// 센서 데이터 읽기
+// 센서 데이터 읽기 (vector 크기를 장치 수에 맞춘 뒤 span 경로 사용)
 bool MockDriver::readSensors(std::vector<double>& data) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    if (data.size() != device_count_) {
+        data.resize(device_count_);
+    }
+    return readSensors(std::span<double>(data));
+}
 
+// 센서 데이터 읽기 (호출자 버퍼, 할당 없음, lock 없음)
+bool MockDriver::readSensors(std::span<double> data) {
     if (status_ != FieldbusStatus::RUNNING) {
-        last_error_ = "Cannot read: not running";
+        setError("Cannot read: not running");
+        return false;
+    }
+
+    if (data.size() != device_count_) {
+        setError("Data size mismatch: expected " + std::to_string(device_count_) +
+                 ", got " + std::to_string(data.size()));
         return false;
     }
 
     if (emergency_stopped_) {
-        // 비상 정지 시 0을 반환
-        data.assign(device_count_, 0.0);
+        // 비상 정지 시 출력 해제 후 0을 반환
+        clearOutputs();
+        std::fill(data.begin(), data.end(), 0.0);
         return true;
     }
 
-    // 센서 데이터 시뮬레이션 (사인파 + 액추에이터 에코)
-    simulation_tick_++;
-    for (size_t i = 0; i < device_count_; ++i) {
-        sensor_data_[i] = actuator_data_[i] +
-                          0.1 * std::sin(simulation_tick_ * 0.01 + i * 0.1);
-    }
+    // 전체 채널 한 cycle 진행 + 버스 왕복 지연
+    simulateStep();
+    simulateLatency();
 
     // 출력으로 복사
-    if (data.size() != device_count_) {
-        data.resize(device_count_);
-    }
-    data = sensor_data_;
+    std::memcpy(data.data(), sensor_data_.data(), device_count_ * sizeof(double));
 
     // 통계 업데이트
     auto now = std::chrono::steady_clock::now();
@@ -139,62 +191,134 @@ bool MockDriver::readSensors(std::vector<double>& data) {
 
 // 액추에이터 데이터 쓰기
 bool MockDriver::writeActuators(const std::vector<double>& data) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    return writeActuators(std::span<const double>(data));
+}
 
+// 액추에이터 데이터 쓰기 (호출자 버퍼, 할당 없음, lock 없음)
+bool MockDriver::writeActuators(std::span<const double> data) {
     if (status_ != FieldbusStatus::RUNNING) {
-        last_error_ = "Cannot write: not running";
+        setError("Cannot write: not running");
         return false;
     }
 
     if (emergency_stopped_) {
-        last_error_ = "Cannot write: emergency stopped";
+        clearOutputs();
+        setError("Cannot write: emergency stopped");
         return false;
     }
 
     if (data.size() != device_count_) {
-        last_error_ = "Data size mismatch: expected " +
-                      std::to_string(device_count_) +
-                      ", got " + std::to_string(data.size());
+        setError("Data size mismatch: expected " + std::to_string(device_count_) +
+                 ", got " + std::to_string(data.size()));
         return false;
     }
 
     // 액추에이터 명령 저장
-    actuator_data_ = data;
+    std::memcpy(actuator_data_.data(), data.data(), device_count_ * sizeof(double));
 
-    stats_.bytes_sent += data.size() * sizeof(double);
+    // 복사 중 비상 정지가 들어왔으면 방금 쓴 명령 해제
+    if (emergency_stopped_) {
+        clearOutputs();
+        setError("Cannot write: emergency stopped");
+        return false;
+    }
+
+    bytes_sent_.fetch_add(data.size() * sizeof(double), std::memory_order_relaxed);
     return true;
 }
 
-// 디지털 입력 읽기
+// 디지털 입력 읽기 (vector<bool>: 비트 단위 변환)
 bool MockDriver::readDigitalInputs(std::vector<bool>& data) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    if (data.size() != device_count_) {
+        data.resize(device_count_);
+    }
 
     if (status_ != FieldbusStatus::RUNNING) {
         return false;
     }
 
-    if (data.size() != device_count_) {
-        data.resize(device_count_);
+    for (size_t i = 0; i < device_count_; ++i) {
+        data[i] = (digital_inputs_[i / 8] >> (i % 8)) & 1u;
     }
+    return true;
+}
 
-    data = digital_inputs_;
+// 디지털 입력 읽기 (bit-packed, 할당 없음)
+bool MockDriver::readDigitalInputs(std::span<uint8_t> bits) {
+    if (status_ != FieldbusStatus::RUNNING) {
+        return false;
+    }
+
+    if (bits.size() != digital_inputs_.size()) {
+        setError("Digital input size mismatch");
+        return false;
+    }
+
+    std::memcpy(bits.data(), digital_inputs_.data(), digital_inputs_.size());
     return true;
 }
 
-// 디지털 출력 쓰기
+// 디지털 출력 쓰기 (vector<bool>: 비트 단위 변환)
 bool MockDriver::writeDigitalOutputs(const std::vector<bool>& data) {
-    std::lock_guard<std::mutex> lock(mutex_);
-
     if (status_ != FieldbusStatus::RUNNING) {
         return false;
     }
 
+    if (emergency_stopped_) {
+        clearOutputs();
+        setError("Cannot write: emergency stopped");
+        return false;
+    }
+
     if (data.size() != device_count_) {
-        last_error_ = "Digital output size mismatch";
+        setError("Digital output size mismatch");
         return false;
     }
 
-    digital_outputs_ = data;
+    std::fill(digital_outputs_.begin(), digital_outputs_.end(), 0);
+    for (size_t i = 0; i < device_count_; ++i) {
+        if (data[i]) {
+            digital_outputs_[i / 8] |= static_cast<uint8_t>(1u << (i % 8));
+        }
+    }
+
+    if (emergency_stopped_) {
+        clearOutputs();
+        setError("Cannot write: emergency stopped");
+        return false;
+    }
+    return true;
+}
+
+// 디지털 출력 쓰기 (bit-packed, 할당 없음)
+bool MockDriver::writeDigitalOutputs(std::span<const uint8_t> bits) {
+    if (status_ != FieldbusStatus::RUNNING) {
+        return false;
+    }
+
+    if (emergency_stopped_) {
+        clearOutputs();
+        setError("Cannot write: emergency stopped");
+        return false;
+    }
+
+    if (bits.size() != digital_outputs_.size()) {
+        setError("Digital output size mismatch");
+        return false;
+    }
+
+    std::memcpy(digital_outputs_.data(), bits.data(), bits.size());
+
+    // 마지막 바이트의 패딩 비트 제거
+    if (device_count_ % 8 != 0) {
+        digital_outputs_.back() &= static_cast<uint8_t>((1u << (device_count_ % 8)) - 1);
+    }
+
+    if (emergency_stopped_) {
+        clearOutputs();
+        setError("Cannot write: emergency stopped");
+        return false;
+    }
     return true;
 }
 
@@ -205,8 +329,15 @@ FieldbusStatus MockDriver::getStatus() const {
 
 // 통계 정보 반환
 FieldbusStats MockDriver::getStatistics() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return stats_;
+    FieldbusStats stats;
+    stats.total_cycles = total_cycles_.load(std::memory_order_relaxed);
+    stats.missed_cycles = missed_cycles_.load(std::memory_order_relaxed);
+    stats.communication_errors = communication_errors_.load(std::memory_order_relaxed);
+    stats.bytes_sent = bytes_sent_.load(std::memory_order_relaxed);
+    stats.bytes_received = bytes_received_.load(std::memory_order_relaxed);
+    stats.avg_cycle_time_us = avg_cycle_time_us_.load(std::memory_order_relaxed);
+    stats.max_cycle_time_us = max_cycle_time_us_.load(std::memory_order_relaxed);
+    return stats;
 }
 
 // 프로토콜 이름 반환
@@ -221,32 +352,30 @@ size_t MockDriver::getDeviceCount() const {
 
 // 마지막 오류 메시지 반환
 std::optional<std::string> MockDriver::getLastError() const {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::lock_guard<std::mutex> lock(error_mutex_);
     return last_error_;
 }
 
-// 비상 정지
+// 비상 정지 (플래그만 설정, 출력은 cycle 스레드가 다음 읽기/쓰기에서 해제)
 bool MockDriver::emergencyStop() {
-    std::lock_guard<std::mutex> lock(mutex_);
-
     emergency_stopped_ = true;
 
-    // 모든 액추에이터를 0으로 설정
-    std::fill(actuator_data_.begin(), actuator_data_.end(), 0.0);
-    std::fill(digital_outputs_.begin(), digital_outputs_.end(), false);
-
     spdlog::warn("[MockDriver] EMERGENCY STOP activated");
     return true;
 }
 
 // 오류 리셋
 bool MockDriver::resetErrors() {
-    std::lock_guard<std::mutex> lock(mutex_);
-
     if (status_ == FieldbusStatus::ERROR) {
-        status_ = FieldbusStatus::INITIALIZED;
-        last_error_.reset();
+        if (emergency_stopped_) {
+            clearOutputs();
+        }
+        {
+            std::lock_guard<std::mutex> lock(error_mutex_);
+            last_error_.reset();
+        }
         emergency_stopped_ = false;
+        status_ = FieldbusStatus::INITIALIZED;
         spdlog::info("[MockDriver] Errors reset");
         return true;
     }
@@ -254,45 +383,353 @@ bool MockDriver::resetErrors() {
     return false;
 }
 
+// YAML에서 batch simulation 설정 로드
+bool MockDriver::loadSimulationConfig(const std::string& file_path) {
+    if (status_ == FieldbusStatus::RUNNING) {
+        setError("Cannot load simulation config while running");
+        return false;
+    }
+
+    MockSimulationConfig sim_config;
+    size_t device_count = device_count_;
+
+    try {
+        YAML::Node root = YAML::LoadFile(file_path);
+
+        if (root["device_count"]) {
+            device_count = root["device_count"].as<size_t>();
+        }
+
+        // 주파수(Hz) → cycle당 위상 (rad)
+        const double cycle_s = config_.cycle_time_us * 1e-6;
+        YAML::Node batch = root["batch_simulation"];
+        if (batch) {
+            sim_config.seed = batch["seed"].as<uint64_t>(sim_config.seed);
+
+            for (const auto& node : batch["generators"]) {
+                MockSignalGenerator generator;
+                std::string type = node["type"].as<std::string>("sine");
+                auto parsed = parseSignalType(type);
+                if (!parsed) {
+                    setError("Unknown generator type: " + type);
+                    spdlog::error("[MockDriver] Unknown generator type: {}", type);
+                    return false;
+                }
+                generator.type = *parsed;
+                generator.first_channel = node["first_channel"].as<size_t>(0);
+                generator.channel_count = node["channel_count"].as<size_t>(0);
+                generator.amplitude = node["amplitude"].as<double>(generator.amplitude);
+                generator.offset = node["offset"].as<double>(generator.offset);
+                if (node["frequency_hz"]) {
+                    generator.phase_per_cycle =
+                        2.0 * std::numbers::pi * node["frequency_hz"].as<double>() * cycle_s;
+                }
+                generator.phase_step = node["phase_step"].as<double>(generator.phase_step);
+                generator.noise = node["noise"].as<double>(generator.noise);
+                generator.echo_actuators =
+                    node["echo_actuators"].as<bool>(generator.echo_actuators);
+                sim_config.generators.push_back(generator);
+            }
+
+            YAML::Node latency = batch["latency"];
+            if (latency) {
+                std::string distribution = latency["distribution"].as<std::string>("none");
+                auto parsed = parseLatencyDistribution(distribution);
+                if (!parsed) {
+                    setError("Unknown latency distribution: " + distribution);
+                    spdlog::error("[MockDriver] Unknown latency distribution: {}", distribution);
+                    return false;
+                }
+                sim_config.latency.distribution = *parsed;
+                sim_config.latency.mean_us = latency["mean_us"].as<double>(0.0);
+                sim_config.latency.spread_us = latency["spread_us"].as<double>(0.0);
+                sim_config.latency.max_us = latency["max_us"].as<double>(0.0);
+            }
+        }
+    } catch (const YAML::Exception& e) {
+        setError(std::string("Failed to load simulation config: ") + e.what());
+        spdlog::error("[MockDriver] Failed to load {}: {}", file_path, e.what());
+        return false;
+    }
+
+    size_t previous_count = device_count_;
+    resizeChannels(device_count);
+    if (!setSimulationConfig(sim_config)) {
+        resizeChannels(previous_count);
+        return false;
+    }
+
+    spdlog::info("[MockDriver] Loaded simulation config {}: {} channels, {} generators",
+                 file_path, device_count_, generators_.size());
+    return true;
+}
+
+// batch simulation 설정 적용 (범위 검증 후 빈 구간은 에코 전용 generator로 채움)
+bool MockDriver::setSimulationConfig(const MockSimulationConfig& sim_config) {
+    if (status_ == FieldbusStatus::RUNNING) {
+        setError("Cannot change simulation config while running");
+        return false;
+    }
+
+    std::vector<MockSignalGenerator> specs = sim_config.generators;
+    if (specs.empty()) {
+        specs.emplace_back();  // 기본: 전체 채널 사인파(±0.1) + 액추에이터 에코
+    }
+
+    std::vector<GeneratorState> generators;
+    generators.reserve(specs.size() * 2 + 1);
+    for (const auto& spec : specs) {
+        size_t begin = spec.first_channel;
+        size_t end = spec.channel_count == 0 ? device_count_ : begin + spec.channel_count;
+        if (begin >= end || end > device_count_) {
+            setError("Generator range out of bounds");
+            spdlog::error("[MockDriver] Generator range [{}, {}) out of bounds (channels={})",
+                          begin, end, device_count_);
+            return false;
+        }
+        generators.push_back({spec, begin, end,
+                              std::cos(spec.phase_per_cycle), std::sin(spec.phase_per_cycle),
+                              spec.phase_per_cycle / (2.0 * std::numbers::pi)});
+    }
+
+    std::sort(generators.begin(), generators.end(),
+              [](const GeneratorState& a, const GeneratorState& b) { return a.begin < b.begin; });
+
+    // 겹침 검사 + 빈 구간 채우기
+    std::vector<GeneratorState> filled;
+    filled.reserve(generators.size() * 2 + 1);
+    size_t cursor = 0;
+    for (const auto& generator : generators) {
+        if (generator.begin < cursor) {
+            setError("Generator ranges overlap");
+            spdlog::error("[MockDriver] Generator range starting at {} overlaps", generator.begin);
+            return false;
+        }
+        if (generator.begin > cursor) {
+            MockSignalGenerator echo;
+            echo.type = MockSignalType::CONSTANT;
+            echo.amplitude = 0.0;
+            filled.push_back({echo, cursor, generator.begin, 1.0, 0.0, 0.0});
+        }
+        filled.push_back(generator);
+        cursor = generator.end;
+    }
+    if (cursor < device_count_) {
+        MockSignalGenerator echo;
+        echo.type = MockSignalType::CONSTANT;
+        echo.amplitude = 0.0;
+        filled.push_back({echo, cursor, device_count_, 1.0, 0.0, 0.0});
+    }
+
+    sim_config_ = sim_config;
+    generators_ = std::move(filled);
+    rng_state_ = sim_config.seed ? sim_config.seed : 1;
+    resetGenerators();
+    return true;
+}
+
 // 시뮬레이션된 오류 설정
 void MockDriver::setSimulatedError(const std::string& error_msg) {
-    std::lock_guard<std::mutex> lock(mutex_);
-
     if (error_msg.empty()) {
-        last_error_.reset();
+        {
+            std::lock_guard<std::mutex> lock(error_mutex_);
+            last_error_.reset();
+        }
         if (status_ == FieldbusStatus::ERROR) {
             status_ = FieldbusStatus::INITIALIZED;
         }
     } else {
-        last_error_ = error_msg;
+        setError(error_msg);
         status_ = FieldbusStatus::ERROR;
         spdlog::error("[MockDriver] Simulated error: {}", error_msg);
     }
 }
 
-// 통계 업데이트
+// 채널 버퍼 크기 변경
+void MockDriver::resizeChannels(size_t device_count) {
+    device_count_ = device_count;
+    sensor_data_.assign(device_count, 0.0);
+    actuator_data_.assign(device_count, 0.0);
+    digital_inputs_.assign(packedBitBytes(device_count), 0);
+    digital_outputs_.assign(packedBitBytes(device_count), 0);
+    phasor_cos_.assign(device_count, 1.0);
+    phasor_sin_.assign(device_count, 0.0);
+    ramp_phase_.assign(device_count, 0.0);
+}
+
+// generator 상태를 tick 기준 위상으로 재설정 (채널 i 위상 = tick * w + i * step)
+void MockDriver::resetGenerators() {
+    for (const auto& generator : generators_) {
+        const auto& spec = generator.spec;
+        for (size_t ch = generator.begin; ch < generator.end; ++ch) {
+            double phase = static_cast<double>(simulation_tick_) * spec.phase_per_cycle +
+                           static_cast<double>(ch - generator.begin) * spec.phase_step;
+            phasor_cos_[ch] = std::cos(phase);
+            phasor_sin_[ch] = std::sin(phase);
+            double cycles = phase / (2.0 * std::numbers::pi);
+            ramp_phase_[ch] = cycles - std::floor(cycles);
+        }
+    }
+}
+
+// 전체 채널 1 cycle 진행
+// generator 범위마다 분기 없는 연속 루프 (phasor 회전/톱니파 누적), 채널별 삼각함수 없음
+void MockDriver::simulateStep() {
+    simulation_tick_++;
+
+    double* __restrict out = sensor_data_.data();
+    const double* __restrict actuator = actuator_data_.data();
+    double* __restrict pc = phasor_cos_.data();
+    double* __restrict ps = phasor_sin_.data();
+    double* __restrict ramp = ramp_phase_.data();
+
+    for (const auto& generator : generators_) {
+        const auto& spec = generator.spec;
+        const size_t begin = generator.begin;
+        const size_t end = generator.end;
+        const double echo = spec.echo_actuators ? 1.0 : 0.0;
+        const double offset = spec.offset;
+        const double amplitude = spec.amplitude;
+
+        switch (spec.type) {
+            case MockSignalType::SINE:
+            case MockSignalType::SQUARE: {
+                const double rc = generator.rotate_cos;
+                const double rs = generator.rotate_sin;
+                for (size_t i = begin; i < end; ++i) {
+                    double c = pc[i] * rc - ps[i] * rs;
+                    double s = ps[i] * rc + pc[i] * rs;
+                    // 크기 재정규화 (1/sqrt(x) ≈ (3 - x) / 2, 누적 오차 제거, 삼각함수 없음)
+                    double k = 0.5 * (3.0 - (c * c + s * s));
+                    pc[i] = c * k;
+                    ps[i] = s * k;
+                }
+                if (spec.type == MockSignalType::SINE) {
+                    for (size_t i = begin; i < end; ++i) {
+                        out[i] = echo * actuator[i] + offset + amplitude * ps[i];
+                    }
+                } else {
+                    for (size_t i = begin; i < end; ++i) {
+                        out[i] = echo * actuator[i] + offset + std::copysign(amplitude, ps[i]);
+                    }
+                }
+                break;
+            }
+            case MockSignalType::RAMP: {
+                const double step = generator.ramp_step;
+                for (size_t i = begin; i < end; ++i) {
+                    double r = ramp[i] + step;
+                    r -= std::floor(r);
+                    ramp[i] = r;
+                    out[i] = echo * actuator[i] + offset + amplitude * r;
+                }
+                break;
+            }
+            case MockSignalType::NOISE: {
+                const uint64_t seed = sim_config_.seed ^ NOISE_WAVEFORM_SALT;
+                const uint64_t tick = simulation_tick_;
+                for (size_t i = begin; i < end; ++i) {
+                    out[i] = echo * actuator[i] + offset + amplitude * hashNoise(seed, tick, i);
+                }
+                break;
+            }
+            case MockSignalType::CONSTANT:
+                for (size_t i = begin; i < end; ++i) {
+                    out[i] = echo * actuator[i] + offset;
+                }
+                break;
+        }
+
+        if (spec.noise > 0.0) {
+            const double noise = spec.noise;
+            const uint64_t seed = sim_config_.seed;
+            const uint64_t tick = simulation_tick_;
+            for (size_t i = begin; i < end; ++i) {
+                out[i] += noise * hashNoise(seed, tick, i);
+            }
+        }
+    }
+}
+
+// 지연 분포에서 표본 추출 후 busy-wait
+void MockDriver::simulateLatency() {
+    const auto& latency = sim_config_.latency;
+    double latency_us = 0.0;
+
+    switch (latency.distribution) {
+        case MockLatencyDistribution::NONE:
+            last_latency_ns_.store(0, std::memory_order_relaxed);
+            return;
+        case MockLatencyDistribution::UNIFORM:
+            latency_us = latency.mean_us + latency.spread_us * (2.0 * nextUniform() - 1.0);
+            break;
+        case MockLatencyDistribution::NORMAL: {
+            // Box-Muller
+            double u1 = 1.0 - nextUniform();
+            double u2 = nextUniform();
+            latency_us = latency.mean_us + latency.spread_us *
+                std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * std::numbers::pi * u2);
+            break;
+        }
+        case MockLatencyDistribution::EXPONENTIAL:
+            latency_us = -latency.mean_us * std::log(1.0 - nextUniform());
+            break;
+    }
+
+    latency_us = std::max(latency_us, 0.0);
+    if (latency.max_us > 0.0) {
+        latency_us = std::min(latency_us, latency.max_us);
+    }
+
+    auto latency_ns = static_cast<uint64_t>(latency_us * 1000.0);
+    last_latency_ns_.store(latency_ns, std::memory_order_relaxed);
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::nanoseconds(latency_ns);
+    while (std::chrono::steady_clock::now() < deadline) {
+    }
+}
+
+// 액추에이터/디지털 출력 해제 (cycle 스레드 또는 data path와 겹치지 않는 lifecycle 경로)
+void MockDriver::clearOutputs() {
+    std::fill(actuator_data_.begin(), actuator_data_.end(), 0.0);
+    std::fill(digital_outputs_.begin(), digital_outputs_.end(), 0);
+}
+
+// 오류 메시지 기록 (실패 경로 전용)
+void MockDriver::setError(std::string message) {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    last_error_ = std::move(message);
+}
+
+// 통계 업데이트 (cycle 스레드 단일 writer)
 void MockDriver::updateStatistics(double cycle_time_us) {
-    stats_.total_cycles++;
-    stats_.bytes_received += device_count_ * sizeof(double);
+    total_cycles_.fetch_add(1, std::memory_order_relaxed);
+    bytes_received_.fetch_add(device_count_ * sizeof(double), std::memory_order_relaxed);
 
     // 평균 사이클 시간 업데이트 (지수 이동 평균)
     const double alpha = 0.1;
-    if (stats_.avg_cycle_time_us == 0.0) {
-        stats_.avg_cycle_time_us = cycle_time_us;
-    } else {
-        stats_.avg_cycle_time_us = alpha * cycle_time_us +
-                                    (1.0 - alpha) * stats_.avg_cycle_time_us;
-    }
+    double avg = avg_cycle_time_us_.load(std::memory_order_relaxed);
+    avg = (avg == 0.0) ? cycle_time_us : alpha * cycle_time_us + (1.0 - alpha) * avg;
+    avg_cycle_time_us_.store(avg, std::memory_order_relaxed);
 
     // 최대 사이클 시간 업데이트
-    if (cycle_time_us > stats_.max_cycle_time_us) {
-        stats_.max_cycle_time_us = cycle_time_us;
+    if (cycle_time_us > max_cycle_time_us_.load(std::memory_order_relaxed)) {
+        max_cycle_time_us_.store(cycle_time_us, std::memory_order_relaxed);
     }
 
     // 마감 시간 누락 확인
     if (cycle_time_us > config_.cycle_time_us * 1.1) {  // 10% 허용 오차
-        stats_.missed_cycles++;
+        missed_cycles_.fetch_add(1, std::memory_order_relaxed);
     }
 }
 
+// xorshift64* → [0, 1)
+double MockDriver::nextUniform() {
+    rng_state_ ^= rng_state_ >> 12;
+    rng_state_ ^= rng_state_ << 25;
+    rng_state_ ^= rng_state_ >> 27;
+    uint64_t value = rng_state_ * 0x2545F4914F6CDD1DULL;
+    return static_cast<double>(value >> 11) * 0x1.0p-53;
+}
+
 } // namespace mxrc::core::fieldbus
@@ -2,38 +2,107 @@
 
 #include "../interfaces/IFieldbus.h"
 #include <atomic>
+#include <chrono>
 #include <mutex>
 
 namespace mxrc::core::fieldbus {
 
+/**
+ * @brief Waveform produced by a MockSignalGenerator
+ */
+enum class MockSignalType {
+    SINE,       ///< offset + amplitude * sin(phase)
+    SQUARE,     ///< offset ± amplitude (sign of sin(phase))
+    RAMP,       ///< offset + amplitude * (phase / 2π mod 1), sawtooth
+    NOISE,      ///< offset + amplitude * uniform noise in [-1, 1)
+    CONSTANT    ///< offset only
+};
+
+/**
+ * @brief Signal generator applied to a contiguous range of analog channels
+ *
+ * Channel i of the range has phase (tick * phase_per_cycle + i * phase_step).
+ * Output = (echo_actuators ? actuator[i] : 0) + waveform + uniform noise in [-noise, noise].
+ */
+struct MockSignalGenerator {
+    MockSignalType type{MockSignalType::SINE};
+    size_t first_channel{0};
+    size_t channel_count{0};        ///< 0 = through the last channel
+    double amplitude{0.1};
+    double offset{0.0};
+    double phase_per_cycle{0.01};   ///< Phase advance per cycle (rad)
+    double phase_step{0.1};         ///< Phase offset between adjacent channels (rad)
+    double noise{0.0};              ///< Uniform noise half-width
+    bool echo_actuators{true};      ///< Loop actuator commands back into the sensor value
+};
+
+/**
+ * @brief Distribution of the simulated bus round-trip inside readSensors()
+ */
+enum class MockLatencyDistribution {
+    NONE,         ///< No added latency
+    UNIFORM,      ///< mean_us ± spread_us
+    NORMAL,       ///< mean_us, standard deviation spread_us
+    EXPONENTIAL   ///< Exponential with mean mean_us
+};
+
+/**
+ * @brief Simulated latency parameters (busy-wait, so cycle timing is realistic)
+ */
+struct MockLatencyConfig {
+    MockLatencyDistribution distribution{MockLatencyDistribution::NONE};
+    double mean_us{0.0};
+    double spread_us{0.0};
+    double max_us{0.0};     ///< Upper clamp, 0 = unbounded
+};
+
+/**
+ * @brief Batch simulation configuration (see config/mock-driver.yaml, batch_simulation)
+ */
+struct MockSimulationConfig {
+    std::vector<MockSignalGenerator> generators;  ///< Empty = one echoing sine over all channels
+    MockLatencyConfig latency;
+    uint64_t seed{1};                             ///< Noise / latency random seed
+};
+
 /**
  * @brief Mock fieldbus driver for testing
  *
  * Simulates a fieldbus without requiring actual hardware.
- * Useful for unit testing, integration testing, and development.
+ * Useful for unit testing, integration testing, load testing and development.
  *
  * Features:
- * - Simulates sensor data (sine wave pattern)
+ * - Batch simulation step: every cycle all channels are updated range by range
+ *   from structure-of-arrays generator state (phasor rotation, no per-channel
+ *   trigonometry), so thousands of channels cost a few vectorized loops
+ * - Configurable signal generators and latency distributions
+ *   (config_file or setSimulationConfig())
  * - Echoes actuator commands back as sensor readings
- * - Configurable device count
- * - Thread-safe operations
  * - Cycle time tracking
  *
+ * Threading:
+ * - Data path (read/write calls) belongs to a single cycle thread and takes no lock
+ * - Lifecycle and configuration calls must not overlap the data path
+ * - getStatus(), getStatistics(), getLastError() and emergencyStop() are safe from any thread
+ * - emergencyStop() only raises a flag; the cycle thread zeroes the outputs on its
+ *   next read/write call (start() also clears them)
+ *
  * Usage Example:
  * @code
  * FieldbusConfig config;
  * config.protocol = "Mock";
+ * config.config_file = "config/mock-driver.yaml";
  * config.cycle_time_us = 1000;
  *
  * MockDriver driver(config);
- * driver.initialize();
+ * driver.initialize();  // Loads batch_simulation from config_file if present
  * driver.start();
  *
- * std::vector<double> sensors(64);
- * driver.readSensors(sensors);  // Returns simulated data
+ * std::vector<double> sensors(driver.getDeviceCount());
+ * driver.readSensors(std::span<double>(sensors));  // One simulation step
  *
- * std::vector<double> commands(64, 1.0);
- * driver.writeActuators(commands);  // Stored for next read
+ * std::vector<double> commands(driver.getDeviceCount(), 1.0);
+ * driver.writeActuators(std::span<const double>(commands));  // Echoed next step
  * @endcode
  */
 class MockDriver : public IFieldbus {
@@ -62,6 +131,12 @@ public:
     bool readDigitalInputs(std::vector<bool>& data) override;
     bool writeDigitalOutputs(const std::vector<bool>& data) override;
 
+    // Allocation-free overloads (single memcpy into caller-owned buffers)
+    bool readSensors(std::span<double> data) override;
+    bool writeActuators(std::span<const double> data) override;
+    bool readDigitalInputs(std::span<uint8_t> bits) override;
+    bool writeDigitalOutputs(std::span<const uint8_t> bits) override;
+
     FieldbusStatus getStatus() const override;
     FieldbusStats getStatistics() const override;
     std::string getProtocolName() const override;
@@ -71,6 +146,28 @@ public:
     bool emergencyStop() override;
     bool resetErrors() override;
 
+    /**
+     * @brief Load batch simulation settings from YAML
+     *
+     * Reads top-level device_count and the batch_simulation section.
+     * Only valid before start().
+     *
+     * @param file_path YAML file path
+     * @return true on success, false on parse error or invalid generator ranges
+     */
+    bool loadSimulationConfig(const std::string& file_path);
+
+    /**
+     * @brief Apply batch simulation settings
+     *
+     * Generator ranges must not overlap; channels outside every range echo
+     * actuator commands unchanged. Only valid before start().
+     *
+     * @param sim_config Simulation configuration
+     * @return true if applied, false if a range is out of bounds or overlaps
+     */
+    bool setSimulationConfig(const MockSimulationConfig& sim_config);
+
     /**
      * @brief Set simulated error state (for testing)
      *
@@ -84,10 +181,59 @@ public:
      * @return Number of completed cycles
      */
     uint64_t getCycleCount() const {
-        return stats_.total_cycles;
+        return total_cycles_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Latency added by the last readSensors() (nanoseconds)
+     */
+    uint64_t getLastSimulatedLatencyNs() const {
+        return last_latency_ns_.load(std::memory_order_relaxed);
     }
 
 private:
+    /**
+     * @brief Generator with precomputed per-cycle constants
+     */
+    struct GeneratorState {
+        MockSignalGenerator spec;
+        size_t begin;
+        size_t end;
+        double rotate_cos;  ///< cos(phase_per_cycle)
+        double rotate_sin;  ///< sin(phase_per_cycle)
+        double ramp_step;   ///< phase_per_cycle / 2π
+    };
+
+    /**
+     * @brief Resize channel buffers (control path)
+     */
+    void resizeChannels(size_t device_count);
+
+    /**
+     * @brief Reset generator state to tick 0
+     */
+    void resetGenerators();
+
+    /**
+     * @brief Advance every channel by one cycle into sensor_data_
+     */
+    void simulateStep();
+
+    /**
+     * @brief Sample and busy-wait the configured latency
+     */
+    void simulateLatency();
+
+    /**
+     * @brief Zero actuator commands and digital outputs (cycle thread or lifecycle path)
+     */
+    void clearOutputs();
+
+    /**
+     * @brief Record an error message (error path only)
+     */
+    void setError(std::string message);
+
     /**
      * @brief Update statistics
      *
@@ -95,27 +241,47 @@ private:
      */
     void updateStatistics(double cycle_time_us);
 
+    /**
+     * @brief xorshift64* random number, [0, 1)
+     */
+    double nextUniform();
+
     // Configuration
     FieldbusConfig config_;
     size_t device_count_;
+    MockSimulationConfig sim_config_;
 
     // State
     std::atomic<FieldbusStatus> status_{FieldbusStatus::UNINITIALIZED};
-    mutable std::mutex mutex_;
 
-    // Data storage
+    // Data storage (owned by the cycle thread)
     std::vector<double> sensor_data_;
     std::vector<double> actuator_data_;
-    std::vector<bool> digital_inputs_;
-    std::vector<bool> digital_outputs_;
+    std::vector<uint8_t> digital_inputs_;   // bit-packed (packedBitBytes(device_count_))
+    std::vector<uint8_t> digital_outputs_;  // bit-packed
+
+    // Batch simulation state (structure of arrays, one entry per channel)
+    std::vector<GeneratorState> generators_;
+    std::vector<double> phasor_cos_;
+    std::vector<double> phasor_sin_;
+    std::vector<double> ramp_phase_;        // [0, 1)
+    uint64_t rng_state_{1};
 
-    // Statistics
-    FieldbusStats stats_;
+    // Statistics (written by the cycle thread, read from any thread)
+    std::atomic<uint64_t> total_cycles_{0};
+    std::atomic<uint64_t> missed_cycles_{0};
+    std::atomic<uint64_t> communication_errors_{0};
+    std::atomic<uint64_t> bytes_sent_{0};
+    std::atomic<uint64_t> bytes_received_{0};
+    std::atomic<double> avg_cycle_time_us_{0.0};
+    std::atomic<double> max_cycle_time_us_{0.0};
+    std::atomic<uint64_t> last_latency_ns_{0};
     std::chrono::steady_clock::time_point last_cycle_time_;
 
-    // Error handling
+    // Error handling (mutex only guards the message string, never the success path)
+    mutable std::mutex error_mutex_;
     std::optional<std::string> last_error_;
-    std::atomic<bool> emergency_stopped_{false};
+    std::atomic<bool> emergency_stopped_{false};   ///< Rejects writes after emergencyStop()
 
     // Simulation state
     uint64_t simulation_tick_{0};
@@ -4,7 +4,9 @@
 #include <vector>
 #include <cstdint>
 #include <memory>
+#include <algorithm>
 #include <optional>
+#include <span>
 
 namespace mxrc::core::fieldbus {
 
@@ -43,6 +45,15 @@ struct FieldbusStats {
     double max_cycle_time_us{0.0};  ///< Maximum cycle time
 };
 
+/**
+ * @brief Number of bytes needed to hold @p bit_count bit-packed digital channels
+ *
+ * Digital I/O buffers are packed LSB-first: channel i is bit (i % 8) of byte (i / 8).
+ */
+constexpr size_t packedBitBytes(size_t bit_count) {
+    return (bit_count + 7) / 8;
+}
+
 /**
  * @brief Abstract interface for fieldbus communication
  *
@@ -70,6 +81,10 @@ struct FieldbusStats {
  * std::vector<double> motor_commands(64);
  * fieldbus->writeActuators(motor_commands);
  *
+ * // RT cycle (caller-owned buffers; allocation-free when the driver overrides the span overloads)
+ * std::array<double, 64> sensors;
+ * fieldbus->readSensors(std::span<double>(sensors));
+ *
  * fieldbus->stop();
  * @endcode
  */
@@ -162,6 +177,84 @@ public:
      */
     virtual bool writeDigitalOutputs(const std::vector<bool>& data) = 0;
 
+    /**
+     * @brief Read sensor data into a caller-owned buffer
+     *
+     * Drivers that hold sensor values contiguously override this as a single
+     * memcpy (RT-safe, allocation-free). The default implementation adapts the
+     * vector overload and allocates a temporary vector on every call; RT drivers
+     * should override it.
+     *
+     * @param[out] data Buffer to store sensor data (size must match device count)
+     * @return true on success, false on communication error or size mismatch
+     */
+    virtual bool readSensors(std::span<double> data) {
+        std::vector<double> tmp(data.size());
+        if (!readSensors(tmp) || tmp.size() != data.size()) {
+            return false;
+        }
+        std::copy(tmp.begin(), tmp.end(), data.begin());
+        return true;
+    }
+
+    /**
+     * @brief Write actuator commands from a caller-owned buffer
+     *
+     * Allocation-free only when overridden by the driver; the default copies
+     * into a temporary vector on every call.
+     *
+     * @param[in] data Actuator commands (size must match device count)
+     * @return true on success, false on communication error or size mismatch
+     */
+    virtual bool writeActuators(std::span<const double> data) {
+        return writeActuators(std::vector<double>(data.begin(), data.end()));
+    }
+
+    /**
+     * @brief Read digital inputs into a bit-packed buffer
+     *
+     * Allocation-free only when overridden by the driver; the default reads
+     * through a temporary vector<bool> on every call.
+     *
+     * @param[out] bits Packed input states, packedBitBytes(device count) bytes.
+     *                  Padding bits of the last byte are cleared.
+     * @return true on success, false on error or size mismatch
+     */
+    virtual bool readDigitalInputs(std::span<uint8_t> bits) {
+        std::vector<bool> tmp(bits.size() * 8);
+        if (!readDigitalInputs(tmp) || packedBitBytes(tmp.size()) != bits.size()) {
+            return false;
+        }
+        std::fill(bits.begin(), bits.end(), 0);
+        for (size_t i = 0; i < tmp.size(); ++i) {
+            if (tmp[i]) {
+                bits[i / 8] |= static_cast<uint8_t>(1u << (i % 8));
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Write digital outputs from a bit-packed buffer
+     *
+     * Allocation-free only when overridden by the driver; the default unpacks
+     * into a temporary vector<bool> on every call.
+     *
+     * @param[in] bits Packed output states, packedBitBytes(device count) bytes.
+     *                 Padding bits of the last byte are ignored.
+     * @return true on success, false on error or size mismatch
+     */
+    virtual bool writeDigitalOutputs(std::span<const uint8_t> bits) {
+        std::vector<bool> tmp(getDeviceCount());
+        if (packedBitBytes(tmp.size()) != bits.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < tmp.size(); ++i) {
+            tmp[i] = (bits[i / 8] >> (i % 8)) & 1u;
+        }
+        return writeDigitalOutputs(tmp);
+    }
+
     /**
      * @brief Get current fieldbus status
      *
@@ -4,9 +4,23 @@
 #include <spdlog/async.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/sinks/basic_file_sink.h>
+#include <spdlog/details/os.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <string_view>
 #include <thread>
+#include <tuple>
+#include <type_traits>
 #include <atomic>
+#include <vector>
 
 namespace mxrc::core::logging {
 
@@ -14,6 +28,486 @@ namespace mxrc::core::logging {
 static std::atomic<bool> g_flush_thread_running{false};
 static std::thread g_flush_thread;
 
+// ============================================================================
+// Hot-path 로깅 프런트엔드 (MXRC_LOG_*)
+//
+// 호출 스레드는 포맷 문자열 포인터와 인자 원시 바이트만 스레드별 SPSC 링의
+// 고정 크기 레코드에 복사하고 반환합니다. 포맷팅과 sink 출력은 백엔드 스레드가
+// 수행합니다. 링이 가득 차면 메시지를 드롭하고 개수만 세므로 호출자는 절대
+// 블록되지 않으며, 스레드 첫 호출(또는 register_log_thread()) 이후 할당이 없습니다.
+//
+// 제약:
+// - 포맷 문자열은 문자열 리터럴 (컴파일 타임 검사, 포인터만 저장)
+// - 인자는 산술/열거형/포인터/문자열 (문자열은 레코드 남은 공간만큼 잘림)
+// ============================================================================
+
+namespace fastlog {
+
+inline constexpr size_t kRecordSize = 128;
+inline constexpr size_t kHeaderSize = 28;
+inline constexpr size_t kPayloadSize = kRecordSize - kHeaderSize;
+inline constexpr size_t kDefaultRingCapacity = 1024;
+
+struct Record;
+using DecodeFn = void (*)(const Record& record, fmt::memory_buffer& out);
+
+/// @brief 링 슬롯 하나 (캐시 라인 2개)
+struct alignas(64) Record {
+    DecodeFn decode;              ///< 인자 타입 목록별 디코더
+    const char* format;           ///< 포맷 문자열 (리터럴)
+    int64_t timestamp_ns;         ///< log_clock 기준 시각
+    uint16_t format_length;       ///< 포맷 문자열 길이
+    uint8_t level;                ///< spdlog::level::level_enum
+    uint8_t reserved;
+    char payload[kPayloadSize];   ///< 고정 크기 인자 → 문자열 바이트 순
+};
+static_assert(sizeof(Record) == kRecordSize, "Record must be exactly two cache lines");
+static_assert(offsetof(Record, payload) == kHeaderSize, "Unexpected Record header layout");
+
+template <typename T>
+inline constexpr bool is_string_arg_v =
+    std::is_same_v<T, const char*> || std::is_same_v<T, char*> ||
+    std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>;
+
+/// @brief 레코드에 저장되는 고정 크기 표현
+template <typename T, typename = void>
+struct StoredArg {
+    static_assert(std::is_arithmetic_v<T> || std::is_pointer_v<T> ||
+                  std::is_null_pointer_v<T> || is_string_arg_v<T>,
+                  "MXRC_LOG_* arguments must be arithmetic, enum, pointer or string");
+    using type = std::conditional_t<std::is_arithmetic_v<T>, T, const void*>;
+};
+
+template <typename T>
+struct StoredArg<T, std::enable_if_t<std::is_enum_v<T>>> {
+    using type = std::underlying_type_t<T>;
+};
+
+template <typename T>
+using stored_arg_t = typename StoredArg<T>::type;
+
+/// @brief 백엔드에서 포맷팅에 넘기는 타입 (문자열은 레코드 내부 string_view)
+template <typename T>
+using decoded_arg_t = std::conditional_t<is_string_arg_v<T>, std::string_view, stored_arg_t<T>>;
+
+template <typename T>
+inline constexpr size_t fixed_size_v = is_string_arg_v<T> ? sizeof(uint16_t) : sizeof(stored_arg_t<T>);
+
+template <typename... Args>
+inline constexpr size_t fixed_total_v = (size_t{0} + ... + fixed_size_v<Args>);
+
+template <typename T>
+inline void encode_arg(char*& fixed, char*& strings, const char* end, const T& value) {
+    using D = std::decay_t<T>;
+    if constexpr (is_string_arg_v<D>) {
+        std::string_view view;
+        if constexpr (std::is_pointer_v<D>) {
+            view = value ? std::string_view(value) : std::string_view("(null)");
+        } else {
+            view = value;
+        }
+        auto length = static_cast<uint16_t>(std::min<size_t>(
+            {view.size(), static_cast<size_t>(end - strings), std::numeric_limits<uint16_t>::max()}));
+        std::memcpy(strings, view.data(), length);
+        strings += length;
+        std::memcpy(fixed, &length, sizeof(length));
+        fixed += sizeof(length);
+    } else {
+        auto stored = [&]() {
+            if constexpr (std::is_arithmetic_v<D> || std::is_enum_v<D>) {
+                return static_cast<stored_arg_t<D>>(value);
+            } else {
+                return static_cast<const void*>(value);
+            }
+        }();
+        std::memcpy(fixed, &stored, sizeof(stored));
+        fixed += sizeof(stored);
+    }
+}
+
+template <typename T>
+inline decoded_arg_t<T> decode_arg(const char*& fixed, const char*& strings) {
+    if constexpr (is_string_arg_v<T>) {
+        uint16_t length;
+        std::memcpy(&length, fixed, sizeof(length));
+        fixed += sizeof(length);
+        std::string_view view(strings, length);
+        strings += length;
+        return view;
+    } else {
+        stored_arg_t<T> value;
+        std::memcpy(&value, fixed, sizeof(value));
+        fixed += sizeof(value);
+        return value;
+    }
+}
+
+template <typename... Args>
+inline void decode_record(const Record& record, fmt::memory_buffer& out) {
+    const char* fixed = record.payload;
+    const char* strings = record.payload + fixed_total_v<Args...>;
+    // 중괄호 초기화는 왼쪽부터 평가되므로 인코딩 순서와 일치
+    std::tuple<decoded_arg_t<Args>...> values{decode_arg<Args>(fixed, strings)...};
+    std::apply([&](const auto&... v) {
+        fmt::vformat_to(std::back_inserter(out),
+                        fmt::string_view(record.format, record.format_length),
+                        fmt::make_format_args(v...));
+    }, values);
+}
+
+/**
+ * @brief 스레드별 로그 링 (단일 생산자: 소유 스레드, 단일 소비자: 백엔드)
+ */
+class LogRing {
+public:
+    explicit LogRing(size_t capacity) {
+        size_t rounded = 1;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        mask_ = rounded - 1;
+        slots_ = std::make_unique<Record[]>(rounded);
+        thread_id_ = spdlog::details::os::thread_id();
+    }
+
+    /// @brief 생산자: 다음 슬롯 (가득 차면 nullptr)
+    Record* reserve() {
+        uint64_t write = write_.load(std::memory_order_relaxed);
+        if (write - cached_read_ > mask_) {
+            cached_read_ = read_.load(std::memory_order_acquire);
+            if (write - cached_read_ > mask_) {
+                return nullptr;
+            }
+        }
+        return &slots_[write & mask_];
+    }
+
+    /// @brief 생산자: reserve()한 슬롯 게시
+    void commit() {
+        write_.store(write_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /// @brief 소비자: 가장 오래된 레코드 (없으면 nullptr)
+    const Record* front() const {
+        uint64_t read = read_.load(std::memory_order_relaxed);
+        if (read == write_.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        return &slots_[read & mask_];
+    }
+
+    /// @brief 소비자: front() 레코드 반환
+    void pop() {
+        read_.store(read_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    void count_drop() { dropped_.fetch_add(1, std::memory_order_relaxed); }
+    uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+    size_t thread_id() const { return thread_id_; }
+    size_t capacity() const { return mask_ + 1; }
+
+    std::atomic<bool> retired{false};   ///< 소유 스레드 종료 (비우면 제거)
+    uint64_t reported_drops = 0;        ///< 백엔드가 보고한 드롭 수
+
+private:
+    std::unique_ptr<Record[]> slots_;
+    uint64_t mask_ = 0;
+    size_t thread_id_ = 0;
+    alignas(64) std::atomic<uint64_t> write_{0};
+    uint64_t cached_read_ = 0;          ///< 생산자 측 read_ 캐시
+    alignas(64) std::atomic<uint64_t> read_{0};
+    std::atomic<uint64_t> dropped_{0};
+};
+
+/**
+ * @brief 로그 링 백엔드 (링 등록, 시간순 병합, 포맷팅, sink 출력)
+ *
+ * 출력 대상은 spdlog 기본 로거의 sink입니다. 백엔드 스레드가 이미 비동기
+ * 단계이므로 async_logger 큐를 다시 거치지 않고 sink에 직접 기록합니다.
+ */
+class Backend {
+public:
+    static Backend& instance() {
+        // spdlog registry가 먼저 생성되어야 백엔드보다 늦게 파괴됨
+        spdlog::details::registry::instance();
+        static Backend backend;
+        return backend;
+    }
+
+    ~Backend() { stop(); }
+
+    /// @brief 백엔드 스레드 시작 (이미 실행 중이면 무시, stop() 이후 재시작 허용)
+    void start() {
+        std::lock_guard<std::mutex> lock(control_mutex_);
+        shut_down_.store(false, std::memory_order_release);
+        startLocked();
+    }
+
+    /// @brief 남은 레코드를 모두 출력하고 백엔드 스레드 종료
+    ///
+    /// 이후 MXRC_LOG_* 호출은 start()가 다시 호출될 때까지 버려짐 (자동 재시작 없음)
+    void stop() {
+        std::lock_guard<std::mutex> lock(control_mutex_);
+        shut_down_.store(true, std::memory_order_release);
+        if (!running_.exchange(false)) {
+            return;
+        }
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        drain(std::numeric_limits<size_t>::max());
+    }
+
+    bool running() const { return running_.load(std::memory_order_acquire); }
+
+    /// @brief stop()으로 명시적으로 종료된 상태인지
+    bool shut_down() const { return shut_down_.load(std::memory_order_acquire); }
+
+    /// @brief 현재 스레드의 링 (첫 호출 시 할당 및 등록, 실패 시 nullptr)
+    LogRing* this_thread_ring(size_t capacity = kDefaultRingCapacity) noexcept {
+        thread_local RingHandle handle;
+        if (!handle.ring) {
+            try {
+                auto ring = std::make_shared<LogRing>(capacity);
+                {
+                    std::lock_guard<std::mutex> lock(rings_mutex_);
+                    rings_.push_back(ring);
+                }
+                handle.ring = std::move(ring);
+                // 첫 사용 시 자동 시작 (명시적 stop() 이후에는 시작하지 않음)
+                std::lock_guard<std::mutex> lock(control_mutex_);
+                if (!shut_down_.load(std::memory_order_relaxed)) {
+                    startLocked();
+                }
+            } catch (...) {
+                return nullptr;
+            }
+        }
+        return handle.ring.get();
+    }
+
+    /// @brief 링에 남은 레코드를 최대 maxCount개 출력
+    size_t drain(size_t maxCount) {
+        std::lock_guard<std::mutex> drainLock(drain_mutex_);
+        {
+            std::lock_guard<std::mutex> lock(rings_mutex_);
+            snapshot_ = rings_;
+        }
+
+        // 배치마다 기본 로거를 shared_ptr로 고정 (set_default_logger와 경합 방지)
+        auto target = spdlog::default_logger();
+        auto* logger = target.get();
+        size_t written = 0;
+        bool flush = false;
+        while (written < maxCount) {
+            // 스레드 간 시간순 병합: 링 앞 레코드 중 가장 이른 것
+            LogRing* next = nullptr;
+            const Record* oldest = nullptr;
+            for (auto& ring : snapshot_) {
+                const Record* record = ring->front();
+                if (record && (!oldest || record->timestamp_ns < oldest->timestamp_ns)) {
+                    oldest = record;
+                    next = ring.get();
+                }
+            }
+            if (!oldest) {
+                break;
+            }
+            flush |= emit(logger, *oldest, next->thread_id());
+            next->pop();
+            ++written;
+        }
+
+        reportDropsAndPrune(logger, flush);
+        if (flush && logger) {
+            logger->flush();
+        }
+        snapshot_.clear();
+        return written;
+    }
+
+    /// @brief 전체 드롭 수 (링 가득 참)
+    uint64_t dropped() const {
+        std::lock_guard<std::mutex> lock(rings_mutex_);
+        uint64_t total = retired_drops_;
+        for (const auto& ring : rings_) {
+            total += ring->dropped();
+        }
+        return total;
+    }
+
+private:
+    struct RingHandle {
+        std::shared_ptr<LogRing> ring;
+        ~RingHandle() {
+            if (ring) {
+                ring->retired.store(true, std::memory_order_release);
+            }
+        }
+    };
+
+    Backend() = default;
+
+    void startLocked() {
+        if (running_.exchange(true)) {
+            return;
+        }
+        thread_ = std::thread([this]() { run(); });
+    }
+
+    void run() {
+        constexpr size_t kBatchSize = 512;
+        while (running_.load(std::memory_order_acquire)) {
+            if (drain(kBatchSize) == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+
+    /// @brief 레코드 포맷팅 후 sink 출력 (flush 필요 여부 반환)
+    bool emit(spdlog::logger* logger, const Record& record, size_t threadId) {
+        if (!logger) {
+            return false;
+        }
+        auto level = static_cast<spdlog::level::level_enum>(record.level);
+        buffer_.clear();
+        try {
+            record.decode(record, buffer_);
+        } catch (const std::exception& e) {
+            buffer_.clear();
+            fmt::format_to(std::back_inserter(buffer_), "[fastlog format error: {}] {}",
+                           e.what(), std::string_view(record.format, record.format_length));
+        }
+
+        auto time = spdlog::log_clock::time_point(
+            std::chrono::duration_cast<spdlog::log_clock::duration>(
+                std::chrono::nanoseconds(record.timestamp_ns)));
+        spdlog::details::log_msg msg(time, spdlog::source_loc{}, logger->name(), level,
+                                     spdlog::string_view_t(buffer_.data(), buffer_.size()));
+        msg.thread_id = threadId;
+        writeToSinks(logger, msg);
+        return level >= logger->flush_level();
+    }
+
+    void writeToSinks(spdlog::logger* logger, const spdlog::details::log_msg& msg) {
+        for (auto& sink : logger->sinks()) {
+            if (sink->should_log(msg.level)) {
+                try {
+                    sink->log(msg);
+                } catch (const std::exception& e) {
+                    std::fprintf(stderr, "Logger error: %s\n", e.what());
+                }
+            }
+        }
+    }
+
+    void reportDropsAndPrune(spdlog::logger* logger, bool& flush) {
+        for (auto& ring : snapshot_) {
+            uint64_t dropped = ring->dropped();
+            if (dropped != ring->reported_drops && logger) {
+                buffer_.clear();
+                fmt::format_to(std::back_inserter(buffer_),
+                               "fastlog: {} messages dropped (ring full, capacity {})",
+                               dropped - ring->reported_drops, ring->capacity());
+                spdlog::details::log_msg msg(logger->name(), spdlog::level::warn,
+                                             spdlog::string_view_t(buffer_.data(), buffer_.size()));
+                msg.thread_id = ring->thread_id();
+                writeToSinks(logger, msg);
+                flush |= spdlog::level::warn >= logger->flush_level();
+            }
+            ring->reported_drops = dropped;
+        }
+
+        std::lock_guard<std::mutex> lock(rings_mutex_);
+        rings_.erase(std::remove_if(rings_.begin(), rings_.end(), [this](const auto& ring) {
+            bool done = ring->retired.load(std::memory_order_acquire) && !ring->front();
+            if (done) {
+                retired_drops_ += ring->dropped();
+            }
+            return done;
+        }), rings_.end());
+    }
+
+    mutable std::mutex rings_mutex_;                  ///< rings_ 보호 (등록/정리 시에만)
+    std::vector<std::shared_ptr<LogRing>> rings_;     ///< 등록된 링
+    uint64_t retired_drops_ = 0;                      ///< 제거된 링의 드롭 수
+    std::mutex drain_mutex_;                          ///< 단일 소비자 보장
+    std::vector<std::shared_ptr<LogRing>> snapshot_;  ///< drain용 링 목록 (재사용)
+    fmt::memory_buffer buffer_;                       ///< 포맷 버퍼 (재사용)
+    std::mutex control_mutex_;                        ///< start/stop 직렬화
+    std::atomic<bool> running_{false};
+    std::atomic<bool> shut_down_{false};              ///< stop() 이후 (자동 시작 금지)
+    std::thread thread_;
+};
+
+/**
+ * @brief 레코드 기록 (MXRC_LOG_* 매크로에서 호출)
+ *
+ * 기본 로거 레벨 검사 → 링 슬롯 예약 → 인자 복사 → 게시.
+ * 블록/할당/포맷팅 없음 (스레드 첫 호출의 링 할당 제외).
+ * shutdown_logger() 이후에는 기록하지 않음.
+ */
+template <typename... Args>
+inline void log(spdlog::level::level_enum level,
+                fmt::format_string<decoded_arg_t<std::decay_t<Args>>...> format,
+                Args&&... args) noexcept {
+    static_assert(fixed_total_v<std::decay_t<Args>...> <= kPayloadSize,
+                  "Too many MXRC_LOG_* arguments for one record");
+
+    auto* logger = spdlog::default_logger_raw();
+    if (logger && !logger->should_log(level)) {
+        return;
+    }
+
+    Backend& backend = Backend::instance();
+    if (backend.shut_down()) {
+        return;  // shutdown_logger() 이후: 소비자 없음
+    }
+    LogRing* ring = backend.this_thread_ring();
+    if (!ring) {
+        return;
+    }
+    Record* record = ring->reserve();
+    if (!record) {
+        ring->count_drop();
+        return;
+    }
+
+    fmt::string_view view = format;
+    record->decode = &decode_record<std::decay_t<Args>...>;
+    record->format = view.data();
+    record->format_length = static_cast<uint16_t>(view.size());
+    record->level = static_cast<uint8_t>(level);
+    record->timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        spdlog::log_clock::now().time_since_epoch()).count();
+
+    char* fixed = record->payload;
+    char* strings = record->payload + fixed_total_v<std::decay_t<Args>...>;
+    (encode_arg(fixed, strings, record->payload + kPayloadSize, args), ...);
+    ring->commit();
+}
+
+}  // namespace fastlog
+
+/**
+ * 현재 스레드의 hot-path 로그 링 미리 할당
+ *
+ * 목적: RT 스레드 초기화 단계에서 호출하여 첫 MXRC_LOG_* 호출의 할당을 제거
+ *
+ * @param capacity 링 레코드 수 (2의 거듭제곱으로 올림, 레코드당 128바이트)
+ * @return 링이 준비되면 true
+ */
+inline bool register_log_thread(size_t capacity = fastlog::kDefaultRingCapacity) {
+    return fastlog::Backend::instance().this_thread_ring(capacity) != nullptr;
+}
+
+/**
+ * hot-path 로그 드롭 수 (링 가득 참으로 버려진 메시지)
+ */
+inline uint64_t fast_log_dropped() {
+    return fastlog::Backend::instance().dropped();
+}
+
 /**
  * 비동기 로거 초기화
  *
@@ -69,12 +563,15 @@ inline void initialize_async_logger() {
 
         // 에러 핸들러 설정
         async_logger->set_error_handler([](const std::string& msg) {
-            std::cerr << "Logger error: " << msg << std::endl;
+            std::fprintf(stderr, "Logger error: %s\n", msg.c_str());
         });
 
         // 기본 로거로 설정
         spdlog::set_default_logger(async_logger);
 
+        // hot-path 로그 백엔드 시작 (MXRC_LOG_*)
+        fastlog::Backend::instance().start();
+
         // 주기적 flush 스레드 시작 (3초 간격)
         g_flush_thread_running = true;
         g_flush_thread = std::thread([]() {
@@ -89,7 +586,7 @@ inline void initialize_async_logger() {
         spdlog::info("Async logger initialized successfully");
 
     } catch (const spdlog::spdlog_ex& ex) {
-        std::cerr << "Log initialization failed: " << ex.what() << std::endl;
+        std::fprintf(stderr, "Log initialization failed: %s\n", ex.what());
         throw;
     }
 }
@@ -107,11 +604,15 @@ inline void initialize_async_logger() {
  * - 모든 파일 핸들 닫힘
  * - 백그라운드 스레드 종료됨
  * - 주기적 flush 스레드 종료됨
+ * - hot-path 로그 링의 남은 메시지 출력 후 백엔드 종료됨
  *
  * 성능 계약:
  * - 호출 시간 < 1초 (큐 크기에 따라 변동)
  */
 inline void shutdown_logger() {
+    // hot-path 로그 백엔드 종료 (기본 로거가 살아있는 동안 남은 레코드 출력)
+    fastlog::Backend::instance().stop();
+
     // 주기적 flush 스레드 종료
     if (g_flush_thread_running.load()) {
         g_flush_thread_running = false;
@@ -125,3 +626,11 @@ inline void shutdown_logger() {
 }
 
 }  // namespace mxrc::core::logging
+
+// Hot-path 로그 매크로 (포맷 문자열은 리터럴, 호출자는 블록/할당/포맷팅 없음)
+#define MXRC_LOG_TRACE(...) ::mxrc::core::logging::fastlog::log(spdlog::level::trace, __VA_ARGS__)
+#define MXRC_LOG_DEBUG(...) ::mxrc::core::logging::fastlog::log(spdlog::level::debug, __VA_ARGS__)
+#define MXRC_LOG_INFO(...) ::mxrc::core::logging::fastlog::log(spdlog::level::info, __VA_ARGS__)
+#define MXRC_LOG_WARN(...) ::mxrc::core::logging::fastlog::log(spdlog::level::warn, __VA_ARGS__)
+#define MXRC_LOG_ERROR(...) ::mxrc::core::logging::fastlog::log(spdlog::level::err, __VA_ARGS__)
+#define MXRC_LOG_CRITICAL(...) ::mxrc::core::logging::fastlog::log(spdlog::level::critical, __VA_ARGS__)
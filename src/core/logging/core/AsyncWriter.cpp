@@ -4,9 +4,23 @@
 
 namespace mxrc::core::logging {
 
-AsyncWriter::AsyncWriter(const std::string& filepath, size_t queueCapacity)
-    : filepath_(filepath), queueCapacity_(queueCapacity) {
-    spdlog::info("AsyncWriter created for file: {}, queue capacity: {}", filepath_, queueCapacity_);
+namespace {
+
+// 깨우기 신호를 놓쳐도 이 주기 안에 큐를 다시 확인
+constexpr auto kIdleWait = std::chrono::milliseconds(50);
+
+}  // namespace
+
+AsyncWriter::AsyncWriter(const std::string& filepath, size_t queueCapacity, BagFormat format,
+                         ChunkCompression compression)
+    : filepath_(filepath), queueCapacity_(queueCapacity), messageQueue_(queueCapacity),
+      format_(format) {
+    if (format_ == BagFormat::Binary) {
+        chunkWriter_ = std::make_unique<BinaryChunkWriter>(BinaryChunkWriter::kDefaultChunkSize,
+                                                           compression);
+    }
+    spdlog::info("AsyncWriter created for file: {}, queue capacity: {}, format: {}", filepath_,
+                 queueCapacity_, format_ == BagFormat::Binary ? "binary" : "jsonl");
 }
 
 AsyncWriter::~AsyncWriter() {
@@ -22,8 +36,7 @@ void AsyncWriter::start() {
     }
 
     // 파일 열기
-    ofs_.open(filepath_, std::ios::out | std::ios::app);
-    if (!ofs_.is_open()) {
+    if (!sink_.open(filepath_)) {
         spdlog::error("Failed to open file for writing: {}", filepath_);
         throw std::runtime_error("Failed to open file: " + filepath_);
     }
@@ -40,39 +53,52 @@ void AsyncWriter::stop() {
 
     spdlog::info("Stopping AsyncWriter...");
     running_.store(false);
-    cv_.notify_all();
+    wakeWriter();
 
     if (writerThread_.joinable()) {
         writerThread_.join();
     }
 
-    if (ofs_.is_open()) {
-        ofs_.flush();
-        ofs_.close();
-    }
+    sink_.close();
 
     spdlog::info("AsyncWriter stopped");
 }
 
 bool AsyncWriter::tryPush(const BagMessage& msg) {
-    std::lock_guard<std::mutex> lock(queueMutex_);
-
-    if (messageQueue_.size() >= queueCapacity_) {
+    if (!messageQueue_.tryPush(msg)) {
         droppedCount_.fetch_add(1, std::memory_order_relaxed);
         spdlog::warn("Message queue full, dropping message. Dropped count: {}", droppedCount_.load());
         return false;
     }
 
-    messageQueue_.push(msg);
-    cv_.notify_one();
+    // 쓰기 스레드가 기록 중이면 깨울 필요 없음 (writerLoop의 fence와 짝)
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (writerIdle_.load(std::memory_order_relaxed)) {
+        wakeWriter();
+    }
     return true;
 }
 
 bool AsyncWriter::flush(uint32_t timeoutMs) {
+    if (!running_.load()) {
+        return queueSize() == 0;
+    }
+
+    // 지금까지 추가된 메시지 위치를 목표로 기록 (요청 시퀀스 증가 전에 갱신)
+    uint64_t target = messageQueue_.writePosition();
+    uint64_t current = flushTarget_.load(std::memory_order_relaxed);
+    while (current < target &&
+           !flushTarget_.compare_exchange_weak(current, target, std::memory_order_acq_rel)) {
+    }
+
+    // 쓰기 스레드에 flush 요청 (파일은 쓰기 스레드만 건드림)
+    uint64_t ticket = flushRequested_.fetch_add(1, std::memory_order_acq_rel) + 1;
+    wakeWriter();
+
     auto startTime = std::chrono::steady_clock::now();
 
-    while (queueSize() > 0) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    while (flushCompleted_.load(std::memory_order_acquire) < ticket) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
 
         if (timeoutMs > 0) {
             auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -86,16 +112,14 @@ bool AsyncWriter::flush(uint32_t timeoutMs) {
         }
     }
 
-    // 파일 스트림 flush
-    if (ofs_.is_open()) {
-        ofs_.flush();
-    }
-
     return true;
 }
 
+void AsyncWriter::setSyncInterval(uint32_t intervalMs) {
+    syncIntervalMs_ = intervalMs;
+}
+
 size_t AsyncWriter::queueSize() const {
-    std::lock_guard<std::mutex> lock(queueMutex_);
     return messageQueue_.size();
 }
 
@@ -112,62 +136,117 @@ uint64_t AsyncWriter::getBytesWritten() const {
 }
 
 bool AsyncWriter::isOpen() const {
-    return ofs_.is_open();
+    return sink_.isOpen();
 }
 
-void AsyncWriter::writerLoop() {
-    spdlog::info("Writer thread started");
+void AsyncWriter::wakeWriter() {
+    // 쓰기 스레드의 조건 확인과 wait 사이에 notify가 끼어들지 않도록 뮤텍스 경유
+    { std::lock_guard<std::mutex> lock(wakeMutex_); }
+    cv_.notify_one();
+}
+
+void AsyncWriter::writeMessage(const BagMessage& msg) {
+    try {
+        if (chunkWriter_) {
+            if (!chunkWriter_->append(msg, sink_)) {
+                return;
+            }
+            bytesWritten_.store(chunkWriter_->bytesWritten(), std::memory_order_relaxed);
+        } else {
+            std::string line = msg.toJsonLine();
+            if (!sink_.append(line.data(), line.size())) {
+                return;
+            }
+            bytesWritten_.fetch_add(line.size(), std::memory_order_relaxed);
+        }
 
-    while (running_.load() || !messageQueue_.empty()) {
-        std::unique_lock<std::mutex> lock(queueMutex_);
+        writtenCount_.fetch_add(1, std::memory_order_relaxed);
 
-        // 큐가 비어있으면 대기
-        cv_.wait(lock, [this] {
-            return !messageQueue_.empty() || !running_.load();
-        });
+    } catch (const std::exception& e) {
+        spdlog::error("Failed to write message: {}", e.what());
+    }
+}
 
-        // 메시지 처리
-        while (!messageQueue_.empty()) {
-            BagMessage msg = messageQueue_.front();
-            messageQueue_.pop();
+void AsyncWriter::flushPending() {
+    if (chunkWriter_) {
+        chunkWriter_->flushChunk(sink_);
+        bytesWritten_.store(chunkWriter_->bytesWritten(), std::memory_order_relaxed);
+    }
+    sink_.flush();
+}
 
-            // 락 해제 후 디스크 쓰기 (I/O는 락 외부에서)
-            lock.unlock();
+size_t AsyncWriter::drainBatch() {
+    size_t count = 0;
+    BagMessage msg;
+    while (count < kWriteBatchSize && messageQueue_.tryPop(msg)) {
+        writeMessage(msg);
+        count++;
+    }
+    return count;
+}
 
-            try {
-                std::string line = msg.toJsonLine();
-                ofs_ << line;
+void AsyncWriter::writerLoop() {
+    spdlog::info("Writer thread started");
 
-                writtenCount_.fetch_add(1, std::memory_order_relaxed);
-                bytesWritten_.fetch_add(line.size(), std::memory_order_relaxed);
+    auto lastSync = std::chrono::steady_clock::now();
+    bool unsynced = false;
+    bool stopping = false;
+    uint64_t stopTarget = 0;
+
+    while (true) {
+        // 요청 시퀀스를 먼저 읽으면 flushTarget_은 이 시퀀스까지의 모든 요청 목표를 포함
+        uint64_t requested = flushRequested_.load(std::memory_order_acquire);
+        if (!stopping && !running_.load()) {
+            // stop() 시점까지 추가된 메시지까지만 기록 (생산자가 계속 push해도 종료)
+            stopping = true;
+            stopTarget = messageQueue_.writePosition();
+        }
 
-            } catch (const std::exception& e) {
-                spdlog::error("Failed to write message: {}", e.what());
-            }
+        // 배치 하나만 기록하고 flush/sync를 확인 (큐가 계속 차 있어도 굶지 않음)
+        size_t written = drainBatch();
+        unsynced = unsynced || written > 0;
 
-            lock.lock();
+        if (requested != flushCompleted_.load(std::memory_order_relaxed) &&
+            messageQueue_.readPosition() >= flushTarget_.load(std::memory_order_acquire)) {
+            flushPending();
+            flushCompleted_.store(requested, std::memory_order_release);
         }
-    }
 
-    // 남은 메시지가 있으면 모두 처리
-    std::lock_guard<std::mutex> lock(queueMutex_);
-    while (!messageQueue_.empty()) {
-        try {
-            BagMessage msg = messageQueue_.front();
-            messageQueue_.pop();
+        if (syncIntervalMs_ > 0 && unsynced) {
+            auto now = std::chrono::steady_clock::now();
+            if (now - lastSync >= std::chrono::milliseconds(syncIntervalMs_)) {
+                flushPending();
+                sink_.sync();
+                lastSync = now;
+                unsynced = false;
+            }
+        }
 
-            std::string line = msg.toJsonLine();
-            ofs_ << line;
+        if (stopping && messageQueue_.readPosition() >= stopTarget) {
+            break;
+        }
 
-            writtenCount_.fetch_add(1, std::memory_order_relaxed);
-            bytesWritten_.fetch_add(line.size(), std::memory_order_relaxed);
+        if (written > 0) {
+            continue;
+        }
 
-        } catch (const std::exception& e) {
-            spdlog::error("Failed to write remaining message: {}", e.what());
+        // 큐가 비었으면 대기 (tryPush의 fence와 짝: 둘 중 하나는 상대를 관찰)
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        writerIdle_.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (messageQueue_.empty() && running_.load() &&
+            flushRequested_.load(std::memory_order_acquire) ==
+                flushCompleted_.load(std::memory_order_relaxed)) {
+            cv_.wait_for(lock, kIdleWait);
         }
+        writerIdle_.store(false, std::memory_order_relaxed);
     }
 
-    ofs_.flush();
+    // 남은 청크/스테이징 기록 (sync 주기가 설정되어 있으면 디스크 동기화)
+    flushPending();
+    if (syncIntervalMs_ > 0) {
+        sink_.sync();
+    }
     spdlog::info("Writer thread stopped. Total written: {}", writtenCount_.load());
 }
 
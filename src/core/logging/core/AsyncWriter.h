@@ -3,13 +3,15 @@
 
 #include "dto/BagMessage.h"
 #include "dto/DataType.h"
+#include "dto/BagFormat.h"
+#include "util/BinaryChunkWriter.h"
+#include "util/BagFileSink.h"
+#include "core/event/util/MPSCLockFreeQueue.h"
 #include <string>
 #include <thread>
-#include <queue>
 #include <mutex>
 #include <condition_variable>
 #include <atomic>
-#include <fstream>
 #include <memory>
 
 namespace mxrc::core::logging {
@@ -17,14 +19,18 @@ namespace mxrc::core::logging {
 /**
  * @brief 비동기 Bag 파일 쓰기 클래스
  *
- * std::thread + std::queue를 사용한 논블로킹 파일 I/O를 제공합니다.
+ * std::thread + MPSCLockFreeQueue를 사용한 논블로킹 파일 I/O를 제공합니다.
  * EventBus 기반 아키텍처와 일관성을 유지하며, 실시간 성능 영향을 최소화합니다.
  *
  * 주요 특징:
- * - tryPush(): 논블로킹 (큐 가득 차면 false 반환)
+ * - tryPush(): lock-free enqueue 1회 (큐 가득 차면 false 반환)
+ *   쓰기 스레드가 유휴 상태일 때만 깨우기 위해 뮤텍스를 잡음
+ * - 쓰기 스레드는 배치(kWriteBatchSize) 하나를 기록할 때마다 flush 요청과
+ *   fdatasync 주기를 확인하고 BagFileSink(정렬 버퍼 + writev)로 기록
+ * - setSyncInterval()로 fdatasync 주기 설정
  * - 큐 오버플로우 시 드롭 정책 (통계 기록)
  * - RAII 원칙 준수 (소멸자에서 안전한 종료)
- * - 성능 영향: ~50-200ns (mutex lock + queue push)
+ * - BagFormat::Binary: 쓰기 스레드에서 BinaryChunkWriter로 청크 인코딩
  */
 class AsyncWriter {
 public:
@@ -32,8 +38,12 @@ public:
      * @brief AsyncWriter 생성자
      * @param filepath 쓰기 대상 파일 경로
      * @param queueCapacity 큐 최대 용량 (기본값: 10,000)
+     * @param format 데이터 영역 포맷 (기본값: JSONL)
+     * @param compression Binary 포맷 청크 압축 방식 (기본값: 없음)
      */
-    explicit AsyncWriter(const std::string& filepath, size_t queueCapacity = 10000);
+    explicit AsyncWriter(const std::string& filepath, size_t queueCapacity = 10000,
+                         BagFormat format = BagFormat::Jsonl,
+                         ChunkCompression compression = ChunkCompression::None);
 
     /**
      * @brief 소멸자 - 큐를 비우고 스레드 안전하게 종료
@@ -50,7 +60,7 @@ public:
     void start();
 
     /**
-     * @brief Writer 스레드 중지 (큐가 빌 때까지 대기)
+     * @brief Writer 스레드 중지 (호출 시점까지 추가된 메시지를 기록할 때까지 대기)
      */
     void stop();
 
@@ -63,13 +73,29 @@ public:
 
     /**
      * @brief 모든 메시지가 디스크에 쓰일 때까지 대기
+     *
+     * 호출 시점까지 큐에 추가된 메시지를 쓰기 스레드가 모두 기록하고
+     * (Binary 포맷은 현재 청크 포함) 스트림을 flush하면 반환합니다.
+     * 이후에 추가되는 메시지는 기다리지 않으므로 생산자가 큐를 계속 채워도
+     * 반환이 지연되지 않습니다.
+     *
      * @param timeoutMs 타임아웃 (밀리초), 0이면 무한 대기
      * @return 성공하면 true, 타임아웃 시 false
      */
     bool flush(uint32_t timeoutMs = 5000);
 
     /**
-     * @brief 현재 큐에 대기 중인 메시지 개수
+     * @brief fdatasync 주기 설정 (start() 전에 호출)
+     *
+     * 쓰기 스레드가 배치를 기록한 뒤 마지막 sync 이후 intervalMs가 지났으면
+     * fdatasync를 호출하고, stop() 시에도 sync합니다. 0이면 sync하지 않습니다.
+     *
+     * @param intervalMs sync 주기 (밀리초)
+     */
+    void setSyncInterval(uint32_t intervalMs);
+
+    /**
+     * @brief 현재 큐에 대기 중인 메시지 개수 (근사값)
      * @return 큐 크기
      */
     size_t queueSize() const;
@@ -88,6 +114,9 @@ public:
 
     /**
      * @brief 총 쓰기 바이트 수 조회
+     *
+     * Binary 포맷은 파일에 기록된 청크 바이트 수 (압축 후, 미기록 청크 제외)입니다.
+     *
      * @return 바이트 수
      */
     uint64_t getBytesWritten() const;
@@ -98,20 +127,67 @@ public:
      */
     bool isOpen() const;
 
+    /**
+     * @brief 데이터 영역 포맷 조회
+     */
+    BagFormat getFormat() const { return format_; }
+
+    /**
+     * @brief 바이너리 청크 인코더 조회
+     *
+     * stop() 이후에만 접근해야 합니다 (쓰기 스레드 전용 상태).
+     *
+     * @return Binary 포맷이면 청크 인코더, 아니면 nullptr
+     */
+    const BinaryChunkWriter* getChunkWriter() const { return chunkWriter_.get(); }
+
 private:
     /**
      * @brief 백그라운드 쓰기 스레드 루프
      */
     void writerLoop();
 
+    /**
+     * @brief 메시지 하나를 포맷에 맞게 기록 (쓰기 스레드 전용)
+     */
+    void writeMessage(const BagMessage& msg);
+
+    /**
+     * @brief 버퍼된 데이터를 파일로 내보냄 (쓰기 스레드 전용)
+     */
+    void flushPending();
+
+    /**
+     * @brief 큐를 최대 kWriteBatchSize개까지 비워 기록 (쓰기 스레드 전용)
+     * @return 기록한 메시지 수
+     */
+    size_t drainBatch();
+
+    /**
+     * @brief 유휴 상태인 쓰기 스레드 깨우기
+     */
+    void wakeWriter();
+
+    /// @brief 한 번에 비우는 최대 메시지 수 (flush/sync 요청 확인 주기)
+    static constexpr size_t kWriteBatchSize = 256;
+
     std::string filepath_;                          ///< 쓰기 대상 파일 경로
     size_t queueCapacity_;                          ///< 큐 최대 용량
-    std::queue<BagMessage> messageQueue_;           ///< 메시지 큐
-    mutable std::mutex queueMutex_;                 ///< 큐 보호 뮤텍스
+    event::MPSCLockFreeQueue<BagMessage> messageQueue_; ///< 메시지 큐 (lock-free MPSC)
+    std::mutex wakeMutex_;                          ///< 쓰기 스레드 대기/깨우기 전용 뮤텍스
     std::condition_variable cv_;                    ///< 조건 변수
+    std::atomic<bool> writerIdle_{false};           ///< 쓰기 스레드 대기 여부
     std::thread writerThread_;                      ///< 백그라운드 스레드
     std::atomic<bool> running_{false};              ///< 실행 상태
-    std::ofstream ofs_;                             ///< 파일 스트림
+    BagFileSink sink_;                              ///< 파일 출력
+    uint32_t syncIntervalMs_ = 0;                   ///< fdatasync 주기 (0이면 비활성)
+    BagFormat format_;                              ///< 데이터 영역 포맷
+    std::unique_ptr<BinaryChunkWriter> chunkWriter_; ///< Binary 포맷 인코더
+
+    // flush 요청/완료 시퀀스 (쓰기 스레드가 요청 시점의 큐 위치까지 기록한 뒤 완료 처리)
+    std::atomic<uint64_t> flushRequested_{0};       ///< 요청된 flush 시퀀스
+    std::atomic<uint64_t> flushCompleted_{0};       ///< 완료된 flush 시퀀스
+    std::atomic<uint64_t> flushTarget_{0};          ///< 완료 전에 pop해야 할 큐 위치
 
     // 통계
     std::atomic<uint64_t> droppedCount_{0};         ///< 드롭된 메시지 수
@@ -1,6 +1,9 @@
 #include "BagReader.h"
+#include "util/ChunkCodec.h"
 #include <spdlog/spdlog.h>
 #include <algorithm>
+#include <cstring>
+#include <limits>
 
 namespace mxrc::core::logging {
 
@@ -14,7 +17,7 @@ BagReader::~BagReader() {
 
 bool BagReader::open(const std::string& filepath) {
     // 이미 열려있으면 먼저 닫기
-    if (ifs_.is_open()) {
+    if (isOpen()) {
         close();
     }
 
@@ -29,7 +32,7 @@ bool BagReader::open(const std::string& filepath) {
     // Footer 및 인덱스 로드
     footer_ = indexer_.readFromFile(filepath_);
 
-    if (!footer_.isValid()) {
+    if (!footer_.isValid() && !recoverBinary()) {
         spdlog::error("BagReader::open - Invalid bag file: {}", filepath);
         close();
         return false;
@@ -42,7 +45,29 @@ bool BagReader::open(const std::string& filepath) {
         return false;
     }
 
+    // 바이너리 포맷은 데이터 영역을 mmap으로 읽음 (복구 시 이미 매핑됨)
+    if (footer_.format() == BagFormat::Binary && !recovered_) {
+        ifs_.close();
+        if (!mapped_.open(filepath_) ||
+            mapped_.size() < static_cast<uint64_t>(footer_.index_offset)) {
+            spdlog::error("BagReader::open - Failed to map bag file: {}", filepath);
+            close();
+            return false;
+        }
+        binary_ = true;
+    }
+
+    // 청크 시작 타임스탬프는 파일 순서대로 증가하지 않을 수 있으므로 (여러 생산자)
+    // 시간 탐색에 청크별 [start, end] 범위를 사용. 인덱스(Chunk Range Block) 또는
+    // 복구 스캔에서 이미 얻었으며, 블록이 없는 이전 파일만 청크 헤더에서 로드
+    if (binary_ && !indexer_.hasChunkRanges()) {
+        indexer_.loadChunkRanges(mapped_.data(), footer_.index_offset);
+    }
+
     // 파일 시작 위치로 이동
+    rangeBegin_ = 0;
+    rangeEnd_ = footer_.index_offset;
+    resolveTopicFilter();
     seekToStart();
 
     spdlog::debug("BagReader::open - Opened {}, {} messages",
@@ -55,13 +80,28 @@ void BagReader::close() {
     if (ifs_.is_open()) {
         ifs_.close();
     }
+    mapped_.close();
+    binary_ = false;
+    recovered_ = false;
+    recordPos_ = nullptr;
+    recordEnd_ = nullptr;
+    nextChunkOffset_ = 0;
+    topicNames_.clear();
+    chunkFilter_ = false;
+    filterChunks_.clear();
     filepath_.clear();
     indexer_.clear();
     topicFilter_.clear();
     currentPosition_ = 0;
+    rangeBegin_ = 0;
+    rangeEnd_ = 0;
 }
 
 bool BagReader::hasNext() const {
+    if (binary_) {
+        return recordPos_ < recordEnd_ || nextChunkToRead() < rangeEnd_;
+    }
+
     if (!ifs_.is_open()) {
         return false;
     }
@@ -75,6 +115,10 @@ std::optional<BagMessage> BagReader::readNext() {
         return std::nullopt;
     }
 
+    if (binary_) {
+        return readNextBinary();
+    }
+
     while (isInDataArea()) {
         auto line = readLine();
         if (!line) {
@@ -100,7 +144,7 @@ std::optional<BagMessage> BagReader::readNext() {
 }
 
 bool BagReader::seekToTimestamp(uint64_t timestamp_ns) {
-    if (!ifs_.is_open()) {
+    if (!isOpen()) {
         spdlog::error("BagReader::seekToTimestamp - File not open");
         return false;
     }
@@ -110,6 +154,10 @@ bool BagReader::seekToTimestamp(uint64_t timestamp_ns) {
         return false;
     }
 
+    if (binary_) {
+        return seekBinary(timestamp_ns);
+    }
+
     bool found = false;
     IndexEntry entry = indexer_.findByTimestamp(timestamp_ns, found);
 
@@ -136,23 +184,65 @@ bool BagReader::seekToTimestamp(uint64_t timestamp_ns) {
 }
 
 void BagReader::seekToStart() {
+    if (binary_) {
+        recordPos_ = nullptr;
+        recordEnd_ = nullptr;
+        nextChunkOffset_ = rangeBegin_;
+        return;
+    }
+
     if (ifs_.is_open()) {
-        ifs_.seekg(0, std::ios::beg);
-        currentPosition_ = 0;
+        ifs_.clear();
+        ifs_.seekg(static_cast<std::streamoff>(rangeBegin_), std::ios::beg);
+        currentPosition_ = rangeBegin_;
+    }
+}
+
+bool BagReader::setReadRange(uint64_t beginOffset, uint64_t endOffset) {
+    if (!isOpen()) {
+        spdlog::error("BagReader::setReadRange - File not open");
+        return false;
+    }
+
+    uint64_t dataEnd = footer_.index_offset;
+    endOffset = std::min(endOffset, dataEnd);
+    if (beginOffset > endOffset) {
+        spdlog::error("BagReader::setReadRange - Invalid range [{}, {})", beginOffset, endOffset);
+        return false;
     }
+
+    rangeBegin_ = beginOffset;
+    rangeEnd_ = endOffset;
+    seekToStart();
+    return true;
+}
+
+void BagReader::clearReadRange() {
+    if (!isOpen()) {
+        return;
+    }
+    rangeBegin_ = 0;
+    rangeEnd_ = footer_.index_offset;
+    seekToStart();
 }
 
 void BagReader::setTopicFilter(const std::string& topic) {
     topicFilter_ = topic;
+    resolveTopicFilter();
     spdlog::debug("BagReader::setTopicFilter - Filter set to: {}", topic);
 }
 
 void BagReader::clearTopicFilter() {
     topicFilter_.clear();
+    resolveTopicFilter();
     spdlog::debug("BagReader::clearTopicFilter - Filter cleared");
 }
 
 size_t BagReader::getMessageCount() const {
+    // 바이너리 포맷 인덱스는 청크 단위이므로 Footer의 메시지 수 사용
+    if (binary_) {
+        return static_cast<size_t>(footer_.message_count);
+    }
     return indexer_.size();
 }
 
@@ -161,6 +251,11 @@ uint64_t BagReader::getStartTimestamp() const {
         return 0;
     }
 
+    // 바이너리 포맷: 전체 청크 중 최소 시작 타임스탬프
+    if (binary_) {
+        return indexer_.getTimeRange().start_ns;
+    }
+
     bool found = false;
     IndexEntry entry = indexer_.findByTimestamp(0, found);
     return found ? entry.timestamp_ns : 0;
@@ -171,6 +266,11 @@ uint64_t BagReader::getEndTimestamp() const {
         return 0;
     }
 
+    // 바이너리 포맷: 전체 청크 중 최대 종료 타임스탬프 (마지막 청크가 최신이라는 보장 없음)
+    if (binary_) {
+        return indexer_.getTimeRange().end_ns;
+    }
+
     bool found = false;
     IndexEntry entry = indexer_.findByTimestamp(UINT64_MAX, found);
     return found ? entry.timestamp_ns : 0;
@@ -205,11 +305,254 @@ bool BagReader::isInDataArea() const {
         return false;
     }
 
-    // 현재 위치가 데이터 영역 내인지 확인
-    // 데이터 영역: [0, index_offset)
-    uint64_t indexOffset = static_cast<uint64_t>(footer_.index_offset);
+    // 현재 위치가 읽기 범위 내인지 확인
+    // 기본 범위는 데이터 영역 전체: [0, index_offset)
+    return currentPosition_ < rangeEnd_;
+}
+
+bool BagReader::recoverBinary() {
+    // 바이너리 포맷은 첫 청크 헤더로 시작 (JSONL 등 다른 파일은 복구 대상 아님)
+    ifs_.close();
+    if (!mapped_.open(filepath_) || mapped_.size() < sizeof(ChunkHeader)) {
+        mapped_.close();
+        return false;
+    }
+
+    uint32_t magic = 0;
+    std::memcpy(&magic, mapped_.data(), sizeof(magic));
+    if (magic != kChunkMagic) {
+        mapped_.close();
+        return false;
+    }
+
+    spdlog::warn("BagReader::open - Missing footer, recovering chunks from {}", filepath_);
+    footer_ = indexer_.recoverFromChunks(mapped_.data(), mapped_.size());
+    if (!footer_.isValid()) {
+        mapped_.close();
+        return false;
+    }
 
-    return currentPosition_ < indexOffset;
+    recovered_ = true;
+    binary_ = true;
+    return true;
+}
+
+bool BagReader::loadChunk(uint64_t offset) {
+    uint64_t dataEnd = footer_.index_offset;
+
+    if (offset + sizeof(ChunkHeader) > dataEnd) {
+        spdlog::error("BagReader::loadChunk - Chunk header out of range: offset {}", offset);
+        nextChunkOffset_ = dataEnd;
+        return false;
+    }
+
+    ChunkHeader header;
+    std::memcpy(&header, mapped_.data() + offset, sizeof(ChunkHeader));
+
+    uint64_t payloadOffset = offset + sizeof(ChunkHeader);
+    if (!header.isValid() || header.stored_size > dataEnd - payloadOffset) {
+        spdlog::error("BagReader::loadChunk - Invalid chunk at offset {}", offset);
+        nextChunkOffset_ = dataEnd;
+        return false;
+    }
+
+    const char* stored = mapped_.data() + payloadOffset;
+    if (!Indexer::verifyChunk(header, stored)) {
+        spdlog::error("BagReader::loadChunk - Checksum mismatch, skipping chunk at offset {}",
+                      offset);
+        nextChunkOffset_ = payloadOffset + header.stored_size;
+        return false;
+    }
+
+    auto compression = static_cast<ChunkCompression>(static_cast<uint16_t>(header.compression));
+
+    if (compression == ChunkCompression::None) {
+        if (header.stored_size != header.raw_size) {
+            spdlog::error("BagReader::loadChunk - Size mismatch at offset {}", offset);
+            nextChunkOffset_ = dataEnd;
+            return false;
+        }
+        recordPos_ = stored;
+    } else {
+        chunkBuffer_.resize(header.raw_size);
+        if (!ChunkCodec::decompress(compression, stored, header.stored_size,
+                                    chunkBuffer_.data(), chunkBuffer_.size())) {
+            spdlog::error("BagReader::loadChunk - Failed to decompress {} chunk at offset {}",
+                          ChunkCodec::name(compression), offset);
+            nextChunkOffset_ = dataEnd;
+            return false;
+        }
+        recordPos_ = chunkBuffer_.data();
+    }
+
+    recordEnd_ = recordPos_ + header.raw_size;
+    nextChunkOffset_ = payloadOffset + header.stored_size;
+    return true;
+}
+
+bool BagReader::nextRecord(RecordHeader& header, const char*& payload) {
+    while (true) {
+        if (recordPos_ >= recordEnd_) {
+            uint64_t chunkOffset = nextChunkToRead();
+            uint64_t dataEnd = rangeEnd_;
+            if (chunkOffset < dataEnd && loadChunk(chunkOffset)) {
+                continue;
+            }
+
+            // 체크섬 불일치 청크는 건너뛰고 계속, 그 외에는 데이터 끝
+            if (chunkOffset < nextChunkOffset_ && nextChunkOffset_ < dataEnd) {
+                continue;
+            }
+            nextChunkOffset_ = std::max<uint64_t>(nextChunkOffset_, chunkOffset);
+            return false;
+        }
+
+        if (static_cast<size_t>(recordEnd_ - recordPos_) < sizeof(RecordHeader)) {
+            spdlog::error("BagReader::nextRecord - Truncated record header");
+            recordPos_ = recordEnd_;
+            continue;
+        }
+
+        std::memcpy(&header, recordPos_, sizeof(RecordHeader));
+        payload = recordPos_ + sizeof(RecordHeader);
+
+        if (header.length > static_cast<size_t>(recordEnd_ - payload)) {
+            spdlog::error("BagReader::nextRecord - Truncated record payload");
+            recordPos_ = recordEnd_;
+            continue;
+        }
+
+        recordPos_ = payload + header.length;
+
+        if (header.kind == static_cast<uint8_t>(RecordKind::TopicDef)) {
+            if (header.topic_id >= topicNames_.size()) {
+                topicNames_.resize(header.topic_id + 1);
+            }
+            topicNames_[header.topic_id].assign(payload, header.length);
+            continue;
+        }
+
+        return true;
+    }
+}
+
+std::optional<BagMessage> BagReader::readNextBinary() {
+    RecordHeader header;
+    const char* payload = nullptr;
+
+    while (nextRecord(header, payload)) {
+        if (header.topic_id >= topicNames_.size() || topicNames_[header.topic_id].empty()) {
+            spdlog::error("BagReader::readNext - Undefined topic id: {}",
+                          static_cast<uint32_t>(header.topic_id));
+            continue;
+        }
+
+        const std::string& topic = topicNames_[header.topic_id];
+
+        // 토픽 필터링 (topic 인덱스가 있으면 ID 비교)
+        if (chunkFilter_) {
+            if (header.topic_id != filterTopicId_) {
+                continue;
+            }
+        } else if (!topicFilter_.empty() && topic != topicFilter_) {
+            continue;
+        }
+
+        BagMessage msg;
+        msg.timestamp_ns = header.timestamp_ns;
+        msg.topic = topic;
+        msg.data_type = static_cast<DataType>(header.data_type);
+        msg.serialized_value.assign(payload, header.length);
+        return msg;
+    }
+
+    return std::nullopt;
+}
+
+uint64_t BagReader::nextChunkToRead() const {
+    if (!chunkFilter_) {
+        return nextChunkOffset_;
+    }
+
+    // 청크 오프셋은 청크 번호 순으로 증가하므로 이진 탐색
+    const auto& entries = indexer_.getEntries();
+    auto it = std::lower_bound(filterChunks_.begin(), filterChunks_.end(), nextChunkOffset_,
+                               [&entries](uint32_t chunk, uint64_t offset) {
+                                   return chunk < entries.size() &&
+                                          entries[chunk].file_offset < offset;
+                               });
+
+    if (it == filterChunks_.end() || *it >= entries.size()) {
+        return footer_.index_offset;
+    }
+    return entries[*it].file_offset;
+}
+
+void BagReader::resolveTopicFilter() {
+    chunkFilter_ = false;
+    filterChunks_.clear();
+
+    if (!binary_ || topicFilter_.empty() || !indexer_.hasTopicIndex()) {
+        return;
+    }
+
+    // topic 인덱스에 없는 topic이면 filterChunks_가 비어 모든 청크를 건너뜀
+    // (writer는 ID를 65535 미만으로 할당하므로 최댓값은 어떤 레코드와도 불일치)
+    filterTopicId_ = std::numeric_limits<uint16_t>::max();
+    uint16_t topicId = 0;
+    if (const TopicIndex* topic = indexer_.findTopic(topicFilter_, topicId)) {
+        filterChunks_ = topic->chunks;
+        filterTopicId_ = topicId;
+    }
+    chunkFilter_ = true;
+
+    spdlog::debug("BagReader::resolveTopicFilter - {} chunks contain topic {}",
+                  filterChunks_.size(), topicFilter_);
+}
+
+bool BagReader::seekBinary(uint64_t timestamp_ns) {
+    // timestamp_ns 이상인 메시지를 가진 첫 청크 (청크별 [start, end] 범위로 탐색)
+    uint32_t chunk = 0;
+    if (!indexer_.findChunkByTimestamp(timestamp_ns, chunk)) {
+        spdlog::error("BagReader::seekToTimestamp - No chunk ranges for timestamp: {}",
+                      timestamp_ns);
+        return false;
+    }
+
+    // 토픽 필터: 그 청크 이후 첫 대상 청크 (앞선 청크는 모두 end < timestamp_ns)
+    if (chunkFilter_) {
+        auto it = std::lower_bound(filterChunks_.begin(), filterChunks_.end(), chunk);
+        if (it == filterChunks_.end()) {
+            // 대상 topic에 timestamp_ns 이후 메시지 없음: 끝으로 이동
+            recordPos_ = recordEnd_ = nullptr;
+            nextChunkOffset_ = footer_.index_offset;
+            return true;
+        }
+        chunk = *it;
+    }
+
+    const auto& entries = indexer_.getEntries();
+    IndexEntry entry = entries[chunk];
+    if (!loadChunk(entry.file_offset)) {
+        spdlog::error("BagReader::seekToTimestamp - Failed to load chunk for timestamp: {}",
+                      timestamp_ns);
+        return false;
+    }
+
+    // 청크 내에서 timestamp_ns 이상인 첫 메시지 레코드 앞에 위치
+    RecordHeader header;
+    const char* payload = nullptr;
+    while (nextRecord(header, payload)) {
+        if (static_cast<uint64_t>(header.timestamp_ns) >= timestamp_ns) {
+            recordPos_ = payload - sizeof(RecordHeader);
+            break;
+        }
+    }
+
+    spdlog::debug("BagReader::seekToTimestamp - Seeked to timestamp {}, chunk offset {}",
+                  timestamp_ns, static_cast<uint64_t>(entry.file_offset));
+
+    return true;
 }
 
 } // namespace mxrc::core::logging
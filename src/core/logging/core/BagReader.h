@@ -5,6 +5,7 @@
 #include "dto/BagFooter.h"
 #include "dto/IndexEntry.h"
 #include "util/Indexer.h"
+#include "util/MappedFile.h"
 #include <string>
 #include <vector>
 #include <fstream>
@@ -17,6 +18,14 @@ namespace mxrc::core::logging {
  * @brief Bag 파일 읽기 클래스
  *
  * Bag 파일로부터 메시지를 읽고, 타임스탬프 기반으로 탐색합니다.
+ * JSONL 포맷(version 1)은 ifstream으로, 바이너리 청크 포맷(version 2)은
+ * mmap으로 읽으며 포맷은 Footer 버전으로 자동 판별합니다.
+ * 압축된 청크는 실제로 읽거나 탐색할 때 해당 청크만 해제합니다.
+ * 바이너리 포맷에 topic 인덱스가 있으면 토픽 필터는 해당 topic이 포함된
+ * 청크만 읽습니다.
+ * 바이너리 청크는 로드할 때 청크 체크섬을 검증하며, 불일치 청크는 건너뜁니다.
+ * Footer가 없는 바이너리 파일(기록 중 크래시 등)은 청크를 스캔하여
+ * 손상되지 않은 청크까지 복구해서 엽니다.
  *
  * **주요 기능**:
  * - Bag 파일 열기 및 검증
@@ -70,6 +79,7 @@ public:
      * @brief Bag 파일 열기
      *
      * 파일을 열고 Footer 및 인덱스를 로드합니다.
+     * Footer가 없는 바이너리 파일은 청크 스캔으로 인덱스를 재구성합니다.
      *
      * @param filepath Bag 파일 경로
      * @return true if 성공
@@ -86,7 +96,7 @@ public:
      *
      * @return true if 열려있음
      */
-    bool isOpen() const { return ifs_.is_open(); }
+    bool isOpen() const { return ifs_.is_open() || mapped_.isOpen(); }
 
     /**
      * @brief 다음 메시지가 있는지 확인
@@ -124,6 +134,7 @@ public:
      * @brief 토픽 필터 설정
      *
      * 설정된 토픽만 읽습니다. 빈 문자열이면 필터링 비활성화.
+     * 바이너리 포맷은 topic 인덱스로 해당 topic이 없는 청크를 건너뜁니다.
      *
      * @param topic 토픽 이름
      */
@@ -134,6 +145,35 @@ public:
      */
     void clearTopicFilter();
 
+    /**
+     * @brief 읽기 범위 제한
+     *
+     * 데이터 영역 중 [beginOffset, endOffset)에서 시작하는 메시지(JSONL) 또는
+     * 청크(바이너리)만 읽도록 제한하고 beginOffset으로 이동합니다.
+     * 오프셋은 인덱스 엔트리 오프셋(또는 데이터 영역 끝)이어야 하며,
+     * 파일을 여러 스레드가 나누어 읽을 때 사용합니다.
+     * seekToStart()는 beginOffset으로 이동합니다.
+     *
+     * @param beginOffset 범위 시작 오프셋
+     * @param endOffset 범위 끝 오프셋 (데이터 영역 끝을 넘으면 데이터 영역 끝)
+     * @return true if 성공
+     */
+    bool setReadRange(uint64_t beginOffset, uint64_t endOffset);
+
+    /**
+     * @brief 읽기 범위 제한 해제 (파일 시작으로 이동)
+     */
+    void clearReadRange();
+
+    /**
+     * @brief 로드된 인덱스 조회
+     *
+     * JSONL 포맷은 메시지별, 바이너리 포맷은 청크별 엔트리입니다.
+     *
+     * @return Indexer
+     */
+    const Indexer& getIndex() const { return indexer_; }
+
     /**
      * @brief 현재 Bag 파일의 메타데이터 조회
      *
@@ -162,6 +202,13 @@ public:
      */
     uint64_t getEndTimestamp() const;
 
+    /**
+     * @brief Footer 없이 청크 스캔으로 복구하여 열었는지 확인
+     *
+     * @return true if 복구된 파일
+     */
+    bool isRecovered() const { return recovered_; }
+
     /**
      * @brief 파일 경로 조회
      *
@@ -184,12 +231,78 @@ private:
      */
     bool isInDataArea() const;
 
+    /**
+     * @brief Footer 없는 바이너리 파일을 매핑하고 청크 스캔으로 인덱스 복구
+     *
+     * @return true if 복구된 청크가 있음
+     */
+    bool recoverBinary();
+
+    /**
+     * @brief 바이너리 청크를 검증하고 레코드 커서를 청크 시작으로 설정
+     *
+     * 압축된 청크는 chunkBuffer_에 해제하고, 아니면 매핑 영역을 직접 가리킵니다.
+     * 체크섬이 맞지 않으면 nextChunkOffset_을 다음 청크로 옮기고 false를 반환합니다.
+     *
+     * @param offset 청크 헤더 오프셋
+     * @return true if 유효한 청크
+     */
+    bool loadChunk(uint64_t offset);
+
+    /**
+     * @brief 다음 메시지 레코드 읽기 (바이너리 포맷)
+     *
+     * 필요하면 다음 청크를 로드하고, TopicDef 레코드는 topicNames_에 반영합니다.
+     *
+     * @param header [out] 레코드 헤더
+     * @param payload [out] 매핑 영역 내 payload 시작 주소
+     * @return true if 메시지 레코드를 읽음
+     */
+    bool nextRecord(RecordHeader& header, const char*& payload);
+
+    /**
+     * @brief 다음에 읽을 청크 오프셋 (토픽 필터 반영)
+     *
+     * @return 청크 헤더 오프셋 (없으면 index_offset)
+     */
+    uint64_t nextChunkToRead() const;
+
+    /**
+     * @brief topic 인덱스로 토픽 필터 대상 청크 계산
+     */
+    void resolveTopicFilter();
+
+    /**
+     * @brief 바이너리 포맷 readNext 구현
+     */
+    std::optional<BagMessage> readNextBinary();
+
+    /**
+     * @brief 바이너리 포맷 seekToTimestamp 구현
+     */
+    bool seekBinary(uint64_t timestamp_ns);
+
     std::string filepath_;          ///< 현재 파일 경로
     std::ifstream ifs_;             ///< 파일 입력 스트림
     BagFooter footer_;              ///< Bag 파일 Footer
     Indexer indexer_;               ///< 인덱스 관리자
     std::string topicFilter_;       ///< 토픽 필터 (빈 문자열이면 비활성화)
     uint64_t currentPosition_;      ///< 현재 파일 읽기 위치
+    uint64_t rangeBegin_ = 0;       ///< 읽기 범위 시작 오프셋
+    uint64_t rangeEnd_ = 0;         ///< 읽기 범위 끝 오프셋 (기본: index_offset)
+
+    // 바이너리 포맷 (version 2) 상태
+    bool binary_ = false;                   ///< 바이너리 포맷 여부
+    bool recovered_ = false;                ///< 청크 스캔으로 복구한 파일 여부
+    MappedFile mapped_;                     ///< 매핑된 파일
+    const char* recordPos_ = nullptr;       ///< 현재 청크 내 다음 레코드
+    const char* recordEnd_ = nullptr;       ///< 현재 청크 레코드 영역 끝
+    uint64_t nextChunkOffset_ = 0;          ///< 다음 청크 헤더 오프셋
+    std::vector<std::string> topicNames_;   ///< topic ID → 이름
+    std::vector<char> chunkBuffer_;         ///< 압축 해제된 청크 (재사용)
+    bool chunkFilter_ = false;              ///< topic 인덱스 기반 필터 활성화 여부
+    uint16_t filterTopicId_ = 0;            ///< 필터 topic ID (chunkFilter_일 때)
+    std::vector<uint32_t> filterChunks_;    ///< 필터 topic이 포함된 청크 번호
 };
 
 } // namespace mxrc::core::logging
@@ -1,11 +1,12 @@
 #include "BagReplayer.h"
+#include "core/rt/util/VirtualClock.h"
 #include <spdlog/spdlog.h>
+#include <algorithm>
 #include <thread>
 
 namespace mxrc::core::logging {
 
-BagReplayer::BagReplayer()
-    : reader_(std::make_unique<BagReader>()) {
+BagReplayer::BagReplayer() {
 }
 
 BagReplayer::~BagReplayer() {
@@ -16,6 +17,10 @@ BagReplayer::~BagReplayer() {
 }
 
 bool BagReplayer::open(const std::string& filepath) {
+    return open(std::vector<std::string>{filepath});
+}
+
+bool BagReplayer::open(const std::vector<std::string>& filepaths) {
     std::lock_guard<std::mutex> lock(controlMutex_);
 
     if (isPlaying_) {
@@ -23,19 +28,28 @@ bool BagReplayer::open(const std::string& filepath) {
         return false;
     }
 
-    bool result = reader_->open(filepath);
-    if (result) {
+    readers_.clear();
+    mergeQueue_ = MergeQueue();
+
+    for (const auto& filepath : filepaths) {
+        auto reader = std::make_unique<BagReader>();
+        if (!reader->open(filepath)) {
+            readers_.clear();
+            return false;
+        }
         spdlog::info("BagReplayer::open - Opened {}", filepath);
+        readers_.push_back(std::move(reader));
     }
 
-    return result;
+    return !readers_.empty();
 }
 
 void BagReplayer::close() {
     stop();
 
     std::lock_guard<std::mutex> lock(controlMutex_);
-    reader_->close();
+    readers_.clear();
+    mergeQueue_ = MergeQueue();
 }
 
 bool BagReplayer::start(const ReplaySpeed& speed) {
@@ -46,11 +60,16 @@ bool BagReplayer::start(const ReplaySpeed& speed) {
         return false;
     }
 
-    if (!reader_->isOpen()) {
+    if (readers_.empty()) {
         spdlog::error("BagReplayer::start - No file open");
         return false;
     }
 
+    // 이전 재생 스레드 정리 (재생이 끝난 뒤 다시 시작하는 경우)
+    if (replayThread_ && replayThread_->joinable()) {
+        replayThread_->join();
+    }
+
     speed_ = speed;
     shouldStop_ = false;
     isPaused_ = false;
@@ -61,11 +80,24 @@ bool BagReplayer::start(const ReplaySpeed& speed) {
         stats_ = ReplayStats();
     }
 
-    // 시작 시간 범위가 설정되어 있으면 해당 위치로 이동
-    if (startTime_ > 0) {
-        reader_->seekToTimestamp(startTime_);
-    } else {
-        reader_->seekToStart();
+    // 시작 시간 범위가 설정되어 있으면 해당 위치로 이동 후 소스별 첫 메시지 적재
+    mergeQueue_ = MergeQueue();
+    for (size_t source = 0; source < readers_.size(); source++) {
+        if (startTime_ > 0) {
+            readers_[source]->seekToTimestamp(startTime_);
+        } else {
+            readers_[source]->seekToStart();
+        }
+        refill(source);
+    }
+
+    // 가상 시간은 재생 구간의 첫 시각에서 시작
+    if (clock_) {
+        uint64_t startNs = startTime_;
+        if (!mergeQueue_.empty()) {
+            startNs = std::max(startNs, static_cast<uint64_t>(mergeQueue_.top().msg.timestamp_ns));
+        }
+        clock_->start(startNs);
     }
 
     // 재생 스레드 시작
@@ -98,6 +130,11 @@ void BagReplayer::stop() {
     shouldStop_ = true;
     isPaused_ = false;  // 일시정지 해제하여 스레드가 종료되도록
 
+    // 가상 시간 전진 대기 중이면 해제
+    if (clock_) {
+        clock_->close();
+    }
+
     if (replayThread_ && replayThread_->joinable()) {
         replayThread_->join();
     }
@@ -132,6 +169,11 @@ void BagReplayer::setTimeRange(uint64_t startTime, uint64_t endTime) {
     spdlog::debug("BagReplayer::setTimeRange - Range: {} to {}", startTime, endTime);
 }
 
+void BagReplayer::setVirtualClock(rt::util::VirtualClock* clock) {
+    std::lock_guard<std::mutex> lock(controlMutex_);
+    clock_ = clock;
+}
+
 ReplayStats BagReplayer::getStats() const {
     std::lock_guard<std::mutex> lock(statsMutex_);
     return stats_;
@@ -152,7 +194,9 @@ void BagReplayer::replayThread() {
     BagMessage previousMsg;
     bool hasPreviousMsg = false;
 
-    while (!shouldStop_ && reader_->hasNext()) {
+    size_t totalMessages = totalMessageCount();
+
+    while (!shouldStop_ && !mergeQueue_.empty()) {
         // 일시정지 대기
         while (isPaused_ && !shouldStop_) {
             std::this_thread::sleep_for(std::chrono::milliseconds(10));
@@ -162,8 +206,8 @@ void BagReplayer::replayThread() {
             break;
         }
 
-        // 메시지 읽기
-        auto msgOpt = reader_->readNext();
+        // 병합 순서상 다음 메시지
+        auto msgOpt = popNext();
         if (!msgOpt) {
             continue;
         }
@@ -194,6 +238,14 @@ void BagReplayer::replayThread() {
             waitForNextMessage(previousMsg, msg);
         }
 
+        // 가상 시간을 메시지 시각까지 전진 (참여자가 해당 시각까지 실행된 뒤 반환)
+        if (clock_) {
+            clock_->advanceTo(static_cast<uint64_t>(msg.timestamp_ns));
+            if (shouldStop_) {
+                break;
+            }
+        }
+
         // 메시지 콜백 호출
         if (messageCallback_) {
             try {
@@ -212,7 +264,6 @@ void BagReplayer::replayThread() {
             stats_.elapsedTime = std::chrono::duration<double>(now - replayStartTime_).count();
 
             // 진행률 계산 (전체 메시지 수 기준)
-            size_t totalMessages = reader_->getMessageCount();
             if (totalMessages > 0) {
                 stats_.progress = static_cast<double>(stats_.messagesReplayed) / totalMessages;
             }
@@ -222,6 +273,11 @@ void BagReplayer::replayThread() {
         hasPreviousMsg = true;
     }
 
+    // 재생 종료: 가상 시간 참여자 해제
+    if (clock_) {
+        clock_->close();
+    }
+
     isPlaying_ = false;
 
     auto finalStats = getStats();
@@ -250,6 +306,38 @@ void BagReplayer::waitForNextMessage(const BagMessage& currentMsg, const BagMess
     std::this_thread::sleep_for(waitTime);
 }
 
+void BagReplayer::refill(size_t source) {
+    auto& reader = readers_[source];
+    while (reader->hasNext()) {
+        auto msg = reader->readNext();
+        if (msg) {
+            mergeQueue_.push(PendingMessage{std::move(*msg), source});
+            return;
+        }
+    }
+}
+
+std::optional<BagMessage> BagReplayer::popNext() {
+    if (mergeQueue_.empty()) {
+        return std::nullopt;
+    }
+
+    // top()은 const 참조이므로 복사 후 pop, 같은 소스의 다음 메시지 적재
+    PendingMessage next = mergeQueue_.top();
+    mergeQueue_.pop();
+    refill(next.source);
+
+    return std::move(next.msg);
+}
+
+size_t BagReplayer::totalMessageCount() const {
+    size_t total = 0;
+    for (const auto& reader : readers_) {
+        total += reader->getMessageCount();
+    }
+    return total;
+}
+
 bool BagReplayer::isInTimeRange(const BagMessage& msg) const {
     uint64_t timestamp = static_cast<uint64_t>(msg.timestamp_ns);
     return timestamp >= startTime_ && timestamp <= endTime_;
@@ -10,6 +10,12 @@
 #include <atomic>
 #include <mutex>
 #include <chrono>
+#include <queue>
+#include <vector>
+
+namespace mxrc::core::rt::util {
+class VirtualClock;
+} // namespace mxrc::core::rt::util
 
 namespace mxrc::core::logging {
 
@@ -41,8 +47,13 @@ struct ReplayStats {
  *
  * Bag 파일을 읽어서 타임스탬프에 따라 메시지를 재생합니다.
  * 실시간 속도 또는 사용자 지정 속도로 재생할 수 있습니다.
+ * 여러 파일(RT/NonRT 스트림, 로테이션된 파일 등)을 열면 k-way merge로
+ * 타임스탬프 순서를 유지하며 하나의 스트림으로 재생합니다.
+ * 타임스탬프가 같으면 open()에 전달한 파일 순서를 따릅니다.
  *
  * **주요 기능**:
+ * - 다중 파일 병합 재생
+ * - 가상 시간 구동 (VirtualClock, 결정적 재생)
  * - 실시간 재생 (1x 속도)
  * - 배속 재생 (2x, 5x 등)
  * - 최대 속도 재생 (타임스탬프 무시)
@@ -71,6 +82,16 @@ struct ReplayStats {
  * // 4. 특정 구간 재생
  * replayer.setTimeRange(startTime, endTime);
  * replayer.start(ReplaySpeed::realtime());
+ *
+ * // 5. RT/NonRT 파일 병합 + 가상 시간으로 RTExecutive 구동
+ * rt::util::VirtualClock clock;
+ * executive.setVirtualClock(&clock);   // 재생 시작 전 참여자 등록
+ * replayer.open({"/data/rt_0001.bag", "/data/nonrt_0001.bag"});
+ * replayer.setVirtualClock(&clock);
+ * std::thread rtThread([&] { executive.run(); });
+ * replayer.start(ReplaySpeed::asFastAsPossible());
+ * replayer.waitUntilFinished();        // 재생 종료 시 clock close → run() 반환
+ * rtThread.join();
  * ```
  *
  * **Thread-Safety**: 재생 제어 메서드는 thread-safe
@@ -97,6 +118,14 @@ public:
      */
     bool open(const std::string& filepath);
 
+    /**
+     * @brief 여러 Bag 파일 열기 (타임스탬프 병합 재생)
+     *
+     * @param filepaths Bag 파일 경로 목록 (동일 타임스탬프는 목록 순서대로 재생)
+     * @return true if 모든 파일 열기 성공 (하나라도 실패하면 모두 닫음)
+     */
+    bool open(const std::vector<std::string>& filepaths);
+
     /**
      * @brief 파일 닫기 (재생 중이면 자동 정지)
      */
@@ -152,6 +181,17 @@ public:
      */
     void setTimeRange(uint64_t startTime, uint64_t endTime);
 
+    /**
+     * @brief 가상 시간 설정
+     *
+     * 설정하면 start() 시 clock을 첫 메시지 시각으로 시작하고, 각 메시지를
+     * 전달하기 전에 해당 타임스탬프까지 clock을 전진시킵니다 (콜백에서
+     * clock->nowNs()는 메시지 타임스탬프). 재생이 끝나거나 중지되면 clock을 닫습니다.
+     *
+     * @param clock VirtualClock (재생 동안 유효해야 함, nullptr이면 해제)
+     */
+    void setVirtualClock(rt::util::VirtualClock* clock);
+
     /**
      * @brief 재생 통계 조회
      *
@@ -174,11 +214,49 @@ public:
     bool isPaused() const;
 
 private:
+    /**
+     * @brief 병합 대기 메시지 (소스별 다음 메시지)
+     */
+    struct PendingMessage {
+        BagMessage msg;
+        size_t source;  ///< readers_ 인덱스
+
+        /// @brief min-heap 정렬 (타임스탬프, 같으면 소스 순서)
+        bool operator>(const PendingMessage& other) const {
+            if (msg.timestamp_ns != other.msg.timestamp_ns) {
+                return msg.timestamp_ns > other.msg.timestamp_ns;
+            }
+            return source > other.source;
+        }
+    };
+
+    using MergeQueue = std::priority_queue<PendingMessage, std::vector<PendingMessage>,
+                                           std::greater<PendingMessage>>;
+
     /**
      * @brief 재생 스레드 (메인 루프)
      */
     void replayThread();
 
+    /**
+     * @brief 소스의 다음 메시지를 병합 큐에 추가
+     *
+     * @param source readers_ 인덱스
+     */
+    void refill(size_t source);
+
+    /**
+     * @brief 병합 순서상 다음 메시지 꺼내기
+     *
+     * @return 다음 메시지 (모든 소스 소진 시 std::nullopt)
+     */
+    std::optional<BagMessage> popNext();
+
+    /**
+     * @brief 열린 모든 파일의 메시지 수 합계
+     */
+    size_t totalMessageCount() const;
+
     /**
      * @brief 다음 메시지까지 대기 (타임스탬프 기반)
      *
@@ -195,7 +273,9 @@ private:
      */
     bool isInTimeRange(const BagMessage& msg) const;
 
-    std::unique_ptr<BagReader> reader_;         ///< Bag 파일 리더
+    std::vector<std::unique_ptr<BagReader>> readers_;  ///< 파일별 리더 (open 순서)
+    MergeQueue mergeQueue_;                     ///< 소스별 다음 메시지 (min-heap)
+    rt::util::VirtualClock* clock_ = nullptr;   ///< 가상 시간 (nullptr이면 미사용)
     MessageCallback messageCallback_;           ///< 메시지 콜백
     ReplaySpeed speed_;                         ///< 재생 속도
     std::string topicFilter_;                   ///< 토픽 필터
@@ -0,0 +1,366 @@
+#include "BagScanner.h"
+#include "BagReader.h"
+#include "util/BinaryChunkWriter.h"
+#include <spdlog/spdlog.h>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <optional>
+#include <thread>
+
+namespace mxrc::core::logging {
+
+namespace {
+
+/**
+ * @brief 직렬화된 값에서 숫자 추출
+ *
+ * field가 없으면 값 전체가 숫자일 때만 성공하며, 이 경우 JSON 파싱 없이
+ * from_chars로 바로 변환합니다.
+ */
+bool extractNumber(const std::string& serialized,
+                   const std::optional<nlohmann::json::json_pointer>& field,
+                   double& out) {
+    if (!field) {
+        const char* first = serialized.data();
+        const char* last = first + serialized.size();
+        auto [ptr, ec] = std::from_chars(first, last, out);
+        return ec == std::errc() && ptr == last;
+    }
+
+    auto json = nlohmann::json::parse(serialized, nullptr, false);
+    if (json.is_discarded() || !json.contains(*field)) {
+        return false;
+    }
+
+    const auto& value = json.at(*field);
+    if (!value.is_number()) {
+        return false;
+    }
+    out = value.get<double>();
+    return true;
+}
+
+bool inTimeRange(const BagMessage& msg, const ScanOptions& options) {
+    uint64_t ts = static_cast<uint64_t>(msg.timestamp_ns);
+    return ts >= options.startTimeNs && ts <= options.endTimeNs;
+}
+
+}  // namespace
+
+void TopicStats::add(uint64_t timestamp_ns, const double* value) {
+    count++;
+    firstTimestampNs = std::min(firstTimestampNs, timestamp_ns);
+    lastTimestampNs = std::max(lastTimestampNs, timestamp_ns);
+
+    if (value) {
+        numericCount++;
+        min = std::min(min, *value);
+        max = std::max(max, *value);
+        sum += *value;
+    }
+}
+
+void TopicStats::merge(const TopicStats& other) {
+    count += other.count;
+    numericCount += other.numericCount;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    sum += other.sum;
+    firstTimestampNs = std::min(firstTimestampNs, other.firstTimestampNs);
+    lastTimestampNs = std::max(lastTimestampNs, other.lastTimestampNs);
+}
+
+double TopicStats::rateHz() const {
+    if (count < 2 || lastTimestampNs <= firstTimestampNs) {
+        return 0.0;
+    }
+    double durationSec = static_cast<double>(lastTimestampNs - firstTimestampNs) / 1e9;
+    return static_cast<double>(count - 1) / durationSec;
+}
+
+bool BagScanner::open(const std::vector<std::string>& filepaths) {
+    close();
+
+    for (const auto& path : filepaths) {
+        BagReader reader;
+        if (!reader.open(path)) {
+            spdlog::error("BagScanner::open - Failed to open bag file: {}", path);
+            close();
+            return false;
+        }
+
+        FileInfo info;
+        info.path = path;
+        info.dataEnd = reader.getFooter().index_offset;
+        info.messageCount = reader.getMessageCount();
+
+        // 인덱스는 기록 순서(오프셋 오름차순)이지만 정렬을 보장하기 위해 한 번 정리
+        const auto& entries = reader.getIndex().getEntries();
+        info.offsets.reserve(entries.size());
+        for (const auto& entry : entries) {
+            if (entry.file_offset < info.dataEnd) {
+                info.offsets.push_back(entry.file_offset);
+            }
+        }
+        if (!std::is_sorted(info.offsets.begin(), info.offsets.end())) {
+            std::sort(info.offsets.begin(), info.offsets.end());
+        }
+        info.offsets.erase(std::unique(info.offsets.begin(), info.offsets.end()),
+                           info.offsets.end());
+
+        files_.push_back(std::move(info));
+    }
+
+    spdlog::debug("BagScanner::open - Opened {} files, {} messages",
+                  files_.size(), messageCount());
+    return !files_.empty();
+}
+
+void BagScanner::close() {
+    files_.clear();
+}
+
+uint64_t BagScanner::messageCount() const {
+    uint64_t total = 0;
+    for (const auto& file : files_) {
+        total += file.messageCount;
+    }
+    return total;
+}
+
+std::vector<ScanRange> BagScanner::splitRanges(size_t targetCount) const {
+    std::vector<ScanRange> ranges;
+
+    uint64_t totalBytes = 0;
+    for (const auto& file : files_) {
+        totalBytes += file.dataEnd;
+    }
+    if (totalBytes == 0) {
+        return ranges;
+    }
+
+    uint64_t targetBytes = std::max<uint64_t>(1, totalBytes / std::max<size_t>(1, targetCount));
+
+    for (size_t i = 0; i < files_.size(); ++i) {
+        const FileInfo& file = files_[i];
+        if (file.dataEnd == 0) {
+            continue;
+        }
+
+        // 인덱스가 없으면 (데이터 시작 오프셋 0 포함) 파일 전체가 한 범위
+        uint64_t begin = 0;
+        for (uint64_t offset : file.offsets) {
+            if (offset > begin && offset - begin >= targetBytes) {
+                ranges.push_back({i, begin, offset});
+                begin = offset;
+            }
+        }
+        ranges.push_back({i, begin, file.dataEnd});
+    }
+
+    return ranges;
+}
+
+unsigned BagScanner::resolveThreads(const ScanOptions& options) {
+    unsigned threads = options.threads;
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    return std::max(1u, threads);
+}
+
+void BagScanner::forEachRange(const std::vector<ScanRange>& ranges, unsigned threads,
+                              const std::string& topic,
+                              const std::function<void(unsigned, size_t, BagReader*)>& fn) const {
+    std::atomic<size_t> next{0};
+
+    auto worker = [&](unsigned id) {
+        // 파일별 리더를 스레드마다 한 번만 열고 범위만 바꿔가며 재사용
+        std::vector<std::unique_ptr<BagReader>> readers(files_.size());
+
+        for (size_t i = next.fetch_add(1); i < ranges.size(); i = next.fetch_add(1)) {
+            const ScanRange& range = ranges[i];
+            auto& reader = readers[range.file];
+
+            if (!reader) {
+                reader = std::make_unique<BagReader>();
+                if (!reader->open(files_[range.file].path)) {
+                    reader.reset();
+                    fn(id, i, nullptr);
+                    continue;
+                }
+                if (!topic.empty()) {
+                    reader->setTopicFilter(topic);
+                }
+            }
+
+            if (!reader->setReadRange(range.beginOffset, range.endOffset)) {
+                fn(id, i, nullptr);
+                continue;
+            }
+            fn(id, i, reader.get());
+        }
+    };
+
+    threads = static_cast<unsigned>(std::min<size_t>(threads, ranges.size()));
+    if (threads <= 1) {
+        worker(0);
+        return;
+    }
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads);
+    for (unsigned id = 0; id < threads; ++id) {
+        pool.emplace_back(worker, id);
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+}
+
+ScanResult BagScanner::aggregate(const ScanOptions& options) const {
+    ScanResult result;
+    auto startTime = std::chrono::steady_clock::now();
+
+    std::optional<nlohmann::json::json_pointer> field;
+    if (!options.field.empty()) {
+        try {
+            field.emplace(options.field);
+        } catch (const std::exception& e) {
+            spdlog::error("BagScanner::aggregate - Invalid field pointer '{}': {}",
+                          options.field, e.what());
+            return result;
+        }
+    }
+
+    unsigned threads = resolveThreads(options);
+    std::vector<ScanRange> ranges = splitRanges(threads * std::max<size_t>(1, options.rangesPerThread));
+
+    // 스레드별 부분 집계 (범위 간 공유 상태 없음)
+    struct Partial {
+        std::map<std::string, TopicStats> topics;
+        uint64_t scanned = 0;
+    };
+    std::vector<Partial> partials(std::max(1u, threads));
+    std::atomic<bool> failed{false};
+
+    forEachRange(ranges, threads, options.topic,
+                 [&](unsigned worker, size_t, BagReader* reader) {
+        if (!reader) {
+            failed.store(true, std::memory_order_relaxed);
+            return;
+        }
+
+        Partial& partial = partials[worker];
+        while (auto msg = reader->readNext()) {
+            partial.scanned++;
+            if (!inTimeRange(*msg, options)) {
+                continue;
+            }
+
+            double value = 0.0;
+            bool numeric = extractNumber(msg->serialized_value, field, value);
+            partial.topics[msg->topic].add(static_cast<uint64_t>(msg->timestamp_ns),
+                                           numeric ? &value : nullptr);
+        }
+    });
+
+    for (const auto& partial : partials) {
+        result.messagesScanned += partial.scanned;
+        for (const auto& [topic, stats] : partial.topics) {
+            result.topics[topic].merge(stats);
+        }
+    }
+
+    result.ok = !failed.load();
+    result.rangeCount = ranges.size();
+    result.threads = static_cast<unsigned>(std::min<size_t>(threads, std::max<size_t>(1, ranges.size())));
+    result.elapsedSec = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - startTime).count();
+
+    spdlog::debug("BagScanner::aggregate - {} messages, {} ranges, {} threads, {:.3f}s",
+                  result.messagesScanned, result.rangeCount, result.threads, result.elapsedSec);
+    return result;
+}
+
+bool BagScanner::exportFiltered(const std::string& outputPath, const ScanOptions& options,
+                                ChunkCompression compression, uint64_t* exported) const {
+    if (exported) {
+        *exported = 0;
+    }
+
+    std::ofstream ofs(outputPath, std::ios::binary | std::ios::trunc);
+    if (!ofs.is_open()) {
+        spdlog::error("BagScanner::exportFiltered - Failed to create file: {}", outputPath);
+        return false;
+    }
+
+    unsigned threads = resolveThreads(options);
+    std::vector<ScanRange> ranges = splitRanges(threads * std::max<size_t>(1, options.rangesPerThread));
+
+    // 범위별 결과를 future로 받아 범위 순서대로 기록 (읽기는 병렬, 쓰기는 순차)
+    std::vector<std::promise<std::optional<std::vector<BagMessage>>>> promises(ranges.size());
+    std::vector<std::future<std::optional<std::vector<BagMessage>>>> futures;
+    futures.reserve(ranges.size());
+    for (auto& promise : promises) {
+        futures.push_back(promise.get_future());
+    }
+
+    std::thread scanThread([&] {
+        forEachRange(ranges, threads, options.topic,
+                     [&](unsigned, size_t index, BagReader* reader) {
+            if (!reader) {
+                promises[index].set_value(std::nullopt);
+                return;
+            }
+
+            std::vector<BagMessage> messages;
+            while (auto msg = reader->readNext()) {
+                if (inTimeRange(*msg, options)) {
+                    messages.push_back(std::move(*msg));
+                }
+            }
+            promises[index].set_value(std::move(messages));
+        });
+    });
+
+    BinaryChunkWriter chunkWriter(BinaryChunkWriter::kDefaultChunkSize, compression);
+    bool ok = true;
+
+    for (auto& future : futures) {
+        auto messages = future.get();
+        if (!messages) {
+            ok = false;
+            continue;
+        }
+        for (const auto& msg : *messages) {
+            ok = ok && chunkWriter.append(msg, ofs);
+        }
+    }
+    scanThread.join();
+
+    ok = ok && chunkWriter.flushChunk(ofs) &&
+         chunkWriter.index().writeToFile(ofs, chunkWriter.bytesWritten(),
+                                         kBagVersionBinary, chunkWriter.messageCount());
+    ofs.close();
+
+    if (!ok) {
+        spdlog::error("BagScanner::exportFiltered - Failed to export to {}", outputPath);
+        return false;
+    }
+
+    if (exported) {
+        *exported = chunkWriter.messageCount();
+    }
+    spdlog::debug("BagScanner::exportFiltered - Exported {} messages to {}",
+                  chunkWriter.messageCount(), outputPath);
+    return true;
+}
+
+} // namespace mxrc::core::logging
@@ -0,0 +1,219 @@
+#ifndef MXRC_CORE_LOGGING_CORE_BAGSCANNER_H
+#define MXRC_CORE_LOGGING_CORE_BAGSCANNER_H
+
+#include "dto/BagFormat.h"
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace mxrc::core::logging {
+
+class BagReader;
+
+/**
+ * @brief topic별 집계 결과
+ *
+ * 숫자 통계(min/max/mean)는 값(또는 ScanOptions::field가 가리키는 필드)이
+ * 숫자인 메시지에 대해서만 계산합니다.
+ */
+struct TopicStats {
+    uint64_t count = 0;              ///< 메시지 수
+    uint64_t numericCount = 0;       ///< 숫자 값이 있는 메시지 수
+    double min = std::numeric_limits<double>::infinity();    ///< 최솟값
+    double max = -std::numeric_limits<double>::infinity();   ///< 최댓값
+    double sum = 0.0;                ///< 합계 (mean 계산용)
+    uint64_t firstTimestampNs = std::numeric_limits<uint64_t>::max();  ///< 최초 타임스탬프
+    uint64_t lastTimestampNs = 0;    ///< 최종 타임스탬프
+
+    /**
+     * @brief 메시지 하나 반영
+     *
+     * @param timestamp_ns 메시지 타임스탬프
+     * @param value 숫자 값 (없으면 nullptr)
+     */
+    void add(uint64_t timestamp_ns, const double* value);
+
+    /**
+     * @brief 다른 범위의 집계 결과 병합
+     */
+    void merge(const TopicStats& other);
+
+    /**
+     * @brief 숫자 값 평균 (숫자 값이 없으면 0)
+     */
+    double mean() const { return numericCount > 0 ? sum / static_cast<double>(numericCount) : 0.0; }
+
+    /**
+     * @brief 평균 발행 주기 기준 메시지 rate (Hz, 메시지 2개 미만이면 0)
+     */
+    double rateHz() const;
+};
+
+/**
+ * @brief 스캔 옵션
+ */
+struct ScanOptions {
+    unsigned threads = 0;            ///< 작업 스레드 수 (0이면 hardware_concurrency)
+    size_t rangesPerThread = 4;      ///< 스레드당 범위 수 (부하 분산용)
+    std::string topic;               ///< 토픽 필터 (빈 문자열이면 전체)
+    std::string field;               ///< 숫자 필드 JSON pointer (예: "/x", 빈 문자열이면 값 자체)
+    uint64_t startTimeNs = 0;        ///< 시간 필터 시작 (포함)
+    uint64_t endTimeNs = std::numeric_limits<uint64_t>::max();  ///< 시간 필터 끝 (포함)
+};
+
+/**
+ * @brief 스캔 결과
+ */
+struct ScanResult {
+    bool ok = false;                             ///< 스캔 성공 여부
+    std::map<std::string, TopicStats> topics;    ///< topic → 집계
+    uint64_t messagesScanned = 0;                ///< 필터 적용 전 읽은 메시지 수
+    size_t rangeCount = 0;                       ///< 처리한 범위 수
+    unsigned threads = 0;                        ///< 사용한 스레드 수
+    double elapsedSec = 0.0;                     ///< 소요 시간 (초)
+};
+
+/**
+ * @brief 파일 내 스캔 범위
+ *
+ * 인덱스 엔트리 오프셋에 정렬된 [beginOffset, endOffset) 구간입니다.
+ */
+struct ScanRange {
+    size_t file = 0;                 ///< 파일 번호 (open()에 전달한 순서)
+    uint64_t beginOffset = 0;        ///< 범위 시작 오프셋
+    uint64_t endOffset = 0;          ///< 범위 끝 오프셋
+};
+
+/**
+ * @brief Bag 파일 병렬 스캔/집계 도구
+ *
+ * Bag 파일(또는 로테이션된 파일 묶음)을 인덱스 엔트리 경계(JSONL은 메시지,
+ * 바이너리는 청크)에 맞춘 범위로 나누고, 각 범위를 작업 스레드가 독립된
+ * BagReader로 읽습니다. 범위 경계가 레코드 경계이므로 스레드 간 공유 상태 없이
+ * 파싱할 수 있고, 결과는 스레드별로 모아 마지막에 병합합니다.
+ *
+ * **주요 기능**:
+ * - topic별 집계: count, min, max, mean, rate
+ * - 필터링된 구간(topic/시간)을 새 바이너리 Bag 파일로 내보내기
+ *
+ * **사용 예시**:
+ * ```cpp
+ * BagScanner scanner;
+ * scanner.open({"run_0.bag", "run_1.bag"});
+ *
+ * ScanOptions options;
+ * options.threads = 8;
+ * options.field = "/x";
+ * ScanResult result = scanner.aggregate(options);
+ * for (const auto& [topic, stats] : result.topics) {
+ *     spdlog::info("{}: {} msgs, mean {}", topic, stats.count, stats.mean());
+ * }
+ *
+ * scanner.exportFiltered("robot_position.bag", options);
+ * ```
+ *
+ * **Thread-Safety**: open() 이후 aggregate/exportFiltered는 const이며 동시 호출 가능
+ */
+class BagScanner {
+public:
+    /**
+     * @brief Bag 파일 열기
+     *
+     * 각 파일의 Footer와 인덱스를 읽어 범위 분할 정보를 준비합니다.
+     * 로테이션된 파일은 시간 순서대로 전달해야 내보내기 순서가 유지됩니다.
+     *
+     * @param filepaths Bag 파일 경로 목록
+     * @return true if 모든 파일을 열었음
+     */
+    bool open(const std::vector<std::string>& filepaths);
+
+    /**
+     * @brief 열린 파일 정보 초기화
+     */
+    void close();
+
+    /**
+     * @brief 열린 파일 수
+     */
+    size_t fileCount() const { return files_.size(); }
+
+    /**
+     * @brief 전체 메시지 수 (Footer 기준)
+     */
+    uint64_t messageCount() const;
+
+    /**
+     * @brief 데이터 영역을 인덱스 경계에 맞춘 범위로 분할
+     *
+     * 범위 크기(바이트)가 비슷하도록 나누며, 한 범위는 한 파일에만 속합니다.
+     * 인덱스 엔트리가 부족하면 targetCount보다 적은 범위를 반환합니다.
+     *
+     * @param targetCount 목표 범위 수
+     * @return 파일/오프셋 순서의 범위 목록
+     */
+    std::vector<ScanRange> splitRanges(size_t targetCount) const;
+
+    /**
+     * @brief 병렬 스캔으로 topic별 집계
+     *
+     * @param options 스캔 옵션
+     * @return 집계 결과 (field가 잘못된 JSON pointer이거나 파일을 열 수 없으면 ok=false)
+     */
+    ScanResult aggregate(const ScanOptions& options) const;
+
+    /**
+     * @brief 필터링된 메시지를 바이너리 Bag 파일로 내보내기
+     *
+     * 범위는 병렬로 읽고, 기록은 범위 순서대로 하여 입력 순서를 유지합니다.
+     *
+     * @param outputPath 출력 파일 경로
+     * @param options 스캔 옵션 (topic/시간 필터, 스레드 수)
+     * @param compression 출력 청크 압축 방식
+     * @param exported [out] 내보낸 메시지 수 (nullptr 가능)
+     * @return true if 성공
+     */
+    bool exportFiltered(const std::string& outputPath, const ScanOptions& options,
+                        ChunkCompression compression = ChunkCompression::None,
+                        uint64_t* exported = nullptr) const;
+
+private:
+    /**
+     * @brief 파일별 분할 정보
+     */
+    struct FileInfo {
+        std::string path;                    ///< 파일 경로
+        uint64_t dataEnd = 0;                ///< 데이터 영역 끝 (index_offset)
+        uint64_t messageCount = 0;           ///< 메시지 수
+        std::vector<uint64_t> offsets;       ///< 인덱스 엔트리 오프셋 (오름차순)
+    };
+
+    /**
+     * @brief 옵션의 스레드 수 결정
+     */
+    static unsigned resolveThreads(const ScanOptions& options);
+
+    /**
+     * @brief 범위를 작업 스레드에 분배하여 실행
+     *
+     * 스레드는 공유 카운터로 다음 범위를 가져가며, 파일별 BagReader를 스레드마다
+     * 하나씩 열어 재사용합니다. fn에는 해당 범위로 제한되고 토픽 필터가 적용된
+     * 리더가 전달되며, 파일을 열 수 없으면 nullptr가 전달됩니다.
+     *
+     * @param ranges 범위 목록
+     * @param threads 작업 스레드 수
+     * @param topic 토픽 필터
+     * @param fn fn(worker, rangeIndex, reader)
+     */
+    void forEachRange(const std::vector<ScanRange>& ranges, unsigned threads,
+                      const std::string& topic,
+                      const std::function<void(unsigned, size_t, BagReader*)>& fn) const;
+
+    std::vector<FileInfo> files_;            ///< 열린 파일
+};
+
+} // namespace mxrc::core::logging
+
+#endif // MXRC_CORE_LOGGING_CORE_BAGSCANNER_H
@@ -0,0 +1,379 @@
+#include "ColumnarExporter.h"
+#include "BagReader.h"
+#include <spdlog/spdlog.h>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+namespace mxrc::core::logging {
+
+namespace {
+
+/// @brief 컬럼 블록 오프셋 정렬
+uint64_t alignUp(uint64_t offset) {
+    return (offset + kColumnAlignment - 1) & ~(kColumnAlignment - 1);
+}
+
+/// @brief JSON 값의 컬럼 타입 (null은 호출 전에 처리)
+ColumnType columnTypeOf(const nlohmann::json& value) {
+    if (value.is_boolean()) {
+        return ColumnType::Bool;
+    }
+    if (value.is_number_unsigned()) {
+        return value.get<uint64_t>() > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())
+                   ? ColumnType::Float64 : ColumnType::Int64;
+    }
+    if (value.is_number_integer()) {
+        return ColumnType::Int64;
+    }
+    if (value.is_number_float()) {
+        return ColumnType::Float64;
+    }
+    return ColumnType::String;
+}
+
+/// @brief String 컬럼에 저장할 텍스트 (JSON 문자열은 따옴표 없이)
+std::string textOf(const nlohmann::json& value) {
+    return value.is_string() ? value.get<std::string>() : value.dump();
+}
+
+}  // namespace
+
+void ColumnarExporter::ColumnBuilder::append(const nlohmann::json& value) {
+    if (value.is_null()) {
+        appendNull();
+        return;
+    }
+
+    ColumnType kind = columnTypeOf(value);
+    if (!typed) {
+        promote(kind);
+        typed = true;
+    } else if (kind != type) {
+        bool widenToFloat = (type == ColumnType::Int64 && kind == ColumnType::Float64);
+        bool storeAsFloat = (type == ColumnType::Float64 && kind == ColumnType::Int64);
+        if (widenToFloat) {
+            promote(ColumnType::Float64);
+        } else if (!storeAsFloat) {
+            promote(ColumnType::String);
+        }
+    }
+
+    switch (type) {
+        case ColumnType::Int64:
+            ints.push_back(value.get<int64_t>());
+            break;
+        case ColumnType::Float64:
+            floats.push_back(value.get<double>());
+            break;
+        case ColumnType::Bool:
+            bools.push_back(value.get<bool>() ? 1 : 0);
+            break;
+        default:
+            bytes += textOf(value);
+            offsets.push_back(bytes.size());
+            break;
+    }
+    valid.push_back(1);
+}
+
+void ColumnarExporter::ColumnBuilder::appendNull() {
+    switch (type) {
+        case ColumnType::Int64:
+            ints.push_back(0);
+            break;
+        case ColumnType::Float64:
+            floats.push_back(std::numeric_limits<double>::quiet_NaN());
+            break;
+        case ColumnType::Bool:
+            bools.push_back(0);
+            break;
+        default:
+            offsets.push_back(bytes.size());
+            break;
+    }
+    valid.push_back(0);
+    nullCount++;
+}
+
+void ColumnarExporter::ColumnBuilder::promote(ColumnType target) {
+    if (target == type) {
+        return;
+    }
+
+    // 타입이 정해지기 전(모두 null)은 Int64 0으로 채워져 있으므로 같은 변환으로 처리
+    const uint64_t count = rows();
+    auto textAt = [this](uint64_t row) -> std::string {
+        if (!valid[row]) {
+            return {};
+        }
+        switch (type) {
+            case ColumnType::Int64:   return std::to_string(ints[row]);
+            case ColumnType::Float64: return nlohmann::json(floats[row]).dump();
+            case ColumnType::Bool:    return bools[row] ? "true" : "false";
+            default:                  return {};
+        }
+    };
+
+    switch (target) {
+        case ColumnType::Float64:
+            floats.resize(count);
+            for (uint64_t row = 0; row < count; ++row) {
+                floats[row] = valid[row] ? static_cast<double>(ints[row])
+                                         : std::numeric_limits<double>::quiet_NaN();
+            }
+            break;
+        case ColumnType::Bool:
+            bools.assign(count, 0);
+            break;
+        case ColumnType::String:
+            bytes.clear();
+            offsets.assign(1, 0);
+            for (uint64_t row = 0; row < count; ++row) {
+                bytes += textAt(row);
+                offsets.push_back(bytes.size());
+            }
+            break;
+        default:
+            break;
+    }
+
+    ints.clear();
+    ints.shrink_to_fit();
+    if (target != ColumnType::Float64) {
+        floats.clear();
+        floats.shrink_to_fit();
+    }
+    if (target != ColumnType::Bool) {
+        bools.clear();
+        bools.shrink_to_fit();
+    }
+    type = target;
+}
+
+ColumnarExporter::ColumnBuilder& ColumnarExporter::TopicBuilder::column(const std::string& field) {
+    auto it = columnIds.find(field);
+    if (it != columnIds.end()) {
+        return columns[it->second];
+    }
+
+    // 중간에 처음 나타난 필드는 이전 행을 null로 채움
+    columnIds.emplace(field, columns.size());
+    ColumnBuilder& builder = columns.emplace_back();
+    builder.name = field;
+    for (size_t row = 0; row + 1 < timestamps.size(); ++row) {
+        builder.appendNull();
+    }
+    return builder;
+}
+
+void ColumnarExporter::flatten(const nlohmann::json& value, const std::string& prefix,
+                               std::vector<std::pair<std::string, const nlohmann::json*>>& out) {
+    if (!value.is_object() || value.empty()) {
+        out.emplace_back(prefix.empty() ? "value" : prefix, &value);
+        return;
+    }
+
+    for (auto it = value.begin(); it != value.end(); ++it) {
+        flatten(it.value(), prefix.empty() ? it.key() : prefix + "." + it.key(), out);
+    }
+}
+
+bool ColumnarExporter::addMessage(const BagMessage& msg) {
+    uint64_t ts = static_cast<uint64_t>(msg.timestamp_ns);
+    if ((!topicFilter_.empty() && msg.topic != topicFilter_) || ts < startNs_ || ts > endNs_) {
+        return false;
+    }
+
+    auto value = nlohmann::json::parse(msg.serialized_value, nullptr, false);
+    if (value.is_discarded()) {
+        spdlog::warn("ColumnarExporter::addMessage - Unparsable value on topic {}", msg.topic);
+        return false;
+    }
+
+    auto [it, inserted] = topicIds_.emplace(msg.topic, topics_.size());
+    if (inserted) {
+        TopicBuilder& created = topics_.emplace_back();
+        created.name = msg.topic;
+        created.dataType = msg.data_type;
+    }
+    TopicBuilder& topic = topics_[it->second];
+
+    topic.timestamps.push_back(ts);
+    const uint64_t rows = topic.timestamps.size();
+
+    fields_.clear();
+    flatten(value, "", fields_);
+    for (const auto& [field, fieldValue] : fields_) {
+        ColumnBuilder& column = topic.column(field);
+        if (column.rows() < rows) {  // 같은 이름이 중복되면 첫 값만 사용
+            column.append(*fieldValue);
+        }
+    }
+
+    // 이번 메시지에 없는 필드는 null
+    for (auto& column : topic.columns) {
+        if (column.rows() < rows) {
+            column.appendNull();
+        }
+    }
+
+    rowCount_++;
+    return true;
+}
+
+bool ColumnarExporter::addBag(const std::string& path) {
+    BagReader reader;
+    if (!reader.open(path)) {
+        spdlog::error("ColumnarExporter::addBag - Failed to open bag file: {}", path);
+        return false;
+    }
+    if (!topicFilter_.empty()) {
+        reader.setTopicFilter(topicFilter_);
+    }
+
+    while (auto msg = reader.readNext()) {
+        addMessage(*msg);
+    }
+    return true;
+}
+
+void ColumnarExporter::clear() {
+    topics_.clear();
+    topicIds_.clear();
+    fields_.clear();
+    rowCount_ = 0;
+}
+
+bool ColumnarExporter::write(const std::string& outputPath) const {
+    // 기록할 블록 (디렉토리 뒤에 정렬하여 순서대로 배치)
+    struct Block {
+        const void* data;
+        uint64_t size;
+        uint64_t offset;
+    };
+    std::vector<Block> blocks;
+    std::vector<ColumnarTopic> topicEntries;
+    std::vector<ColumnarColumn> columnEntries;
+    std::string names;
+
+    size_t columnCount = 0;
+    for (const auto& topic : topics_) {
+        columnCount += 1 + topic.columns.size();
+    }
+
+    ColumnarHeader header{};
+    header.magic = kColumnarMagic;
+    header.version = kColumnarVersion;
+    header.topic_count = static_cast<uint32_t>(topics_.size());
+    header.column_count = columnCount;
+    header.topics_offset = sizeof(ColumnarHeader);
+    header.columns_offset = header.topics_offset + topics_.size() * sizeof(ColumnarTopic);
+    header.names_offset = header.columns_offset + columnCount * sizeof(ColumnarColumn);
+
+    for (const auto& topic : topics_) {
+        names += topic.name;
+        names += kTimestampColumn;
+        for (const auto& column : topic.columns) {
+            names += column.name;
+        }
+    }
+    header.names_size = names.size();
+
+    uint64_t cursor = alignUp(header.names_offset + header.names_size);
+    auto place = [&](const void* data, uint64_t size) {
+        uint64_t offset = cursor;
+        blocks.push_back({data, size, offset});
+        cursor = alignUp(cursor + size);
+        return offset;
+    };
+
+    uint64_t nameCursor = 0;
+    auto addColumn = [&](uint64_t nameLength, ColumnType type) -> ColumnarColumn& {
+        ColumnarColumn& entry = columnEntries.emplace_back();
+        std::memset(&entry, 0, sizeof(entry));
+        entry.name_offset = nameCursor;
+        entry.name_length = static_cast<uint32_t>(nameLength);
+        entry.type = static_cast<uint8_t>(type);
+        nameCursor += nameLength;
+        return entry;
+    };
+
+    const uint64_t timestampNameLength = std::char_traits<char>::length(kTimestampColumn);
+    for (const auto& topic : topics_) {
+        ColumnarTopic& entry = topicEntries.emplace_back();
+        entry.name_offset = nameCursor;
+        entry.name_length = static_cast<uint32_t>(topic.name.size());
+        entry.data_type = static_cast<uint32_t>(topic.dataType);
+        entry.row_count = topic.timestamps.size();
+        entry.first_column = static_cast<uint32_t>(columnEntries.size());
+        entry.column_count = static_cast<uint32_t>(1 + topic.columns.size());
+        nameCursor += topic.name.size();
+
+        ColumnarColumn& ts = addColumn(timestampNameLength, ColumnType::UInt64);
+        ts.data_size = topic.timestamps.size() * sizeof(uint64_t);
+        ts.data_offset = place(topic.timestamps.data(), ts.data_size);
+
+        for (const auto& column : topic.columns) {
+            ColumnarColumn& col = addColumn(column.name.size(), column.type);
+            switch (column.type) {
+                case ColumnType::Int64:
+                    col.data_size = column.ints.size() * sizeof(int64_t);
+                    col.data_offset = place(column.ints.data(), col.data_size);
+                    break;
+                case ColumnType::Float64:
+                    col.data_size = column.floats.size() * sizeof(double);
+                    col.data_offset = place(column.floats.data(), col.data_size);
+                    break;
+                case ColumnType::Bool:
+                    col.data_size = column.bools.size();
+                    col.data_offset = place(column.bools.data(), col.data_size);
+                    break;
+                default:
+                    col.data_size = column.bytes.size();
+                    col.data_offset = place(column.bytes.data(), col.data_size);
+                    col.aux_offset = place(column.offsets.data(),
+                                           column.offsets.size() * sizeof(uint64_t));
+                    break;
+            }
+            if (column.nullCount > 0) {
+                col.valid_offset = place(column.valid.data(), column.valid.size());
+            }
+        }
+    }
+    header.file_size = cursor;
+
+    std::ofstream ofs(outputPath, std::ios::binary | std::ios::trunc);
+    if (!ofs.is_open()) {
+        spdlog::error("ColumnarExporter::write - Failed to create file: {}", outputPath);
+        return false;
+    }
+
+    ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    ofs.write(reinterpret_cast<const char*>(topicEntries.data()),
+              static_cast<std::streamsize>(topicEntries.size() * sizeof(ColumnarTopic)));
+    ofs.write(reinterpret_cast<const char*>(columnEntries.data()),
+              static_cast<std::streamsize>(columnEntries.size() * sizeof(ColumnarColumn)));
+    ofs.write(names.data(), static_cast<std::streamsize>(names.size()));
+
+    const char zeros[kColumnAlignment] = {};
+    uint64_t written = header.names_offset + header.names_size;
+    for (const auto& block : blocks) {
+        ofs.write(zeros, static_cast<std::streamsize>(block.offset - written));
+        ofs.write(static_cast<const char*>(block.data), static_cast<std::streamsize>(block.size));
+        written = block.offset + block.size;
+    }
+    ofs.write(zeros, static_cast<std::streamsize>(cursor - written));
+    ofs.close();
+
+    if (!ofs) {
+        spdlog::error("ColumnarExporter::write - Failed to write file: {}", outputPath);
+        return false;
+    }
+
+    spdlog::debug("ColumnarExporter::write - {} topics, {} columns, {} rows, {} bytes to {}",
+                  topics_.size(), columnCount, rowCount_, cursor, outputPath);
+    return true;
+}
+
+} // namespace mxrc::core::logging
@@ -0,0 +1,153 @@
+#ifndef MXRC_CORE_LOGGING_CORE_COLUMNAREXPORTER_H
+#define MXRC_CORE_LOGGING_CORE_COLUMNAREXPORTER_H
+
+#include "dto/BagMessage.h"
+#include "dto/ColumnarFormat.h"
+#include <nlohmann/json.hpp>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mxrc::core::logging {
+
+/**
+ * @brief Bag → 컬럼 파일 변환기
+ *
+ * 메시지 값을 topic별 타입 컬럼으로 모은 뒤 mmap 가능한 컬럼 파일
+ * (ColumnarFormat.h)로 기록합니다. 값 JSON의 숫자/불리언 필드는 문자열이 아닌
+ * 원래 타입(int64/double/uint8) 배열로 저장되므로, 분석 시 ColumnarReader로
+ * 파싱 없이 바로 배열을 사용할 수 있습니다.
+ *
+ * **컬럼 타입 결정**:
+ * - 정수만 나타나면 Int64, 실수가 섞이면 Float64
+ * - 불리언만 나타나면 Bool
+ * - 문자열/배열 또는 서로 호환되지 않는 타입이 섞이면 String
+ * - 값이 없거나 null인 행은 유효 플래그 0
+ *
+ * **사용 예시**:
+ * ```cpp
+ * ColumnarExporter exporter;
+ * exporter.setTopicFilter("robot_position");
+ * exporter.addBag("run_0.bag");
+ * exporter.addBag("run_1.bag");
+ * exporter.write("run.mxcol");
+ * ```
+ *
+ * **Thread-Safety**: NOT thread-safe
+ */
+class ColumnarExporter {
+public:
+    /**
+     * @brief 토픽 필터 설정 (빈 문자열이면 전체)
+     */
+    void setTopicFilter(const std::string& topic) { topicFilter_ = topic; }
+
+    /**
+     * @brief 시간 필터 설정 (양 끝 포함)
+     */
+    void setTimeRange(uint64_t startNs, uint64_t endNs) {
+        startNs_ = startNs;
+        endNs_ = endNs;
+    }
+
+    /**
+     * @brief 메시지 하나를 컬럼에 추가
+     *
+     * 필터에 맞지 않거나 값 JSON을 파싱할 수 없으면 건너뜁니다.
+     *
+     * @param msg 메시지
+     * @return true if 추가됨
+     */
+    bool addMessage(const BagMessage& msg);
+
+    /**
+     * @brief Bag 파일의 메시지를 순서대로 추가
+     *
+     * @param path Bag 파일 경로
+     * @return true if 파일을 읽었음
+     */
+    bool addBag(const std::string& path);
+
+    /**
+     * @brief 컬럼 파일 기록
+     *
+     * @param outputPath 출력 파일 경로
+     * @return true if 성공
+     */
+    bool write(const std::string& outputPath) const;
+
+    /**
+     * @brief 추가된 전체 행 수
+     */
+    uint64_t rowCount() const { return rowCount_; }
+
+    /**
+     * @brief 수집된 topic 수
+     */
+    size_t topicCount() const { return topics_.size(); }
+
+    /**
+     * @brief 수집된 데이터 초기화
+     */
+    void clear();
+
+private:
+    /**
+     * @brief 한 필드의 값 배열
+     *
+     * 첫 값의 타입으로 시작하고, 호환되지 않는 값이 들어오면 더 넓은 타입
+     * (Int64 → Float64 → String)으로 기존 값을 변환합니다.
+     */
+    struct ColumnBuilder {
+        std::string name;                    ///< 필드 이름
+        bool typed = false;                  ///< 첫 유효 값으로 타입이 정해졌는지
+        ColumnType type = ColumnType::Int64; ///< 현재 타입
+        std::vector<int64_t> ints;           ///< Int64 값
+        std::vector<double> floats;          ///< Float64 값
+        std::vector<uint8_t> bools;          ///< Bool 값
+        std::string bytes;                   ///< String 바이트
+        std::vector<uint64_t> offsets;       ///< String 시작 오프셋 (rows + 1)
+        std::vector<uint8_t> valid;          ///< 행별 유효 플래그
+        uint64_t nullCount = 0;              ///< 유효하지 않은 행 수
+
+        uint64_t rows() const { return valid.size(); }
+        void append(const nlohmann::json& value);
+        void appendNull();
+        void promote(ColumnType target);
+    };
+
+    /**
+     * @brief topic별 컬럼 묶음
+     */
+    struct TopicBuilder {
+        std::string name;                                    ///< topic 이름
+        DataType dataType = DataType::Event;                 ///< 첫 메시지 DataType
+        std::vector<uint64_t> timestamps;                    ///< 타임스탬프 컬럼
+        std::vector<ColumnBuilder> columns;                  ///< 필드 컬럼 (첫 등장 순서)
+        std::unordered_map<std::string, size_t> columnIds;   ///< 필드 이름 → 컬럼 번호
+
+        ColumnBuilder& column(const std::string& field);
+    };
+
+    /**
+     * @brief 값 JSON을 (필드 이름, 값) 목록으로 펼침
+     *
+     * 객체는 재귀적으로 '.'로 연결하고, 스칼라/배열 최상위 값은 "value"로 둡니다.
+     */
+    static void flatten(const nlohmann::json& value, const std::string& prefix,
+                        std::vector<std::pair<std::string, const nlohmann::json*>>& out);
+
+    std::vector<TopicBuilder> topics_;                       ///< topic (첫 등장 순서)
+    std::unordered_map<std::string, size_t> topicIds_;       ///< topic 이름 → 번호
+    std::vector<std::pair<std::string, const nlohmann::json*>> fields_;  ///< flatten 버퍼 (재사용)
+    std::string topicFilter_;                                ///< 토픽 필터
+    uint64_t startNs_ = 0;                                   ///< 시간 필터 시작
+    uint64_t endNs_ = std::numeric_limits<uint64_t>::max();  ///< 시간 필터 끝
+    uint64_t rowCount_ = 0;                                  ///< 전체 행 수
+};
+
+} // namespace mxrc::core::logging
+
+#endif // MXRC_CORE_LOGGING_CORE_COLUMNAREXPORTER_H
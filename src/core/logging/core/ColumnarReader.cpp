@@ -0,0 +1,217 @@
+#include "ColumnarReader.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstring>
+
+namespace mxrc::core::logging {
+
+namespace {
+
+/// @brief 고정 크기 컬럼의 값 크기 (String은 0)
+uint64_t elementSize(ColumnType type) {
+    switch (type) {
+        case ColumnType::Int64:
+        case ColumnType::Float64:
+        case ColumnType::UInt64:
+            return 8;
+        case ColumnType::Bool:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+}  // namespace
+
+std::string_view ColumnView::stringAt(uint64_t row) const {
+    if (type != ColumnType::String || !offsets || row >= rows) {
+        return {};
+    }
+    uint64_t begin = std::min(offsets[row], dataSize);
+    uint64_t end = std::min(offsets[row + 1], dataSize);
+    return end > begin ? std::string_view(data + begin, end - begin) : std::string_view();
+}
+
+bool ColumnarReader::open(const std::string& filepath) {
+    close();
+
+    if (!mapped_.open(filepath) || mapped_.size() < sizeof(ColumnarHeader)) {
+        spdlog::error("ColumnarReader::open - Failed to map file: {}", filepath);
+        close();
+        return false;
+    }
+
+    std::memcpy(&header_, mapped_.data(), sizeof(ColumnarHeader));
+    if (!header_.isValid() || header_.file_size > mapped_.size()) {
+        spdlog::error("ColumnarReader::open - Invalid or truncated columnar file: {}", filepath);
+        close();
+        return false;
+    }
+
+    topics_ = reinterpret_cast<const ColumnarTopic*>(mapped_.data() + header_.topics_offset);
+    columns_ = reinterpret_cast<const ColumnarColumn*>(mapped_.data() + header_.columns_offset);
+    names_ = mapped_.data() + header_.names_offset;
+
+    if (!validate()) {
+        spdlog::error("ColumnarReader::open - Corrupted directory: {}", filepath);
+        close();
+        return false;
+    }
+
+    spdlog::debug("ColumnarReader::open - Opened {}, {} topics, {} columns",
+                  filepath, static_cast<uint32_t>(header_.topic_count),
+                  static_cast<uint64_t>(header_.column_count));
+    return true;
+}
+
+void ColumnarReader::close() {
+    mapped_.close();
+    header_ = ColumnarHeader{};
+    topics_ = nullptr;
+    columns_ = nullptr;
+    names_ = nullptr;
+}
+
+bool ColumnarReader::validate() const {
+    const uint64_t size = header_.file_size;
+    auto inRange = [size](uint64_t offset, uint64_t length) {
+        return offset <= size && length <= size - offset;
+    };
+    auto inNames = [this](uint64_t offset, uint64_t length) {
+        return offset <= header_.names_size && length <= header_.names_size - offset;
+    };
+
+    if (header_.column_count > size / sizeof(ColumnarColumn) ||
+        !inRange(header_.topics_offset, header_.topic_count * sizeof(ColumnarTopic)) ||
+        !inRange(header_.columns_offset, header_.column_count * sizeof(ColumnarColumn)) ||
+        !inRange(header_.names_offset, header_.names_size)) {
+        return false;
+    }
+
+    for (uint32_t t = 0; t < header_.topic_count; ++t) {
+        const ColumnarTopic& topic = topics_[t];
+        uint64_t rows = topic.row_count;
+        if (!inNames(topic.name_offset, topic.name_length) ||
+            rows >= size / sizeof(uint64_t) ||
+            topic.column_count == 0 ||
+            static_cast<uint64_t>(topic.first_column) + topic.column_count > header_.column_count) {
+            return false;
+        }
+
+        for (uint32_t c = topic.first_column; c < topic.first_column + topic.column_count; ++c) {
+            const ColumnarColumn& column = columns_[c];
+            auto type = static_cast<ColumnType>(column.type);
+            uint64_t element = elementSize(type);
+
+            if (column.type > static_cast<uint8_t>(ColumnType::UInt64) ||
+                !inNames(column.name_offset, column.name_length) ||
+                !inRange(column.data_offset, column.data_size) ||
+                column.data_offset % kColumnAlignment != 0) {
+                return false;
+            }
+            if (element > 0 && column.data_size != rows * element) {
+                return false;
+            }
+            if (type == ColumnType::String &&
+                (column.aux_offset % kColumnAlignment != 0 ||
+                 !inRange(column.aux_offset, (rows + 1) * sizeof(uint64_t)))) {
+                return false;
+            }
+            if (column.valid_offset != 0 && !inRange(column.valid_offset, rows)) {
+                return false;
+            }
+        }
+
+        // 첫 컬럼은 타임스탬프
+        if (static_cast<ColumnType>(columns_[topic.first_column].type) != ColumnType::UInt64) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string_view ColumnarReader::nameAt(uint64_t offset, uint32_t length) const {
+    return std::string_view(names_ + offset, length);
+}
+
+const ColumnarTopic* ColumnarReader::findTopic(const std::string& topic) const {
+    for (uint32_t t = 0; isOpen() && t < header_.topic_count; ++t) {
+        if (nameAt(topics_[t].name_offset, topics_[t].name_length) == topic) {
+            return &topics_[t];
+        }
+    }
+    return nullptr;
+}
+
+std::vector<std::string> ColumnarReader::topics() const {
+    std::vector<std::string> names;
+    for (uint32_t t = 0; isOpen() && t < header_.topic_count; ++t) {
+        names.emplace_back(nameAt(topics_[t].name_offset, topics_[t].name_length));
+    }
+    return names;
+}
+
+uint64_t ColumnarReader::rowCount(const std::string& topic) const {
+    const ColumnarTopic* entry = findTopic(topic);
+    return entry ? entry->row_count : 0;
+}
+
+std::optional<uint32_t> ColumnarReader::dataType(const std::string& topic) const {
+    const ColumnarTopic* entry = findTopic(topic);
+    if (!entry) {
+        return std::nullopt;
+    }
+    return entry->data_type;
+}
+
+const uint64_t* ColumnarReader::timestamps(const std::string& topic) const {
+    const ColumnarTopic* entry = findTopic(topic);
+    if (!entry) {
+        return nullptr;
+    }
+    return makeView(*entry, columns_[entry->first_column]).values<uint64_t>();
+}
+
+std::vector<std::string> ColumnarReader::columnNames(const std::string& topic) const {
+    std::vector<std::string> names;
+    if (const ColumnarTopic* entry = findTopic(topic)) {
+        for (uint32_t c = entry->first_column; c < entry->first_column + entry->column_count; ++c) {
+            names.emplace_back(nameAt(columns_[c].name_offset, columns_[c].name_length));
+        }
+    }
+    return names;
+}
+
+std::optional<ColumnView> ColumnarReader::column(const std::string& topic,
+                                                 const std::string& field) const {
+    const ColumnarTopic* entry = findTopic(topic);
+    if (!entry) {
+        return std::nullopt;
+    }
+
+    for (uint32_t c = entry->first_column; c < entry->first_column + entry->column_count; ++c) {
+        if (nameAt(columns_[c].name_offset, columns_[c].name_length) == field) {
+            return makeView(*entry, columns_[c]);
+        }
+    }
+    return std::nullopt;
+}
+
+ColumnView ColumnarReader::makeView(const ColumnarTopic& topic,
+                                    const ColumnarColumn& column) const {
+    ColumnView view;
+    view.name = nameAt(column.name_offset, column.name_length);
+    view.type = static_cast<ColumnType>(column.type);
+    view.rows = topic.row_count;
+    view.data = mapped_.data() + column.data_offset;
+    view.dataSize = column.data_size;
+    if (column.valid_offset != 0) {
+        view.validFlags = reinterpret_cast<const uint8_t*>(mapped_.data() + column.valid_offset);
+    }
+    if (view.type == ColumnType::String) {
+        view.offsets = reinterpret_cast<const uint64_t*>(mapped_.data() + column.aux_offset);
+    }
+    return view;
+}
+
+} // namespace mxrc::core::logging
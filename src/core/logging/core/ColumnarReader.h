@@ -0,0 +1,149 @@
+#ifndef MXRC_CORE_LOGGING_CORE_COLUMNARREADER_H
+#define MXRC_CORE_LOGGING_CORE_COLUMNARREADER_H
+
+#include "dto/ColumnarFormat.h"
+#include "util/MappedFile.h"
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mxrc::core::logging {
+
+/**
+ * @brief 매핑된 컬럼 하나에 대한 뷰
+ *
+ * 값 배열은 매핑 영역을 직접 가리키므로 ColumnarReader가 열려 있는 동안만 유효합니다.
+ */
+struct ColumnView {
+    std::string_view name;                       ///< 필드 이름
+    ColumnType type = ColumnType::Int64;         ///< 값 타입
+    uint64_t rows = 0;                           ///< 행 수
+    const char* data = nullptr;                  ///< 값 배열 (String은 바이트)
+    uint64_t dataSize = 0;                       ///< 값 배열 크기 (바이트)
+    const uint8_t* validFlags = nullptr;         ///< 행별 유효 플래그 (nullptr이면 모두 유효)
+    const uint64_t* offsets = nullptr;           ///< String 시작 오프셋 (rows + 1)
+
+    /**
+     * @brief 타입 배열로 접근 (Int64 → int64_t, Float64 → double, Bool → uint8_t, UInt64 → uint64_t)
+     */
+    template <typename T>
+    const T* values() const { return reinterpret_cast<const T*>(data); }
+
+    /**
+     * @brief 행 값 유효 여부 (원본 메시지에 필드가 없거나 null이면 false)
+     */
+    bool isValid(uint64_t row) const { return !validFlags || validFlags[row] != 0; }
+
+    /**
+     * @brief String 컬럼의 행 값
+     */
+    std::string_view stringAt(uint64_t row) const;
+};
+
+/**
+ * @brief 컬럼 파일 읽기 클래스
+ *
+ * ColumnarExporter가 기록한 파일을 mmap하고 디렉토리만 검증하므로,
+ * 여는 비용이 데이터 크기와 무관하며 컬럼 값은 필요한 페이지만 로드됩니다.
+ *
+ * **사용 예시**:
+ * ```cpp
+ * ColumnarReader reader;
+ * reader.open("run.mxcol");
+ * const uint64_t* ts = reader.timestamps("imu");
+ * auto ax = reader.column("imu", "accel.x");
+ * if (ax && ax->type == ColumnType::Float64) {
+ *     const double* values = ax->values<double>();
+ *     // values[0 .. ax->rows)
+ * }
+ * ```
+ *
+ * **Thread-Safety**: open() 이후 읽기 전용 (동시 조회 가능)
+ */
+class ColumnarReader {
+public:
+    /**
+     * @brief 컬럼 파일 열기
+     *
+     * @param filepath 파일 경로
+     * @return true if 헤더와 디렉토리가 유효함
+     */
+    bool open(const std::string& filepath);
+
+    /**
+     * @brief 파일 닫기
+     */
+    void close();
+
+    /**
+     * @brief 파일이 열려있는지 확인
+     */
+    bool isOpen() const { return mapped_.isOpen(); }
+
+    /**
+     * @brief topic 이름 목록 (기록 순서)
+     */
+    std::vector<std::string> topics() const;
+
+    /**
+     * @brief topic의 행 수 (없으면 0)
+     */
+    uint64_t rowCount(const std::string& topic) const;
+
+    /**
+     * @brief topic의 DataType 값 (없으면 std::nullopt)
+     */
+    std::optional<uint32_t> dataType(const std::string& topic) const;
+
+    /**
+     * @brief topic의 타임스탬프 배열 (없으면 nullptr)
+     */
+    const uint64_t* timestamps(const std::string& topic) const;
+
+    /**
+     * @brief topic의 컬럼 이름 목록 (타임스탬프 컬럼 포함)
+     */
+    std::vector<std::string> columnNames(const std::string& topic) const;
+
+    /**
+     * @brief topic의 컬럼 조회
+     *
+     * @param topic topic 이름
+     * @param field 필드 이름 (예: "value", "pose.x", kTimestampColumn)
+     * @return 컬럼 뷰 (없으면 std::nullopt)
+     */
+    std::optional<ColumnView> column(const std::string& topic, const std::string& field) const;
+
+private:
+    /**
+     * @brief 이름 테이블의 문자열
+     */
+    std::string_view nameAt(uint64_t offset, uint32_t length) const;
+
+    /**
+     * @brief topic 디렉토리 엔트리 검색
+     */
+    const ColumnarTopic* findTopic(const std::string& topic) const;
+
+    /**
+     * @brief 디렉토리 엔트리 범위 검증
+     */
+    bool validate() const;
+
+    /**
+     * @brief 컬럼 디렉토리 엔트리로 뷰 생성
+     */
+    ColumnView makeView(const ColumnarTopic& topic, const ColumnarColumn& column) const;
+
+    MappedFile mapped_;                          ///< 매핑된 파일
+    ColumnarHeader header_{};                    ///< 파일 헤더
+    const ColumnarTopic* topics_ = nullptr;      ///< topic 디렉토리 (매핑 영역)
+    const ColumnarColumn* columns_ = nullptr;    ///< 컬럼 디렉토리 (매핑 영역)
+    const char* names_ = nullptr;                ///< 이름 테이블 (매핑 영역)
+};
+
+} // namespace mxrc::core::logging
+
+#endif // MXRC_CORE_LOGGING_CORE_COLUMNARREADER_H
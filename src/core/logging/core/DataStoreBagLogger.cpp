@@ -62,11 +62,12 @@ void DataStoreBagLogger::stop() {
         return;
     }
 
-    // 1. EventBus 구독 해제
+    // 1. EventBus 구독 해제 및 DataStore 캡처 해제
     if (!subscriptionId_.empty()) {
         eventBus_->unsubscribe(subscriptionId_);
         subscriptionId_.clear();
     }
+    detachDataStoreLocked();
 
     // 2. 남은 메시지 flush
     bagWriter_->flush(5000);
@@ -89,8 +90,11 @@ BagWriterStats DataStoreBagLogger::getStats() const {
     auto stats = bagWriter_->getStats();
 
     // eventsDropped는 BagWriter의 messagesDropped와 별도로 추적
-    // (EventBus에서 수신했지만 BagWriter로 전달 실패한 경우)
+    // (EventBus에서 수신했지만 BagWriter로 전달 실패한 경우, 캡처 버퍼 드롭 포함)
     stats.messagesDropped += eventsDropped_.load();
+    if (capture_) {
+        stats.messagesDropped += capture_->droppedCount();
+    }
 
     return stats;
 }
@@ -120,6 +124,64 @@ bool DataStoreBagLogger::flush(uint32_t timeoutMs) {
     return bagWriter_->flush(timeoutMs);
 }
 
+bool DataStoreBagLogger::attachDataStore(std::shared_ptr<DataStore> dataStore, size_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!isRunning_ || !dataStore || dataStore_) {
+        spdlog::warn("DataStoreBagLogger::attachDataStore - not running or already attached");
+        return false;
+    }
+
+    dataStore_ = std::move(dataStore);
+    capture_ = std::make_unique<DataStoreCapture>(capacity);
+    captureRunning_ = true;
+    captureThread_ = std::thread(&DataStoreBagLogger::captureLoop, this);
+    captureAttached_ = true;
+    dataStore_->setWriteTap(capture_.get());
+
+    spdlog::info("DataStoreBagLogger attached to DataStore, capture capacity: {}", capacity);
+    return true;
+}
+
+void DataStoreBagLogger::detachDataStore() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    detachDataStoreLocked();
+}
+
+void DataStoreBagLogger::detachDataStoreLocked() {
+    if (!dataStore_) {
+        return;
+    }
+
+    // 1. 탭 해제 (반환 후에는 onWrite 호출 없음)
+    dataStore_->setWriteTap(nullptr);
+
+    // 2. 캡처 스레드 종료 후 남은 샘플 전달 (단일 소비자 유지)
+    captureRunning_ = false;
+    if (captureThread_.joinable()) {
+        captureThread_.join();
+    }
+    capture_->drain(*bagWriter_);
+    captureAttached_ = false;
+
+    spdlog::info("DataStoreBagLogger detached from DataStore, captured: {}, dropped: {}",
+                 capture_->capturedCount(), capture_->droppedCount());
+
+    eventsDropped_ += capture_->droppedCount();
+    capture_.reset();
+    dataStore_.reset();
+}
+
+void DataStoreBagLogger::captureLoop() {
+    constexpr size_t kBatchSize = 256;
+
+    while (captureRunning_.load(std::memory_order_acquire)) {
+        if (capture_->drain(*bagWriter_, kBatchSize) == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
 void DataStoreBagLogger::onDataStoreEvent(std::shared_ptr<event::IEvent> event) {
     eventsReceived_++;
 
@@ -131,6 +193,11 @@ void DataStoreBagLogger::onDataStoreEvent(std::shared_ptr<event::IEvent> event)
         return;
     }
 
+    // 직접 캡처 중에는 DataStoreEventAdapter 이벤트가 중복이므로 무시
+    if (captureAttached_.load(std::memory_order_acquire) && dsEvent->source == "datastore") {
+        return;
+    }
+
     // BagMessage로 변환
     BagMessage bagMsg = convertToBagMessage(dsEvent);
 
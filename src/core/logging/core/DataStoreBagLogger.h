@@ -2,6 +2,7 @@
 #define MXRC_CORE_LOGGING_CORE_DATASTOREBAGLOGGER_H
 
 #include "interfaces/IBagWriter.h"
+#include "core/DataStoreCapture.h"
 #include "core/event/interfaces/IEventBus.h"
 #include "core/event/dto/DataStoreEvents.h"
 #include "dto/BagMessage.h"
@@ -9,6 +10,7 @@
 #include <string>
 #include <mutex>
 #include <atomic>
+#include <thread>
 
 namespace mxrc::core::logging {
 
@@ -24,6 +26,7 @@ namespace mxrc::core::logging {
  * - IBagWriter를 통한 비동기 쓰기
  * - 통계 수집 (기록/드롭 카운트)
  * - 안전한 시작/종료 제어
+ * - DataStore 직접 캡처 (attachDataStore): 이벤트/문자열 변환 없이 쓰기 값을 복사
  */
 class DataStoreBagLogger {
 public:
@@ -95,6 +98,28 @@ public:
      */
     bool flush(uint32_t timeoutMs = 5000);
 
+    /**
+     * @brief DataStore 직접 캡처 연결
+     *
+     * DataStore 쓰기 탭을 등록해 모든 set()/setVersioned() 값을 원시 바이트로
+     * 링 버퍼에 복사하고, 전용 스레드가 BagMessage로 변환해 기록합니다.
+     * 연결 중에는 DataStoreEventAdapter가 발행한 (source "datastore") 이벤트를
+     * 중복 기록하지 않습니다. DataStore에는 탭이 하나만 등록될 수 있습니다.
+     *
+     * @param dataStore 대상 DataStore
+     * @param capacity 링 버퍼 슬롯 수
+     * @return 성공하면 true, 정지 상태이거나 이미 연결되어 있으면 false
+     */
+    bool attachDataStore(std::shared_ptr<DataStore> dataStore, size_t capacity = 8192);
+
+    /**
+     * @brief DataStore 직접 캡처 해제
+     *
+     * 탭을 해제한 뒤 버퍼에 남은 샘플을 모두 Bag Writer로 전달합니다.
+     * stop()에서도 자동으로 호출됩니다.
+     */
+    void detachDataStore();
+
 private:
     /**
      * @brief EventBus 콜백 - DataStoreValueChangedEvent 처리
@@ -112,6 +137,16 @@ private:
     BagMessage convertToBagMessage(
         const std::shared_ptr<event::DataStoreValueChangedEvent>& event);
 
+    /**
+     * @brief 캡처 스레드 - 링 버퍼를 주기적으로 비움
+     */
+    void captureLoop();
+
+    /**
+     * @brief 캡처 해제 (mutex_ 보유 상태에서 호출)
+     */
+    void detachDataStoreLocked();
+
     std::shared_ptr<event::IEventBus> eventBus_;    ///< EventBus 인스턴스
     std::shared_ptr<IBagWriter> bagWriter_;         ///< Bag Writer 인스턴스
     event::SubscriptionId subscriptionId_;          ///< 구독 ID (해제 시 사용)
@@ -119,6 +154,12 @@ private:
     std::atomic<uint64_t> eventsReceived_;          ///< 수신한 이벤트 수
     std::atomic<uint64_t> eventsDropped_;           ///< 드롭된 이벤트 수
 
+    std::shared_ptr<DataStore> dataStore_;          ///< 캡처 대상 DataStore
+    std::unique_ptr<DataStoreCapture> capture_;     ///< 캡처 버퍼
+    std::thread captureThread_;                     ///< 캡처 버퍼 소비 스레드
+    std::atomic<bool> captureRunning_{false};       ///< 캡처 스레드 실행 플래그
+    std::atomic<bool> captureAttached_{false};      ///< 캡처 연결 상태 (중복 이벤트 무시용)
+
     mutable std::mutex mutex_;                      ///< 동기화 뮤텍스
 };
 
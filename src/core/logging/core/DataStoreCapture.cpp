@@ -0,0 +1,220 @@
+#include "core/DataStoreCapture.h"
+#include <nlohmann/json.hpp>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <functional>
+
+namespace mxrc::core::logging {
+
+namespace {
+
+template <typename T>
+T loadValue(const char* data) {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+template <typename T>
+void appendNumber(std::string& out, T value) {
+    if constexpr (std::is_floating_point_v<T>) {
+        if (!std::isfinite(value)) {
+            out += "null";
+            return;
+        }
+    }
+    char buf[32];
+    auto result = std::to_chars(buf, buf + sizeof(buf), value);
+    out.append(buf, result.ptr);
+}
+
+}  // namespace
+
+DataStoreCapture::DataStoreCapture(size_t capacity, size_t reserveBytes, size_t maxTopics)
+    : queue_(capacity), maxTopics_(maxTopics) {
+    // 모든 슬롯을 한 바퀴 돌려 값 문자열 용량 확보 (캡처 경로에서 할당 방지)
+    for (size_t i = 0; i < queue_.capacity(); ++i) {
+        queue_.tryPushWith([reserveBytes](CapturedSample& slot) {
+            slot.bytes.reserve(reserveBytes);
+        });
+        queue_.tryPopWith([](CapturedSample&) {});
+    }
+
+    // 적재율 50% 이하로 유지되는 2의 거듭제곱 크기
+    size_t tableSize = 16;
+    while (tableSize < maxTopics_ * 2) {
+        tableSize <<= 1;
+    }
+    topics_ = std::make_unique<std::atomic<const std::string*>[]>(tableSize);
+    for (size_t i = 0; i < tableSize; ++i) {
+        topics_[i].store(nullptr, std::memory_order_relaxed);
+    }
+    topicMask_ = tableSize - 1;
+}
+
+DataStoreCapture::~DataStoreCapture() {
+    for (size_t i = 0; i <= topicMask_; ++i) {
+        delete topics_[i].load(std::memory_order_relaxed);
+    }
+}
+
+bool DataStoreCapture::internTopic(const std::string& id, uint32_t& topicId) noexcept {
+    size_t index = std::hash<std::string>{}(id) & topicMask_;
+    std::string* created = nullptr;
+
+    for (size_t probe = 0; probe <= topicMask_; ++probe, index = (index + 1) & topicMask_) {
+        const std::string* name = topics_[index].load(std::memory_order_acquire);
+        if (name == nullptr) {
+            // 처음 보는 키: 등록 수를 먼저 예약하고 이름을 한 번만 복사해 빈 칸에 등록
+            if (topicCount_.fetch_add(1, std::memory_order_relaxed) >= maxTopics_) {
+                topicCount_.fetch_sub(1, std::memory_order_relaxed);
+                break;
+            }
+            if (created == nullptr) {
+                try {
+                    created = new std::string(id);
+                } catch (...) {
+                    topicCount_.fetch_sub(1, std::memory_order_relaxed);
+                    return false;
+                }
+            }
+            if (topics_[index].compare_exchange_strong(name, created,
+                                                       std::memory_order_acq_rel,
+                                                       std::memory_order_acquire)) {
+                topicId = static_cast<uint32_t>(index);
+                return true;
+            }
+            // 다른 스레드가 먼저 등록: 예약 반납 후 같은 키인지 아래에서 확인
+            topicCount_.fetch_sub(1, std::memory_order_relaxed);
+        }
+        if (*name == id) {
+            delete created;
+            topicId = static_cast<uint32_t>(index);
+            return true;
+        }
+    }
+
+    delete created;
+    return false;
+}
+
+void DataStoreCapture::onWrite(const std::string& id, ::DataType type, CapturedValueKind kind,
+                               const void* data, size_t size,
+                               std::chrono::system_clock::time_point timestamp) noexcept {
+    uint32_t topicId = 0;
+    if (!internTopic(id, topicId)) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    bool pushed = queue_.tryPushWith([&](CapturedSample& slot) {
+        slot.timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            timestamp.time_since_epoch()).count();
+        slot.dataType = type;
+        slot.kind = kind;
+        slot.topicId = topicId;
+        slot.bytes.assign(static_cast<const char*>(data), size);
+    });
+
+    if (pushed) {
+        captured_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+size_t DataStoreCapture::drain(IBagWriter& writer, size_t maxCount) {
+    size_t drained = 0;
+    while (drained < maxCount && queue_.tryPopWith([this](CapturedSample& slot) {
+               scratch_.timestamp_ns = slot.timestamp_ns;
+               scratch_.topic.assign(*topics_[slot.topicId].load(std::memory_order_acquire));
+               scratch_.data_type = toBagDataType(slot.dataType);
+               renderValue(slot.kind, slot.bytes.data(), slot.bytes.size(),
+                           scratch_.serialized_value);
+           })) {
+        if (!writer.appendAsync(scratch_)) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+        }
+        ++drained;
+    }
+    return drained;
+}
+
+void DataStoreCapture::renderValue(CapturedValueKind kind, const char* data, size_t size,
+                                   std::string& out) {
+    out.clear();
+
+    auto fixed = [size](size_t expected) { return size == expected; };
+
+    switch (kind) {
+        case CapturedValueKind::Int32:
+            if (fixed(4)) { appendNumber(out, loadValue<int32_t>(data)); return; }
+            break;
+        case CapturedValueKind::Int64:
+            if (fixed(8)) { appendNumber(out, loadValue<int64_t>(data)); return; }
+            break;
+        case CapturedValueKind::UInt32:
+            if (fixed(4)) { appendNumber(out, loadValue<uint32_t>(data)); return; }
+            break;
+        case CapturedValueKind::UInt64:
+            if (fixed(8)) { appendNumber(out, loadValue<uint64_t>(data)); return; }
+            break;
+        case CapturedValueKind::Float:
+            if (fixed(4)) { appendNumber(out, loadValue<float>(data)); return; }
+            break;
+        case CapturedValueKind::Double:
+            if (fixed(8)) { appendNumber(out, loadValue<double>(data)); return; }
+            break;
+        case CapturedValueKind::Bool:
+            if (fixed(1)) { out += (data[0] != 0) ? "true" : "false"; return; }
+            break;
+        case CapturedValueKind::String:
+            out = nlohmann::json(std::string(data, size))
+                      .dump(-1, ' ', false, nlohmann::json::error_handler_t::replace);
+            return;
+        case CapturedValueKind::DoubleArray:
+            if (size % sizeof(double) == 0) {
+                out += '[';
+                for (size_t i = 0; i < size / sizeof(double); ++i) {
+                    if (i > 0) {
+                        out += ',';
+                    }
+                    appendNumber(out, loadValue<double>(data + i * sizeof(double)));
+                }
+                out += ']';
+                return;
+            }
+            break;
+        case CapturedValueKind::Bytes:
+            break;
+    }
+
+    // Bytes 또는 크기가 맞지 않는 값: 16진수 문자열
+    static constexpr char kHex[] = "0123456789abcdef";
+    out.clear();
+    out.reserve(size * 2 + 2);
+    out += '"';
+    for (size_t i = 0; i < size; ++i) {
+        auto byte = static_cast<uint8_t>(data[i]);
+        out += kHex[byte >> 4];
+        out += kHex[byte & 0x0F];
+    }
+    out += '"';
+}
+
+DataType DataStoreCapture::toBagDataType(::DataType type) {
+    switch (type) {
+        case ::DataType::RobotMode:     return DataType::RobotMode;
+        case ::DataType::InterfaceData: return DataType::InterfaceData;
+        case ::DataType::Config:        return DataType::Config;
+        case ::DataType::Para:          return DataType::Para;
+        case ::DataType::Alarm:         return DataType::Alarm;
+        case ::DataType::Event:         return DataType::Event;
+        case ::DataType::MissionState:  return DataType::MissionState;
+        case ::DataType::TaskState:     return DataType::TaskState;
+    }
+    return DataType::Event;
+}
+
+} // namespace mxrc::core::logging
@@ -0,0 +1,131 @@
+#ifndef MXRC_CORE_LOGGING_CORE_DATASTORECAPTURE_H
+#define MXRC_CORE_LOGGING_CORE_DATASTORECAPTURE_H
+
+#include "interfaces/IBagWriter.h"
+#include "dto/BagMessage.h"
+#include "core/datastore/DataStore.h"
+#include "core/event/util/MPSCLockFreeQueue.h"
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+
+namespace mxrc::core::logging {
+
+/**
+ * @brief 캡처된 DataStore 쓰기 한 건 (큐 슬롯)
+ *
+ * 슬롯은 재사용되므로 bytes 문자열의 용량이 유지되어, 값이 확보된 용량
+ * 이내면 캡처 시 힙 할당이 발생하지 않습니다. 키는 문자열 대신 intern된
+ * topic ID로 기록합니다.
+ */
+struct CapturedSample {
+    int64_t timestamp_ns = 0;                            ///< 쓰기 시각 (ns)
+    ::DataType dataType = ::DataType::Event;             ///< DataStore DataType
+    CapturedValueKind kind = CapturedValueKind::Bytes;   ///< 값 표현
+    uint32_t topicId = 0;                                ///< intern된 DataStore 키 ID
+    std::string bytes;                                   ///< 값 원시 바이트
+};
+
+/**
+ * @brief DataStore 쓰기 탭 → Bag 기록 캡처 버퍼
+ *
+ * DataStore::setWriteTap()에 등록되어 쓰기마다 값의 원시 바이트를
+ * lock-free 링 버퍼 슬롯으로 복사만 합니다. 이벤트 생성, 문자열 변환,
+ * JSON 직렬화, EventBus 디스패치는 모두 drain() 쪽(기록 스레드)으로 옮겨집니다.
+ *
+ * **비용**: 쓰기당 키 해시 조회 + 슬롯 예약(CAS) + 값 복사. 키 문자열은 처음 볼 때만
+ * topic 테이블에 한 번 복사(할당)하고 이후에는 ID만 기록합니다.
+ * 버퍼 또는 topic 테이블이 가득 차면 드롭합니다.
+ *
+ * **값 렌더링** (drain 시, serialized_value JSON):
+ * - 정수/실수: JSON 숫자 (실수는 왕복 가능한 최단 표기, NaN/Inf는 null)
+ * - Bool: true/false
+ * - String: JSON 문자열
+ * - DoubleArray: 숫자 배열
+ * - Bytes: 16진수 문자열
+ *
+ * **Thread-Safety**: onWrite()는 여러 스레드에서 동시 호출 가능,
+ * drain()은 단일 소비자 스레드에서만 호출
+ */
+class DataStoreCapture : public WriteTap {
+public:
+    /**
+     * @brief 생성자
+     *
+     * @param capacity 링 버퍼 슬롯 수
+     * @param reserveBytes 슬롯별로 미리 확보할 값 용량
+     * @param maxTopics 기록할 수 있는 서로 다른 키 수
+     */
+    explicit DataStoreCapture(size_t capacity = 8192, size_t reserveBytes = 64,
+                              size_t maxTopics = 4096);
+
+    ~DataStoreCapture() override;
+
+    DataStoreCapture(const DataStoreCapture&) = delete;
+    DataStoreCapture& operator=(const DataStoreCapture&) = delete;
+
+    /**
+     * @brief DataStore 쓰기 수신 (WriteTap)
+     */
+    void onWrite(const std::string& id, ::DataType type, CapturedValueKind kind,
+                 const void* data, size_t size,
+                 std::chrono::system_clock::time_point timestamp) noexcept override;
+
+    /**
+     * @brief 캡처된 샘플을 BagMessage로 변환해 writer에 전달
+     *
+     * @param writer 대상 Bag Writer (appendAsync 사용)
+     * @param maxCount 최대 처리 개수
+     * @return 큐에서 꺼낸 샘플 수 (writer 거부 포함)
+     */
+    size_t drain(IBagWriter& writer, size_t maxCount = std::numeric_limits<size_t>::max());
+
+    /**
+     * @brief 캡처된 샘플 수
+     */
+    uint64_t capturedCount() const { return captured_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 드롭된 샘플 수 (버퍼 가득 참 또는 writer 거부)
+     */
+    uint64_t droppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 원시 값을 serialized_value JSON으로 렌더링
+     *
+     * @param kind 값 표현
+     * @param data 원시 바이트
+     * @param size 바이트 수
+     * @param out 결과 (덮어씀)
+     */
+    static void renderValue(CapturedValueKind kind, const char* data, size_t size,
+                            std::string& out);
+
+    /**
+     * @brief DataStore DataType → Bag DataType 변환
+     */
+    static DataType toBagDataType(::DataType type);
+
+private:
+    /**
+     * @brief 키 → topic ID (lock-free open addressing, 처음 본 키만 이름 복사)
+     *
+     * @return false if 테이블이 가득 참 또는 할당 실패
+     */
+    bool internTopic(const std::string& id, uint32_t& topicId) noexcept;
+
+    event::MPSCLockFreeQueue<CapturedSample> queue_;   ///< 캡처 링 버퍼
+    std::unique_ptr<std::atomic<const std::string*>[]> topics_;  ///< topic ID별 키 (등록 후 불변)
+    size_t topicMask_ = 0;                             ///< 테이블 크기 - 1 (2의 거듭제곱)
+    size_t maxTopics_ = 0;                             ///< 등록 가능한 키 수
+    std::atomic<size_t> topicCount_{0};                ///< 등록된 키 수
+    BagMessage scratch_;                               ///< drain용 재사용 메시지
+    std::atomic<uint64_t> captured_{0};                ///< 캡처 수
+    std::atomic<uint64_t> dropped_{0};                 ///< 드롭 수
+};
+
+} // namespace mxrc::core::logging
+
+#endif // MXRC_CORE_LOGGING_CORE_DATASTORECAPTURE_H
@@ -1,5 +1,6 @@
 #include "core/SimpleBagWriter.h"
 #include "util/FileUtils.h"
+#include "util/ChunkCodec.h"
 #include <spdlog/spdlog.h>
 #include <filesystem>
 
@@ -9,10 +10,12 @@ namespace mxrc::core::logging {
 
 SimpleBagWriter::SimpleBagWriter(const std::string& bagDirectory,
                                  const std::string& baseFilename,
-                                 size_t queueCapacity)
+                                 size_t queueCapacity,
+                                 BagFormat format)
     : bagDirectory_(bagDirectory),
       baseFilename_(baseFilename),
       queueCapacity_(queueCapacity),
+      format_(format),
       rotationPolicy_(RotationPolicy::createSizePolicy(1024)),  // 기본 1GB
       retentionPolicy_(RetentionPolicy::createTimePolicy(7)) {  // 기본 7일
 
@@ -43,7 +46,9 @@ bool SimpleBagWriter::open(const std::string& filepath) {
     }
 
     currentFilePath_ = filepath;
-    asyncWriter_ = std::make_unique<AsyncWriter>(currentFilePath_, queueCapacity_);
+    asyncWriter_ = std::make_unique<AsyncWriter>(currentFilePath_, queueCapacity_, format_,
+                                                 compression_);
+    asyncWriter_->setSyncInterval(syncIntervalMs_);
     indexer_.clear();  // 새 파일이므로 인덱스 초기화
 
     try {
@@ -66,24 +71,7 @@ void SimpleBagWriter::close() {
         return;
     }
 
-    uint64_t dataSize = 0;
-
-    if (asyncWriter_) {
-        asyncWriter_->flush(5000);
-        dataSize = asyncWriter_->getBytesWritten();
-        asyncWriter_->stop();
-        asyncWriter_.reset();
-    }
-
-    // Index 블록 및 Footer 작성 (빈 파일이어도 Footer는 작성)
-    std::ofstream ofs(currentFilePath_, std::ios::binary | std::ios::app);
-    if (ofs.is_open()) {
-        indexer_.writeToFile(ofs, dataSize);
-        ofs.close();
-        spdlog::debug("SimpleBagWriter: Index and Footer written to {}", currentFilePath_);
-    } else {
-        spdlog::error("SimpleBagWriter: Failed to open file for index writing: {}", currentFilePath_);
-    }
+    finalizeCurrentFile();
 
     isOpen_ = false;
     spdlog::info("SimpleBagWriter closed: {}", currentFilePath_);
@@ -119,8 +107,8 @@ bool SimpleBagWriter::append(const BagMessage& msg) {
 
     bool flushed = asyncWriter_->flush(1000);
 
-    // flush 성공 시 인덱스 업데이트
-    if (flushed) {
+    // flush 성공 시 인덱스 업데이트 (바이너리 포맷은 청크 단위 인덱스 사용)
+    if (flushed && format_ == BagFormat::Jsonl) {
         indexer_.addEntry(static_cast<uint64_t>(msg.timestamp_ns), currentOffset);
     }
 
@@ -152,6 +140,18 @@ void SimpleBagWriter::setRotationPolicy(const RotationPolicy& policy) {
                  (policy.type == RotationType::SIZE) ? "SIZE" : "TIME");
 }
 
+void SimpleBagWriter::setCompression(ChunkCompression compression) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    compression_ = compression;
+    spdlog::info("Chunk compression updated: {}", ChunkCodec::name(compression));
+}
+
+void SimpleBagWriter::setSyncInterval(uint32_t intervalMs) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    syncIntervalMs_ = intervalMs;
+    spdlog::info("Bag sync interval updated: {} ms", intervalMs);
+}
+
 void SimpleBagWriter::setRetentionPolicy(const RetentionPolicy& policy) {
     std::lock_guard<std::mutex> lock(mutex_);
     retentionPolicy_ = policy;
@@ -192,15 +192,22 @@ bool SimpleBagWriter::rotate() {
     totalMessagesDropped_ += asyncWriter_->getDroppedCount();
     totalBytesWritten_ += asyncWriter_->getBytesWritten();
 
-    asyncWriter_->stop();
-    asyncWriter_.reset();
+    // 바이너리 파일은 청크 인덱스가 있어야 읽을 수 있으므로 Footer까지 작성
+    if (format_ == BagFormat::Binary) {
+        finalizeCurrentFile();
+    } else {
+        asyncWriter_->stop();
+        asyncWriter_.reset();
+    }
 
     // 3. 보존 정책 적용
     applyRetentionPolicy();
 
     // 4. 새 파일 생성
     std::string newFilePath = createNewBagFile();
-    asyncWriter_ = std::make_unique<AsyncWriter>(newFilePath, queueCapacity_);
+    asyncWriter_ = std::make_unique<AsyncWriter>(newFilePath, queueCapacity_, format_,
+                                                 compression_);
+    asyncWriter_->setSyncInterval(syncIntervalMs_);
 
     try {
         asyncWriter_->start();
@@ -263,7 +270,9 @@ void SimpleBagWriter::start() {
     // 새 파일 생성 및 시작
     std::string filepath = createNewBagFile();
     currentFilePath_ = filepath;
-    asyncWriter_ = std::make_unique<AsyncWriter>(currentFilePath_, queueCapacity_);
+    asyncWriter_ = std::make_unique<AsyncWriter>(currentFilePath_, queueCapacity_, format_,
+                                                 compression_);
+    asyncWriter_->setSyncInterval(syncIntervalMs_);
 
     try {
         asyncWriter_->start();
@@ -327,6 +336,42 @@ bool SimpleBagWriter::shouldRotateInternal() const {
     return rotationPolicy_.shouldRotate(currentSize, elapsed);
 }
 
+void SimpleBagWriter::finalizeCurrentFile() {
+    // mutex는 호출자가 이미 잡고 있음
+
+    uint64_t dataSize = 0;
+    uint64_t messageCount = 0;
+    Indexer chunkIndex;
+
+    if (asyncWriter_) {
+        asyncWriter_->flush(5000);
+        asyncWriter_->stop();
+
+        if (const BinaryChunkWriter* chunkWriter = asyncWriter_->getChunkWriter()) {
+            dataSize = chunkWriter->bytesWritten();
+            messageCount = chunkWriter->messageCount();
+            chunkIndex = chunkWriter->index();
+        } else {
+            dataSize = asyncWriter_->getBytesWritten();
+        }
+        asyncWriter_.reset();
+    }
+
+    // Index 블록 및 Footer 작성 (빈 파일이어도 Footer는 작성)
+    std::ofstream ofs(currentFilePath_, std::ios::binary | std::ios::app);
+    if (ofs.is_open()) {
+        if (format_ == BagFormat::Binary) {
+            chunkIndex.writeToFile(ofs, dataSize, kBagVersionBinary, messageCount);
+        } else {
+            indexer_.writeToFile(ofs, dataSize);
+        }
+        ofs.close();
+        spdlog::debug("SimpleBagWriter: Index and Footer written to {}", currentFilePath_);
+    } else {
+        spdlog::error("SimpleBagWriter: Failed to open file for index writing: {}", currentFilePath_);
+    }
+}
+
 void SimpleBagWriter::applyRetentionPolicy() {
     // mutex는 호출자(rotate)가 이미 잡고 있음
 
@@ -19,7 +19,7 @@ namespace mxrc::core::logging {
  * RotationPolicy와 RetentionPolicy를 적용합니다.
  *
  * 주요 기능:
- * - JSONL 형식으로 메시지 기록
+ * - JSONL 또는 바이너리 청크 형식으로 메시지 기록
  * - 파일 크기/시간 기반 자동 순환
  * - 오래된 파일 자동 삭제
  * - 비동기/동기 쓰기 지원
@@ -32,10 +32,12 @@ public:
      * @param bagDirectory Bag 파일 저장 디렉토리
      * @param baseFilename 기본 파일 이름 (타임스탬프 자동 추가)
      * @param queueCapacity 비동기 큐 용량 (기본 10,000)
+     * @param format 데이터 영역 포맷 (기본 JSONL)
      */
     explicit SimpleBagWriter(const std::string& bagDirectory,
                              const std::string& baseFilename = "mxrc",
-                             size_t queueCapacity = 10000);
+                             size_t queueCapacity = 10000,
+                             BagFormat format = BagFormat::Jsonl);
 
     ~SimpleBagWriter() override;
 
@@ -55,6 +57,25 @@ public:
     void start() override;
     void stop() override;
 
+    /**
+     * @brief 바이너리 포맷 청크 압축 방식 설정
+     *
+     * 다음에 생성되는 파일(start/open/rotate)부터 적용됩니다.
+     * JSONL 포맷에서는 무시됩니다.
+     *
+     * @param compression 압축 방식
+     */
+    void setCompression(ChunkCompression compression);
+
+    /**
+     * @brief fdatasync 주기 설정 (AsyncWriter::setSyncInterval 참고)
+     *
+     * 다음에 생성되는 파일(start/open/rotate)부터 적용됩니다.
+     *
+     * @param intervalMs sync 주기 (밀리초, 0이면 비활성)
+     */
+    void setSyncInterval(uint32_t intervalMs);
+
 private:
     /**
      * @brief 새 Bag 파일 생성
@@ -78,9 +99,19 @@ private:
      */
     void applyRetentionPolicy();
 
+    /**
+     * @brief 현재 파일에 Index 블록 및 Footer 작성 후 AsyncWriter 해제
+     *
+     * mutex는 호출자가 이미 잡고 있어야 합니다.
+     */
+    void finalizeCurrentFile();
+
     std::string bagDirectory_;                  ///< Bag 파일 디렉토리
     std::string baseFilename_;                  ///< 기본 파일 이름
     size_t queueCapacity_;                      ///< 큐 용량
+    BagFormat format_;                          ///< 데이터 영역 포맷
+    ChunkCompression compression_ = ChunkCompression::None; ///< 청크 압축 방식
+    uint32_t syncIntervalMs_ = 0;               ///< fdatasync 주기 (0이면 비활성)
     std::string currentFilePath_;               ///< 현재 파일 경로
     std::unique_ptr<AsyncWriter> asyncWriter_;  ///< 비동기 Writer
     std::unique_ptr<RetentionManager> retentionManager_; ///< 보존 관리자
@@ -1,6 +1,7 @@
 #ifndef MXRC_CORE_LOGGING_DTO_BAGFOOTER_H
 #define MXRC_CORE_LOGGING_DTO_BAGFOOTER_H
 
+#include "BagFormat.h"
 #include <cstdint>
 #include <cstring>
 
@@ -19,18 +20,26 @@ namespace mxrc::core::logging {
  * - index_offset: 8 bytes (uint64_t) - 인덱스 블록 시작 위치
  * - index_count: 8 bytes (uint64_t) - 인덱스 엔트리 개수
  * - checksum: 4 bytes (uint32_t) - CRC32 체크섬
- * - reserved: 24 bytes - 향후 확장용
+ * - message_count: 8 bytes (uint64_t) - 메시지 개수 (version 2)
+ * - topic_index_offset: 8 bytes (uint64_t) - Topic 인덱스 블록 시작 위치 (version 2, 0이면 없음)
+ * - chunk_range_offset: 8 bytes (uint64_t) - 청크 끝 타임스탬프 블록 시작 위치 (version 2, 0이면 없음)
  *
  * **파일 구조**:
  * ```
- * [Messages...] [Index Block...] [Footer (64 bytes)]
+ * version 1 (JSONL):  [Messages...] [Index Block...] [Footer (64 bytes)]
+ * version 2 (Binary): [Chunks...]   [Index Block...] [Chunk Range Block...] [Topic Index Block...] [Footer (64 bytes)]
  * ```
+ *
+ * version 1의 인덱스는 메시지당 1개, version 2는 청크당 1개 엔트리입니다.
+ * Chunk Range Block은 청크 번호 순 uint64_t end_timestamp_ns 배열이며
+ * (start는 IndexEntry::timestamp_ns), 열 때 청크 헤더를 읽지 않고 시간 범위를 얻습니다.
+ * 이 블록이 없는 이전 파일은 chunk_range_offset이 0입니다 (예약 영역).
  */
 struct BagFooter {
     /// @brief 매직 넘버 (파일 타입 식별)
     char magic[8];
 
-    /// @brief Bag 포맷 버전 (현재: 1)
+    /// @brief Bag 포맷 버전 (1: JSONL, 2: Binary)
     uint32_t version;
 
     /// @brief 메시지 데이터 영역 크기 (바이트)
@@ -45,8 +54,14 @@ struct BagFooter {
     /// @brief 데이터 + 인덱스 영역의 CRC32 체크섬
     uint32_t checksum;
 
-    /// @brief 향후 확장용 예약 영역
-    char reserved[24];
+    /// @brief 메시지 개수 (version 2; version 1은 index_count와 동일)
+    uint64_t message_count;
+
+    /// @brief Topic 인덱스 블록 시작 위치 (version 2, 0이면 없음)
+    uint64_t topic_index_offset;
+
+    /// @brief 청크 끝 타임스탬프 블록 시작 위치 (version 2, 0이면 없음)
+    uint64_t chunk_range_offset;
 
     /**
      * @brief 기본 생성자 (초기화)
@@ -54,7 +69,7 @@ struct BagFooter {
     BagFooter() {
         std::memset(this, 0, sizeof(BagFooter));
         setMagic();
-        version = 1;
+        version = kBagVersionJsonl;
     }
 
     /**
@@ -88,10 +103,19 @@ struct BagFooter {
     /**
      * @brief 버전 호환성 확인
      *
-     * @return true if 지원되는 버전 (현재: version == 1)
+     * @return true if 지원되는 버전 (version 1 또는 2)
      */
     bool isSupportedVersion() const {
-        return version == 1;
+        return version == kBagVersionJsonl || version == kBagVersionBinary;
+    }
+
+    /**
+     * @brief 데이터 영역 포맷 조회
+     *
+     * @return version 2면 BagFormat::Binary, 그 외 BagFormat::Jsonl
+     */
+    BagFormat format() const {
+        return version == kBagVersionBinary ? BagFormat::Binary : BagFormat::Jsonl;
     }
 
     /**
@@ -0,0 +1,136 @@
+#ifndef MXRC_CORE_LOGGING_DTO_BAGFORMAT_H
+#define MXRC_CORE_LOGGING_DTO_BAGFORMAT_H
+
+#include <cstdint>
+
+namespace mxrc::core::logging {
+
+/**
+ * @brief Bag 파일 데이터 영역 포맷
+ *
+ * - Jsonl: 메시지당 JSON 한 줄 (BagMessage::toJsonLine), 사람이 읽기 쉬움
+ * - Binary: 고정 헤더 + payload 레코드를 청크 단위로 기록 (mmap 읽기 지원)
+ *
+ * 제한 사항: Binary 포맷의 메시지 payload는 타입별 바이너리 값이 아니라
+ * BagMessage::serialized_value의 JSON 텍스트 바이트입니다. 헤더/인덱스/청크
+ * 구조는 바이너리이고 메시지당 JSON 파싱/덤프는 없지만, 값 크기는 JSONL과
+ * 같습니다 (압축 청크 사용 시 줄어듦). DataType은 값의 의미 분류
+ * (RobotMode, Alarm 등)일 뿐 값의 바이너리 레이아웃을 정하지 않으므로
+ * 타입별 인코딩은 하지 않습니다.
+ *
+ * 포맷은 BagFooter::version으로 구분됩니다 (Jsonl: 1, Binary: 2).
+ */
+enum class BagFormat {
+    Jsonl,   ///< JSONL 텍스트 (footer version 1)
+    Binary   ///< 청크 기반 바이너리 (footer version 2)
+};
+
+/// @brief BagFooter::version 값 (JSONL 포맷)
+constexpr uint32_t kBagVersionJsonl = 1;
+
+/// @brief BagFooter::version 값 (바이너리 청크 포맷)
+constexpr uint32_t kBagVersionBinary = 2;
+
+/// @brief 청크 헤더 매직 넘버 ("MXCK", little-endian)
+constexpr uint32_t kChunkMagic = 0x4B43584D;
+
+/// @brief ChunkHeader::flags - checksum 필드가 유효함 (헤더 + payload CRC32)
+constexpr uint16_t kChunkFlagChecksum = 0x0001;
+
+/**
+ * @brief 청크 압축 방식 (ChunkHeader::compression)
+ *
+ * 청크 단위로 독립 압축되므로 탐색 시 필요한 청크만 해제합니다.
+ */
+enum class ChunkCompression : uint16_t {
+    None = 0,   ///< 압축 없음
+    Lz4 = 1,    ///< LZ4 (빠른 압축/해제)
+    Zstd = 2    ///< Zstandard (높은 압축률)
+};
+
+/**
+ * @brief 바이너리 레코드 종류
+ */
+enum class RecordKind : uint8_t {
+    Message = 0,     ///< BagMessage (payload = serialized_value, JSON 텍스트)
+    TopicDef = 1     ///< topic ID 정의 (payload = topic 이름)
+};
+
+/**
+ * @brief 바이너리 청크 헤더
+ *
+ * 각 청크는 자신이 사용하는 topic의 TopicDef 레코드를 포함하므로
+ * 다른 청크 없이 단독으로 해석할 수 있습니다.
+ * 청크마다 자신의 CRC32(헤더 + 기록된 payload)를 가지므로 파일 전체를
+ * 읽지 않고 청크를 읽을 때 해당 청크만 검증합니다.
+ *
+ * **메모리 레이아웃**: 48 bytes (packed)
+ * - magic: 4 bytes ("MXCK")
+ * - compression: 2 bytes (ChunkCompression)
+ * - flags: 2 bytes (kChunkFlagChecksum)
+ * - message_count: 4 bytes (TopicDef 제외)
+ * - checksum: 4 bytes (헤더 + 기록된 payload의 CRC32, Indexer::chunkChecksum)
+ * - raw_size: 8 bytes (압축 전 레코드 영역 크기)
+ * - stored_size: 8 bytes (파일에 기록된 payload 크기, 압축 시 압축 후 크기)
+ * - start_timestamp_ns / end_timestamp_ns: 8 + 8 bytes
+ *
+ * **청크 구조**:
+ * ```
+ * [ChunkHeader (48 bytes)] [RecordHeader + payload]...
+ * ```
+ */
+struct ChunkHeader {
+    uint32_t magic;                 ///< kChunkMagic
+    uint16_t compression;           ///< 압축 방식 (ChunkCompression)
+    uint16_t flags;                 ///< 청크 플래그 (kChunkFlag*)
+    uint32_t message_count;         ///< 메시지 레코드 개수
+    uint32_t checksum;              ///< 청크 CRC32 (kChunkFlagChecksum일 때 유효)
+    uint64_t raw_size;              ///< 레코드 영역 크기 (바이트)
+    uint64_t stored_size;           ///< 헤더 뒤에 기록된 payload 크기 (바이트)
+    uint64_t start_timestamp_ns;    ///< 청크 내 최소 타임스탬프
+    uint64_t end_timestamp_ns;      ///< 청크 내 최대 타임스탬프
+
+    /**
+     * @brief 매직 넘버 검증
+     *
+     * @return true if 유효한 청크 헤더
+     */
+    bool isValid() const {
+        return magic == kChunkMagic;
+    }
+
+    /**
+     * @brief payload 체크섬 보유 여부 (체크섬 도입 이전 청크는 false)
+     */
+    bool hasChecksum() const {
+        return (flags & kChunkFlagChecksum) != 0;
+    }
+} __attribute__((packed));
+
+/**
+ * @brief 바이너리 레코드 헤더
+ *
+ * **메모리 레이아웃**: 16 bytes (packed)
+ * - timestamp_ns: 8 bytes
+ * - topic_id: 2 bytes
+ * - data_type: 1 byte (DataType)
+ * - kind: 1 byte (RecordKind)
+ * - length: 4 bytes (뒤따르는 payload 크기)
+ */
+struct RecordHeader {
+    int64_t timestamp_ns;   ///< 나노초 타임스탬프 (TopicDef는 0)
+    uint16_t topic_id;      ///< 파일 내 topic ID
+    uint8_t data_type;      ///< DataType 값 (의미 분류, payload 인코딩과 무관)
+    uint8_t kind;           ///< RecordKind 값
+    uint32_t length;        ///< payload 길이 (바이트)
+} __attribute__((packed));
+
+// 컴파일 타임 크기 검증
+static_assert(sizeof(ChunkHeader) == 48,
+              "ChunkHeader must be exactly 48 bytes");
+static_assert(sizeof(RecordHeader) == 16,
+              "RecordHeader must be exactly 16 bytes");
+
+} // namespace mxrc::core::logging
+
+#endif // MXRC_CORE_LOGGING_DTO_BAGFORMAT_H
@@ -0,0 +1,118 @@
+#ifndef MXRC_CORE_LOGGING_DTO_COLUMNARFORMAT_H
+#define MXRC_CORE_LOGGING_DTO_COLUMNARFORMAT_H
+
+#include <cstdint>
+
+namespace mxrc::core::logging {
+
+/**
+ * @brief 컬럼 파일 구조
+ *
+ * Bag 데이터를 topic별 컬럼(필드당 연속 배열)으로 변환한 파일입니다.
+ * 모든 컬럼 데이터는 kColumnAlignment 경계에 정렬되어 있으므로 mmap한 주소를
+ * 그대로 타입 배열(const int64_t* 등)로 사용할 수 있습니다 (little-endian).
+ *
+ * ```
+ * [ColumnarHeader (64 bytes)]
+ * [ColumnarTopic × topic_count]
+ * [ColumnarColumn × column_count]
+ * [이름 문자열 테이블]
+ * [컬럼 데이터 블록 (64 bytes 정렬)]...
+ * ```
+ *
+ * topic마다 첫 컬럼은 타임스탬프(UInt64, 이름 "timestamp_ns")이며, 이후 컬럼은
+ * 값 JSON의 필드입니다 (중첩 객체는 "pose.x"처럼 '.'로 연결, 스칼라 값은 "value").
+ */
+
+/// @brief 컬럼 파일 매직 넘버 ("MXRCCOL\0", little-endian)
+constexpr uint64_t kColumnarMagic = 0x004C4F434352584DULL;
+
+/// @brief 컬럼 파일 버전
+constexpr uint32_t kColumnarVersion = 1;
+
+/// @brief 컬럼 데이터 블록 정렬 (캐시 라인 / SIMD 로드 정렬)
+constexpr uint64_t kColumnAlignment = 64;
+
+/// @brief topic별 타임스탬프 컬럼 이름
+constexpr const char* kTimestampColumn = "timestamp_ns";
+
+/**
+ * @brief 컬럼 값 타입
+ *
+ * - Int64/Float64/Bool/UInt64: data에 row_count개의 고정 크기 값
+ * - String: data에 바이트 연결, aux에 (row_count + 1)개의 uint64 시작 오프셋
+ *   (JSON 문자열은 따옴표 없이, 배열/혼합 타입은 JSON 텍스트로 저장)
+ */
+enum class ColumnType : uint8_t {
+    Int64 = 0,     ///< int64_t
+    Float64 = 1,   ///< double
+    Bool = 2,      ///< uint8_t (0/1)
+    String = 3,    ///< 가변 길이 바이트
+    UInt64 = 4     ///< uint64_t (타임스탬프)
+};
+
+/**
+ * @brief 컬럼 파일 헤더
+ *
+ * **메모리 레이아웃**: 64 bytes (packed)
+ */
+struct ColumnarHeader {
+    uint64_t magic;              ///< kColumnarMagic
+    uint32_t version;            ///< kColumnarVersion
+    uint32_t topic_count;        ///< ColumnarTopic 개수
+    uint64_t column_count;       ///< ColumnarColumn 개수 (전체 topic 합계)
+    uint64_t topics_offset;      ///< ColumnarTopic 배열 오프셋
+    uint64_t columns_offset;     ///< ColumnarColumn 배열 오프셋
+    uint64_t names_offset;       ///< 이름 문자열 테이블 오프셋
+    uint64_t names_size;         ///< 이름 문자열 테이블 크기
+    uint64_t file_size;          ///< 전체 파일 크기 (잘린 파일 검출용)
+
+    /**
+     * @brief 매직 넘버 및 버전 검증
+     */
+    bool isValid() const {
+        return magic == kColumnarMagic && version == kColumnarVersion;
+    }
+} __attribute__((packed));
+
+/**
+ * @brief topic 디렉토리 엔트리
+ *
+ * **메모리 레이아웃**: 32 bytes (packed)
+ */
+struct ColumnarTopic {
+    uint64_t name_offset;        ///< 이름 테이블 내 오프셋
+    uint32_t name_length;        ///< 이름 길이
+    uint32_t data_type;          ///< DataType 값 (첫 메시지 기준)
+    uint64_t row_count;          ///< 행(메시지) 수
+    uint32_t first_column;       ///< 첫 컬럼 번호 (타임스탬프 컬럼)
+    uint32_t column_count;       ///< 컬럼 수 (타임스탬프 포함)
+} __attribute__((packed));
+
+/**
+ * @brief 컬럼 디렉토리 엔트리
+ *
+ * **메모리 레이아웃**: 48 bytes (packed)
+ */
+struct ColumnarColumn {
+    uint64_t name_offset;        ///< 이름 테이블 내 오프셋
+    uint32_t name_length;        ///< 이름 길이
+    uint8_t type;                ///< ColumnType 값
+    uint8_t reserved[3];         ///< 예약 (0)
+    uint64_t data_offset;        ///< 값 배열 오프셋 (정렬됨)
+    uint64_t data_size;          ///< 값 배열 크기 (바이트)
+    uint64_t valid_offset;       ///< 행별 유효 플래그(uint8_t) 오프셋, 0이면 모두 유효
+    uint64_t aux_offset;         ///< String: 시작 오프셋 배열, 그 외 0
+} __attribute__((packed));
+
+// 컴파일 타임 크기 검증
+static_assert(sizeof(ColumnarHeader) == 64,
+              "ColumnarHeader must be exactly 64 bytes");
+static_assert(sizeof(ColumnarTopic) == 32,
+              "ColumnarTopic must be exactly 32 bytes");
+static_assert(sizeof(ColumnarColumn) == 48,
+              "ColumnarColumn must be exactly 48 bytes");
+
+} // namespace mxrc::core::logging
+
+#endif // MXRC_CORE_LOGGING_DTO_COLUMNARFORMAT_H
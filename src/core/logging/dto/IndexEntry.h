@@ -80,6 +80,18 @@ struct IndexEntry {
 static_assert(sizeof(IndexEntry) == 16,
               "IndexEntry must be exactly 16 bytes");
 
+/**
+ * @brief 바이너리 청크의 타임스탬프 범위 (메모리 표현)
+ *
+ * 여러 생산자가 기록한 bag은 청크 시작 타임스탬프가 파일 순서대로
+ * 증가하지 않을 수 있으므로, 시간 탐색은 청크별 [start, end] 범위를 사용합니다.
+ * start는 IndexEntry::timestamp_ns, end는 Chunk Range Block에서 로드합니다 (BagFooter 참고).
+ */
+struct ChunkTimeRange {
+    uint64_t start_ns = 0;   ///< 청크 내 최소 타임스탬프
+    uint64_t end_ns = 0;     ///< 청크 내 최대 타임스탬프
+};
+
 } // namespace mxrc::core::logging
 
 #endif // MXRC_CORE_LOGGING_DTO_INDEXENTRY_H
@@ -0,0 +1,46 @@
+#ifndef MXRC_CORE_LOGGING_DTO_TOPICINDEXENTRY_H
+#define MXRC_CORE_LOGGING_DTO_TOPICINDEXENTRY_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace mxrc::core::logging {
+
+/**
+ * @brief Topic 인덱스 블록의 topic별 헤더 (바이너리 포맷)
+ *
+ * Topic 인덱스 블록은 청크 인덱스 블록 뒤, Footer 앞에 위치하며
+ * topic마다 [TopicIndexHeader][topic 이름][uint32_t 청크 번호...]로 구성됩니다.
+ * 청크 번호는 청크 인덱스(IndexEntry 배열)의 위치입니다.
+ *
+ * **메모리 레이아웃**: 16 bytes (packed)
+ * - topic_id: 2 bytes (RecordHeader::topic_id와 동일)
+ * - name_length: 2 bytes
+ * - chunk_count: 4 bytes
+ * - message_count: 8 bytes
+ */
+struct TopicIndexHeader {
+    uint16_t topic_id;        ///< 파일 내 topic ID
+    uint16_t name_length;     ///< 뒤따르는 topic 이름 길이
+    uint32_t chunk_count;     ///< 이 topic을 포함하는 청크 수
+    uint64_t message_count;   ///< 이 topic의 메시지 수
+} __attribute__((packed));
+
+static_assert(sizeof(TopicIndexHeader) == 16,
+              "TopicIndexHeader must be exactly 16 bytes");
+
+/**
+ * @brief Topic별 인덱스 (메모리 표현)
+ *
+ * 특정 topic을 읽을 때 chunks에 있는 청크만 해제/스캔합니다.
+ */
+struct TopicIndex {
+    std::string name;               ///< topic 이름
+    std::vector<uint32_t> chunks;   ///< 이 topic을 포함하는 청크 번호 (오름차순)
+    uint64_t message_count = 0;     ///< 이 topic의 메시지 수
+};
+
+} // namespace mxrc::core::logging
+
+#endif // MXRC_CORE_LOGGING_DTO_TOPICINDEXENTRY_H
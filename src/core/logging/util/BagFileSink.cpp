@@ -0,0 +1,140 @@
+#include "util/BagFileSink.h"
+#include <spdlog/spdlog.h>
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace mxrc::core::logging {
+
+namespace {
+
+constexpr size_t kPageSize = 4096;
+
+}  // namespace
+
+BagFileSink::BagFileSink(size_t bufferSize)
+    : capacity_((bufferSize + kPageSize - 1) / kPageSize * kPageSize) {
+    if (capacity_ == 0) {
+        capacity_ = kPageSize;
+    }
+    void* ptr = nullptr;
+    if (::posix_memalign(&ptr, kPageSize, capacity_) != 0) {
+        throw std::bad_alloc();
+    }
+    buffer_ = static_cast<char*>(ptr);
+}
+
+BagFileSink::~BagFileSink() {
+    close();
+    std::free(buffer_);
+}
+
+bool BagFileSink::open(const std::string& filepath) {
+    close();
+
+    fd_ = ::open(filepath.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        spdlog::error("BagFileSink::open - Failed to open {}: {}", filepath, std::strerror(errno));
+        return false;
+    }
+
+    filepath_ = filepath;
+    used_ = 0;
+    appended_ = 0;
+    return true;
+}
+
+void BagFileSink::close() {
+    if (fd_ < 0) {
+        return;
+    }
+    flush();
+    ::close(fd_);
+    fd_ = -1;
+}
+
+bool BagFileSink::append(const char* data, size_t size) {
+    if (fd_ < 0) {
+        return false;
+    }
+
+    appended_ += size;
+
+    if (used_ + size <= capacity_) {
+        std::memcpy(buffer_ + used_, data, size);
+        used_ += size;
+        return true;
+    }
+
+    // 스테이징 내용 + 큰 블록을 한 번의 writev로 기록
+    bool ok = writeAll(buffer_, used_, data, size);
+    used_ = 0;
+    return ok;
+}
+
+bool BagFileSink::flush() {
+    if (fd_ < 0 || used_ == 0) {
+        return fd_ >= 0;
+    }
+
+    bool ok = writeAll(buffer_, used_, nullptr, 0);
+    used_ = 0;
+    return ok;
+}
+
+bool BagFileSink::sync() {
+    if (!flush()) {
+        return false;
+    }
+    if (::fdatasync(fd_) != 0) {
+        spdlog::error("BagFileSink::sync - fdatasync failed for {}: {}", filepath_,
+                      std::strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+bool BagFileSink::writeAll(const char* first, size_t firstSize,
+                           const char* second, size_t secondSize) {
+    iovec iov[2];
+    int count = 0;
+    if (firstSize > 0) {
+        iov[count++] = {const_cast<char*>(first), firstSize};
+    }
+    if (secondSize > 0) {
+        iov[count++] = {const_cast<char*>(second), secondSize};
+    }
+
+    iovec* current = iov;
+    while (count > 0) {
+        ssize_t written = ::writev(fd_, current, count);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            spdlog::error("BagFileSink::writeAll - writev failed for {}: {}", filepath_,
+                          std::strerror(errno));
+            return false;
+        }
+
+        // 부분 쓰기: 남은 iovec부터 재시도
+        auto remaining = static_cast<size_t>(written);
+        while (count > 0 && remaining >= current->iov_len) {
+            remaining -= current->iov_len;
+            current++;
+            count--;
+        }
+        if (count > 0) {
+            current->iov_base = static_cast<char*>(current->iov_base) + remaining;
+            current->iov_len -= remaining;
+        }
+    }
+
+    return true;
+}
+
+} // namespace mxrc::core::logging
@@ -0,0 +1,110 @@
+#ifndef MXRC_CORE_LOGGING_UTIL_BAGFILESINK_H
+#define MXRC_CORE_LOGGING_UTIL_BAGFILESINK_H
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+namespace mxrc::core::logging {
+
+/**
+ * @brief Bag 파일 출력 싱크 (POSIX fd + 정렬된 스테이징 버퍼)
+ *
+ * 작은 쓰기(JSONL 라인, 청크 헤더)는 페이지 정렬된 스테이징 버퍼에 모았다가
+ * 한 번에 기록하고, 큰 블록(청크 payload)은 스테이징 내용과 함께 writev로
+ * 복사 없이 기록합니다. ofstream 대비 메시지당 스트림 호출이 없습니다.
+ *
+ * **사용 예시**:
+ * ```cpp
+ * BagFileSink sink;
+ * sink.open("/data/recording.bag");
+ * sink.append(header, sizeof(header));   // 스테이징
+ * sink.append(payload, payloadSize);     // 크면 writev로 바로 기록
+ * sink.flush();                          // 스테이징 기록
+ * sink.sync();                           // fdatasync
+ * ```
+ *
+ * **Thread-Safety**: NOT thread-safe (AsyncWriter 쓰기 스레드 전용)
+ */
+class BagFileSink {
+public:
+    /// @brief 기본 스테이징 버퍼 크기 (1 MiB)
+    static constexpr size_t kDefaultBufferSize = 1024 * 1024;
+
+    /**
+     * @brief 생성자
+     * @param bufferSize 스테이징 버퍼 크기 (페이지 단위로 올림)
+     */
+    explicit BagFileSink(size_t bufferSize = kDefaultBufferSize);
+
+    /**
+     * @brief 소멸자 (스테이징 기록 후 닫기)
+     */
+    ~BagFileSink();
+
+    // 복사 금지
+    BagFileSink(const BagFileSink&) = delete;
+    BagFileSink& operator=(const BagFileSink&) = delete;
+
+    /**
+     * @brief 파일 열기 (append 모드, 없으면 생성)
+     * @param filepath 파일 경로
+     * @return 성공하면 true
+     */
+    bool open(const std::string& filepath);
+
+    /**
+     * @brief 스테이징 기록 후 파일 닫기
+     */
+    void close();
+
+    /**
+     * @brief 파일이 열려 있는지 확인
+     */
+    bool isOpen() const { return fd_ >= 0; }
+
+    /**
+     * @brief 데이터 추가
+     *
+     * 스테이징 버퍼에 들어가지 않으면 스테이징 내용과 data를 writev 한 번으로 기록합니다.
+     *
+     * @param data 데이터
+     * @param size 크기 (바이트)
+     * @return 성공하면 true
+     */
+    bool append(const char* data, size_t size);
+
+    /**
+     * @brief 스테이징 버퍼를 파일에 기록
+     * @return 성공하면 true
+     */
+    bool flush();
+
+    /**
+     * @brief 스테이징 기록 후 fdatasync
+     * @return 성공하면 true
+     */
+    bool sync();
+
+    /**
+     * @brief 지금까지 append된 총 바이트 수 (스테이징 포함)
+     */
+    uint64_t size() const { return appended_; }
+
+private:
+    /**
+     * @brief 두 블록을 writev로 모두 기록 (부분 쓰기/EINTR 재시도)
+     */
+    bool writeAll(const char* first, size_t firstSize, const char* second, size_t secondSize);
+
+    int fd_ = -1;                   ///< 파일 디스크립터
+    char* buffer_ = nullptr;        ///< 페이지 정렬된 스테이징 버퍼
+    size_t capacity_;               ///< 스테이징 버퍼 크기
+    size_t used_ = 0;               ///< 스테이징 사용량
+    uint64_t appended_ = 0;         ///< 총 append 바이트 수
+    std::string filepath_;          ///< 파일 경로 (로그용)
+};
+
+} // namespace mxrc::core::logging
+
+#endif // MXRC_CORE_LOGGING_UTIL_BAGFILESINK_H
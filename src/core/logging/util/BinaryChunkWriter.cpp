@@ -0,0 +1,171 @@
+#include "util/BinaryChunkWriter.h"
+#include "util/ChunkCodec.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace mxrc::core::logging {
+
+BinaryChunkWriter::BinaryChunkWriter(size_t chunkSizeBytes, ChunkCompression compression)
+    : chunkSizeBytes_(chunkSizeBytes), compression_(compression) {
+    if (!ChunkCodec::isAvailable(compression_)) {
+        spdlog::warn("BinaryChunkWriter - {} compression not available, writing uncompressed chunks",
+                     ChunkCodec::name(compression_));
+        compression_ = ChunkCompression::None;
+    }
+    chunkBuffer_.reserve(chunkSizeBytes_ + 4096);
+}
+
+bool BinaryChunkWriter::append(const BagMessage& msg, std::ostream& out) {
+    if (!encode(msg)) {
+        return false;
+    }
+    return chunkBuffer_.size() >= chunkSizeBytes_ ? flushChunk(out) : true;
+}
+
+bool BinaryChunkWriter::append(const BagMessage& msg, BagFileSink& sink) {
+    if (!encode(msg)) {
+        return false;
+    }
+    return chunkBuffer_.size() >= chunkSizeBytes_ ? flushChunk(sink) : true;
+}
+
+bool BinaryChunkWriter::flushChunk(std::ostream& out) {
+    return emitChunk([&out](const char* header, size_t headerSize,
+                            const char* payload, size_t payloadSize) {
+        out.write(header, static_cast<std::streamsize>(headerSize));
+        out.write(payload, static_cast<std::streamsize>(payloadSize));
+        return out.good();
+    });
+}
+
+bool BinaryChunkWriter::flushChunk(BagFileSink& sink) {
+    return emitChunk([&sink](const char* header, size_t headerSize,
+                             const char* payload, size_t payloadSize) {
+        return sink.append(header, headerSize) && sink.append(payload, payloadSize);
+    });
+}
+
+bool BinaryChunkWriter::encode(const BagMessage& msg) {
+    uint16_t topicId = 0;
+    if (!resolveTopic(msg.topic, topicId)) {
+        return false;
+    }
+
+    // 청크마다 사용한 topic을 선언하여 청크 단독으로 해석 가능하게 함
+    if (chunkTopicCounts_[topicId] == 0) {
+        RecordHeader def{};
+        def.topic_id = topicId;
+        def.kind = static_cast<uint8_t>(RecordKind::TopicDef);
+        def.length = static_cast<uint32_t>(msg.topic.size());
+        appendRecord(def, msg.topic.data());
+        chunkTopics_.push_back(topicId);
+    }
+    chunkTopicCounts_[topicId]++;
+
+    RecordHeader header{};
+    header.timestamp_ns = msg.timestamp_ns;
+    header.topic_id = topicId;
+    header.data_type = static_cast<uint8_t>(msg.data_type);
+    header.kind = static_cast<uint8_t>(RecordKind::Message);
+    header.length = static_cast<uint32_t>(msg.serialized_value.size());
+    appendRecord(header, msg.serialized_value.data());
+
+    uint64_t ts = static_cast<uint64_t>(msg.timestamp_ns);
+    if (chunkMessageCount_ == 0) {
+        chunkStartNs_ = ts;
+        chunkEndNs_ = ts;
+    } else {
+        chunkStartNs_ = std::min(chunkStartNs_, ts);
+        chunkEndNs_ = std::max(chunkEndNs_, ts);
+    }
+    chunkMessageCount_++;
+    return true;
+}
+
+template <typename WriteFn>
+bool BinaryChunkWriter::emitChunk(WriteFn&& write) {
+    if (chunkMessageCount_ == 0) {
+        return true;
+    }
+
+    // 압축 이득이 없으면 (작은 청크 등) 원본 그대로 기록
+    const char* stored = chunkBuffer_.data();
+    size_t storedSize = chunkBuffer_.size();
+    ChunkCompression applied = ChunkCompression::None;
+
+    if (compression_ != ChunkCompression::None &&
+        ChunkCodec::compress(compression_, chunkBuffer_.data(), chunkBuffer_.size(),
+                             compressBuffer_) &&
+        compressBuffer_.size() < chunkBuffer_.size()) {
+        stored = compressBuffer_.data();
+        storedSize = compressBuffer_.size();
+        applied = compression_;
+    }
+
+    ChunkHeader header{};
+    header.magic = kChunkMagic;
+    header.compression = static_cast<uint16_t>(applied);
+    header.message_count = chunkMessageCount_;
+    header.raw_size = chunkBuffer_.size();
+    header.stored_size = storedSize;
+    header.start_timestamp_ns = chunkStartNs_;
+    header.end_timestamp_ns = chunkEndNs_;
+    header.flags = kChunkFlagChecksum;
+    header.checksum = Indexer::chunkChecksum(header, stored);
+
+    if (!write(reinterpret_cast<const char*>(&header), sizeof(ChunkHeader), stored, storedSize)) {
+        spdlog::error("BinaryChunkWriter::flushChunk - Failed to write chunk ({} messages)",
+                      chunkMessageCount_);
+        return false;
+    }
+
+    uint32_t chunk = static_cast<uint32_t>(index_.size());
+    index_.addChunk(chunkStartNs_, chunkEndNs_, bytesWritten_);
+    for (uint16_t id : chunkTopics_) {
+        index_.addTopicChunk(id, topicNames_[id], chunk, chunkTopicCounts_[id]);
+    }
+    bytesWritten_ += sizeof(ChunkHeader) + storedSize;
+    messageCount_ += chunkMessageCount_;
+
+    // 다음 청크 준비 (버퍼 용량은 유지)
+    chunkBuffer_.clear();
+    chunkMessageCount_ = 0;
+    for (uint16_t id : chunkTopics_) {
+        chunkTopicCounts_[id] = 0;
+    }
+    chunkTopics_.clear();
+
+    return true;
+}
+
+bool BinaryChunkWriter::resolveTopic(const std::string& topic, uint16_t& topicId) {
+    auto it = topicIds_.find(topic);
+    if (it != topicIds_.end()) {
+        topicId = it->second;
+        return true;
+    }
+
+    if (topicIds_.size() >= std::numeric_limits<uint16_t>::max()) {
+        spdlog::error("BinaryChunkWriter - Topic ID space exhausted, dropping topic: {}", topic);
+        return false;
+    }
+
+    topicId = static_cast<uint16_t>(topicIds_.size());
+    topicIds_.emplace(topic, topicId);
+    topicNames_.push_back(topic);
+    chunkTopicCounts_.push_back(0);
+    return true;
+}
+
+void BinaryChunkWriter::appendRecord(const RecordHeader& header, const char* payload) {
+    size_t offset = chunkBuffer_.size();
+    chunkBuffer_.resize(offset + sizeof(RecordHeader) + header.length);
+    std::memcpy(chunkBuffer_.data() + offset, &header, sizeof(RecordHeader));
+    if (header.length > 0) {
+        std::memcpy(chunkBuffer_.data() + offset + sizeof(RecordHeader), payload, header.length);
+    }
+}
+
+} // namespace mxrc::core::logging
@@ -0,0 +1,160 @@
+#ifndef MXRC_CORE_LOGGING_UTIL_BINARYCHUNKWRITER_H
+#define MXRC_CORE_LOGGING_UTIL_BINARYCHUNKWRITER_H
+
+#include "dto/BagMessage.h"
+#include "dto/BagFormat.h"
+#include "util/Indexer.h"
+#include "util/BagFileSink.h"
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+namespace mxrc::core::logging {
+
+/**
+ * @brief 바이너리 청크 포맷 인코더
+ *
+ * BagMessage를 [RecordHeader][payload] 레코드로 변환하여 메모리 청크에 모으고,
+ * 청크가 chunkSizeBytes에 도달하면 [ChunkHeader][records]로 스트림에 기록합니다.
+ * payload는 serialized_value(JSON 텍스트)를 그대로 복사하므로 메시지당 JSON
+ * 파싱/덤프는 없지만, 값 자체는 여전히 JSON 텍스트로 저장됩니다 (BagFormat.h 참고).
+ *
+ * 기록된 청크마다 (청크 시작 타임스탬프, 청크 오프셋) 인덱스 엔트리와
+ * 청크에 포함된 topic 목록(topic 인덱스)을 추가합니다.
+ * 압축을 설정하면 청크마다 독립적으로 압축하며, 압축 후 크기가 더 크면
+ * 해당 청크는 압축 없이 기록합니다.
+ * 각 청크 헤더에는 헤더와 기록된 payload의 CRC32가 포함됩니다.
+ *
+ * **사용 예시**:
+ * ```cpp
+ * std::ofstream ofs("data.bag", std::ios::binary);
+ * BinaryChunkWriter chunkWriter;
+ * chunkWriter.append(msg, ofs);      // 청크가 가득 차면 자동 기록
+ * chunkWriter.flushChunk(ofs);       // 남은 청크 기록
+ * chunkWriter.index().writeToFile(ofs, chunkWriter.bytesWritten(),
+ *                                 kBagVersionBinary, chunkWriter.messageCount());
+ * ```
+ *
+ * **Thread-Safety**: NOT thread-safe (AsyncWriter 쓰기 스레드 전용)
+ */
+class BinaryChunkWriter {
+public:
+    /// @brief 기본 청크 크기 (1 MiB)
+    static constexpr size_t kDefaultChunkSize = 1024 * 1024;
+
+    /**
+     * @brief 생성자
+     *
+     * @param chunkSizeBytes 청크를 기록하는 레코드 영역 크기 임계값
+     * @param compression 청크 압축 방식 (빌드에서 지원하지 않으면 None으로 대체)
+     */
+    explicit BinaryChunkWriter(size_t chunkSizeBytes = kDefaultChunkSize,
+                               ChunkCompression compression = ChunkCompression::None);
+
+    /**
+     * @brief 메시지를 현재 청크에 추가
+     *
+     * 청크가 임계값에 도달하면 out에 기록합니다.
+     *
+     * @param msg 기록할 메시지
+     * @param out 출력 스트림 (binary 모드)
+     * @return 성공 여부 (topic ID 고갈 또는 쓰기 실패 시 false)
+     */
+    bool append(const BagMessage& msg, std::ostream& out);
+
+    /**
+     * @brief 메시지를 현재 청크에 추가 (BagFileSink 출력)
+     *
+     * 청크가 가득 차면 청크 헤더와 payload를 sink에 기록합니다 (payload는 writev).
+     */
+    bool append(const BagMessage& msg, BagFileSink& sink);
+
+    /**
+     * @brief 현재 청크를 out에 기록
+     *
+     * @param out 출력 스트림
+     * @return 쓰기 성공 여부 (빈 청크면 true)
+     */
+    bool flushChunk(std::ostream& out);
+
+    /**
+     * @brief 현재 청크를 sink에 기록
+     */
+    bool flushChunk(BagFileSink& sink);
+
+    /**
+     * @brief 아직 기록되지 않은 메시지가 있는지 확인
+     */
+    bool hasPendingChunk() const { return chunkMessageCount_ > 0; }
+
+    /**
+     * @brief 스트림에 기록된 총 바이트 수 (청크 헤더 포함)
+     */
+    uint64_t bytesWritten() const { return bytesWritten_; }
+
+    /**
+     * @brief 스트림에 기록된 메시지 수
+     */
+    uint64_t messageCount() const { return messageCount_; }
+
+    /**
+     * @brief 청크 인덱스 (청크 시작 타임스탬프, 청크 오프셋) 및 topic 인덱스
+     */
+    const Indexer& index() const { return index_; }
+
+    /**
+     * @brief 적용 중인 압축 방식
+     */
+    ChunkCompression compression() const { return compression_; }
+
+private:
+    /**
+     * @brief topic 이름에 대한 파일 내 ID 조회/할당
+     *
+     * @return 성공 여부 (ID 공간 고갈 시 false)
+     */
+    bool resolveTopic(const std::string& topic, uint16_t& topicId);
+
+    /**
+     * @brief 레코드를 청크 버퍼에 추가
+     */
+    void appendRecord(const RecordHeader& header, const char* payload);
+
+    /**
+     * @brief 메시지를 청크 버퍼에 인코딩
+     *
+     * @return 성공 여부 (topic ID 고갈 시 false)
+     */
+    bool encode(const BagMessage& msg);
+
+    /**
+     * @brief 현재 청크를 압축/봉인하여 write(header, headerSize, payload, payloadSize)로 출력
+     *
+     * @return 쓰기 성공 여부 (빈 청크면 true)
+     */
+    template <typename WriteFn>
+    bool emitChunk(WriteFn&& write);
+
+    size_t chunkSizeBytes_;                                ///< 청크 기록 임계값
+    ChunkCompression compression_;                         ///< 청크 압축 방식
+    std::vector<char> compressBuffer_;                     ///< 압축 결과 버퍼 (재사용)
+    std::vector<char> chunkBuffer_;                        ///< 현재 청크 레코드 영역
+    uint32_t chunkMessageCount_ = 0;                       ///< 현재 청크 메시지 수
+    uint64_t chunkStartNs_ = 0;                            ///< 현재 청크 최소 타임스탬프
+    uint64_t chunkEndNs_ = 0;                              ///< 현재 청크 최대 타임스탬프
+
+    std::unordered_map<std::string, uint16_t> topicIds_;  ///< topic → ID
+    std::vector<std::string> topicNames_;                  ///< ID → topic
+    std::vector<uint32_t> chunkTopicCounts_;               ///< ID별 현재 청크 메시지 수 (0이면 미선언)
+    std::vector<uint16_t> chunkTopics_;                    ///< 현재 청크에 선언된 topic ID
+
+    Indexer index_;                                        ///< 청크 인덱스
+    uint64_t bytesWritten_ = 0;                            ///< 기록된 바이트 수 (= 다음 청크 오프셋)
+    uint64_t messageCount_ = 0;                            ///< 기록된 메시지 수
+};
+
+} // namespace mxrc::core::logging
+
+#endif // MXRC_CORE_LOGGING_UTIL_BINARYCHUNKWRITER_H
@@ -0,0 +1,124 @@
+#include "util/ChunkCodec.h"
+#include <spdlog/spdlog.h>
+#include <limits>
+
+// Conditional codec support
+// HAVE_LZ4 / HAVE_ZSTD are defined by CMake only when the library is linked,
+// so the compile-time switch always matches the link step
+#ifndef HAVE_LZ4
+#  define HAVE_LZ4 0
+#endif
+#ifndef HAVE_ZSTD
+#  define HAVE_ZSTD 0
+#endif
+#if HAVE_LZ4
+#  include <lz4.h>
+#endif
+#if HAVE_ZSTD
+#  include <zstd.h>
+#endif
+
+namespace mxrc::core::logging {
+
+namespace {
+
+// 센서 시계열은 level 3에서도 충분히 압축되며 1 kHz 기록에 부담이 없음
+constexpr int kZstdLevel = 3;
+
+}  // namespace
+
+bool ChunkCodec::isAvailable(ChunkCompression compression) {
+    switch (compression) {
+        case ChunkCompression::None:
+            return true;
+        case ChunkCompression::Lz4:
+            return HAVE_LZ4;
+        case ChunkCompression::Zstd:
+            return HAVE_ZSTD;
+    }
+    return false;
+}
+
+const char* ChunkCodec::name(ChunkCompression compression) {
+    switch (compression) {
+        case ChunkCompression::None:
+            return "none";
+        case ChunkCompression::Lz4:
+            return "lz4";
+        case ChunkCompression::Zstd:
+            return "zstd";
+    }
+    return "unknown";
+}
+
+bool ChunkCodec::compress(ChunkCompression compression, const char* src, size_t size,
+                          std::vector<char>& out) {
+    switch (compression) {
+        case ChunkCompression::Lz4: {
+#if HAVE_LZ4
+            if (size > static_cast<size_t>(LZ4_MAX_INPUT_SIZE)) {
+                return false;
+            }
+            out.resize(static_cast<size_t>(LZ4_compressBound(static_cast<int>(size))));
+            int written = LZ4_compress_default(src, out.data(), static_cast<int>(size),
+                                               static_cast<int>(out.size()));
+            if (written <= 0) {
+                return false;
+            }
+            out.resize(static_cast<size_t>(written));
+            return true;
+#else
+            break;
+#endif
+        }
+        case ChunkCompression::Zstd: {
+#if HAVE_ZSTD
+            out.resize(ZSTD_compressBound(size));
+            size_t written = ZSTD_compress(out.data(), out.size(), src, size, kZstdLevel);
+            if (ZSTD_isError(written)) {
+                spdlog::error("ChunkCodec::compress - zstd error: {}", ZSTD_getErrorName(written));
+                return false;
+            }
+            out.resize(written);
+            return true;
+#else
+            break;
+#endif
+        }
+        case ChunkCompression::None:
+            break;
+    }
+    return false;
+}
+
+bool ChunkCodec::decompress(ChunkCompression compression, const char* src, size_t storedSize,
+                            char* dst, size_t rawSize) {
+    switch (compression) {
+        case ChunkCompression::Lz4: {
+#if HAVE_LZ4
+            if (storedSize > static_cast<size_t>(std::numeric_limits<int>::max()) ||
+                rawSize > static_cast<size_t>(std::numeric_limits<int>::max())) {
+                return false;
+            }
+            int read = LZ4_decompress_safe(src, dst, static_cast<int>(storedSize),
+                                           static_cast<int>(rawSize));
+            return read >= 0 && static_cast<size_t>(read) == rawSize;
+#else
+            break;
+#endif
+        }
+        case ChunkCompression::Zstd: {
+#if HAVE_ZSTD
+            size_t read = ZSTD_decompress(dst, rawSize, src, storedSize);
+            return !ZSTD_isError(read) && read == rawSize;
+#else
+            break;
+#endif
+        }
+        case ChunkCompression::None:
+            break;
+    }
+    return false;
+}
+
+} // namespace mxrc::core::logging
@@ -0,0 +1,56 @@
+#ifndef MXRC_CORE_LOGGING_UTIL_CHUNKCODEC_H
+#define MXRC_CORE_LOGGING_UTIL_CHUNKCODEC_H
+
+#include "dto/BagFormat.h"
+#include <vector>
+#include <cstddef>
+
+namespace mxrc::core::logging {
+
+/**
+ * @brief 바이너리 청크 압축/해제 유틸리티
+ *
+ * LZ4/zstd는 빌드 시 헤더가 있을 때만 활성화됩니다 (__has_include).
+ * 사용할 수 없는 방식을 요청하면 false를 반환합니다.
+ */
+class ChunkCodec {
+public:
+    /**
+     * @brief 압축 방식 사용 가능 여부
+     * @param compression 압축 방식
+     * @return 이 빌드에서 지원하면 true (None은 항상 true)
+     */
+    static bool isAvailable(ChunkCompression compression);
+
+    /**
+     * @brief 압축 방식 이름 (로그용)
+     */
+    static const char* name(ChunkCompression compression);
+
+    /**
+     * @brief 청크 압축
+     * @param compression 압축 방식 (None 제외)
+     * @param src 원본 데이터
+     * @param size 원본 크기
+     * @param out [out] 압축 결과 (크기 조정됨, 용량은 재사용)
+     * @return 성공하면 true
+     */
+    static bool compress(ChunkCompression compression, const char* src, size_t size,
+                         std::vector<char>& out);
+
+    /**
+     * @brief 청크 해제
+     * @param compression 압축 방식 (None 제외)
+     * @param src 압축 데이터
+     * @param storedSize 압축 데이터 크기
+     * @param dst 출력 버퍼 (rawSize 이상)
+     * @param rawSize 원본 크기 (ChunkHeader::raw_size)
+     * @return 정확히 rawSize 바이트로 해제되면 true
+     */
+    static bool decompress(ChunkCompression compression, const char* src, size_t storedSize,
+                           char* dst, size_t rawSize);
+};
+
+} // namespace mxrc::core::logging
+
+#endif // MXRC_CORE_LOGGING_UTIL_CHUNKCODEC_H
@@ -1,15 +1,63 @@
 #include "Indexer.h"
+#include "ChunkCodec.h"
 #include <spdlog/spdlog.h>
 #include <algorithm>
 #include <cstring>
+#include <limits>
 
 namespace mxrc::core::logging {
 
+namespace {
+
+/**
+ * @brief CRC32 slicing-by-8 테이블 (다항식 0xEDB88320, IEEE 802.3)
+ *
+ * t[0]은 바이트 단위 테이블, t[k]는 k바이트 뒤 위치의 기여분입니다.
+ */
+struct Crc32Tables {
+    uint32_t t[8][256];
+
+    Crc32Tables() {
+        constexpr uint32_t poly = 0xEDB88320;
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t crc = i;
+            for (uint32_t j = 0; j < 8; j++) {
+                crc = (crc & 1) ? (crc >> 1) ^ poly : crc >> 1;
+            }
+            t[0][i] = crc;
+        }
+        for (uint32_t i = 0; i < 256; i++) {
+            for (uint32_t k = 1; k < 8; k++) {
+                t[k][i] = (t[k - 1][i] >> 8) ^ t[0][t[k - 1][i] & 0xFF];
+            }
+        }
+    }
+};
+
+const Crc32Tables& crc32Tables() {
+    static const Crc32Tables tables;  // 최초 1회 생성 (스레드 안전)
+    return tables;
+}
+
+}  // namespace
+
 void Indexer::addEntry(uint64_t timestamp_ns, uint64_t file_offset) {
     entries_.emplace_back(timestamp_ns, file_offset);
 }
 
-bool Indexer::writeToFile(std::ofstream& ofs, uint64_t dataSize) {
+void Indexer::addChunk(uint64_t start_ns, uint64_t end_ns, uint64_t file_offset) {
+    entries_.emplace_back(start_ns, file_offset);
+
+    ChunkTimeRange range;
+    range.start_ns = start_ns;
+    range.end_ns = end_ns;
+    uint64_t prefixMax = chunkEndPrefixMax_.empty() ? 0 : chunkEndPrefixMax_.back();
+    chunkRanges_.push_back(range);
+    chunkEndPrefixMax_.push_back(std::max(prefixMax, end_ns));
+}
+
+bool Indexer::writeToFile(std::ofstream& ofs, uint64_t dataSize,
+                          uint32_t version, uint64_t messageCount) const {
     if (!ofs.is_open()) {
         spdlog::error("Indexer::writeToFile - File not open");
         return false;
@@ -30,17 +78,64 @@ bool Indexer::writeToFile(std::ofstream& ofs, uint64_t dataSize) {
 
     uint64_t indexSize = entries_.size() * sizeof(IndexEntry);
 
-    // 2. BagFooter 생성
+    // 2. Chunk Range Block 쓰기 (바이너리 포맷, 청크별 end 타임스탬프)
+    uint64_t chunkRangeOffset = 0;
+    uint64_t chunkRangeSize = 0;
+    if (!chunkRanges_.empty() && chunkRanges_.size() == entries_.size()) {
+        chunkRangeOffset = indexOffset + indexSize;
+        for (const ChunkTimeRange& range : chunkRanges_) {
+            ofs.write(reinterpret_cast<const char*>(&range.end_ns), sizeof(uint64_t));
+        }
+        chunkRangeSize = chunkRanges_.size() * sizeof(uint64_t);
+
+        if (!ofs.good()) {
+            spdlog::error("Indexer::writeToFile - Failed to write chunk range block");
+            return false;
+        }
+    }
+
+    // 3. Topic 인덱스 블록 쓰기 (바이너리 포맷)
+    uint64_t topicIndexOffset = 0;
+    if (!topics_.empty()) {
+        topicIndexOffset = indexOffset + indexSize + chunkRangeSize;
+        for (size_t id = 0; id < topics_.size(); id++) {
+            const TopicIndex& topic = topics_[id];
+            if (topic.name.empty()) {
+                continue;
+            }
+
+            TopicIndexHeader header{};
+            header.topic_id = static_cast<uint16_t>(id);
+            header.name_length = static_cast<uint16_t>(topic.name.size());
+            header.chunk_count = static_cast<uint32_t>(topic.chunks.size());
+            header.message_count = topic.message_count;
+
+            ofs.write(reinterpret_cast<const char*>(&header), sizeof(TopicIndexHeader));
+            ofs.write(topic.name.data(), static_cast<std::streamsize>(topic.name.size()));
+            ofs.write(reinterpret_cast<const char*>(topic.chunks.data()),
+                      static_cast<std::streamsize>(topic.chunks.size() * sizeof(uint32_t)));
+        }
+
+        if (!ofs.good()) {
+            spdlog::error("Indexer::writeToFile - Failed to write topic index block");
+            return false;
+        }
+    }
+
+    // 4. BagFooter 생성
     BagFooter footer;
+    footer.version = version;
+    footer.message_count = (messageCount > 0) ? messageCount : entries_.size();
     footer.setDataSize(dataSize);
     footer.setIndexInfo(indexOffset, entries_.size());
+    footer.topic_index_offset = topicIndexOffset;
+    footer.chunk_range_offset = chunkRangeOffset;
 
-    // 3. 체크섬 계산 (데이터 + 인덱스 블록)
-    // NOTE: 실제 체크섬 계산은 파일 전체를 읽어야 하므로
-    //       여기서는 0으로 설정 (향후 개선 가능)
+    // 5. 파일 전체 체크섬은 계산하지 않음 (finalize 시 재읽기 방지)
+    //    바이너리 포맷은 청크마다 체크섬을 가지며 읽을 때 검증
     footer.setChecksum(0);
 
-    // 4. Footer 쓰기
+    // 6. Footer 쓰기
     ofs.write(reinterpret_cast<const char*>(&footer), sizeof(BagFooter));
 
     if (!ofs.good()) {
@@ -48,8 +143,8 @@ bool Indexer::writeToFile(std::ofstream& ofs, uint64_t dataSize) {
         return false;
     }
 
-    spdlog::debug("Indexer::writeToFile - Wrote {} index entries, footer at offset {}",
-                  entries_.size(), indexOffset + indexSize);
+    spdlog::debug("Indexer::writeToFile - Wrote {} index entries, {} topics",
+                  entries_.size(), topics_.size());
 
     return true;
 }
@@ -94,6 +189,11 @@ BagFooter Indexer::readFromFile(const std::string& filepath) {
         return BagFooter::createInvalid();
     }
 
+    entries_.clear();
+    topics_.clear();
+    chunkRanges_.clear();
+    chunkEndPrefixMax_.clear();
+
     // 4. 인덱스 블록 읽기
     if (footer.index_count == 0) {
         spdlog::warn("Indexer::readFromFile - No index entries");
@@ -102,7 +202,6 @@ BagFooter Indexer::readFromFile(const std::string& filepath) {
 
     ifs.seekg(static_cast<std::streamoff>(footer.index_offset), std::ios::beg);
 
-    entries_.clear();
     entries_.reserve(static_cast<size_t>(footer.index_count));
 
     for (uint64_t i = 0; i < static_cast<uint64_t>(footer.index_count); i++) {
@@ -118,6 +217,24 @@ BagFooter Indexer::readFromFile(const std::string& filepath) {
         entries_.push_back(entry);
     }
 
+    // 5. Chunk Range Block 읽기 (없거나 손상되면 호출자가 청크 헤더에서 로드)
+    if (footer.format() == BagFormat::Binary && footer.chunk_range_offset != 0 &&
+        !readChunkRanges(ifs, footer.chunk_range_offset)) {
+        spdlog::warn("Indexer::readFromFile - Ignoring corrupted chunk range block in {}", filepath);
+        chunkRanges_.clear();
+        chunkEndPrefixMax_.clear();
+    }
+
+    // 6. Topic 인덱스 블록 읽기 (없거나 손상되면 topic 인덱스 없이 동작)
+    uint64_t topicIndexOffset = footer.topic_index_offset;
+    if (footer.format() == BagFormat::Binary && topicIndexOffset != 0) {
+        uint64_t footerOffset = static_cast<uint64_t>(fileSize) - sizeof(BagFooter);
+        if (!readTopicIndex(ifs, topicIndexOffset, footerOffset)) {
+            spdlog::warn("Indexer::readFromFile - Ignoring corrupted topic index in {}", filepath);
+            topics_.clear();
+        }
+    }
+
     spdlog::debug("Indexer::readFromFile - Loaded {} index entries from {}",
                   entries_.size(), filepath);
 
@@ -152,6 +269,176 @@ IndexEntry Indexer::findByTimestamp(uint64_t timestamp_ns, bool& found) const {
     return *it;
 }
 
+bool Indexer::loadChunkRanges(const char* data, uint64_t dataEnd) {
+    chunkRanges_.clear();
+    chunkEndPrefixMax_.clear();
+    chunkRanges_.reserve(entries_.size());
+    chunkEndPrefixMax_.reserve(entries_.size());
+
+    bool allValid = true;
+    uint64_t prefixMax = 0;
+    for (const IndexEntry& entry : entries_) {
+        ChunkTimeRange range;
+        range.start_ns = entry.timestamp_ns;
+        range.end_ns = std::numeric_limits<uint64_t>::max();
+
+        uint64_t offset = entry.file_offset;
+        if (offset <= dataEnd && dataEnd - offset >= sizeof(ChunkHeader)) {
+            ChunkHeader header;
+            std::memcpy(&header, data + offset, sizeof(ChunkHeader));
+            if (header.isValid()) {
+                range.start_ns = header.start_timestamp_ns;
+                range.end_ns = header.end_timestamp_ns;
+            } else {
+                allValid = false;
+            }
+        } else {
+            allValid = false;
+        }
+
+        prefixMax = std::max(prefixMax, range.end_ns);
+        chunkRanges_.push_back(range);
+        chunkEndPrefixMax_.push_back(prefixMax);
+    }
+
+    if (!allValid) {
+        spdlog::warn("Indexer::loadChunkRanges - Some chunk headers are invalid");
+    }
+    return allValid;
+}
+
+bool Indexer::findChunkByTimestamp(uint64_t timestamp_ns, uint32_t& chunk) const {
+    if (chunkEndPrefixMax_.empty()) {
+        return false;
+    }
+
+    // 누적 최댓값은 비감소이므로 end >= timestamp_ns인 첫 청크를 이진 탐색
+    auto it = std::lower_bound(chunkEndPrefixMax_.begin(), chunkEndPrefixMax_.end(),
+                               timestamp_ns);
+    if (it == chunkEndPrefixMax_.end()) {
+        --it;
+    }
+
+    chunk = static_cast<uint32_t>(it - chunkEndPrefixMax_.begin());
+    return true;
+}
+
+ChunkTimeRange Indexer::getTimeRange() const {
+    ChunkTimeRange total;
+    if (chunkRanges_.empty()) {
+        return total;
+    }
+
+    total.start_ns = std::numeric_limits<uint64_t>::max();
+    for (const ChunkTimeRange& range : chunkRanges_) {
+        total.start_ns = std::min(total.start_ns, range.start_ns);
+    }
+    total.end_ns = chunkEndPrefixMax_.back();
+    return total;
+}
+
+void Indexer::addTopicChunk(uint16_t topicId, const std::string& name, uint32_t chunk,
+                            uint32_t messageCount) {
+    if (topicId >= topics_.size()) {
+        topics_.resize(static_cast<size_t>(topicId) + 1);
+    }
+
+    TopicIndex& topic = topics_[topicId];
+    if (topic.name.empty()) {
+        topic.name = name;
+    }
+    if (topic.chunks.empty() || topic.chunks.back() != chunk) {
+        topic.chunks.push_back(chunk);
+    }
+    topic.message_count += messageCount;
+}
+
+const TopicIndex* Indexer::findTopic(const std::string& name, uint16_t& topicId) const {
+    for (size_t id = 0; id < topics_.size(); id++) {
+        if (topics_[id].name == name) {
+            topicId = static_cast<uint16_t>(id);
+            return &topics_[id];
+        }
+    }
+    return nullptr;
+}
+
+std::vector<uint16_t> Indexer::getChunkTopics(uint32_t chunk) const {
+    std::vector<uint16_t> result;
+    for (size_t id = 0; id < topics_.size(); id++) {
+        const auto& chunks = topics_[id].chunks;
+        if (std::binary_search(chunks.begin(), chunks.end(), chunk)) {
+            result.push_back(static_cast<uint16_t>(id));
+        }
+    }
+    return result;
+}
+
+bool Indexer::readChunkRanges(std::ifstream& ifs, uint64_t offset) {
+    std::vector<uint64_t> ends(entries_.size());
+    ifs.clear();
+    ifs.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+    ifs.read(reinterpret_cast<char*>(ends.data()),
+             static_cast<std::streamsize>(ends.size() * sizeof(uint64_t)));
+    if (!ifs.good()) {
+        return false;
+    }
+
+    chunkRanges_.reserve(entries_.size());
+    chunkEndPrefixMax_.reserve(entries_.size());
+    uint64_t prefixMax = 0;
+    for (size_t i = 0; i < entries_.size(); i++) {
+        ChunkTimeRange range;
+        range.start_ns = entries_[i].timestamp_ns;
+        range.end_ns = ends[i];
+        prefixMax = std::max(prefixMax, range.end_ns);
+        chunkRanges_.push_back(range);
+        chunkEndPrefixMax_.push_back(prefixMax);
+    }
+    return true;
+}
+
+bool Indexer::readTopicIndex(std::ifstream& ifs, uint64_t offset, uint64_t end) {
+    ifs.clear();
+    ifs.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+
+    uint64_t position = offset;
+    while (position < end) {
+        TopicIndexHeader header;
+        if (end - position < sizeof(TopicIndexHeader)) {
+            return false;
+        }
+        ifs.read(reinterpret_cast<char*>(&header), sizeof(TopicIndexHeader));
+
+        uint64_t bodySize = header.name_length +
+                            static_cast<uint64_t>(header.chunk_count) * sizeof(uint32_t);
+        position += sizeof(TopicIndexHeader);
+        if (!ifs.good() || bodySize > end - position || header.name_length == 0) {
+            return false;
+        }
+
+        uint16_t topicId = header.topic_id;
+        if (topicId >= topics_.size()) {
+            topics_.resize(static_cast<size_t>(topicId) + 1);
+        }
+
+        TopicIndex& topic = topics_[topicId];
+        topic.name.resize(header.name_length);
+        topic.chunks.resize(header.chunk_count);
+        topic.message_count = header.message_count;
+        ifs.read(topic.name.data(), header.name_length);
+        ifs.read(reinterpret_cast<char*>(topic.chunks.data()),
+                 static_cast<std::streamsize>(header.chunk_count * sizeof(uint32_t)));
+
+        if (!ifs.good()) {
+            return false;
+        }
+        position += bodySize;
+    }
+
+    return true;
+}
+
 uint32_t Indexer::calculateChecksum(const std::string& filepath,
                                      uint64_t dataSize,
                                      uint64_t indexSize) {
@@ -176,38 +463,151 @@ uint32_t Indexer::calculateChecksum(const std::string& filepath,
     return crc32(buffer.data(), totalSize);
 }
 
-uint32_t Indexer::crc32(const char* data, size_t length) {
-    // CRC32 다항식: 0xEDB88320 (IEEE 802.3)
-    static const uint32_t poly = 0xEDB88320;
+uint32_t Indexer::crc32(const char* data, size_t length, uint32_t crc) {
+    const auto& t = crc32Tables().t;
+    const auto* p = reinterpret_cast<const uint8_t*>(data);
+    crc = ~crc;
+
+    // 8바이트 단위 (slicing-by-8, little-endian)
+    while (length >= 8) {
+        uint32_t lo;
+        uint32_t hi;
+        std::memcpy(&lo, p, 4);
+        std::memcpy(&hi, p + 4, 4);
+        lo ^= crc;
+        crc = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^ t[5][(lo >> 16) & 0xFF] ^ t[4][lo >> 24] ^
+              t[3][hi & 0xFF] ^ t[2][(hi >> 8) & 0xFF] ^ t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24];
+        p += 8;
+        length -= 8;
+    }
 
-    // CRC32 테이블 생성 (최초 1회)
-    static uint32_t table[256];
-    static bool tableInitialized = false;
+    while (length-- > 0) {
+        crc = (crc >> 8) ^ t[0][(crc ^ *p++) & 0xFF];
+    }
 
-    if (!tableInitialized) {
-        for (uint32_t i = 0; i < 256; i++) {
-            uint32_t crc = i;
-            for (uint32_t j = 0; j < 8; j++) {
-                if (crc & 1) {
-                    crc = (crc >> 1) ^ poly;
-                } else {
-                    crc >>= 1;
-                }
+    return ~crc;
+}
+
+uint32_t Indexer::chunkChecksum(const ChunkHeader& header, const char* payload) {
+    ChunkHeader copy = header;
+    copy.checksum = 0;
+    uint32_t crc = crc32(payload, static_cast<size_t>(header.stored_size));
+    return crc32(reinterpret_cast<const char*>(&copy), sizeof(ChunkHeader), crc);
+}
+
+bool Indexer::verifyChunk(const ChunkHeader& header, const char* payload) {
+    return !header.hasChecksum() || chunkChecksum(header, payload) == header.checksum;
+}
+
+BagFooter Indexer::recoverFromChunks(const char* data, uint64_t size) {
+    entries_.clear();
+    topics_.clear();
+    chunkRanges_.clear();
+    chunkEndPrefixMax_.clear();
+
+    uint64_t offset = 0;
+    uint64_t dataEnd = 0;
+    uint64_t messageCount = 0;
+    std::vector<char> records;
+
+    while (size - offset >= sizeof(ChunkHeader)) {
+        ChunkHeader header;
+        std::memcpy(&header, data + offset, sizeof(ChunkHeader));
+
+        // 헤더가 깨졌거나 잘린 청크 = 기록이 중단된 지점
+        uint64_t payloadOffset = offset + sizeof(ChunkHeader);
+        if (!header.isValid() || header.stored_size > size - payloadOffset) {
+            break;
+        }
+
+        const char* stored = data + payloadOffset;
+        uint64_t nextOffset = payloadOffset + header.stored_size;
+
+        if (!verifyChunk(header, stored)) {
+            spdlog::warn("Indexer::recoverFromChunks - Checksum mismatch, skipping chunk at offset {}",
+                         offset);
+            offset = nextOffset;
+            continue;
+        }
+
+        auto compression = static_cast<ChunkCompression>(static_cast<uint16_t>(header.compression));
+        const char* raw = stored;
+        if (compression != ChunkCompression::None) {
+            records.resize(header.raw_size);
+            if (!ChunkCodec::decompress(compression, stored, header.stored_size,
+                                        records.data(), records.size())) {
+                spdlog::warn("Indexer::recoverFromChunks - Failed to decompress chunk at offset {}",
+                             offset);
+                offset = nextOffset;
+                continue;
             }
-            table[i] = crc;
+            raw = records.data();
+        } else if (header.stored_size != header.raw_size) {
+            break;
         }
-        tableInitialized = true;
+
+        uint32_t chunk = static_cast<uint32_t>(entries_.size());
+        addChunk(header.start_timestamp_ns, header.end_timestamp_ns, offset);
+        indexChunkTopics(raw, header.raw_size, chunk);
+        messageCount += header.message_count;
+
+        offset = nextOffset;
+        dataEnd = nextOffset;
     }
 
-    // CRC32 계산
-    uint32_t crc = 0xFFFFFFFF;
+    if (entries_.empty()) {
+        spdlog::error("Indexer::recoverFromChunks - No intact chunks found");
+        return BagFooter::createInvalid();
+    }
+
+    BagFooter footer;
+    footer.version = kBagVersionBinary;
+    footer.message_count = messageCount;
+    footer.setDataSize(dataEnd);
+    footer.setIndexInfo(dataEnd, entries_.size());
+
+    spdlog::info("Indexer::recoverFromChunks - Recovered {} chunks, {} messages ({} of {} bytes)",
+                 entries_.size(), messageCount, dataEnd, size);
+
+    return footer;
+}
 
-    for (size_t i = 0; i < length; i++) {
-        uint8_t byte = static_cast<uint8_t>(data[i]);
-        crc = (crc >> 8) ^ table[(crc ^ byte) & 0xFF];
+void Indexer::indexChunkTopics(const char* records, uint64_t size, uint32_t chunk) {
+    std::vector<std::pair<uint16_t, uint32_t>> counts;  // 청크 내 topic ID별 메시지 수
+    std::vector<std::string> names;
+
+    uint64_t position = 0;
+    while (size - position >= sizeof(RecordHeader)) {
+        RecordHeader header;
+        std::memcpy(&header, records + position, sizeof(RecordHeader));
+        position += sizeof(RecordHeader);
+        if (header.length > size - position) {
+            break;
+        }
+
+        uint16_t topicId = header.topic_id;
+        if (header.kind == static_cast<uint8_t>(RecordKind::TopicDef)) {
+            if (topicId >= names.size()) {
+                names.resize(static_cast<size_t>(topicId) + 1);
+            }
+            names[topicId].assign(records + position, header.length);
+        } else {
+            auto it = std::find_if(counts.begin(), counts.end(),
+                                   [topicId](const auto& c) { return c.first == topicId; });
+            if (it == counts.end()) {
+                counts.emplace_back(topicId, 1);
+            } else {
+                it->second++;
+            }
+        }
+        position += header.length;
     }
 
-    return ~crc;
+    for (const auto& [topicId, count] : counts) {
+        if (topicId < names.size() && !names[topicId].empty()) {
+            addTopicChunk(topicId, names[topicId], chunk, count);
+        }
+    }
 }
 
 } // namespace mxrc::core::logging
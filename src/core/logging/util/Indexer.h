@@ -3,6 +3,7 @@
 
 #include "dto/IndexEntry.h"
 #include "dto/BagFooter.h"
+#include "dto/TopicIndexEntry.h"
 #include <vector>
 #include <string>
 #include <fstream>
@@ -55,24 +56,42 @@ public:
      */
     void addEntry(uint64_t timestamp_ns, uint64_t file_offset);
 
+    /**
+     * @brief 청크 인덱스 엔트리와 타임스탬프 범위 추가 (바이너리 포맷)
+     *
+     * 범위는 writeToFile()에서 Chunk Range Block으로 기록됩니다.
+     *
+     * @param start_ns 청크 내 최소 타임스탬프
+     * @param end_ns 청크 내 최대 타임스탬프
+     * @param file_offset 청크 헤더 오프셋 (바이트)
+     */
+    void addChunk(uint64_t start_ns, uint64_t end_ns, uint64_t file_offset);
+
     /**
      * @brief 인덱스 블록을 파일에 쓰기
      *
      * 파일 포맷:
      * - Index Block: [IndexEntry...] (entries_.size() * 16 bytes)
+     * - Chunk Range Block: addChunk()로 모든 엔트리의 범위가 있을 때만 (엔트리당 8 bytes)
+     * - Topic Index Block: topic 인덱스가 있을 때만 (TopicIndexHeader 참고)
      * - Footer: BagFooter (64 bytes)
      *
      * @param ofs 출력 파일 스트림 (append 모드)
      * @param dataSize 메시지 데이터 영역 크기 (바이트)
+     * @param version Footer 버전 (kBagVersionJsonl 또는 kBagVersionBinary)
+     * @param messageCount 메시지 개수 (0이면 엔트리 개수 사용)
      * @return 쓰기 성공 여부
      */
-    bool writeToFile(std::ofstream& ofs, uint64_t dataSize);
+    bool writeToFile(std::ofstream& ofs, uint64_t dataSize,
+                     uint32_t version = kBagVersionJsonl,
+                     uint64_t messageCount = 0) const;
 
     /**
      * @brief 파일에서 인덱스 블록 및 푸터 읽기
      *
      * 파일 끝에서 64바이트를 읽어 Footer를 파싱하고,
      * Footer의 index_offset을 사용하여 인덱스 블록을 로드합니다.
+     * 바이너리 포맷은 Chunk Range Block과 Topic 인덱스 블록도 함께 로드합니다.
      *
      * @param filepath Bag 파일 경로
      * @return BagFooter (isValid() == false면 실패)
@@ -85,6 +104,9 @@ public:
      * 주어진 타임스탬프보다 작거나 같은 가장 최근 엔트리를 반환합니다.
      * (lower_bound 방식)
      *
+     * 엔트리가 타임스탬프 순이라고 가정합니다 (JSONL 메시지 인덱스).
+     * 바이너리 청크 인덱스는 findChunkByTimestamp()를 사용합니다.
+     *
      * @param timestamp_ns 찾을 타임스탬프 (나노초)
      * @param found 찾았는지 여부 (출력 파라미터)
      * @return 찾은 IndexEntry (found == false면 유효하지 않음)
@@ -108,7 +130,97 @@ public:
     /**
      * @brief 인덱스 초기화
      */
-    void clear() { entries_.clear(); }
+    void clear() {
+        entries_.clear();
+        topics_.clear();
+        chunkRanges_.clear();
+        chunkEndPrefixMax_.clear();
+    }
+
+    /**
+     * @brief 청크 헤더에서 청크별 타임스탬프 범위 로드 (Chunk Range Block 없는 이전 파일)
+     *
+     * 엔트리의 file_offset 위치에 있는 ChunkHeader의 start/end 타임스탬프를 읽습니다.
+     * 청크마다 헤더 페이지를 건드리므로 O(청크 수)이며, Chunk Range Block이 있는
+     * 파일은 readFromFile()이 인덱스만으로 범위를 로드하므로 호출할 필요가 없습니다.
+     * 헤더가 데이터 영역 밖이거나 손상된 청크는 탐색에서 제외되지 않도록
+     * [entry.timestamp_ns, UINT64_MAX]로 간주합니다.
+     *
+     * @param data 파일 매핑 시작 주소
+     * @param dataEnd 청크 영역 끝 (index_offset)
+     * @return true if 모든 청크 헤더가 유효함
+     */
+    bool loadChunkRanges(const char* data, uint64_t dataEnd);
+
+    /**
+     * @brief 청크 범위 로드 여부
+     */
+    bool hasChunkRanges() const { return !chunkRanges_.empty(); }
+
+    /**
+     * @brief 청크별 타임스탬프 범위 (청크 번호 순, 읽기 전용)
+     */
+    const std::vector<ChunkTimeRange>& getChunkRanges() const { return chunkRanges_; }
+
+    /**
+     * @brief 타임스탬프 이상인 메시지를 가진 첫 청크 찾기 (바이너리 포맷)
+     *
+     * 청크 시작 타임스탬프는 파일 순서대로 증가한다는 보장이 없으므로
+     * (여러 생산자), 청크 끝 타임스탬프의 누적 최댓값을 이진 탐색합니다.
+     * 반환된 청크부터 순서대로 읽으면 timestamp_ns 이상인 메시지를 놓치지 않습니다.
+     *
+     * @param timestamp_ns 찾을 타임스탬프 (나노초)
+     * @param chunk [out] 청크 번호 (모든 청크가 timestamp_ns 이전이면 마지막 청크)
+     * @return false if 청크 범위가 로드되지 않음
+     */
+    bool findChunkByTimestamp(uint64_t timestamp_ns, uint32_t& chunk) const;
+
+    /**
+     * @brief 전체 청크의 타임스탬프 범위 (최소 start, 최대 end)
+     *
+     * @return 청크 범위가 없으면 {0, 0}
+     */
+    ChunkTimeRange getTimeRange() const;
+
+    /**
+     * @brief 청크에 포함된 topic 기록 (바이너리 포맷)
+     *
+     * 같은 청크 번호로 여러 번 호출하면 메시지 수만 누적됩니다.
+     *
+     * @param topicId 파일 내 topic ID
+     * @param name topic 이름
+     * @param chunk 청크 번호 (엔트리 위치, 오름차순으로 호출)
+     * @param messageCount 청크 내 해당 topic 메시지 수
+     */
+    void addTopicChunk(uint16_t topicId, const std::string& name, uint32_t chunk,
+                       uint32_t messageCount);
+
+    /**
+     * @brief topic 이름으로 topic 인덱스 찾기
+     *
+     * @param name topic 이름
+     * @param topicId [out] 파일 내 topic ID
+     * @return TopicIndex (없으면 nullptr)
+     */
+    const TopicIndex* findTopic(const std::string& name, uint16_t& topicId) const;
+
+    /**
+     * @brief topic 인덱스 보유 여부 (version 2 + topic 인덱스 블록)
+     */
+    bool hasTopicIndex() const { return !topics_.empty(); }
+
+    /**
+     * @brief topic ID별 인덱스 반환 (읽기 전용, 이름이 빈 항목은 미사용 ID)
+     */
+    const std::vector<TopicIndex>& getTopics() const { return topics_; }
+
+    /**
+     * @brief 청크에 포함된 topic ID 집합 (topic별 청크 목록의 역방향 조회)
+     *
+     * @param chunk 청크 번호
+     * @return topic ID 목록 (오름차순)
+     */
+    std::vector<uint16_t> getChunkTopics(uint32_t chunk) const;
 
     /**
      * @brief 모든 엔트리 반환 (읽기 전용)
@@ -117,10 +229,59 @@ public:
      */
     const std::vector<IndexEntry>& getEntries() const { return entries_; }
 
+    /**
+     * @brief 매핑된 청크 영역을 스캔하여 인덱스 재구성 (Footer 없는 바이너리 파일 복구)
+     *
+     * 크래시로 Footer/인덱스가 기록되지 않았거나 파일이 청크 중간에서 잘린 경우,
+     * 파일 시작부터 청크 헤더를 따라가며 체크섬이 맞는 청크로 청크 인덱스와
+     * topic 인덱스를 다시 만듭니다. 헤더가 손상되었거나 파일 범위를 벗어나는
+     * 청크에서 스캔을 멈추며, 체크섬만 틀린 청크는 인덱스에서 제외하고 계속합니다.
+     *
+     * @param data 파일 매핑 시작 주소
+     * @param size 파일 크기 (바이트)
+     * @return 재구성된 Footer (index_offset = 마지막 정상 청크의 끝,
+     *         정상 청크가 없으면 isValid() == false)
+     */
+    BagFooter recoverFromChunks(const char* data, uint64_t size);
+
+    /**
+     * @brief 청크 체크섬 계산
+     *
+     * payload와 헤더(checksum 필드는 0으로 간주)를 함께 계산하므로
+     * 크기/타임스탬프 등 헤더 필드 손상도 검출합니다.
+     *
+     * @param header 청크 헤더
+     * @param payload 헤더 뒤에 기록된 payload (stored_size 바이트)
+     * @return CRC32 값
+     */
+    static uint32_t chunkChecksum(const ChunkHeader& header, const char* payload);
+
+    /**
+     * @brief 청크 체크섬 검증
+     *
+     * @param header 청크 헤더
+     * @param payload 헤더 뒤에 기록된 payload (stored_size 바이트)
+     * @return true if 체크섬 일치 또는 체크섬 없는 청크
+     */
+    static bool verifyChunk(const ChunkHeader& header, const char* payload);
+
+    /**
+     * @brief 데이터의 CRC32 계산 (IEEE 802.3)
+     *
+     * 이전 결과를 crc로 넘기면 여러 구간을 이어서 계산합니다.
+     *
+     * @param data 데이터 포인터
+     * @param length 데이터 길이
+     * @param crc 이전 구간의 CRC32 (처음이면 0)
+     * @return CRC32 값
+     */
+    static uint32_t crc32(const char* data, size_t length, uint32_t crc = 0);
+
     /**
      * @brief CRC32 체크섬 계산
      *
      * 데이터 + 인덱스 블록의 체크섬을 계산합니다.
+     * 파일 전체를 읽으므로 바이너리 포맷은 청크별 체크섬(verifyChunk)을 사용합니다.
      *
      * @param filepath Bag 파일 경로
      * @param dataSize 메시지 데이터 크기
@@ -133,15 +294,32 @@ public:
 
 private:
     std::vector<IndexEntry> entries_;  ///< 인덱스 엔트리 목록
+    std::vector<TopicIndex> topics_;   ///< topic ID별 청크 목록 (바이너리 포맷)
+    std::vector<ChunkTimeRange> chunkRanges_;   ///< 청크별 타임스탬프 범위 (바이너리 포맷)
+    std::vector<uint64_t> chunkEndPrefixMax_;   ///< chunkRanges_[0..i].end_ns의 최댓값
 
     /**
-     * @brief 데이터의 CRC32 계산 (내부 헬퍼)
+     * @brief Chunk Range Block 읽기 (readFromFile 내부 헬퍼)
      *
-     * @param data 데이터 포인터
-     * @param length 데이터 길이
-     * @return CRC32 값
+     * @return 성공 여부 (실패 시 범위 없이 동작)
+     */
+    bool readChunkRanges(std::ifstream& ifs, uint64_t offset);
+
+    /**
+     * @brief Topic 인덱스 블록 읽기 (readFromFile 내부 헬퍼)
+     *
+     * @return 성공 여부
+     */
+    bool readTopicIndex(std::ifstream& ifs, uint64_t offset, uint64_t end);
+
+    /**
+     * @brief 청크 레코드를 스캔하여 topic 인덱스에 반영 (recoverFromChunks 내부 헬퍼)
+     *
+     * @param records 압축 해제된 레코드 영역
+     * @param size 레코드 영역 크기
+     * @param chunk 청크 번호
      */
-    static uint32_t crc32(const char* data, size_t length);
+    void indexChunkTopics(const char* records, uint64_t size, uint32_t chunk);
 };
 
 } // namespace mxrc::core::logging
@@ -0,0 +1,57 @@
+#include "util/MappedFile.h"
+#include <spdlog/spdlog.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+namespace mxrc::core::logging {
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+bool MappedFile::open(const std::string& filepath) {
+    close();
+
+    int fd = ::open(filepath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        spdlog::error("MappedFile::open - Failed to open {}: {}", filepath, std::strerror(errno));
+        return false;
+    }
+
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+        spdlog::error("MappedFile::open - Empty or unreadable file: {}", filepath);
+        ::close(fd);
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(st.st_size);
+    void* addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // 매핑은 fd와 독립적으로 유지됨
+
+    if (addr == MAP_FAILED) {
+        spdlog::error("MappedFile::open - mmap failed for {}: {}", filepath, std::strerror(errno));
+        return false;
+    }
+
+    // 재생/스캔은 앞에서부터 순차 접근
+    ::madvise(addr, size, MADV_SEQUENTIAL);
+
+    data_ = static_cast<const char*>(addr);
+    size_ = size;
+    return true;
+}
+
+void MappedFile::close() {
+    if (data_ != nullptr) {
+        ::munmap(const_cast<char*>(data_), size_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+}
+
+} // namespace mxrc::core::logging
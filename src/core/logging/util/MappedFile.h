@@ -0,0 +1,74 @@
+#ifndef MXRC_CORE_LOGGING_UTIL_MAPPEDFILE_H
+#define MXRC_CORE_LOGGING_UTIL_MAPPEDFILE_H
+
+#include <string>
+#include <cstddef>
+
+namespace mxrc::core::logging {
+
+/**
+ * @brief 읽기 전용 메모리 매핑 파일 (RAII)
+ *
+ * 파일 전체를 mmap(PROT_READ, MAP_PRIVATE)으로 매핑합니다.
+ * 바이너리 Bag 파일을 복사 없이 순차/임의 접근하는 데 사용합니다.
+ *
+ * **사용 예시**:
+ * ```cpp
+ * MappedFile file;
+ * if (file.open("/data/recording.bag")) {
+ *     const char* bytes = file.data();
+ *     size_t size = file.size();
+ * }
+ * ```
+ *
+ * **Thread-Safety**: open/close는 NOT thread-safe, 매핑된 데이터 읽기는 thread-safe
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+
+    /**
+     * @brief 소멸자 (매핑 자동 해제)
+     */
+    ~MappedFile();
+
+    // 복사 금지
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief 파일을 읽기 전용으로 매핑
+     *
+     * @param filepath 파일 경로
+     * @return true if 성공 (빈 파일은 실패)
+     */
+    bool open(const std::string& filepath);
+
+    /**
+     * @brief 매핑 해제
+     */
+    void close();
+
+    /**
+     * @brief 매핑 여부 확인
+     */
+    bool isOpen() const { return data_ != nullptr; }
+
+    /**
+     * @brief 매핑된 데이터 시작 주소
+     */
+    const char* data() const { return data_; }
+
+    /**
+     * @brief 매핑된 바이트 수
+     */
+    size_t size() const { return size_; }
+
+private:
+    const char* data_ = nullptr;   ///< 매핑 시작 주소
+    size_t size_ = 0;              ///< 매핑 크기 (바이트)
+};
+
+} // namespace mxrc::core::logging
+
+#endif // MXRC_CORE_LOGGING_UTIL_MAPPEDFILE_H
@@ -12,6 +12,7 @@
 #include <spdlog/spdlog.h>
 #include <thread>
 #include <chrono>
+#include <optional>
 
 // DataStore is already included above, but we need to ensure template instantiation
 namespace mxrc {
@@ -197,8 +198,13 @@ void NonRTExecutive::syncRTStatus() {
         return;
     }
 
-    // DataStore에 반영
+    // DataStore에 반영 (변경 이벤트는 한 배치로 발행)
     try {
+        std::optional<event::EventBus::BatchScope> batch;
+        if (event_bus_) {
+            batch.emplace(*event_bus_);
+        }
+
         datastore_->set("rt.robot_mode", robot_mode, DataType::RobotMode);
         datastore_->set("rt.position_x", position_x, DataType::RobotMode);
         datastore_->set("rt.position_y", position_y, DataType::RobotMode);
@@ -8,8 +8,11 @@ namespace mxrc {
 namespace core {
 namespace rt {
 
-RTDataStore::RTDataStore() {
+RTDataStore::RTDataStore()
+    : image_seq_(0)
+    , image_timestamp_ns_(0) {
     // 모든 엔트리 초기화 (생성자에서 자동 호출됨)
+    std::memset(process_image_, 0, sizeof(process_image_));
 }
 
 bool RTDataStore::isValidKey(DataKey key) const {
@@ -22,6 +25,9 @@ int RTDataStore::setInt32(DataKey key, int32_t value) {
     }
 
     auto idx = static_cast<size_t>(key);
+    if (views_[idx].bound) {
+        return -1;  // 뷰는 읽기 전용
+    }
 
     // Seqlock: 쓰기 시작 (seq를 홀수로)
     entries_[idx].seq.fetch_add(1, std::memory_order_release);
@@ -43,6 +49,9 @@ int RTDataStore::setFloat(DataKey key, float value) {
     }
 
     auto idx = static_cast<size_t>(key);
+    if (views_[idx].bound) {
+        return -1;  // 뷰는 읽기 전용
+    }
 
     // Seqlock: 쓰기 시작 (seq를 홀수로)
     entries_[idx].seq.fetch_add(1, std::memory_order_release);
@@ -64,6 +73,9 @@ int RTDataStore::setDouble(DataKey key, double value) {
     }
 
     auto idx = static_cast<size_t>(key);
+    if (views_[idx].bound) {
+        return -1;  // 뷰는 읽기 전용
+    }
 
     // Seqlock: 쓰기 시작 (seq를 홀수로)
     entries_[idx].seq.fetch_add(1, std::memory_order_release);
@@ -85,6 +97,9 @@ int RTDataStore::setUint64(DataKey key, uint64_t value) {
     }
 
     auto idx = static_cast<size_t>(key);
+    if (views_[idx].bound) {
+        return -1;  // 뷰는 읽기 전용
+    }
 
     // Seqlock: 쓰기 시작 (seq를 홀수로)
     entries_[idx].seq.fetch_add(1, std::memory_order_release);
@@ -106,6 +121,9 @@ int RTDataStore::setString(DataKey key, const char* value, size_t len) {
     }
 
     auto idx = static_cast<size_t>(key);
+    if (views_[idx].bound) {
+        return -1;  // 뷰는 읽기 전용
+    }
 
     // Seqlock: 쓰기 시작 (seq를 홀수로)
     entries_[idx].seq.fetch_add(1, std::memory_order_release);
@@ -131,6 +149,16 @@ int RTDataStore::getInt32(DataKey key, int32_t& out_value) const {
 
     auto idx = static_cast<size_t>(key);
 
+    if (views_[idx].bound) {
+        const ImageView& view = views_[idx];
+        if (view.format == ImageFormat::FLOAT || view.format == ImageFormat::DOUBLE ||
+            view.scale != 1.0) {
+            return -1;
+        }
+        out_value = static_cast<int32_t>(static_cast<int64_t>(readView(view)));
+        return 0;
+    }
+
     // Seqlock 읽기: 재시도 루프
     uint64_t seq1, seq2;
     int32_t temp_value;
@@ -172,6 +200,15 @@ int RTDataStore::getFloat(DataKey key, float& out_value) const {
 
     auto idx = static_cast<size_t>(key);
 
+    if (views_[idx].bound) {
+        const ImageView& view = views_[idx];
+        if (view.format != ImageFormat::FLOAT || view.scale != 1.0) {
+            return -1;
+        }
+        out_value = static_cast<float>(readView(view));
+        return 0;
+    }
+
     // Seqlock 읽기: 재시도 루프
     uint64_t seq1, seq2;
     float temp_value;
@@ -205,6 +242,11 @@ int RTDataStore::getDouble(DataKey key, double& out_value) const {
 
     auto idx = static_cast<size_t>(key);
 
+    if (views_[idx].bound) {
+        out_value = readView(views_[idx]) * views_[idx].scale;
+        return 0;
+    }
+
     // Seqlock 읽기: 재시도 루프
     uint64_t seq1, seq2;
     double temp_value;
@@ -238,6 +280,10 @@ int RTDataStore::getUint64(DataKey key, uint64_t& out_value) const {
 
     auto idx = static_cast<size_t>(key);
 
+    if (views_[idx].bound) {
+        return -1;
+    }
+
     // Seqlock 읽기: 재시도 루프
     uint64_t seq1, seq2;
     uint64_t temp_value;
@@ -270,6 +316,9 @@ int RTDataStore::getString(DataKey key, char* out_buffer, size_t buffer_size) co
     }
 
     auto idx = static_cast<size_t>(key);
+    if (views_[idx].bound) {
+        return -1;
+    }
 
     // Seqlock 읽기: 재시도 루프
     uint64_t seq1, seq2;
@@ -316,6 +365,9 @@ uint64_t RTDataStore::getSeq(DataKey key) const {
     }
 
     auto idx = static_cast<size_t>(key);
+    if (views_[idx].bound) {
+        return image_seq_.load(std::memory_order_relaxed);
+    }
     return entries_[idx].seq.load(std::memory_order_relaxed);
 }
 
@@ -326,13 +378,21 @@ bool RTDataStore::isFresh(DataKey key, uint64_t max_age_ns) const {
 
     auto idx = static_cast<size_t>(key);
 
+    // 뷰는 마지막 image 갱신 시각 기준
+    uint64_t timestamp_ns = views_[idx].bound
+        ? image_timestamp_ns_.load(std::memory_order_acquire)
+        : entries_[idx].timestamp_ns;
+
     // 데이터가 없으면 fresh하지 않음
-    if (entries_[idx].type == DataType::NONE) {
+    if (!views_[idx].bound && entries_[idx].type == DataType::NONE) {
+        return false;
+    }
+    if (timestamp_ns == 0) {
         return false;
     }
 
     uint64_t current_time = util::getMonotonicTimeNs();
-    uint64_t age = current_time - entries_[idx].timestamp_ns;
+    uint64_t age = current_time - timestamp_ns;
 
     return age <= max_age_ns;
 }
@@ -343,9 +403,123 @@ uint64_t RTDataStore::getTimestamp(DataKey key) const {
     }
 
     auto idx = static_cast<size_t>(key);
+    if (views_[idx].bound) {
+        return image_timestamp_ns_.load(std::memory_order_acquire);
+    }
     return entries_[idx].timestamp_ns;
 }
 
+void RTDataStore::beginImageUpdate() {
+    // Seqlock: 쓰기 시작 (seq를 홀수로)
+    image_seq_.fetch_add(1, std::memory_order_release);
+}
+
+void RTDataStore::endImageUpdate() {
+    image_timestamp_ns_.store(util::getMonotonicTimeNs(), std::memory_order_release);
+
+    // Seqlock: 쓰기 완료 (seq를 짝수로)
+    image_seq_.fetch_add(1, std::memory_order_release);
+}
+
+int RTDataStore::publishImage(const uint8_t* src, size_t size) {
+    if (src == nullptr || size > PROCESS_IMAGE_SIZE) {
+        return -1;
+    }
+
+    beginImageUpdate();
+    std::memcpy(process_image_, src, size);
+    endImageUpdate();
+
+    return 0;
+}
+
+int RTDataStore::bindView(DataKey key, uint32_t offset, ImageFormat format, double scale) {
+    if (!isValidKey(key)) {
+        return -1;
+    }
+    if (static_cast<size_t>(offset) + imageFormatSize(format) > PROCESS_IMAGE_SIZE) {
+        return -1;
+    }
+
+    auto idx = static_cast<size_t>(key);
+    views_[idx].offset = offset;
+    views_[idx].format = format;
+    views_[idx].scale = scale;
+    views_[idx].bound = true;
+
+    return 0;
+}
+
+int RTDataStore::unbindView(DataKey key) {
+    if (!isValidKey(key)) {
+        return -1;
+    }
+
+    views_[static_cast<size_t>(key)] = ImageView();
+    return 0;
+}
+
+bool RTDataStore::isView(DataKey key) const {
+    return isValidKey(key) && views_[static_cast<size_t>(key)].bound;
+}
+
+size_t RTDataStore::imageFormatSize(ImageFormat format) {
+    switch (format) {
+        case ImageFormat::INT8:
+        case ImageFormat::UINT8:  return 1;
+        case ImageFormat::INT16:
+        case ImageFormat::UINT16: return 2;
+        case ImageFormat::INT32:
+        case ImageFormat::UINT32:
+        case ImageFormat::FLOAT:  return 4;
+        case ImageFormat::DOUBLE: return 8;
+    }
+    return 0;
+}
+
+namespace {
+
+template <typename T>
+double loadImageValue(const uint8_t* src) {
+    T value;
+    std::memcpy(&value, src, sizeof(T));
+    return static_cast<double>(value);
+}
+
+} // namespace
+
+double RTDataStore::readView(const ImageView& view) const {
+    const uint8_t* src = process_image_ + view.offset;
+    double value = 0.0;
+
+    // Seqlock 읽기: image 갱신 중이면 재시도
+    while (true) {
+        uint64_t seq1 = image_seq_.load(std::memory_order_acquire);
+        if (seq1 & 1) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        switch (view.format) {
+            case ImageFormat::INT8:   value = loadImageValue<int8_t>(src); break;
+            case ImageFormat::UINT8:  value = loadImageValue<uint8_t>(src); break;
+            case ImageFormat::INT16:  value = loadImageValue<int16_t>(src); break;
+            case ImageFormat::UINT16: value = loadImageValue<uint16_t>(src); break;
+            case ImageFormat::INT32:  value = loadImageValue<int32_t>(src); break;
+            case ImageFormat::UINT32: value = loadImageValue<uint32_t>(src); break;
+            case ImageFormat::FLOAT:  value = loadImageValue<float>(src); break;
+            case ImageFormat::DOUBLE: value = loadImageValue<double>(src); break;
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (image_seq_.load(std::memory_order_relaxed) == seq1) {
+            break;
+        }
+    }
+
+    return value;
+}
+
 } // namespace rt
 } // namespace core
 } // namespace mxrc
@@ -39,6 +39,29 @@ struct DataEntry {
     DataEntry() : type(DataType::NONE), timestamp_ns(0), seq(0) {}
 };
 
+// Process image 값 형식 (zero-copy 뷰)
+enum class ImageFormat : uint8_t {
+    INT8,
+    UINT8,
+    INT16,
+    UINT16,
+    INT32,
+    UINT32,
+    FLOAT,
+    DOUBLE
+};
+
+// Process image 위의 타입 뷰
+// 키를 바인딩하면 get*()이 엔트리 대신 process image의 offset에서 직접 읽음
+struct ImageView {
+    uint32_t offset;       // process image 내 바이트 offset
+    ImageFormat format;    // 값 형식
+    bool bound;            // 바인딩 여부
+    double scale;          // getDouble() 배율
+
+    ImageView() : offset(0), format(ImageFormat::UINT8), bound(false), scale(1.0) {}
+};
+
 // 키 정의 (타입 안전성)
 enum class DataKey : uint16_t {
     // 예제 키들
@@ -96,6 +119,10 @@ enum class DataKey : uint16_t {
 // - Lock-free 읽기/쓰기
 class RTDataStore {
 public:
+    // 내장 process image 크기 (EtherCAT domain 등)
+    // 공유 메모리에 배치되므로 포인터가 아닌 내장 버퍼 + offset으로 관리
+    static constexpr size_t PROCESS_IMAGE_SIZE = 4096;
+
     RTDataStore();
     ~RTDataStore() = default;
 
@@ -126,12 +153,43 @@ public:
     // 타임스탬프 가져오기
     uint64_t getTimestamp(DataKey key) const;
 
+    // Process image (zero-copy 입력)
+    // - 쓰기 측(RT 스레드): beginImageUpdate() → image 갱신 → endImageUpdate()
+    //   또는 외부 버퍼를 publishImage()로 한 번에 복사
+    // - EtherCAT domain이 processImage()를 외부 메모리로 사용하면 복사 없이 갱신됨
+    uint8_t* processImage() { return process_image_; }
+    const uint8_t* processImage() const { return process_image_; }
+    void beginImageUpdate();
+    void endImageUpdate();
+    int publishImage(const uint8_t* src, size_t size);
+
+    // 키를 process image 뷰로 바인딩 (set*()은 -1, get*()은 image에서 읽음)
+    // getDouble(): 모든 형식 (scale 적용)
+    // getInt32(): 정수 형식이고 scale == 1.0일 때
+    // getFloat(): FLOAT 형식이고 scale == 1.0일 때
+    // 반환: 성공 0, 실패 -1 (키 또는 범위 오류)
+    int bindView(DataKey key, uint32_t offset, ImageFormat format, double scale = 1.0);
+    int unbindView(DataKey key);
+    bool isView(DataKey key) const;
+
+    // 형식별 바이트 크기
+    static size_t imageFormatSize(ImageFormat format);
+
 private:
     // 키 유효성 검증
     bool isValidKey(DataKey key) const;
 
+    // 뷰 값 읽기 (image seqlock, scale 미적용)
+    double readView(const ImageView& view) const;
+
     // 고정 크기 배열
     DataEntry entries_[static_cast<size_t>(DataKey::MAX_KEYS)];
+
+    // Process image 및 키별 뷰
+    alignas(64) uint8_t process_image_[PROCESS_IMAGE_SIZE];
+    std::atomic<uint64_t> image_seq_;
+    std::atomic<uint64_t> image_timestamp_ns_;  // 마지막 image 갱신 시각 (seqlock 밖에서 읽힘)
+    ImageView views_[static_cast<size_t>(DataKey::MAX_KEYS)];
 };
 
 } // namespace rt
@@ -1,6 +1,8 @@
 #include "RTExecutive.h"
 #include "RTStateMachine.h"
 #include "util/TimeUtils.h"
+#include "util/VirtualClock.h"
+#include "util/DCPhaseTracker.h"
 #include "util/ScheduleCalculator.h"
 #include "ipc/SharedMemoryData.h"
 #include "core/event/interfaces/IEventBus.h"
@@ -9,8 +11,10 @@
 #include "core/rt/perf/NUMABinding.h"
 #include "core/rt/perf/PerfMonitor.h"
 #include "core/rt/RTMetrics.h"
+#include "core/logging/Log.h"
 #include "core/fieldbus/interfaces/IFieldbus.h"
 #include <spdlog/spdlog.h>
+#include <algorithm>
 #include <sched.h>
 
 namespace mxrc {
@@ -32,6 +36,8 @@ RTExecutive::RTExecutive(uint32_t minor_cycle_ms, uint32_t major_cycle_ms,
     , safe_mode_enter_time_ns_(0)
     , event_bus_(event_bus)
     , fieldbus_(nullptr)
+    , virtual_clock_(nullptr)
+    , virtual_clock_attached_(false)
     , cpu_affinity_mgr_impl_(new mxrc::rt::perf::CPUAffinityManager())
     , numa_binding_impl_(new mxrc::rt::perf::NUMABinding())
     , perf_monitor_impl_(new mxrc::rt::perf::PerfMonitor())
@@ -86,6 +92,7 @@ std::unique_ptr<RTExecutive> RTExecutive::createFromPeriods(
 
 RTExecutive::~RTExecutive() {
     stop();
+    setVirtualClock(nullptr);
 
     // Production readiness: Clean up performance monitoring
     delete static_cast<mxrc::rt::perf::CPUAffinityManager*>(cpu_affinity_mgr_impl_);
@@ -137,6 +144,19 @@ int RTExecutive::run() {
     uint64_t cycle_duration_ns = minor_cycle_ms_ * 1'000'000ULL;
     uint64_t cycle_start_ns = util::getMonotonicTimeNs();
 
+    // 가상 시간: 재생 시작 시각부터 주기 실행
+    if (virtual_clock_) {
+        if (!virtual_clock_attached_) {
+            virtual_clock_->attach();
+            virtual_clock_attached_ = true;
+        }
+        if (!virtual_clock_->waitForStart(&running_)) {
+            spdlog::info("Virtual clock closed before start");
+            stop();
+        }
+        cycle_start_ns = virtual_clock_->nowNs();
+    }
+
     // Main cyclic executive loop
     while (running_) {
         // Production readiness: Start cycle performance monitoring
@@ -191,16 +211,27 @@ int RTExecutive::run() {
             }
         }
 
+        // DC reference clock에 위상 정렬 (다음 cycle 길이 보정)
+        int64_t dc_correction_ns = updateDCSync(cycle_start_ns);
+        uint64_t this_cycle_ns = static_cast<uint64_t>(
+            std::max<int64_t>(0, static_cast<int64_t>(cycle_duration_ns) + dc_correction_ns));
+
         // Move to next slot
         current_slot_ = (current_slot_ + 1) % num_slots_;
         cycle_count_++;
 
         // Wait until next cycle
-        uint64_t next_cycle_ns = cycle_start_ns + cycle_duration_ns;
-        waitUntilNextCycle(cycle_start_ns, cycle_duration_ns);
+        uint64_t next_cycle_ns = cycle_start_ns + this_cycle_ns;
+        waitUntilNextCycle(cycle_start_ns, this_cycle_ns);
         cycle_start_ns = next_cycle_ns;
     }
 
+    // 가상 시간 참여 종료 (재생이 이 executive를 기다리지 않도록)
+    if (virtual_clock_ && virtual_clock_attached_) {
+        virtual_clock_->detach();
+        virtual_clock_attached_ = false;
+    }
+
     spdlog::info("RTExecutive stopped");
     return 0;
 }
@@ -210,6 +241,11 @@ void RTExecutive::stop() {
         spdlog::info("RTExecutive stopping...");
         running_ = false;
 
+        // 가상 시간 대기 중이면 깨워서 루프 종료
+        if (virtual_clock_) {
+            virtual_clock_->wakeAll();
+        }
+
         // RUNNING/PAUSED -> SHUTDOWN 전환
         if (state_machine_->getState() == RTState::RUNNING ||
             state_machine_->getState() == RTState::PAUSED) {
@@ -247,12 +283,12 @@ void RTExecutive::executeSlot(uint32_t slot) {
         // Check guard condition first
         if (action.guard) {
             if (!action.guard(*state_machine_)) {
-                spdlog::trace("Skipping action '{}' - guard condition failed", action.name);
+                MXRC_LOG_TRACE("Skipping action '{}' - guard condition failed", action.name);
                 continue;
             }
         }
 
-        spdlog::trace("Executing action '{}'", action.name);
+        MXRC_LOG_TRACE("Executing action '{}'", action.name);
 
         // Execute action with context
         if (action.callback) {
@@ -272,8 +308,68 @@ void RTExecutive::setFieldbus(fieldbus::IFieldbus* fieldbus) {
                  fieldbus ? fieldbus->getProtocolName() : "nullptr");
 }
 
+void RTExecutive::setVirtualClock(util::VirtualClock* clock) {
+    if (virtual_clock_ && virtual_clock_attached_) {
+        virtual_clock_->detach();
+        virtual_clock_attached_ = false;
+    }
+
+    virtual_clock_ = clock;
+    if (virtual_clock_) {
+        virtual_clock_->attach();
+        virtual_clock_attached_ = true;
+        spdlog::info("Virtual clock attached to RTExecutive");
+    }
+}
+
+void RTExecutive::enableDCSync(ReferenceClockSource source, const util::DCPhaseConfig& config) {
+    dc_reference_clock_ = std::move(source);
+    dc_tracker_ = std::make_unique<util::DCPhaseTracker>(config);
+    spdlog::info("DC phase alignment enabled: sync0_cycle={}ns, shift={}ns, send_lead={}ns",
+                 config.sync0_cycle_ns, config.sync0_shift_ns, config.send_lead_ns);
+}
+
+void RTExecutive::disableDCSync() {
+    dc_reference_clock_ = nullptr;
+    dc_tracker_.reset();
+}
+
+int64_t RTExecutive::updateDCSync(uint64_t cycle_start_ns) {
+    if (!dc_tracker_ || !dc_reference_clock_) {
+        return 0;
+    }
+
+    uint64_t reference_ns = 0;
+    if (dc_reference_clock_(reference_ns) != 0) {
+        return 0;
+    }
+
+    int64_t correction_ns = dc_tracker_->update(cycle_start_ns, reference_ns);
+
+    // Update DC metrics periodically (every 1000 cycles)
+    if (rt_metrics_ && cycle_count_ % 1000 == 0) {
+        rt_metrics_->updateDCSync(
+            dc_tracker_->getOffsetNs() / 1e9,
+            dc_tracker_->getDriftPpm(),
+            dc_tracker_->getPhaseErrorNs() / 1e9,
+            correction_ns / 1e9);
+    }
+
+    return correction_ns;
+}
+
 int RTExecutive::waitUntilNextCycle(uint64_t cycle_start_ns, uint64_t cycle_duration_ns) {
     uint64_t wakeup_time_ns = cycle_start_ns + cycle_duration_ns;
+
+    if (virtual_clock_) {
+        // clock 종료 = 재생 종료
+        if (virtual_clock_->waitUntil(wakeup_time_ns, &running_) != 0) {
+            stop();
+            return -1;
+        }
+        return 0;
+    }
+
     return util::waitUntilAbsoluteTime(wakeup_time_ns);
 }
 
@@ -298,8 +394,8 @@ void RTExecutive::checkHeartbeat() {
     if (time_since_last_hb > ipc::SharedMemoryData::HEARTBEAT_TIMEOUT_NS) {
         // Heartbeat 실패 - SAFE_MODE 진입
         if (state_machine_->getState() == RTState::RUNNING) {
-            spdlog::warn("Non-RT heartbeat lost (timeout: {} ms), entering SAFE_MODE",
-                        time_since_last_hb / 1'000'000);
+            MXRC_LOG_WARN("Non-RT heartbeat lost (timeout: {} ms), entering SAFE_MODE",
+                          time_since_last_hb / 1'000'000);
 
             // SAFE_MODE 진입 시각 기록
             safe_mode_enter_time_ns_ = now_ns;
@@ -318,7 +414,7 @@ void RTExecutive::checkHeartbeat() {
     } else {
         // Heartbeat 정상 - SAFE_MODE에서 복구
         if (state_machine_->getState() == RTState::SAFE_MODE) {
-            spdlog::info("Non-RT heartbeat recovered, exiting SAFE_MODE");
+            MXRC_LOG_INFO("Non-RT heartbeat recovered, exiting SAFE_MODE");
 
             // SAFE_MODE 복구 이벤트 발행
             if (event_bus_ && safe_mode_enter_time_ns_ > 0) {
@@ -27,6 +27,12 @@ class RTStateMachine;
 class RTMetrics;
 enum class RTState : uint8_t;
 
+namespace util {
+class VirtualClock;
+class DCPhaseTracker;
+struct DCPhaseConfig;
+}
+
 } // namespace rt
 } // namespace core
 } // namespace mxrc
@@ -53,6 +59,7 @@ public:
     using ActionCallback = std::function<void(RTContext&)>;
     using GuardCondition = std::function<bool(const RTStateMachine&)>;
     using InitializationHook = std::function<void()>;  // Production readiness: init hook
+    using ReferenceClockSource = std::function<int(uint64_t& reference_ns)>;  // DC reference clock
 
     // minor_cycle_ms: 최소 주기 (ms)
     // major_cycle_ms: 전체 프레임 크기 (ms)
@@ -99,6 +106,37 @@ public:
      */
     fieldbus::IFieldbus* getFieldbus() { return fieldbus_; }
 
+    /**
+     * @brief Drive cycles from a virtual clock instead of CLOCK_MONOTONIC
+     *
+     * 설정 시 run()은 가상 시간 기준으로 주기를 실행합니다 (BagReplayer 결정적 재생).
+     * 호출 시점에 참여자로 attach되며, run() 종료 시 detach됩니다.
+     * clock이 close되면 run()이 종료됩니다.
+     *
+     * @param clock VirtualClock (must outlive RTExecutive, nullptr이면 해제)
+     */
+    void setVirtualClock(util::VirtualClock* clock);
+
+    /**
+     * @brief Align cycle phase to the EtherCAT DC reference clock
+     *
+     * 매 cycle action 실행 후 source로 reference clock(DCConfiguration::reference_slave)을 읽어
+     * cycle 시작과의 offset/drift를 추적하고, 다음 wakeup을 보정하여 cycle 시작이
+     * SYNC0보다 config.send_lead_ns 앞서도록 위상을 유지합니다.
+     * source가 0이 아닌 값을 반환한 cycle은 보정하지 않습니다.
+     * 예: master->getReferenceClockTime(reference_ns)
+     *
+     * @param source Reference clock 읽기 (RT 스레드에서 호출, 할당 없어야 함)
+     * @param config 위상 추적 파라미터
+     */
+    void enableDCSync(ReferenceClockSource source, const util::DCPhaseConfig& config);
+
+    // DC 위상 정렬 해제 (run() 중 호출 불가)
+    void disableDCSync();
+
+    // DC 위상 추적 상태 (offset, drift, 위상 오차), 미사용 시 nullptr
+    const util::DCPhaseTracker* getDCPhaseTracker() const { return dc_tracker_.get(); }
+
     // 스케줄 파라미터 조회
     uint32_t getMinorCycleMs() const { return minor_cycle_ms_; }
     uint32_t getMajorCycleMs() const { return major_cycle_ms_; }
@@ -165,6 +203,9 @@ private:
     // 다음 주기까지 대기
     int waitUntilNextCycle(uint64_t cycle_start_ns, uint64_t cycle_duration_ns);
 
+    // DC reference clock 측정 및 다음 wakeup 보정값 산출 (ns)
+    int64_t updateDCSync(uint64_t cycle_start_ns);
+
     // Configuration
     uint32_t minor_cycle_ms_;
     uint32_t major_cycle_ms_;
@@ -193,6 +234,14 @@ private:
     // Fieldbus interface (Feature 019 US4 - T043)
     fieldbus::IFieldbus* fieldbus_;  // Non-owning pointer, managed by caller
 
+    // Virtual clock for deterministic replay (nullptr = CLOCK_MONOTONIC)
+    util::VirtualClock* virtual_clock_;  // Non-owning pointer, managed by caller
+    bool virtual_clock_attached_;
+
+    // DC phase alignment (nullptr = 독립 clock)
+    ReferenceClockSource dc_reference_clock_;
+    std::unique_ptr<util::DCPhaseTracker> dc_tracker_;
+
     // Action storage
     struct ActionSlot {
         std::string name;
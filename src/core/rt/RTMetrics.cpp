@@ -114,6 +114,27 @@ RTMetrics::RTMetrics(std::shared_ptr<monitoring::MetricsCollector> collector)
         "rt_perf_deadline_miss_rate_percent",
         {},
         "Percentage of cycles that missed deadline");
+
+    // DC phase alignment metrics
+    dc_offset_ = collector_->getOrCreateGauge(
+        "rt_dc_offset_seconds",
+        {},
+        "DC reference clock offset from RT cycle start in seconds");
+
+    dc_drift_ppm_ = collector_->getOrCreateGauge(
+        "rt_dc_drift_ppm",
+        {},
+        "DC reference clock drift relative to the RT clock in ppm");
+
+    dc_phase_error_ = collector_->getOrCreateGauge(
+        "rt_dc_phase_error_seconds",
+        {},
+        "RT cycle phase error relative to the target SYNC0 lead in seconds");
+
+    dc_correction_ = collector_->getOrCreateGauge(
+        "rt_dc_wakeup_correction_seconds",
+        {},
+        "Wakeup correction applied to the next RT cycle in seconds");
 }
 
 void RTMetrics::recordMinorCycleDuration(double duration_seconds) {
@@ -196,4 +217,14 @@ void RTMetrics::updatePerfDeadlineMissRate(double miss_rate_percent) {
     perf_deadline_miss_rate_->set(miss_rate_percent);
 }
 
+// DC phase alignment methods
+
+void RTMetrics::updateDCSync(double offset_seconds, double drift_ppm,
+                             double phase_error_seconds, double correction_seconds) {
+    dc_offset_->set(offset_seconds);
+    dc_drift_ppm_->set(drift_ppm);
+    dc_phase_error_->set(phase_error_seconds);
+    dc_correction_->set(correction_seconds);
+}
+
 } // namespace mxrc::core::rt
@@ -52,6 +52,12 @@ private:
     std::shared_ptr<monitoring::Counter> perf_deadline_misses_;
     std::shared_ptr<monitoring::Gauge> perf_deadline_miss_rate_;
 
+    // DC phase alignment metrics
+    std::shared_ptr<monitoring::Gauge> dc_offset_;
+    std::shared_ptr<monitoring::Gauge> dc_drift_ppm_;
+    std::shared_ptr<monitoring::Gauge> dc_phase_error_;
+    std::shared_ptr<monitoring::Gauge> dc_correction_;
+
 public:
     /**
      * @brief RTMetrics 생성자
@@ -194,6 +200,19 @@ public:
      * @param miss_rate_percent Deadline miss rate as percentage
      */
     void updatePerfDeadlineMissRate(double miss_rate_percent);
+
+    // DC phase alignment methods
+
+    /**
+     * @brief Update DC reference clock tracking state
+     *
+     * @param offset_seconds Reference clock - RT cycle start offset in seconds
+     * @param drift_ppm Reference clock drift relative to the RT clock (ppm)
+     * @param phase_error_seconds Cycle phase error relative to target SYNC0 lead in seconds
+     * @param correction_seconds Wakeup correction applied to the next cycle in seconds
+     */
+    void updateDCSync(double offset_seconds, double drift_ppm,
+                      double phase_error_seconds, double correction_seconds);
 };
 
 } // namespace mxrc::core::rt
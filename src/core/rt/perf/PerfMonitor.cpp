@@ -20,6 +20,11 @@ PerfMonitor::PerfMonitor()
     , sum_latency_(0.0)
     , sum_squared_latency_(0.0)
     , last_missed_deadline_(false) {
+    // configure() 없이 사용해도 기본 설정 크기의 버퍼 사용
+    latency_samples_.resize(config_.sample_buffer_size, 0.0);
+    if (config_.enable_histogram) {
+        histogram_.resize(config_.histogram_buckets, 0);
+    }
 }
 
 bool PerfMonitor::configure(const PerfMonitorConfig& config) {
@@ -0,0 +1,83 @@
+#include "DCPhaseTracker.h"
+#include <algorithm>
+#include <cmath>
+
+namespace mxrc {
+namespace core {
+namespace rt {
+namespace util {
+
+DCPhaseTracker::DCPhaseTracker(const DCPhaseConfig& config)
+    : config_(config) {
+    reset();
+}
+
+void DCPhaseTracker::reset() {
+    last_local_ns_ = 0;
+    offset_ns_ = 0;
+    drift_ppm_ = 0.0;
+    phase_error_ns_ = 0;
+    integral_ns_ = 0.0;
+    correction_ns_ = 0;
+    sample_count_ = 0;
+}
+
+int64_t DCPhaseTracker::update(uint64_t local_ns, uint64_t reference_ns) {
+    const int64_t period = static_cast<int64_t>(config_.sync0_cycle_ns);
+    if (period <= 0) {
+        return 0;
+    }
+
+    // 1. offset / drift
+    int64_t offset = static_cast<int64_t>(reference_ns - local_ns);
+    if (sample_count_ > 0 && local_ns > last_local_ns_) {
+        double elapsed = static_cast<double>(local_ns - last_local_ns_);
+        double drift = static_cast<double>(offset - offset_ns_) / elapsed * 1e6;
+        drift_ppm_ = sample_count_ == 1
+            ? drift
+            : drift_ppm_ + config_.drift_filter_alpha * (drift - drift_ppm_);
+    }
+    offset_ns_ = offset;
+    last_local_ns_ = local_ns;
+    sample_count_++;
+
+    // 2. 위상 오차: SYNC0는 reference 시각 (k * T + shift)에 발생
+    //    목표는 cycle 시작이 다음 SYNC0보다 send_lead_ns 앞서는 것 (위상 = T - lead)
+    int64_t phase = (static_cast<int64_t>(reference_ns % config_.sync0_cycle_ns) -
+                     config_.sync0_shift_ns % period + period) % period;
+    int64_t target = ((period - config_.send_lead_ns) % period + period) % period;
+    int64_t error = phase - target;
+    if (error >= period / 2) {
+        error -= period;
+    } else if (error < -period / 2) {
+        error += period;
+    }
+    phase_error_ns_ = error;
+
+    // 3. PI + drift feed-forward
+    //    위상이 앞서면(error > 0) 다음 cycle을 일찍 시작
+    //    slave clock이 빠르면(drift > 0) 로컬 cycle을 T * drift만큼 줄여 위상 유지
+    double feed_forward = -drift_ppm_ * 1e-6 * static_cast<double>(period);
+    double limit = static_cast<double>(config_.max_correction_ns);
+
+    integral_ns_ += static_cast<double>(error);
+    if (config_.ki > 0.0) {
+        // anti-windup: 적분 항 단독으로 한도를 넘지 않음
+        double integral_limit = limit / config_.ki;
+        integral_ns_ = std::clamp(integral_ns_, -integral_limit, integral_limit);
+    }
+
+    double correction = feed_forward -
+        (config_.kp * static_cast<double>(error) + config_.ki * integral_ns_);
+    correction_ns_ = static_cast<int64_t>(std::llround(std::clamp(correction, -limit, limit)));
+    return correction_ns_;
+}
+
+bool DCPhaseTracker::isLocked(int64_t tolerance_ns) const {
+    return sample_count_ > 0 && std::llabs(phase_error_ns_) <= tolerance_ns;
+}
+
+} // namespace util
+} // namespace rt
+} // namespace core
+} // namespace mxrc
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+
+namespace mxrc {
+namespace core {
+namespace rt {
+namespace util {
+
+// DC 위상 추적 파라미터
+struct DCPhaseConfig {
+    uint64_t sync0_cycle_ns;        // SYNC0 주기 (DCConfiguration::sync0_cycle_time)
+    int64_t sync0_shift_ns;         // SYNC0 shift (DCConfiguration::sync0_shift_time)
+    int64_t send_lead_ns;           // 목표 위상: cycle 시작이 SYNC0보다 앞서는 시간
+    double kp;                      // 위상 오차 비례 이득
+    double ki;                      // 위상 오차 적분 이득
+    int64_t max_correction_ns;      // cycle당 wakeup 보정 한도 (절댓값)
+    double drift_filter_alpha;      // drift 추정 저역 필터 계수 (0~1, 클수록 빠르게 추종)
+
+    DCPhaseConfig()
+        : sync0_cycle_ns(1000000)   // 기본 1ms
+        , sync0_shift_ns(0)
+        , send_lead_ns(100000)      // 기본 100us 전
+        , kp(0.1)
+        , ki(0.01)
+        , max_correction_ns(10000)  // 기본 10us
+        , drift_filter_alpha(0.01) {}
+};
+
+// RT cycle과 EtherCAT DC reference clock 간 위상 추적기
+// 매 cycle (로컬 cycle 시작 시각, 같은 cycle에 읽은 reference clock 시각)을 입력받아
+// - offset: reference - local
+// - drift: offset 변화율 (ppm, 저역 필터)
+// - 위상 오차: reference 시각의 SYNC0 주기 내 위상 - 목표 위상 ([-T/2, T/2)로 wrap)
+// 을 계산하고, 다음 wakeup 보정값을 PI 제어 + drift feed-forward로 산출
+// 보정값 > 0이면 다음 cycle을 늦게, < 0이면 일찍 시작 (할당 없음, RT 스레드 전용)
+class DCPhaseTracker {
+public:
+    explicit DCPhaseTracker(const DCPhaseConfig& config = DCPhaseConfig());
+
+    // 측정값 반영
+    // local_ns: 로컬 cycle 시작 시각 (CLOCK_MONOTONIC 또는 가상 시간)
+    // reference_ns: local_ns 시점의 DC reference clock 시각 (송신/수신 지연이 포함되면 위상 오차에 편향)
+    // 반환: 다음 wakeup 보정값 (ns)
+    int64_t update(uint64_t local_ns, uint64_t reference_ns);
+
+    // 상태 초기화 (설정 유지)
+    void reset();
+
+    const DCPhaseConfig& getConfig() const { return config_; }
+
+    int64_t getOffsetNs() const { return offset_ns_; }
+    double getDriftPpm() const { return drift_ppm_; }
+    int64_t getPhaseErrorNs() const { return phase_error_ns_; }
+    int64_t getCorrectionNs() const { return correction_ns_; }
+    uint64_t getSampleCount() const { return sample_count_; }
+
+    // 위상 오차가 tolerance_ns 이내인지
+    bool isLocked(int64_t tolerance_ns) const;
+
+private:
+    DCPhaseConfig config_;
+
+    uint64_t last_local_ns_;
+    int64_t offset_ns_;
+    double drift_ppm_;
+    int64_t phase_error_ns_;
+    double integral_ns_;
+    int64_t correction_ns_;
+    uint64_t sample_count_;
+};
+
+} // namespace util
+} // namespace rt
+} // namespace core
+} // namespace mxrc
@@ -0,0 +1,117 @@
+#include "VirtualClock.h"
+
+namespace mxrc {
+namespace core {
+namespace rt {
+namespace util {
+
+void VirtualClock::attach() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    attached_++;
+}
+
+void VirtualClock::detach() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (attached_ > 0) {
+            attached_--;
+        }
+    }
+    driver_cv_.notify_all();
+}
+
+void VirtualClock::start(uint64_t start_ns) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        now_ns_.store(start_ns, std::memory_order_release);
+        started_ = true;
+        closed_ = false;
+    }
+    waiter_cv_.notify_all();
+}
+
+bool VirtualClock::waitForStart(const std::atomic<bool>* running) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    waiter_cv_.wait(lock, [&] {
+        return started_ || closed_ || (running && !running->load(std::memory_order_acquire));
+    });
+    return started_ && !closed_;
+}
+
+int VirtualClock::waitUntil(uint64_t wakeup_ns, const std::atomic<bool>* running) {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (closed_) {
+        return -1;
+    }
+    if (wakeup_ns <= nowNs()) {
+        return 0;
+    }
+
+    // 대기 진입 = driver에게 진행 양보
+    auto it = deadlines_.insert(wakeup_ns);
+    driver_cv_.notify_all();
+
+    waiter_cv_.wait(lock, [&] {
+        return closed_ || nowNs() >= wakeup_ns ||
+               (running && !running->load(std::memory_order_acquire));
+    });
+
+    deadlines_.erase(it);
+    bool reached = nowNs() >= wakeup_ns && !closed_;
+    lock.unlock();
+    driver_cv_.notify_all();
+
+    return reached ? 0 : -1;
+}
+
+void VirtualClock::advanceTo(uint64_t target_ns) {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (!closed_) {
+        driver_cv_.wait(lock, [this] { return closed_ || isQuiescent(); });
+        if (closed_ || deadlines_.empty() || *deadlines_.begin() > target_ns) {
+            break;
+        }
+
+        // 가장 이른 마감으로 전진하여 해당 참여자 실행
+        now_ns_.store(*deadlines_.begin(), std::memory_order_release);
+        waiter_cv_.notify_all();
+    }
+
+    if (!closed_ && target_ns > nowNs()) {
+        now_ns_.store(target_ns, std::memory_order_release);
+    }
+}
+
+void VirtualClock::close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+    }
+    waiter_cv_.notify_all();
+    driver_cv_.notify_all();
+}
+
+bool VirtualClock::isClosed() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closed_;
+}
+
+void VirtualClock::wakeAll() {
+    { std::lock_guard<std::mutex> lock(mutex_); }
+    waiter_cv_.notify_all();
+}
+
+bool VirtualClock::isQuiescent() const {
+    // 깨운 참여자가 아직 실행 중이면 (마감 ≤ 현재 시각인 항목이 남아 있으면) 대기
+    if (!deadlines_.empty() && *deadlines_.begin() <= nowNs()) {
+        return false;
+    }
+    return deadlines_.size() >= attached_;
+}
+
+} // namespace util
+} // namespace rt
+} // namespace core
+} // namespace mxrc
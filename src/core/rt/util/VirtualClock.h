@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <set>
+
+namespace mxrc {
+namespace core {
+namespace rt {
+namespace util {
+
+// 결정적 재생용 가상 시간
+// 시간은 driver(BagReplayer)가 advanceTo()로만 전진시키고, 참여자(RTExecutive 등)는
+// waitUntil()로 가상 시간에 맞춰 진행합니다.
+// advanceTo()는 깨운 참여자가 모두 다음 대기 지점에 도달한 뒤에만 시간을 더 전진시키므로
+// 벽시계 속도와 무관하게 메시지와 주기 실행의 순서가 항상 같습니다.
+//
+// 사용 순서:
+//   1. 참여자 attach() (재생 시작 전)
+//   2. driver start(start_ns) → 참여자는 waitForStart()로 시작 시각 수신
+//   3. driver advanceTo(t) 반복, 참여자는 waitUntil(deadline) 반복
+//   4. driver close() → 모든 대기 해제, 참여자는 detach()
+class VirtualClock {
+public:
+    VirtualClock() = default;
+
+    VirtualClock(const VirtualClock&) = delete;
+    VirtualClock& operator=(const VirtualClock&) = delete;
+
+    // 현재 가상 시간 (나노초)
+    uint64_t nowNs() const { return now_ns_.load(std::memory_order_acquire); }
+
+    // 참여자 등록/해제
+    // attach한 스레드는 waitUntil() 또는 detach()로 반드시 진행을 양보해야 함
+    void attach();
+    void detach();
+
+    // 시작 시각 설정 및 waitForStart() 대기 해제 (close 상태도 해제)
+    void start(uint64_t start_ns);
+
+    // start()될 때까지 대기
+    // running: nullptr이 아니면 false가 될 때 대기 취소 (wakeAll()로 재확인)
+    // 반환: true 시작됨, false 종료(close) 또는 취소
+    bool waitForStart(const std::atomic<bool>* running = nullptr);
+
+    // 가상 시간이 wakeup_ns에 도달할 때까지 대기
+    // running: nullptr이 아니면 false가 될 때 대기 취소 (wakeAll()로 재확인)
+    // 반환: 0 도달, -1 종료(close) 또는 취소
+    int waitUntil(uint64_t wakeup_ns, const std::atomic<bool>* running = nullptr);
+
+    // target_ns까지 시간 전진
+    // 마감이 target_ns 이하인 대기를 마감 순서대로 깨우며, 각 단계마다 참여자가
+    // 모두 다시 대기할 때까지 기다림 (시간은 뒤로 가지 않음)
+    void advanceTo(uint64_t target_ns);
+
+    // 종료: 모든 대기 해제, 이후 waitUntil()은 즉시 -1
+    void close();
+
+    bool isClosed() const;
+
+    // 대기 중인 스레드가 취소 조건을 다시 확인하도록 깨움
+    void wakeAll();
+
+private:
+    // 모든 참여자가 현재 시각 이후의 마감으로 대기 중인지 (mutex_ 보유 상태에서 호출)
+    bool isQuiescent() const;
+
+    mutable std::mutex mutex_;
+    std::condition_variable waiter_cv_;   // 참여자 깨우기
+    std::condition_variable driver_cv_;   // advanceTo 진행
+    std::atomic<uint64_t> now_ns_{0};
+    std::multiset<uint64_t> deadlines_;   // 대기 중인 마감 시각
+    uint32_t attached_ = 0;
+    bool started_ = false;
+    bool closed_ = false;
+};
+
+} // namespace util
+} // namespace rt
+} // namespace core
+} // namespace mxrc
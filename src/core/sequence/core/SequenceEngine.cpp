@@ -1,5 +1,6 @@
 #include "core/sequence/core/SequenceEngine.h"
 #include "interfaces/IEventBus.h"
+#include "util/EventPool.h"
 #include "dto/SequenceEvents.h"
 #include <thread>
 #include <chrono>
@@ -79,7 +80,7 @@ SequenceResult SequenceEngine::execute(
     auto startTime = state.startTime;
 
     // 이벤트 발행: SEQUENCE_STARTED
-    publishEvent(std::make_shared<mxrc::core::event::SequenceStartedEvent>(
+    publishEvent(event::EventPool<event::SequenceStartedEvent>::make(
         definition.id, definition.name, definition.steps.size()));
 
     // 순차 실행
@@ -101,15 +102,15 @@ SequenceResult SequenceEngine::execute(
     // 이벤트 발행: SEQUENCE_COMPLETED, FAILED, or CANCELLED
     long durationMs = result.executionTime.count();
     if (result.status == SequenceStatus::COMPLETED) {
-        publishEvent(std::make_shared<mxrc::core::event::SequenceCompletedEvent>(
+        publishEvent(event::EventPool<event::SequenceCompletedEvent>::make(
             definition.id, definition.name, result.completedSteps, result.totalSteps, durationMs));
     } else if (result.status == SequenceStatus::FAILED) {
         int failedStepIndex = result.completedSteps;  // 실패한 스텝은 completedSteps 이후
-        publishEvent(std::make_shared<mxrc::core::event::SequenceFailedEvent>(
+        publishEvent(event::EventPool<event::SequenceFailedEvent>::make(
             definition.id, definition.name, result.errorMessage, result.completedSteps,
             result.totalSteps, failedStepIndex, durationMs));
     } else if (result.status == SequenceStatus::CANCELLED) {
-        publishEvent(std::make_shared<mxrc::core::event::SequenceCancelledEvent>(
+        publishEvent(event::EventPool<event::SequenceCancelledEvent>::make(
             definition.id, definition.name, result.completedSteps, result.totalSteps, durationMs));
     }
 
@@ -161,7 +162,7 @@ SequenceResult SequenceEngine::executeSequential(
         );
 
         // 이벤트 발행: SEQUENCE_STEP_STARTED
-        publishEvent(std::make_shared<mxrc::core::event::SequenceStepStartedEvent>(
+        publishEvent(event::EventPool<event::SequenceStepStartedEvent>::make(
             definition.id, step.actionId, step.actionType, static_cast<int>(i), definition.steps.size()));
 
         try {
@@ -203,7 +204,7 @@ SequenceResult SequenceEngine::executeSequential(
                     actionSucceeded = true;
 
                     // 이벤트 발행: SEQUENCE_STEP_COMPLETED (성공 시에만)
-                    publishEvent(std::make_shared<mxrc::core::event::SequenceStepCompletedEvent>(
+                    publishEvent(event::EventPool<event::SequenceStepCompletedEvent>::make(
                         definition.id, step.actionId, step.actionType, static_cast<int>(i), definition.steps.size()));
                 } else {
                     // 재시도 정책 확인
@@ -1,6 +1,7 @@
 #include "core/task/core/TaskExecutor.h"
 #include "core/sequence/dto/SequenceDefinition.h"
 #include "interfaces/IEventBus.h"
+#include "util/EventPool.h"
 #include "dto/TaskEvents.h"
 #include <chrono>
 #include <sstream>
@@ -54,7 +55,7 @@ TaskExecution TaskExecutor::execute(
                         definition.id, taskStatusToString(prevStatus));
 
     // 이벤트 발행: TASK_STARTED
-    publishEvent(std::make_shared<mxrc::core::event::TaskStartedEvent>(
+    publishEvent(event::EventPool<event::TaskStartedEvent>::make(
         definition.id,
         definition.name,
         taskExecutionModeToString(definition.executionMode),
@@ -90,14 +91,14 @@ TaskExecution TaskExecutor::execute(
 
     // 이벤트 발행: Task 완료 상태
     if (result.status == TaskStatus::COMPLETED) {
-        publishEvent(std::make_shared<mxrc::core::event::TaskCompletedEvent>(
+        publishEvent(event::EventPool<event::TaskCompletedEvent>::make(
             definition.id,
             definition.name,
             elapsed.count(),
             result.progress * 100.0  // progressPercent
         ));
     } else if (result.status == TaskStatus::FAILED) {
-        publishEvent(std::make_shared<mxrc::core::event::TaskFailedEvent>(
+        publishEvent(event::EventPool<event::TaskFailedEvent>::make(
             definition.id,
             definition.name,
             result.errorMessage,
@@ -105,7 +106,7 @@ TaskExecution TaskExecutor::execute(
             result.progress * 100.0  // progressPercent
         ));
     } else if (result.status == TaskStatus::CANCELLED) {
-        publishEvent(std::make_shared<mxrc::core::event::TaskCancelledEvent>(
+        publishEvent(event::EventPool<event::TaskCancelledEvent>::make(
             definition.id,
             definition.name,
             elapsed.count(),
@@ -116,6 +116,112 @@ TEST_F(RTEtherCATCycleTest, ReadVelocitySensor) {
     EXPECT_DOUBLE_EQ(expected_vel, stored_vel);
 }
 
+// 테스트 3b: 센서 타입은 등록 시 해석 (알 수 없는 타입 거부)
+TEST_F(RTEtherCATCycleTest, RegisterSensorResolvesTypeAtConfiguration) {
+    EXPECT_NE(0, cycle_->registerSensor(1, DataKey::ETHERCAT_SENSOR_VELOCITY_0, "SPEED"));
+
+    RTEtherCATCycle::SensorType type;
+    ASSERT_EQ(0, RTEtherCATCycle::parseSensorType("AI", type));
+    EXPECT_EQ(RTEtherCATCycle::SensorType::AI, type);
+    EXPECT_STREQ("TORQUE", RTEtherCATCycle::sensorTypeName(RTEtherCATCycle::SensorType::TORQUE));
+
+    PDOMapping vel_mapping;
+    vel_mapping.direction = PDODirection::INPUT;
+    vel_mapping.index = 0x1A01;
+    vel_mapping.subindex = 0x01;
+    vel_mapping.data_type = PDODataType::DOUBLE;
+    vel_mapping.offset = 0;
+    mock_config_->addPDOMapping(1, vel_mapping);
+
+    double expected_vel = -2.25;
+    mock_master_->setDomainData(0, &expected_vel, sizeof(double));
+
+    ASSERT_EQ(0, cycle_->registerSensor(1, DataKey::ETHERCAT_SENSOR_VELOCITY_0,
+                                        RTEtherCATCycle::SensorType::VELOCITY));
+    cycle_->execute(context_);
+
+    double stored_vel;
+    ASSERT_EQ(0, data_store_->getDouble(DataKey::ETHERCAT_SENSOR_VELOCITY_0, stored_vel));
+    EXPECT_DOUBLE_EQ(expected_vel, stored_vel);
+    EXPECT_EQ(1u, cycle_->getReadSuccessCount());
+}
+
+// 테스트 3c: Process image 연결 - 입력 채널이 RTDataStore 뷰로 노출 (채널별 저장 없음)
+TEST_F(RTEtherCATCycleTest, ProcessImageViewsExposeInputChannels) {
+    PDOMapping pos_mapping;
+    pos_mapping.direction = PDODirection::INPUT;
+    pos_mapping.index = 0x1A00;
+    pos_mapping.subindex = 0x01;
+    pos_mapping.data_type = PDODataType::INT32;
+    pos_mapping.offset = 40;
+    mock_config_->addPDOMapping(4, pos_mapping);
+
+    sensor_manager_->addInputChannel(4, 0x1A00, 0x01, DataKey::ETHERCAT_SENSOR_POSITION_1, 0.01);
+
+    // Mock master는 외부 메모리를 지원하지 않으므로 복사 모드
+    ASSERT_EQ(1, cycle_->attachProcessImage(*data_store_));
+    EXPECT_TRUE(data_store_->isView(DataKey::ETHERCAT_SENSOR_POSITION_1));
+
+    int32_t counts = 31400;
+    mock_master_->setDomainData(40, &counts, sizeof(counts));
+    cycle_->execute(context_);
+
+    double position = 0.0;
+    ASSERT_EQ(0, data_store_->getDouble(DataKey::ETHERCAT_SENSOR_POSITION_1, position));
+    EXPECT_DOUBLE_EQ(314.0, position);
+
+    // 다음 cycle 값 반영
+    counts = -500;
+    mock_master_->setDomainData(40, &counts, sizeof(counts));
+    cycle_->execute(context_);
+    ASSERT_EQ(0, data_store_->getDouble(DataKey::ETHERCAT_SENSOR_POSITION_1, position));
+    EXPECT_DOUBLE_EQ(-5.0, position);
+}
+
+// 테스트 3d: Process image 연결 - 등록된 position 센서가 image 뷰에서 읽힘
+TEST_F(RTEtherCATCycleTest, ProcessImageServesRegisteredPositionSensor) {
+    PDOMapping pos_mapping;
+    pos_mapping.direction = PDODirection::INPUT;
+    pos_mapping.index = 0x1A00;
+    pos_mapping.subindex = 0x01;
+    pos_mapping.data_type = PDODataType::INT32;
+    pos_mapping.offset = 16;
+    mock_config_->addPDOMapping(2, pos_mapping);
+
+    PDOMapping vel_mapping = pos_mapping;
+    vel_mapping.subindex = 0x02;
+    vel_mapping.offset = 20;
+    mock_config_->addPDOMapping(2, vel_mapping);
+
+    ASSERT_EQ(0, cycle_->registerPositionSensor(2, DataKey::ETHERCAT_SENSOR_POSITION_0,
+                                                DataKey::ETHERCAT_SENSOR_VELOCITY_0, 0.5));
+
+    ASSERT_EQ(1, cycle_->attachProcessImage(*data_store_));
+    EXPECT_TRUE(data_store_->isView(DataKey::ETHERCAT_SENSOR_POSITION_0));
+    EXPECT_TRUE(data_store_->isView(DataKey::ETHERCAT_SENSOR_VELOCITY_0));
+
+    int32_t counts[2] = {2000, -40};
+    mock_master_->setDomainData(16, counts, sizeof(counts));
+    cycle_->execute(context_);
+
+    // 센서 경로는 image 뷰 (cycle마다 읽어서 저장하지 않음)
+    EXPECT_EQ(0u, cycle_->getReadSuccessCount());
+    double position = 0.0;
+    double velocity = 0.0;
+    ASSERT_EQ(0, data_store_->getDouble(DataKey::ETHERCAT_SENSOR_POSITION_0, position));
+    ASSERT_EQ(0, data_store_->getDouble(DataKey::ETHERCAT_SENSOR_VELOCITY_0, velocity));
+    EXPECT_DOUBLE_EQ(1000.0, position);
+    EXPECT_DOUBLE_EQ(-20.0, velocity);
+    EXPECT_TRUE(data_store_->isFresh(DataKey::ETHERCAT_SENSOR_POSITION_0, 1000000000ULL));
+
+    // 다음 cycle 값 반영
+    counts[0] = -6;
+    mock_master_->setDomainData(16, counts, sizeof(counts));
+    cycle_->execute(context_);
+    ASSERT_EQ(0, data_store_->getDouble(DataKey::ETHERCAT_SENSOR_POSITION_0, position));
+    EXPECT_DOUBLE_EQ(-3.0, position);
+}
+
 // 테스트 4: Torque 센서 읽기 (torque_z만)
 TEST_F(RTEtherCATCycleTest, ReadTorqueSensor) {
     // Arrange: torque_z만 매핑 (subindex 0x06)
@@ -464,3 +570,91 @@ TEST_F(RTEtherCATCycleTest, StateMachineIntegrationTransitionsToSafeMode) {
     EXPECT_EQ(mxrc::core::rt::RTState::SAFE_MODE, state_machine->getState());
     EXPECT_EQ(11ULL, cycle_with_events->getErrorCount());
 }
+
+// 테스트 15: 분할 실행 - send와 receive 사이에 다른 action 실행
+TEST_F(RTEtherCATCycleTest, SplitPhaseSendThenReceive) {
+    // Arrange: 위치 센서 (offset 0)
+    PDOMapping pos_mapping;
+    pos_mapping.direction = PDODirection::INPUT;
+    pos_mapping.index = 0x1A00;
+    pos_mapping.subindex = 0x01;
+    pos_mapping.data_type = PDODataType::INT32;
+    pos_mapping.offset = 0;
+    mock_config_->addPDOMapping(0, pos_mapping);
+
+    cycle_->registerSensor(0, DataKey::ETHERCAT_SENSOR_POSITION_0, "POSITION");
+
+    int32_t pos = 500;
+    mock_master_->setDomainData(0, &pos, sizeof(int32_t));
+    data_store_->setDouble(DataKey::ETHERCAT_SENSOR_POSITION_0, -1.0);
+    cycle_->setReceiveDelay(200000);  // 200us
+
+    // 송신 없이 수신 불가
+    mock_master_->resetCallFlags();
+    EXPECT_EQ(-1, cycle_->executeReceive(context_));
+    EXPECT_FALSE(mock_master_->wasReceiveCalled());
+
+    // Act 1: send만 수행 → 센서 미갱신
+    ASSERT_EQ(0, cycle_->executeSend(context_));
+    EXPECT_TRUE(mock_master_->wasSendCalled());
+    EXPECT_FALSE(mock_master_->wasReceiveCalled());
+
+    double stored_pos = 0.0;
+    ASSERT_EQ(0, data_store_->getDouble(DataKey::ETHERCAT_SENSOR_POSITION_0, stored_pos));
+    EXPECT_DOUBLE_EQ(-1.0, stored_pos);
+    EXPECT_EQ(0ULL, cycle_->getTotalCycles());
+
+    // Act 2: receive는 최소 지연 이후 수행되고 센서 저장
+    ASSERT_EQ(0, cycle_->executeReceive(context_));
+    EXPECT_TRUE(mock_master_->wasReceiveCalled());
+    EXPECT_GE(cycle_->getLastWireTimeNs(), 200000ULL);
+
+    ASSERT_EQ(0, data_store_->getDouble(DataKey::ETHERCAT_SENSOR_POSITION_0, stored_pos));
+    EXPECT_DOUBLE_EQ(500.0, stored_pos);
+    EXPECT_EQ(1ULL, cycle_->getTotalCycles());
+
+    // 같은 프레임을 두 번 수신하지 않음
+    EXPECT_EQ(-1, cycle_->executeReceive(context_));
+    EXPECT_EQ(1ULL, cycle_->getTotalCycles());
+    EXPECT_EQ(0ULL, cycle_->getErrorCount());
+}
+
+// 테스트 16: 분할 실행 - send 실패 시 receive 생략
+TEST_F(RTEtherCATCycleTest, SplitPhaseSkipsReceiveAfterSendFailure) {
+    mock_master_->deactivate();
+    mock_master_->resetCallFlags();
+
+    EXPECT_EQ(-1, cycle_->executeSend(context_));
+    EXPECT_EQ(-1, cycle_->executeReceive(context_));
+
+    EXPECT_FALSE(mock_master_->wasReceiveCalled());
+    EXPECT_EQ(1ULL, cycle_->getErrorCount());  // send 실패만 보고
+    EXPECT_EQ(0ULL, cycle_->getTotalCycles());
+}
+
+// 테스트 17: 연속 에러 이벤트는 배치로 발행, 정상 cycle에서 나머지 발행
+TEST_F(RTEtherCATCycleTest, ConsecutiveErrorEventsArePublishedInBatches) {
+    auto event_bus = std::make_shared<mxrc::core::event::EventBus>();
+    auto cycle_with_events = std::make_unique<RTEtherCATCycle>(
+        mock_master_, sensor_manager_, nullptr, event_bus, nullptr);
+
+    // Act: 20회 연속 에러
+    mock_master_->deactivate();
+    for (int i = 0; i < 20; ++i) {
+        cycle_with_events->execute(context_);
+    }
+
+    // Assert: 첫 이벤트 즉시 + 16개 배치 1회, 3개는 대기 중
+    EXPECT_EQ(20ULL, cycle_with_events->getErrorCount());
+    EXPECT_EQ(17u, event_bus->getStats().publishedEvents.load());
+
+    // 정상 cycle로 에러 구간 종료 → 남은 이벤트 발행
+    mock_master_->activate();
+    cycle_with_events->execute(context_);
+    EXPECT_EQ(20u, event_bus->getStats().publishedEvents.load());
+
+    // 다음 에러 구간의 첫 이벤트는 다시 즉시 발행
+    mock_master_->deactivate();
+    cycle_with_events->execute(context_);
+    EXPECT_EQ(21u, event_bus->getStats().publishedEvents.load());
+}
@@ -5,6 +5,11 @@
 #include "core/fieldbus/factory/FieldbusFactory.h"
 #include "core/fieldbus/interfaces/IFieldbus.h"
 #include "core/fieldbus/drivers/MockDriver.h"
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <span>
 #include <vector>
 #include <thread>
 #include <chrono>
@@ -306,3 +311,340 @@ TEST_F(FieldbusIntegrationTest, RepeatedStartStop) {
         EXPECT_EQ(fieldbus_->getStatus(), FieldbusStatus::STOPPED);
     }
 }
+
+// 호출자 버퍼(span) 및 bit-packed 디지털 I/O 경로 테스트
+TEST_F(FieldbusIntegrationTest, MockDriver_SpanAndPackedIO) {
+    FieldbusConfig config;
+    config.protocol = "Mock";
+    config.config_file = "test.yaml";
+    config.cycle_time_us = 1000;
+    config.device_count = 10;  // 8의 배수가 아닌 채널 수
+
+    fieldbus_ = FieldbusFactory::create(config);
+    ASSERT_NE(fieldbus_, nullptr);
+    ASSERT_TRUE(fieldbus_->initialize());
+    ASSERT_TRUE(fieldbus_->start());
+
+    // 액추에이터 → 센서 에코 (사인파 ±0.1)
+    std::array<double, 10> commands{};
+    for (size_t i = 0; i < commands.size(); ++i) {
+        commands[i] = static_cast<double>(i);
+    }
+    EXPECT_TRUE(fieldbus_->writeActuators(std::span<const double>(commands)));
+
+    std::array<double, 10> sensors{};
+    EXPECT_TRUE(fieldbus_->readSensors(std::span<double>(sensors)));
+    for (size_t i = 0; i < sensors.size(); ++i) {
+        EXPECT_NEAR(commands[i], sensors[i], 0.1 + 1e-9);
+    }
+
+    // 크기 불일치는 실패 (resize 없음)
+    std::array<double, 4> short_buffer{};
+    EXPECT_FALSE(fieldbus_->readSensors(std::span<double>(short_buffer)));
+    EXPECT_FALSE(fieldbus_->writeActuators(std::span<const double>(short_buffer)));
+
+    // 디지털 I/O: 10채널 = 2바이트
+    ASSERT_EQ(2u, packedBitBytes(config.device_count));
+    std::array<uint8_t, 2> outputs = {0xA5, 0xFF};  // 패딩 비트 포함
+    EXPECT_TRUE(fieldbus_->writeDigitalOutputs(std::span<const uint8_t>(outputs)));
+
+    std::array<uint8_t, 2> inputs = {0xFF, 0xFF};
+    EXPECT_TRUE(fieldbus_->readDigitalInputs(std::span<uint8_t>(inputs)));
+    std::vector<bool> input_bits;
+    EXPECT_TRUE(fieldbus_->readDigitalInputs(input_bits));
+    ASSERT_EQ(config.device_count, input_bits.size());
+    for (size_t i = 0; i < input_bits.size(); ++i) {
+        EXPECT_EQ(input_bits[i], static_cast<bool>((inputs[i / 8] >> (i % 8)) & 1u));
+    }
+
+    std::array<uint8_t, 1> short_bits{};
+    EXPECT_FALSE(fieldbus_->readDigitalInputs(std::span<uint8_t>(short_bits)));
+    EXPECT_FALSE(fieldbus_->writeDigitalOutputs(std::span<const uint8_t>(short_bits)));
+}
+
+// 대량 채널 batch simulation: generator 범위별 파형 + 빈 구간 에코
+TEST_F(FieldbusIntegrationTest, MockDriver_BatchSimulationGenerators) {
+    constexpr size_t CHANNELS = 4096;
+    FieldbusConfig config;
+    config.protocol = "Mock";
+    config.cycle_time_us = 1000;
+
+    MockDriver driver(config, CHANNELS);
+
+    MockSimulationConfig sim;
+    MockSignalGenerator sine;
+    sine.first_channel = 0;
+    sine.channel_count = 1024;
+    sine.amplitude = 2.0;
+    sine.phase_per_cycle = 0.05;
+    sine.phase_step = 0.001;
+    sine.echo_actuators = false;
+    sim.generators.push_back(sine);
+
+    MockSignalGenerator square;
+    square.type = MockSignalType::SQUARE;
+    square.first_channel = 1024;
+    square.channel_count = 1024;
+    square.amplitude = 1.0;
+    square.offset = 5.0;
+    square.echo_actuators = false;
+    sim.generators.push_back(square);
+
+    MockSignalGenerator ramp;
+    ramp.type = MockSignalType::RAMP;
+    ramp.first_channel = 2048;
+    ramp.channel_count = 1024;
+    ramp.amplitude = 10.0;
+    ramp.phase_per_cycle = 2.0 * 3.141592653589793 / 8.0;  // 8 cycle 주기
+    ramp.phase_step = 0.0;
+    ramp.echo_actuators = false;
+    sim.generators.push_back(ramp);
+    // 3072..4095: generator 없음 → 액추에이터 에코
+
+    // 겹치는 범위는 거부
+    MockSimulationConfig overlapping = sim;
+    overlapping.generators[1].first_channel = 1000;
+    EXPECT_FALSE(driver.setSimulationConfig(overlapping));
+    ASSERT_TRUE(driver.setSimulationConfig(sim));
+
+    ASSERT_TRUE(driver.initialize());
+    ASSERT_TRUE(driver.start());
+
+    std::vector<double> commands(CHANNELS, 7.0);
+    ASSERT_TRUE(driver.writeActuators(std::span<const double>(commands)));
+
+    std::vector<double> sensors(CHANNELS);
+    constexpr uint64_t CYCLES = 5000;  // phasor 재정규화 구간 포함
+    for (uint64_t cycle = 0; cycle < CYCLES; ++cycle) {
+        ASSERT_TRUE(driver.readSensors(std::span<double>(sensors)));
+    }
+
+    for (size_t ch = 0; ch < 1024; ch += 97) {
+        double expected = 2.0 * std::sin(CYCLES * 0.05 + ch * 0.001);
+        EXPECT_NEAR(expected, sensors[ch], 1e-9);
+    }
+    for (size_t ch = 1024; ch < 2048; ++ch) {
+        ASSERT_TRUE(sensors[ch] == 4.0 || sensors[ch] == 6.0);
+    }
+    // 5000 % 8 == 0 → 톱니파 위상 0
+    EXPECT_NEAR(0.0, std::fmod(sensors[2048], 10.0), 1e-6);
+    for (size_t ch = 3072; ch < CHANNELS; ++ch) {
+        ASSERT_DOUBLE_EQ(7.0, sensors[ch]);
+    }
+    EXPECT_EQ(CYCLES, driver.getCycleCount());
+}
+
+// NOISE 파형: offset ± amplitude 범위, 채널/cycle마다 다른 값
+TEST_F(FieldbusIntegrationTest, MockDriver_NoiseGeneratorUsesAmplitude) {
+    constexpr size_t CHANNELS = 256;
+    FieldbusConfig config;
+    config.protocol = "Mock";
+    config.cycle_time_us = 1000;
+
+    MockDriver driver(config, CHANNELS);
+
+    MockSimulationConfig sim;
+    MockSignalGenerator noise;
+    noise.type = MockSignalType::NOISE;
+    noise.amplitude = 2.0;
+    noise.offset = 10.0;
+    noise.noise = 0.0;
+    noise.echo_actuators = false;
+    sim.generators.push_back(noise);
+    ASSERT_TRUE(driver.setSimulationConfig(sim));
+
+    ASSERT_TRUE(driver.initialize());
+    ASSERT_TRUE(driver.start());
+
+    std::vector<double> first(CHANNELS);
+    std::vector<double> second(CHANNELS);
+    ASSERT_TRUE(driver.readSensors(std::span<double>(first)));
+    ASSERT_TRUE(driver.readSensors(std::span<double>(second)));
+
+    double min_value = first[0];
+    double max_value = first[0];
+    size_t changed = 0;
+    for (size_t ch = 0; ch < CHANNELS; ++ch) {
+        EXPECT_GE(first[ch], 8.0);
+        EXPECT_LT(first[ch], 12.0);
+        min_value = std::min(min_value, first[ch]);
+        max_value = std::max(max_value, first[ch]);
+        if (first[ch] != second[ch]) {
+            changed++;
+        }
+    }
+    EXPECT_GT(max_value - min_value, 2.0);
+    EXPECT_GT(changed, CHANNELS / 2);
+}
+
+// 비상 정지: 호출 즉시 출력 해제, 이후 쓰기 거부
+TEST_F(FieldbusIntegrationTest, MockDriver_EmergencyStopClearsOutputsOnCycleThread) {
+    constexpr size_t CHANNELS = 16;
+    FieldbusConfig config;
+    config.protocol = "Mock";
+    config.cycle_time_us = 1000;
+
+    MockDriver driver(config, CHANNELS);
+
+    // 전 채널 에코만 (파형 없음)
+    MockSimulationConfig sim;
+    MockSignalGenerator echo;
+    echo.type = MockSignalType::CONSTANT;
+    echo.amplitude = 0.0;
+    sim.generators.push_back(echo);
+    ASSERT_TRUE(driver.setSimulationConfig(sim));
+
+    ASSERT_TRUE(driver.initialize());
+    ASSERT_TRUE(driver.start());
+
+    std::vector<double> commands(CHANNELS, 7.0);
+    ASSERT_TRUE(driver.writeActuators(std::span<const double>(commands)));
+    std::array<uint8_t, 2> outputs{0xFF, 0xFF};
+    ASSERT_TRUE(driver.writeDigitalOutputs(std::span<const uint8_t>(outputs)));
+
+    // emergencyStop()은 플래그만 설정, 다음 cycle 스레드 호출(거부된 쓰기)에서 해제
+    ASSERT_TRUE(driver.emergencyStop());
+
+    EXPECT_FALSE(driver.writeActuators(std::span<const double>(commands)));
+    EXPECT_FALSE(driver.writeDigitalOutputs(std::span<const uint8_t>(outputs)));
+    EXPECT_FALSE(driver.writeDigitalOutputs(std::vector<bool>(CHANNELS, true)));
+    ASSERT_TRUE(driver.getLastError().has_value());
+
+    std::vector<double> sensors(CHANNELS, -1.0);
+    ASSERT_TRUE(driver.readSensors(std::span<double>(sensors)));
+    for (double value : sensors) {
+        EXPECT_EQ(0.0, value);
+    }
+
+    // 재시작 후 에코: 정지 전 명령(7.0)이 남아 있지 않음
+    ASSERT_TRUE(driver.stop());
+    ASSERT_TRUE(driver.start());
+    ASSERT_TRUE(driver.readSensors(std::span<double>(sensors)));
+    for (double value : sensors) {
+        EXPECT_EQ(0.0, value);
+    }
+}
+
+TEST_F(FieldbusIntegrationTest, MockDriver_SinePhasorStaysAccurateOverLongRuns) {
+    constexpr size_t CHANNELS = 8;
+    FieldbusConfig config;
+    config.protocol = "Mock";
+    config.cycle_time_us = 1000;
+
+    MockDriver driver(config, CHANNELS);
+
+    MockSimulationConfig sim;
+    MockSignalGenerator sine;
+    sine.type = MockSignalType::SINE;
+    sine.amplitude = 1.0;
+    sine.phase_per_cycle = 0.0123;
+    sine.phase_step = 0.25;
+    sine.echo_actuators = false;
+    sim.generators.push_back(sine);
+    ASSERT_TRUE(driver.setSimulationConfig(sim));
+
+    ASSERT_TRUE(driver.initialize());
+    ASSERT_TRUE(driver.start());
+
+    // 매 cycle 재정규화: 주기적 재계산 없이 진폭/위상 오차가 누적되지 않음
+    constexpr int TICKS = 100000;
+    std::vector<double> sensors(CHANNELS);
+    for (int tick = 1; tick <= TICKS; ++tick) {
+        ASSERT_TRUE(driver.readSensors(std::span<double>(sensors)));
+    }
+    for (size_t ch = 0; ch < CHANNELS; ++ch) {
+        double expected = std::sin(TICKS * sine.phase_per_cycle + ch * sine.phase_step);
+        EXPECT_NEAR(expected, sensors[ch], 1e-9) << "channel " << ch;
+    }
+}
+
+// YAML 설정: 채널 수, 노이즈, 지연 분포
+TEST_F(FieldbusIntegrationTest, MockDriver_BatchSimulationFromYaml) {
+    const std::string path = ::testing::TempDir() + "mock_driver_batch.yaml";
+    {
+        std::ofstream out(path);
+        out << "device_count: 2000\n"
+            << "batch_simulation:\n"
+            << "  seed: 7\n"
+            << "  generators:\n"
+            << "    - type: \"noise\"\n"
+            << "      first_channel: 0\n"
+            << "      channel_count: 1000\n"
+            << "      amplitude: 0.2\n"
+            << "      offset: 1.0\n"
+            << "      noise: 0.3\n"
+            << "      echo_actuators: false\n"
+            << "  latency:\n"
+            << "    distribution: \"uniform\"\n"
+            << "    mean_us: 200\n"
+            << "    spread_us: 50\n"
+            << "    max_us: 300\n";
+    }
+
+    FieldbusConfig config;
+    config.protocol = "Mock";
+    config.config_file = path;
+    config.cycle_time_us = 1000;
+
+    fieldbus_ = FieldbusFactory::create(config);
+    ASSERT_NE(fieldbus_, nullptr);
+    ASSERT_TRUE(fieldbus_->initialize());
+    ASSERT_EQ(2000u, fieldbus_->getDeviceCount());
+    ASSERT_TRUE(fieldbus_->start());
+
+    auto* driver = dynamic_cast<MockDriver*>(fieldbus_.get());
+    ASSERT_NE(driver, nullptr);
+
+    std::vector<double> sensors(2000);
+    auto begin = std::chrono::steady_clock::now();
+    constexpr int CYCLES = 10;
+    for (int cycle = 0; cycle < CYCLES; ++cycle) {
+        ASSERT_TRUE(fieldbus_->readSensors(std::span<double>(sensors)));
+        EXPECT_GE(driver->getLastSimulatedLatencyNs(), 150000u);
+        EXPECT_LE(driver->getLastSimulatedLatencyNs(), 250000u);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - begin;
+    EXPECT_GE(elapsed, std::chrono::microseconds(150 * CYCLES));
+
+    double min_value = sensors[0];
+    double max_value = sensors[0];
+    for (size_t ch = 0; ch < 1000; ++ch) {
+        min_value = std::min(min_value, sensors[ch]);
+        max_value = std::max(max_value, sensors[ch]);
+    }
+    EXPECT_GE(min_value, 0.5);
+    EXPECT_LE(max_value, 1.5);
+    EXPECT_GT(max_value - min_value, 0.5);  // 채널마다 다른 노이즈 (amplitude + noise)
+
+    // 잘못된 파일은 초기화 실패
+    std::ofstream(path) << "batch_simulation:\n  generators:\n    - type: \"triangle\"\n";
+    MockDriver invalid(config, 4);
+    EXPECT_FALSE(invalid.initialize());
+    std::remove(path.c_str());
+}
+
+// 저장소의 config/mock-driver.yaml 로드 (기본 동작 유지)
+TEST_F(FieldbusIntegrationTest, MockDriver_LoadsRepositoryConfig) {
+    std::string root = __FILE__;
+    for (int i = 0; i < 4; ++i) {
+        root = root.substr(0, root.find_last_of('/'));
+    }
+
+    FieldbusConfig config;
+    config.protocol = "Mock";
+    config.config_file = root + "/config/mock-driver.yaml";
+    config.cycle_time_us = 1000;
+
+    MockDriver driver(config, 4);
+    ASSERT_TRUE(driver.initialize());
+    EXPECT_EQ(64u, driver.getDeviceCount());
+    ASSERT_TRUE(driver.start());
+
+    std::vector<double> commands(64, 3.0);
+    ASSERT_TRUE(driver.writeActuators(std::span<const double>(commands)));
+    std::vector<double> sensors(64);
+    ASSERT_TRUE(driver.readSensors(std::span<double>(sensors)));
+    for (double value : sensors) {
+        EXPECT_NEAR(3.0, value, 0.1 + 1e-9);
+    }
+}
@@ -62,6 +62,14 @@ public:
         return error_count_;
     }
 
+    uint8_t* getProcessImage() override {
+        return domain_data_.data();
+    }
+
+    size_t getProcessImageSize() const override {
+        return domain_data_.size();
+    }
+
     // 테스트 헬퍼: PDO domain 데이터 설정
     void setDomainData(uint32_t offset, const void* data, size_t size) {
         if (offset + size <= domain_data_.size()) {
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include "core/ethercat/core/EtherCATCycleStats.h"
+#include "core/ethercat/core/SimulatedEtherCATMaster.h"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+using namespace mxrc::ethercat;
+
+namespace {
+
+// 저장소 루트 기준 샘플 설정 (tests/unit/ethercat/ → 루트)
+std::string sampleConfigPath() {
+    std::string path = __FILE__;
+    for (int i = 0; i < 4; ++i) {
+        path = path.substr(0, path.find_last_of('/'));
+    }
+    return path + "/config/ethercat/slaves_sample.yaml";
+}
+
+} // namespace
+
+// 테스트 1: WKC 불일치, 프레임 손실, receive 에러, 지연 수신, slave bitmap, 히스토그램 집계
+TEST(EtherCATCycleStatsTest, RecordsCycleOutcomes) {
+    EtherCATCycleStats stats;
+    stats.setLateThreshold(100000);  // 100us
+
+    uint64_t slave_errors[EtherCATCycleStats::SLAVE_BITMAP_WORDS] = {};
+    slave_errors[1] = 1ULL << 6;  // slave 70
+
+    stats.recordReceive(12, 12, 50000, nullptr);         // 정상, 50us
+    stats.recordReceive(9, 12, 200000, slave_errors);    // 불일치 + 지연, 200us
+    stats.recordReceive(12, 12, 500, nullptr);           // 정상, 1us 미만
+    stats.recordFrameLoss(3000000);                      // 손실, 3ms
+    stats.recordReceiveError(20000);                     // receive 실패, 20us
+    stats.recordSendError();
+
+    EtherCATCycleStatsSnapshot snapshot;
+    ASSERT_TRUE(stats.readSnapshot(snapshot));
+
+    EXPECT_EQ(5u, snapshot.cycles);  // 손실/receive 에러 cycle 포함
+    EXPECT_EQ(1u, snapshot.wkc_mismatches);
+    EXPECT_EQ(1u, snapshot.lost_frames);
+    EXPECT_EQ(1u, snapshot.receive_errors);
+    EXPECT_EQ(2u, snapshot.late_receives);
+    EXPECT_EQ(1u, snapshot.send_errors);
+    EXPECT_EQ(0u, snapshot.last_wkc);
+    EXPECT_EQ(3000000u, snapshot.max_receive_latency_ns);
+
+    // slave 70: 현재 cycle은 정상, sticky/카운트에는 남음
+    EXPECT_FALSE(snapshot.isSlaveInError(70));
+    EXPECT_TRUE(snapshot.hasSlaveEverFailed(70));
+    EXPECT_FALSE(snapshot.hasSlaveEverFailed(69));
+    EXPECT_EQ(1u, snapshot.slave_error_counts[70]);
+
+    EXPECT_EQ(1u, snapshot.latency_histogram[0]);
+    EXPECT_EQ(1u, snapshot.latency_histogram[EtherCATCycleStats::latencyBucket(50000)]);
+    EXPECT_EQ(1u, snapshot.latency_histogram[EtherCATCycleStats::latencyBucket(200000)]);
+    EXPECT_EQ(1u, snapshot.latency_histogram[EtherCATCycleStats::latencyBucket(3000000)]);
+    EXPECT_EQ(1u, snapshot.latency_histogram[EtherCATCycleStats::latencyBucket(20000)]);
+
+    // bucket 경계: [2^(k-1), 2^k) us
+    EXPECT_EQ(0u, EtherCATCycleStats::latencyBucket(999));
+    EXPECT_EQ(1u, EtherCATCycleStats::latencyBucket(1000));
+    EXPECT_EQ(2u, EtherCATCycleStats::latencyBucket(2000));
+    EXPECT_EQ(2u, EtherCATCycleStats::latencyBucket(3999));
+    EXPECT_EQ(EtherCATCycleStats::LATENCY_BUCKETS - 1,
+              EtherCATCycleStats::latencyBucket(10000000000ULL));
+
+    stats.reset();
+    ASSERT_TRUE(stats.readSnapshot(snapshot));
+    EXPECT_EQ(0u, snapshot.cycles);
+    EXPECT_EQ(0u, snapshot.receive_errors);
+    EXPECT_FALSE(snapshot.hasSlaveEverFailed(70));
+    EXPECT_EQ(100000u, snapshot.late_threshold_ns);  // 설정은 유지
+}
+
+// 테스트 2: writer 갱신과 겹쳐도 snapshot은 일관됨 (cycles == 히스토그램 합)
+TEST(EtherCATCycleStatsTest, SnapshotIsConsistentUnderConcurrentWrites) {
+    EtherCATCycleStats stats;
+    std::atomic<bool> done{false};
+
+    std::thread writer([&]() {
+        for (uint64_t i = 0; i < 200000; ++i) {
+            stats.recordReceive(3, 3, (i % 64) * 1000, nullptr);
+        }
+        done.store(true);
+    });
+
+    int checked = 0;
+    while (!done.load()) {
+        EtherCATCycleStatsSnapshot snapshot;
+        if (!stats.readSnapshot(snapshot)) {
+            continue;
+        }
+        uint64_t sum = 0;
+        for (uint64_t count : snapshot.latency_histogram) {
+            sum += count;
+        }
+        ASSERT_EQ(snapshot.cycles, sum);
+        checked++;
+    }
+    writer.join();
+
+    EtherCATCycleStatsSnapshot snapshot;
+    ASSERT_TRUE(stats.readSnapshot(snapshot));
+    EXPECT_EQ(200000u, snapshot.cycles);
+    EXPECT_GT(checked, 0);
+}
+
+// 테스트 3: 공유 메모리 블록을 시뮬레이션 master에 연결, Non-RT 측에서 읽기
+TEST(EtherCATCycleStatsTest, SimulatedMasterPublishesToSharedMemory) {
+    const std::string name = "/mxrc_test_ec_stats_" + std::to_string(getpid());
+    EtherCATCycleStatsShared::unlinkShared(name);
+
+    EtherCATCycleStatsShared rt_side;
+    ASSERT_EQ(0, rt_side.createShared(name));
+
+    SimulationConfig sim;
+    sim.wkc_error_rate = 0.5;
+    sim.frame_loss_rate = 0.1;
+    SimulatedEtherCATMaster master(sim);
+    ASSERT_EQ(0, master.loadFromFile(sampleConfigPath(), 8));
+    master.setLateReceiveThreshold(1000000000);  // 1s (지연 수신 없음)
+    ASSERT_EQ(0, master.useExternalCycleStats(rt_side.getStats()));
+    ASSERT_EQ(0, master.activate());
+    EXPECT_EQ(rt_side.getStats(), master.getCycleStats());
+
+    // 활성화 후 교체 불가 (RT 스레드가 갱신 중인 블록)
+    EtherCATCycleStats other;
+    EXPECT_EQ(-1, master.useExternalCycleStats(&other));
+    EXPECT_EQ(rt_side.getStats(), master.getCycleStats());
+
+    constexpr int CYCLES = 1000;
+    int failed_receives = 0;
+    for (int i = 0; i < CYCLES; ++i) {
+        ASSERT_EQ(0, master.send());
+        if (master.receive() != 0) {
+            failed_receives++;
+        }
+    }
+
+    EtherCATCycleStatsShared nonrt_side;
+    ASSERT_EQ(0, nonrt_side.openShared(name));
+    EtherCATCycleStatsSnapshot snapshot;
+    ASSERT_TRUE(nonrt_side.getStats()->readSnapshot(snapshot));
+
+    EXPECT_EQ(master.getFrameLossCount(), snapshot.lost_frames);
+    EXPECT_EQ(static_cast<uint64_t>(failed_receives), snapshot.lost_frames);
+    EXPECT_EQ(static_cast<uint64_t>(CYCLES), snapshot.cycles);
+    EXPECT_EQ(0u, snapshot.receive_errors);
+    EXPECT_EQ(master.getWKCErrorCount(), snapshot.wkc_mismatches);
+    EXPECT_EQ(master.getExpectedWorkingCounter(), snapshot.expected_wkc);
+    EXPECT_EQ(0u, snapshot.late_receives);
+
+    // 무응답 slave 카운트 합 == WKC 불일치 수, 범위 밖 slave는 없음
+    uint64_t slave_errors = 0;
+    for (uint16_t id = 0; id < EtherCATCycleStats::MAX_SLAVES; ++id) {
+        slave_errors += snapshot.slave_error_counts[id];
+        if (id >= 8) {
+            EXPECT_FALSE(snapshot.hasSlaveEverFailed(id));
+        }
+    }
+    EXPECT_EQ(snapshot.wkc_mismatches, slave_errors);
+
+    uint64_t histogram_total = 0;
+    for (uint64_t count : snapshot.latency_histogram) {
+        histogram_total += count;
+    }
+    EXPECT_EQ(static_cast<uint64_t>(CYCLES), histogram_total);
+
+    EtherCATCycleStatsShared::unlinkShared(name);
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include "core/ethercat/core/EtherCATMaster.h"
+#include "core/rt/util/DCPhaseTracker.h"
+#include <cstdint>
+
+using namespace mxrc::ethercat;
+using namespace mxrc::core::rt::util;
+
+// 테스트 1: 32비트 reference clock이 2^32 wrap을 넘어도 application time 기준으로 64비트 복원
+TEST(EtherCATMasterTest, ReferenceClockExtendsAcross32BitWrap) {
+    constexpr uint64_t WRAP = 1ULL << 32;
+    constexpr uint64_t CYCLE_NS = 1'000'000;
+
+    // application time 상위 비트가 0이 아닌 구간에서 wrap 직전 → 직후 (reference는 앞서거나 뒤처짐)
+    for (int64_t skew_ns : {3'000LL, -7'000LL}) {
+        uint64_t application_ns = 5 * WRAP - 10 * CYCLE_NS;
+        for (int cycle = 0; cycle < 20; ++cycle) {
+            uint64_t reference_ns = application_ns + skew_ns;
+            uint32_t reference_low = static_cast<uint32_t>(reference_ns);
+
+            EXPECT_EQ(reference_ns,
+                      EtherCATMaster::extendReferenceClock(reference_low, application_ns))
+                << "cycle=" << cycle << " skew=" << skew_ns;
+            application_ns += CYCLE_NS;
+        }
+        EXPECT_GT(application_ns, 5 * WRAP);
+    }
+
+    // application time의 하위 비트가 막 wrap한 직후, reference는 아직 wrap 전
+    EXPECT_EQ(3 * WRAP - 256, EtherCATMaster::extendReferenceClock(0xFFFFFF00u, 3 * WRAP + 100));
+    // application time은 wrap 전, reference는 이미 wrap 후
+    EXPECT_EQ(3 * WRAP + 50, EtherCATMaster::extendReferenceClock(50u, 3 * WRAP - 100));
+}
+
+// 테스트 2: 확장한 reference clock으로 계산한 SYNC0 위상은 64비트 시각 기준 위상과 일치
+TEST(EtherCATMasterTest, ReferenceClockPhaseIsConsistentAcrossWrap) {
+    DCPhaseConfig config;
+    config.sync0_cycle_ns = 1'000'000;
+    config.send_lead_ns = 100'000;  // 목표 위상 900us
+    DCPhaseTracker tracker(config);
+
+    // reference 위상 950us (목표보다 50us 늦음), 2^32 경계를 넘는 구간
+    constexpr uint64_t WRAP = 1ULL << 32;
+    uint64_t reference_ns = (2 * WRAP / config.sync0_cycle_ns) * config.sync0_cycle_ns + 950'000;
+    uint64_t application_ns = reference_ns - 4'000;
+    ASSERT_GT(reference_ns, 2 * WRAP);
+    ASSERT_LT(application_ns - 2 * config.sync0_cycle_ns, 2 * WRAP);
+
+    for (int cycle = 0; cycle < 4; ++cycle) {
+        uint64_t probe_application = application_ns + (cycle - 2) * config.sync0_cycle_ns;
+        uint64_t probe_reference = reference_ns + (cycle - 2) * config.sync0_cycle_ns;
+        uint64_t extended = EtherCATMaster::extendReferenceClock(
+            static_cast<uint32_t>(probe_reference), probe_application);
+        ASSERT_EQ(probe_reference, extended);
+
+        tracker.reset();
+        tracker.update(probe_application, extended);
+        EXPECT_EQ(50'000, tracker.getPhaseErrorNs()) << "cycle=" << cycle;
+    }
+
+    // 하위 32비트만으로는 위상이 어긋남 (2^32는 SYNC0 주기의 배수가 아님)
+    tracker.reset();
+    tracker.update(0, static_cast<uint32_t>(reference_ns));
+    EXPECT_NE(50'000, tracker.getPhaseErrorNs());
+}
+
+// 테스트 3: application time은 송신 시각 jitter와 무관하게 SYNC0 주기 격자를 따름
+TEST(EtherCATMasterTest, ApplicationTimeFollowsCycleGrid) {
+    constexpr uint64_t CYCLE = 1'000'000;
+    const uint64_t start = 5'000'000'000ULL;
+
+    // 첫 cycle: 격자 기준 없음 → 현재 시각
+    EXPECT_EQ(start, EtherCATMaster::nextApplicationTime(0, CYCLE, start));
+
+    // 송신이 늦어도(+30us) 이상적 cycle 시작 유지
+    EXPECT_EQ(start + CYCLE, EtherCATMaster::nextApplicationTime(start, CYCLE, start + CYCLE + 30'000));
+    EXPECT_EQ(start + CYCLE, EtherCATMaster::nextApplicationTime(start, CYCLE, start + CYCLE - 20'000));
+
+    // 2 cycle 놓침 → 주기 단위로 건너뜀
+    EXPECT_EQ(start + 3 * CYCLE,
+              EtherCATMaster::nextApplicationTime(start, CYCLE, start + 3 * CYCLE + 10'000));
+}
+
+// 테스트 4: cycle 시작 → 송신 지연을 빼면 위상 오차에 편향 없음
+TEST(EtherCATMasterTest, ReferenceClockAlignedToCycleStart) {
+    DCPhaseConfig config;
+    config.sync0_cycle_ns = 1'000'000;
+    config.send_lead_ns = 100'000;  // 목표 위상 900us
+    DCPhaseTracker tracker(config);
+
+    // cycle 시작 시 reference 위상 900us (목표와 일치), 프레임은 cycle 시작 40us 후 송신
+    const uint64_t cycle_start = 7'000'000'000ULL;
+    const uint64_t reference_at_start = 9'000'900'000ULL;
+    const uint64_t send_delay = 40'000;
+    const uint64_t latched = reference_at_start + send_delay;
+
+    tracker.update(cycle_start, latched);
+    EXPECT_EQ(static_cast<int64_t>(send_delay), tracker.getPhaseErrorNs());
+
+    uint64_t aligned = EtherCATMaster::alignReferenceClock(latched, cycle_start, cycle_start + send_delay);
+    EXPECT_EQ(reference_at_start, aligned);
+    tracker.reset();
+    tracker.update(cycle_start, aligned);
+    EXPECT_EQ(0, tracker.getPhaseErrorNs());
+
+    // 송신 시각이 application time 이전이면 보정 없음
+    EXPECT_EQ(latched, EtherCATMaster::alignReferenceClock(latched, cycle_start, cycle_start - 1));
+}
@@ -356,3 +356,69 @@ TEST_F(MotorCommandManagerTest, WriteCommandWhenMasterInactive) {
     // Assert
     EXPECT_EQ(0, result);
 }
+
+// 테스트: 컴파일된 접근 계획으로 Servo 명령 전송
+TEST_F(MotorCommandManagerTest, CompiledAccessPlanWritesServoCommand) {
+    PDOMapping control_mapping;
+    control_mapping.direction = PDODirection::OUTPUT;
+    control_mapping.index = 0x1603;
+    control_mapping.subindex = 0x01;
+    control_mapping.data_type = PDODataType::UINT16;
+    control_mapping.offset = 0;
+    mock_config_->addPDOMapping(21, control_mapping);
+
+    PDOMapping velocity_mapping;
+    velocity_mapping.direction = PDODirection::OUTPUT;
+    velocity_mapping.index = 0x1603;
+    velocity_mapping.subindex = 0x04;
+    velocity_mapping.data_type = PDODataType::DOUBLE;
+    velocity_mapping.offset = 8;
+    mock_config_->addPDOMapping(21, velocity_mapping);
+
+    ASSERT_EQ(0, manager_->compileAccessPlan({21}));
+
+    ServoDriverCommand cmd;
+    cmd.slave_id = 21;
+    cmd.control_mode = ControlMode::VELOCITY;
+    cmd.target_velocity = 2.5;
+    cmd.enable = true;
+
+    EXPECT_EQ(0, manager_->writeServoCommand(cmd));
+
+    uint16_t control_word = 0;
+    mock_master_->getDomainData(0, &control_word, sizeof(uint16_t));
+    EXPECT_EQ(0x0001 | (0x02 << 1), control_word);
+
+    double velocity = 0.0;
+    mock_master_->getDomainData(8, &velocity, sizeof(double));
+    EXPECT_DOUBLE_EQ(2.5, velocity);
+}
+
+// 테스트: 출력 채널 계획 RTDataStore → domain (scale, 정수 반올림)
+TEST_F(MotorCommandManagerTest, OutputChannelsWriteFromDataStore) {
+    using mxrc::core::rt::DataKey;
+
+    PDOMapping velocity_mapping;
+    velocity_mapping.direction = PDODirection::OUTPUT;
+    velocity_mapping.index = 0x1602;
+    velocity_mapping.subindex = 0x02;
+    velocity_mapping.data_type = PDODataType::INT32;
+    velocity_mapping.offset = 4;
+    mock_config_->addPDOMapping(22, velocity_mapping);
+
+    manager_->addOutputChannel(22, 0x1602, 0x02, DataKey::ETHERCAT_MOTOR_CMD_0, 60.0);
+    manager_->addOutputChannel(22, 0x1602, 0x03, DataKey::ETHERCAT_MOTOR_CMD_1);  // 매핑 없음
+    ASSERT_EQ(0, manager_->compileAccessPlan({22}));
+
+    mxrc::core::rt::RTDataStore store;
+    // 키에 값이 없으면 기록하지 않음
+    EXPECT_EQ(0, manager_->writeOutputChannels(store));
+
+    store.setDouble(DataKey::ETHERCAT_MOTOR_CMD_0, 12.34);  // rps → rpm
+    store.setDouble(DataKey::ETHERCAT_MOTOR_CMD_1, 1.0);
+    EXPECT_EQ(1, manager_->writeOutputChannels(store));
+
+    int32_t velocity = 0;
+    mock_master_->getDomainData(4, &velocity, sizeof(int32_t));
+    EXPECT_EQ(740, velocity);
+}
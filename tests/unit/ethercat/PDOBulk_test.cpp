@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include "core/ethercat/util/PDOBulk.h"
+#include "core/ethercat/util/PDOAccessPlan.h"
+#include "MockSlaveConfig.h"
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using namespace mxrc::ethercat;
+using namespace mxrc::ethercat::test;
+
+namespace {
+
+PDOMapping makeMapping(PDODirection direction, uint16_t index, uint8_t subindex,
+                       PDODataType type, uint32_t offset) {
+    PDOMapping mapping;
+    mapping.direction = direction;
+    mapping.index = index;
+    mapping.subindex = subindex;
+    mapping.data_type = type;
+    mapping.offset = offset;
+    return mapping;
+}
+
+} // namespace
+
+// 테스트 1: INT32 일괄 decode (SIMD 폭의 배수가 아닌 개수, 비정렬 시작 주소)
+TEST(PDOBulkTest, DecodeInt32Scaled) {
+    constexpr size_t N = 67;
+    std::vector<uint8_t> domain(N * 4 + 1);
+    for (size_t i = 0; i < N; ++i) {
+        int32_t raw = static_cast<int32_t>(i * 1000) - 30000;
+        std::memcpy(domain.data() + 1 + i * 4, &raw, sizeof(raw));
+    }
+
+    std::vector<double> out(N, 0.0);
+    PDOBulk::decodeInt32(domain.data() + 1, N, 0.001, out.data());
+
+    for (size_t i = 0; i < N; ++i) {
+        double expected = static_cast<double>(static_cast<int32_t>(i * 1000) - 30000) * 0.001;
+        EXPECT_DOUBLE_EQ(expected, out[i]) << "i=" << i;
+    }
+}
+
+// 테스트 2: INT32 일괄 encode - 반올림과 범위 포화 (NaN은 최솟값)
+TEST(PDOBulkTest, EncodeInt32RoundsAndSaturates) {
+    const double in[] = {1.4, 1.6, -2.6, 1e12, -1e12, std::nan(""), 123456.0};
+    constexpr size_t N = sizeof(in) / sizeof(in[0]);
+    uint8_t domain[N * 4];
+
+    PDOBulk::encodeInt32(in, N, 1.0, domain);
+
+    int32_t out[N];
+    std::memcpy(out, domain, sizeof(out));
+    EXPECT_EQ(1, out[0]);
+    EXPECT_EQ(2, out[1]);
+    EXPECT_EQ(-3, out[2]);
+    EXPECT_EQ(std::numeric_limits<int32_t>::max(), out[3]);
+    EXPECT_EQ(std::numeric_limits<int32_t>::min(), out[4]);
+    EXPECT_EQ(std::numeric_limits<int32_t>::min(), out[5]);
+    EXPECT_EQ(123456, out[6]);
+}
+
+// 테스트 3: 타입 분기 왕복 (INT16/FLOAT/DOUBLE)
+TEST(PDOBulkTest, RoundTripOtherTypes) {
+    const double values[] = {-3.0, 0.0, 7.0, 12.0, -250.0};
+    constexpr size_t N = sizeof(values) / sizeof(values[0]);
+
+    for (PDODataType type : {PDODataType::INT16, PDODataType::FLOAT, PDODataType::DOUBLE}) {
+        std::vector<uint8_t> domain(N * PDOBulk::typeSize(type));
+        double out[N] = {};
+
+        PDOBulk::encode(type, values, N, 2.0, domain.data());
+        PDOBulk::decode(type, domain.data(), N, 0.5, out);
+
+        for (size_t i = 0; i < N; ++i) {
+            EXPECT_DOUBLE_EQ(values[i], out[i]);
+        }
+    }
+
+    // 범위 밖 INT16은 포화
+    const double big = 40000.0;
+    int16_t raw = 0;
+    PDOBulk::encode(PDODataType::INT16, &big, 1, 1.0, reinterpret_cast<uint8_t*>(&raw));
+    EXPECT_EQ(std::numeric_limits<int16_t>::max(), raw);
+}
+
+// 테스트 4: 접근 계획의 연속 구간 구성 및 일괄 변환
+TEST(PDOBulkTest, AccessPlanMergesContiguousRuns) {
+    MockSlaveConfig config;
+    constexpr uint16_t AXES = 64;
+
+    // slave별 0x1A00:01 INT32 위치 (domain offset 연속), 0x1603:02 DOUBLE 목표 위치
+    for (uint16_t axis = 0; axis < AXES; ++axis) {
+        config.addPDOMapping(axis, makeMapping(PDODirection::INPUT, 0x1A00, 0x01,
+                                               PDODataType::INT32, axis * 4));
+        config.addPDOMapping(axis, makeMapping(PDODirection::OUTPUT, 0x1603, 0x02,
+                                               PDODataType::DOUBLE, 512 + axis * 8));
+    }
+
+    PDOAccessPlan inputs;
+    PDOAccessPlan outputs;
+    for (uint16_t axis = 0; axis < AXES; ++axis) {
+        inputs.add(axis, PDODirection::INPUT, 0x1A00, 0x01, PDO_NO_DATA_KEY, 0.5);
+        outputs.add(axis, PDODirection::OUTPUT, 0x1603, 0x02);
+    }
+    // 매핑 없는 엔트리는 구간을 끊음
+    inputs.add(99, PDODirection::INPUT, 0x1A00, 0x01);
+
+    ASSERT_EQ(1, inputs.compile(config));
+    ASSERT_EQ(0, outputs.compile(config));
+    ASSERT_EQ(1u, inputs.runs().size());
+    EXPECT_EQ(AXES, inputs.runs()[0].count);
+    ASSERT_EQ(1u, outputs.runs().size());
+
+    std::vector<uint8_t> domain(1024, 0);
+    for (int32_t axis = 0; axis < AXES; ++axis) {
+        int32_t counts = axis * 10 - 100;
+        std::memcpy(domain.data() + axis * 4, &counts, sizeof(counts));
+    }
+
+    std::vector<double> positions(inputs.size(), -1.0);
+    EXPECT_EQ(AXES, inputs.decodeInputs(domain.data(), positions.data(), positions.size()));
+    for (int32_t axis = 0; axis < AXES; ++axis) {
+        EXPECT_DOUBLE_EQ((axis * 10 - 100) * 0.5, positions[axis]);
+    }
+    EXPECT_DOUBLE_EQ(-1.0, positions[AXES]);  // 미해석 엔트리는 변경 없음
+
+    EXPECT_EQ(AXES, outputs.encodeOutputs(domain.data(), positions.data(), AXES));
+    double target = 0.0;
+    std::memcpy(&target, domain.data() + 512 + 10 * 8, sizeof(target));
+    EXPECT_DOUBLE_EQ(0.0, target);  // (10 * 10 - 100) * 0.5
+
+    // 배열 크기 부족
+    EXPECT_EQ(-1, inputs.decodeInputs(domain.data(), positions.data(), AXES));
+}
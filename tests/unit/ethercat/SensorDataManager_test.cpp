@@ -454,3 +454,86 @@ TEST_F(SensorDataManagerTest, WriteAnalogOutputOutOfRange) {
     // 범위 초과 시 실패
     EXPECT_NE(0, manager_->writeAnalogOutput(7, 0, data));
 }
+
+// 테스트 17: 컴파일된 접근 계획으로 센서 읽기 (설정 변경 없이 동일 결과)
+TEST_F(SensorDataManagerTest, CompiledAccessPlanReadsSensors) {
+    PDOMapping pos_mapping;
+    pos_mapping.direction = PDODirection::INPUT;
+    pos_mapping.index = 0x1A00;
+    pos_mapping.subindex = 0x01;
+    pos_mapping.data_type = PDODataType::INT32;
+    pos_mapping.offset = 0;
+    mock_config_->addPDOMapping(2, pos_mapping);
+
+    PDOMapping ai_mapping;
+    ai_mapping.direction = PDODirection::INPUT;
+    ai_mapping.index = 0x1A04;
+    ai_mapping.subindex = 0x02;  // channel 1
+    ai_mapping.data_type = PDODataType::FLOAT;
+    ai_mapping.offset = 4;
+    mock_config_->addPDOMapping(2, ai_mapping);
+
+    ASSERT_EQ(0, manager_->compileAccessPlan({2}));
+
+    int32_t pos = -4242;
+    float ai = 3.5f;
+    mock_master_->setDomainData(0, &pos, sizeof(int32_t));
+    mock_master_->setDomainData(4, &ai, sizeof(float));
+
+    PositionSensorData pos_data;
+    EXPECT_EQ(0, manager_->readPositionSensor(2, pos_data));
+    EXPECT_EQ(-4242, pos_data.position);
+    EXPECT_EQ(0, pos_data.velocity);
+
+    AnalogInputData ai_data;
+    EXPECT_EQ(0, manager_->readAnalogInput(2, 1, ai_data));
+    EXPECT_DOUBLE_EQ(3.5, ai_data.value);
+
+    // 컴파일된 slave에서 매핑 없는 PDO는 실패
+    AnalogInputData missing;
+    EXPECT_NE(0, manager_->readAnalogInput(2, 0, missing));
+    VelocitySensorData vel_data;
+    EXPECT_NE(0, manager_->readVelocitySensor(2, vel_data));
+}
+
+// 테스트 18: 입력 채널 계획 → RTDataStore (scale 적용)
+TEST_F(SensorDataManagerTest, InputChannelsStoreScaledValues) {
+    using mxrc::core::rt::DataKey;
+
+    PDOMapping pos_mapping;
+    pos_mapping.direction = PDODirection::INPUT;
+    pos_mapping.index = 0x1A00;
+    pos_mapping.subindex = 0x01;
+    pos_mapping.data_type = PDODataType::INT32;
+    pos_mapping.offset = 8;
+    mock_config_->addPDOMapping(3, pos_mapping);
+
+    PDOMapping ai_mapping;
+    ai_mapping.direction = PDODirection::INPUT;
+    ai_mapping.index = 0x1A04;
+    ai_mapping.subindex = 0x01;
+    ai_mapping.data_type = PDODataType::INT16;
+    ai_mapping.offset = 12;
+    mock_config_->addPDOMapping(3, ai_mapping);
+
+    manager_->addInputChannel(3, 0x1A00, 0x01, DataKey::ETHERCAT_SENSOR_POSITION_0, 0.001);
+    manager_->addInputChannel(3, 0x1A04, 0x01, DataKey::ETHERCAT_SENSOR_AI_0);
+    manager_->addInputChannel(3, 0x1A04, 0x03, DataKey::ETHERCAT_SENSOR_AI_2);  // 매핑 없음
+
+    ASSERT_EQ(0, manager_->compileAccessPlan({3}));
+
+    int32_t pos = 250000;
+    int16_t ai = -120;
+    mock_master_->setDomainData(8, &pos, sizeof(int32_t));
+    mock_master_->setDomainData(12, &ai, sizeof(int16_t));
+
+    mxrc::core::rt::RTDataStore store;
+    EXPECT_EQ(2, manager_->readInputChannels(store));
+
+    double value = 0.0;
+    ASSERT_EQ(0, store.getDouble(DataKey::ETHERCAT_SENSOR_POSITION_0, value));
+    EXPECT_DOUBLE_EQ(250.0, value);
+    ASSERT_EQ(0, store.getDouble(DataKey::ETHERCAT_SENSOR_AI_0, value));
+    EXPECT_DOUBLE_EQ(-120.0, value);
+    EXPECT_NE(0, store.getDouble(DataKey::ETHERCAT_SENSOR_AI_2, value));
+}
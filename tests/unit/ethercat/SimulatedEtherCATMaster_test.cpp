@@ -0,0 +1,248 @@
+#include <gtest/gtest.h>
+#include "core/ethercat/core/SimulatedEtherCATMaster.h"
+#include "core/ethercat/adapters/RTEtherCATCycle.h"
+#include "core/ethercat/impl/SensorDataManager.h"
+#include "core/ethercat/util/PDOBulk.h"
+#include "core/rt/RTDataStore.h"
+#include "core/rt/RTContext.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace mxrc::ethercat;
+using namespace mxrc::core::rt;
+
+namespace {
+
+// 저장소 루트 기준 샘플 설정 (tests/unit/ethercat/ → 루트)
+std::string sampleConfigPath() {
+    std::string path = __FILE__;
+    for (int i = 0; i < 4; ++i) {
+        path = path.substr(0, path.find_last_of('/'));
+    }
+    return path + "/config/ethercat/slaves_sample.yaml";
+}
+
+// slave의 PDO 매핑 domain offset 조회
+uint32_t offsetOf(const SimulatedEtherCATMaster& master, uint16_t slave_id,
+                  PDODirection direction, uint16_t index, uint8_t subindex) {
+    for (const auto& mapping : master.getPDOMappings(slave_id)) {
+        if (mapping.direction == direction && mapping.index == index &&
+            mapping.subindex == subindex) {
+            return mapping.offset;
+        }
+    }
+    ADD_FAILURE() << "PDO 매핑 없음: slave=" << slave_id;
+    return 0;
+}
+
+} // namespace
+
+// 테스트 1: 샘플 YAML을 40 slave로 복제, domain 재배치 및 기대 WKC
+TEST(SimulatedEtherCATMasterTest, LoadsSampleNetworkAndRelocatesPDOs) {
+    SimulatedEtherCATMaster master;
+    ASSERT_EQ(0, master.loadFromFile(sampleConfigPath(), 40));
+
+    ASSERT_EQ(40u, master.getSlaveCount());
+    ASSERT_NE(nullptr, master.getSlaveConfig(5));
+    EXPECT_EQ(5, master.getSlaveConfig(5)->position);
+    EXPECT_EQ("Joint1_ServoDriver_5", master.getSlaveConfig(5)->device_name);
+    EXPECT_EQ(nullptr, master.getSlaveConfig(40));
+
+    // 모든 PDO가 domain 안에서 겹치지 않음
+    std::vector<std::pair<uint32_t, uint32_t>> ranges;
+    for (uint16_t id = 0; id < master.getSlaveCount(); ++id) {
+        for (const auto& mapping : master.getPDOMappings(id)) {
+            ranges.emplace_back(mapping.offset,
+                                mapping.offset + PDOBulk::typeSize(mapping.data_type));
+        }
+    }
+    std::sort(ranges.begin(), ranges.end());
+    for (size_t i = 1; i < ranges.size(); ++i) {
+        EXPECT_LE(ranges[i - 1].second, ranges[i].first);
+    }
+    EXPECT_EQ(ranges.back().second, master.getProcessImageSize());
+
+    // 템플릿 4개당 WKC: encoder 1 + servo 3 (입력 1 + 출력 2) + AI 1 + DI 1
+    EXPECT_EQ(60u, master.getExpectedWorkingCounter());
+}
+
+// 테스트 2: 출력 loopback과 생성 신호
+TEST(SimulatedEtherCATMasterTest, LoopsBackOutputsAndGeneratesInputs) {
+    SimulatedEtherCATMaster master;
+    ASSERT_EQ(0, master.loadFromFile(sampleConfigPath()));
+    ASSERT_EQ(0, master.activate());
+
+    uint8_t* domain = master.getProcessImage();
+    ASSERT_NE(nullptr, domain);
+
+    // Servo(slave 1) 목표 위치 0x1600:01 → 실제 위치 0x1A00:01
+    int32_t target = 4242;
+    std::memcpy(domain + offsetOf(master, 1, PDODirection::OUTPUT, 0x1600, 0x01),
+                &target, sizeof(target));
+
+    ASSERT_EQ(0, master.send());
+    // send 이후 출력 변경은 이번 프레임에 반영되지 않음
+    int32_t late = -1;
+    std::memcpy(domain + offsetOf(master, 1, PDODirection::OUTPUT, 0x1600, 0x01),
+                &late, sizeof(late));
+    ASSERT_EQ(0, master.receive());
+
+    int32_t actual = 0;
+    std::memcpy(&actual, domain + offsetOf(master, 1, PDODirection::INPUT, 0x1A00, 0x01),
+                sizeof(actual));
+    EXPECT_EQ(target, actual);
+    EXPECT_EQ(master.getExpectedWorkingCounter(), master.getWorkingCounter());
+
+    // Encoder(slave 0) 위치는 cycle마다 증가
+    uint32_t encoder = offsetOf(master, 0, PDODirection::INPUT, 0x1A00, 0x01);
+    int32_t first = 0;
+    int32_t second = 0;
+    std::memcpy(&first, domain + encoder, sizeof(first));
+    ASSERT_EQ(0, master.send());
+    ASSERT_EQ(0, master.receive());
+    std::memcpy(&second, domain + encoder, sizeof(second));
+    EXPECT_GT(second, first);
+}
+
+// 테스트 3: WKC 불일치와 프레임 손실
+TEST(SimulatedEtherCATMasterTest, InjectsWorkingCounterErrorsAndFrameLoss) {
+    SimulationConfig sim;
+    sim.wkc_error_rate = 1.0;
+    SimulatedEtherCATMaster master(sim);
+    ASSERT_EQ(0, master.loadFromFile(sampleConfigPath(), 20));
+    ASSERT_EQ(0, master.activate());
+
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_EQ(0, master.send());
+        EXPECT_EQ(0, master.receive());
+        EXPECT_LT(master.getWorkingCounter(), master.getExpectedWorkingCounter());
+    }
+    EXPECT_EQ(10u, master.getWKCErrorCount());
+
+    sim.wkc_error_rate = 0.0;
+    sim.frame_loss_rate = 1.0;
+    master.setSimulationConfig(sim);
+    ASSERT_EQ(0, master.send());
+    EXPECT_EQ(-1, master.receive());
+    EXPECT_EQ(0u, master.getWorkingCounter());
+    EXPECT_EQ(1u, master.getFrameLossCount());
+    EXPECT_EQ(11u, master.getErrorCount());
+}
+
+// 테스트 4: DC reference clock drift (가상 시간)
+TEST(SimulatedEtherCATMasterTest, ReferenceClockDrifts) {
+    SimulationConfig sim;
+    sim.dc_drift_ppm = 50.0;
+    sim.dc_initial_offset_ns = 1000;
+    sim.cycle_time_ns = 1000000;  // 1ms
+    SimulatedEtherCATMaster master(sim);
+    ASSERT_EQ(0, master.loadFromFile(sampleConfigPath()));
+
+    DCConfiguration dc;
+    dc.enable = true;
+    dc.reference_slave = 0;
+    dc.sync0_cycle_time = sim.cycle_time_ns;
+    master.setDCConfig(dc);
+    ASSERT_EQ(0, master.activate());
+
+    uint64_t ref_time = 0;
+    EXPECT_EQ(-1, master.getReferenceClockTime(ref_time));  // 아직 수신 없음
+
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(0, master.send());
+        ASSERT_EQ(0, master.receive());
+    }
+
+    ASSERT_EQ(0, master.getReferenceClockTime(ref_time));
+    // 1초 경과 후 50ppm = 50us drift + 초기 offset
+    EXPECT_EQ(1000000000ULL, master.getSimulationTimeNs());
+    EXPECT_EQ(1000000000ULL + 50000ULL + 1000ULL, ref_time);
+}
+
+// 테스트 4b: DC jitter는 0 중심 대칭이므로 평균 offset은 dc_initial_offset_ns
+TEST(SimulatedEtherCATMasterTest, ReferenceClockJitterIsCentered) {
+    SimulationConfig sim;
+    sim.dc_initial_offset_ns = 5000;
+    sim.dc_jitter_ns = 1000;
+    sim.cycle_time_ns = 1000000;
+    SimulatedEtherCATMaster master(sim);
+    ASSERT_EQ(0, master.loadFromFile(sampleConfigPath()));
+
+    DCConfiguration dc;
+    dc.enable = true;
+    dc.reference_slave = 0;
+    dc.sync0_cycle_time = sim.cycle_time_ns;
+    master.setDCConfig(dc);
+    ASSERT_EQ(0, master.activate());
+
+    constexpr int CYCLES = 4000;
+    int64_t sum = 0;
+    int64_t min_offset = INT64_MAX;
+    int64_t max_offset = INT64_MIN;
+    for (int i = 0; i < CYCLES; ++i) {
+        ASSERT_EQ(0, master.send());
+        ASSERT_EQ(0, master.receive());
+        uint64_t ref_time = 0;
+        ASSERT_EQ(0, master.getReferenceClockTime(ref_time));
+        int64_t offset = static_cast<int64_t>(ref_time - master.getSimulationTimeNs());
+        sum += offset;
+        min_offset = std::min(min_offset, offset);
+        max_offset = std::max(max_offset, offset);
+    }
+
+    EXPECT_GE(min_offset, 4000);
+    EXPECT_LE(max_offset, 6000);
+    EXPECT_LT(min_offset, 4500);  // 음의 jitter도 발생
+    EXPECT_NEAR(5000.0, static_cast<double>(sum) / CYCLES, 50.0);
+}
+
+// 테스트 5: RTEtherCATCycle 전체 경로 (32 slave, zero-copy process image)
+TEST(SimulatedEtherCATMasterTest, DrivesRTEtherCATCycle) {
+    auto master = std::make_shared<SimulatedEtherCATMaster>();
+    ASSERT_EQ(0, master->loadFromFile(sampleConfigPath(), 32));
+
+    auto sensor_manager = std::make_shared<SensorDataManager>(master, master);
+    RTEtherCATCycle cycle(master, sensor_manager);
+
+    // slave 0: encoder, slave 1: servo loopback
+    cycle.registerPositionSensor(0, DataKey::ETHERCAT_SENSOR_POSITION_0,
+                                 DataKey::ETHERCAT_SENSOR_VELOCITY_0);
+    cycle.registerPositionSensor(1, DataKey::ETHERCAT_SENSOR_POSITION_1,
+                                 DataKey::ETHERCAT_SENSOR_POSITION_1);
+
+    RTDataStore store;
+    ASSERT_EQ(0, cycle.attachProcessImage(store));  // activate() 전: zero-copy
+    ASSERT_EQ(0, master->activate());
+    ASSERT_EQ(store.processImage(), master->getProcessImage());
+    sensor_manager->setDomainPtr(master->getProcessImage());
+
+    RTContext ctx;
+    ctx.data_store = &store;
+
+    int32_t target = -777;
+    std::memcpy(master->getProcessImage() +
+                    offsetOf(*master, 1, PDODirection::OUTPUT, 0x1600, 0x01),
+                &target, sizeof(target));
+
+    constexpr int CYCLES = 10;
+    for (int i = 0; i < CYCLES; ++i) {
+        cycle.execute(ctx);
+    }
+
+    EXPECT_EQ(static_cast<uint64_t>(CYCLES), cycle.getTotalCycles());
+    EXPECT_EQ(0u, cycle.getErrorCount());
+
+    // encoder 0x1A00:01 기울기 = 1 + (slave 0 + subindex 1) % 10 = 2
+    double position = 0.0;
+    ASSERT_EQ(0, store.getDouble(DataKey::ETHERCAT_SENSOR_POSITION_0, position));
+    EXPECT_DOUBLE_EQ(2.0 * CYCLES, position);
+
+    double servo_position = 0.0;
+    ASSERT_EQ(0, store.getDouble(DataKey::ETHERCAT_SENSOR_POSITION_1, servo_position));
+    EXPECT_DOUBLE_EQ(static_cast<double>(target), servo_position);
+}
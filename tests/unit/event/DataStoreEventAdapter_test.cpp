@@ -594,6 +594,30 @@ TEST_F(DataStoreEventAdapterTest, HighFrequencyUpdates) {
     EXPECT_GE(receivedEvents_.size(), 100);
 }
 
+TEST_F(DataStoreEventAdapterTest, HighFrequencyUpdatesInBatchScope) {
+    // Given: 감시 중인 키
+    subscribeToEvents(EventType::DATASTORE_VALUE_CHANGED);
+    adapter_->startWatching("hf.batch");
+    const uint64_t publishedBefore = eventBus_->getStats().publishedEvents.load();
+
+    {
+        // When: 쓰기 burst를 BatchScope로 묶음
+        EventBus::BatchScope batch(*eventBus_);
+        for (int i = 0; i < 100; i++) {
+            dataStore_->set("hf.batch", i, DataType::Config);
+        }
+
+        // 어댑터 이벤트는 스코프에 모이고 아직 큐에 들어가지 않음
+        EXPECT_EQ(batch.pending(), 100u);
+        EXPECT_EQ(eventBus_->getStats().publishedEvents.load(), publishedBefore);
+    }
+
+    // Then: 스코프 종료 시 한 배치로 발행되어 모두 전달됨
+    EXPECT_EQ(eventBus_->getStats().publishedEvents.load(), publishedBefore + 100);
+    ASSERT_TRUE(waitForEventCount(100, 2000));
+    EXPECT_EQ(receivedEvents_.size(), 100u);
+}
+
 TEST_F(DataStoreEventAdapterTest, EventPublishFailureHandling) {
     // Given: EventBus를 stop하여 publish 실패 유발
     subscribeToEvents(EventType::DATASTORE_VALUE_CHANGED);
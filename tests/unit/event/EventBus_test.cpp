@@ -4,6 +4,8 @@
 #include "gtest/gtest.h"
 #include "core/EventBus.h"
 #include "dto/EventBase.h"
+#include "dto/RTEvents.h"
+#include "dto/DataStoreEvents.h"
 #include "util/EventFilter.h"
 #include <thread>
 #include <chrono>
@@ -389,4 +391,206 @@ TEST_F(EventBusTest, ProcessRemainingEventsOnStop) {
     eventBus_->unsubscribe(subId);
 }
 
+// ===== Priority propagation 테스트 =====
+
+TEST_F(EventBusTest, PriorityTakenFromEvent) {
+    // Given: 작은 큐를 가진 EventBus (시작 전, 소비자 없음)
+    auto smallBus = std::make_unique<EventBus>(10);
+
+    // When: LOW 우선순위 DataStore 이벤트로 큐를 채움
+    int lowAccepted = 0;
+    for (int i = 0; i < 10; ++i) {
+        auto event = std::make_shared<DataStoreValueChangedEvent>(
+            "key" + std::to_string(i), "0", "1", "int");
+        if (smallBus->publish(event)) {
+            lowAccepted++;
+        }
+    }
+
+    // Then: LOW 이벤트는 80%에서 drop되고, CRITICAL 이벤트는 계속 수용됨
+    EXPECT_EQ(lowAccepted, 8);
+    EXPECT_TRUE(smallBus->publish(std::make_shared<RTSafeModeEnteredEvent>(100, "test")));
+    EXPECT_TRUE(smallBus->publish(std::make_shared<RTSafeModeExitedEvent>(50)));
+
+    const auto& metrics = smallBus->getQueueMetrics();
+    EXPECT_EQ(metrics.low_events_dropped.load(), 2);
+    EXPECT_EQ(metrics.critical_events_pushed.load(), 2);
+    EXPECT_EQ(metrics.critical_events_dropped.load(), 0);
+}
+
+TEST_F(EventBusTest, CriticalEventsDispatchedFirst) {
+    // Given: 시작 전에 LOW → NORMAL → CRITICAL 순서로 발행
+    std::vector<EventType> received;
+    std::mutex receivedMutex;
+
+    eventBus_->subscribe(
+        Filters::all(),
+        [&](std::shared_ptr<IEvent> event) {
+            std::lock_guard<std::mutex> lock(receivedMutex);
+            received.push_back(event->getType());
+        }
+    );
+
+    eventBus_->publish(std::make_shared<DataStoreValueChangedEvent>("key", "0", "1", "int"));
+    eventBus_->publish(std::make_shared<EventBase>(EventType::ACTION_STARTED, "action"));
+    eventBus_->publish(std::make_shared<RTSafeModeEnteredEvent>(100, "test"));
+
+    // When: 디스패치 시작 후 정지 (남은 이벤트 처리)
+    eventBus_->start();
+    eventBus_->stop();
+
+    // Then: 우선순위 순서로 전달됨
+    ASSERT_EQ(received.size(), 3u);
+    EXPECT_EQ(received[0], EventType::RT_SAFE_MODE_ENTERED);
+    EXPECT_EQ(received[1], EventType::ACTION_STARTED);
+    EXPECT_EQ(received[2], EventType::DATASTORE_VALUE_CHANGED);
+}
+
+// ===== Batch publish 테스트 =====
+
+namespace {
+
+/**
+ * @brief 배치 훅 호출 횟수를 세는 observer
+ */
+class BatchCountingObserver : public IEventObserver {
+public:
+    std::atomic<int> singlePublishes{0};
+    std::atomic<int> batchesBefore{0};
+    std::atomic<int> batchesAfter{0};
+    std::atomic<size_t> lastBatchAccepted{0};
+
+    void onBeforePublish(const std::shared_ptr<IEvent>&) override { singlePublishes++; }
+    void onAfterPublish(const std::shared_ptr<IEvent>&, bool) override {}
+    void onBeforeDispatch(const std::shared_ptr<IEvent>&) override {}
+    void onAfterDispatch(const std::shared_ptr<IEvent>&, size_t) override {}
+
+    void onBeforePublishBatch(const std::vector<std::shared_ptr<IEvent>>&) override {
+        batchesBefore++;
+    }
+    void onAfterPublishBatch(const std::vector<std::shared_ptr<IEvent>>&,
+                             const std::vector<bool>& accepted) override {
+        batchesAfter++;
+        lastBatchAccepted = std::count(accepted.begin(), accepted.end(), true);
+    }
+};
+
+} // namespace
+
+TEST_F(EventBusTest, PublishBatchDispatchesInOrder) {
+    // Given: 구독자와 batch observer 등록
+    std::vector<std::string> received;
+    std::mutex receivedMutex;
+    eventBus_->subscribe(
+        Filters::all(),
+        [&](std::shared_ptr<IEvent> event) {
+            std::lock_guard<std::mutex> lock(receivedMutex);
+            received.push_back(event->getTargetId());
+        }
+    );
+    auto observer = std::make_shared<BatchCountingObserver>();
+    eventBus_->registerObserver(observer);
+
+    // When: 5개 이벤트(+ null 1개)를 한 번에 발행
+    std::vector<std::shared_ptr<IEvent>> batch;
+    for (int i = 0; i < 5; ++i) {
+        batch.push_back(std::make_shared<EventBase>(EventType::ACTION_STARTED, "action" + std::to_string(i)));
+    }
+    batch.push_back(nullptr);
+
+    size_t accepted = eventBus_->publishBatch(std::move(batch));
+
+    eventBus_->start();
+    eventBus_->stop();
+
+    // Then: 모두 발행되고 순서대로 전달되며 observer는 배치당 한 번 호출됨
+    EXPECT_EQ(accepted, 5u);
+    EXPECT_EQ(eventBus_->getStats().publishedEvents.load(), 5u);
+    ASSERT_EQ(received.size(), 5u);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(received[i], "action" + std::to_string(i));
+    }
+    EXPECT_EQ(observer->batchesBefore.load(), 1);
+    EXPECT_EQ(observer->batchesAfter.load(), 1);
+    EXPECT_EQ(observer->lastBatchAccepted.load(), 5u);
+    EXPECT_EQ(observer->singlePublishes.load(), 0);
+}
+
+TEST_F(EventBusTest, PublishBatchCountsDrops) {
+    // Given: 작은 큐
+    auto smallBus = std::make_unique<EventBus>(10);
+
+    std::vector<std::shared_ptr<IEvent>> batch;
+    for (int i = 0; i < 20; ++i) {
+        batch.push_back(std::make_shared<EventBase>(EventType::ACTION_STARTED, "action" + std::to_string(i)));
+    }
+
+    // When: 용량보다 큰 배치 발행
+    size_t accepted = smallBus->publishBatch(std::move(batch));
+
+    // Then: NORMAL 이벤트는 90%까지만 수용됨
+    EXPECT_EQ(accepted, 9u);
+    EXPECT_EQ(smallBus->getStats().publishedEvents.load(), 9u);
+    EXPECT_EQ(smallBus->getStats().droppedEvents.load(), 11u);
+}
+
+TEST_F(EventBusTest, BatchScopeCollectsPublishes) {
+    std::atomic<int> receivedCount{0};
+    eventBus_->subscribe(Filters::all(), [&](auto) { receivedCount++; });
+    auto observer = std::make_shared<BatchCountingObserver>();
+    eventBus_->registerObserver(observer);
+
+    {
+        // Given: 활성 BatchScope
+        EventBus::BatchScope batch(*eventBus_);
+
+        // When: 스코프 안에서 publish
+        for (int i = 0; i < 3; ++i) {
+            EXPECT_TRUE(eventBus_->publish(
+                std::make_shared<EventBase>(EventType::ACTION_STARTED, "action" + std::to_string(i))));
+        }
+
+        // Then: 스코프가 끝나기 전에는 큐에 들어가지 않음
+        EXPECT_EQ(batch.pending(), 3u);
+        EXPECT_EQ(eventBus_->getStats().publishedEvents.load(), 0u);
+    }
+
+    // 스코프 종료 시 한 배치로 발행됨
+    EXPECT_EQ(eventBus_->getStats().publishedEvents.load(), 3u);
+    EXPECT_EQ(observer->batchesAfter.load(), 1);
+    EXPECT_EQ(observer->singlePublishes.load(), 0);
+
+    eventBus_->start();
+    eventBus_->stop();
+    EXPECT_EQ(receivedCount.load(), 3);
+}
+
+TEST_F(EventBusTest, UnregisteredObserverReceivesNoHooks) {
+    std::atomic<int> receivedCount{0};
+    eventBus_->subscribe(Filters::all(), [&](auto) { receivedCount++; });
+
+    // Given: 등록 후 해제된 observer
+    auto observer = std::make_shared<BatchCountingObserver>();
+    eventBus_->registerObserver(observer);
+    eventBus_->publish(std::make_shared<EventBase>(EventType::ACTION_STARTED, "before"));
+    eventBus_->unregisterObserver(observer);
+
+    // When: observer 없이 단건/배치 발행
+    eventBus_->publish(std::make_shared<EventBase>(EventType::ACTION_STARTED, "single"));
+    std::vector<std::shared_ptr<IEvent>> batch;
+    for (int i = 0; i < 3; ++i) {
+        batch.push_back(std::make_shared<EventBase>(EventType::ACTION_STARTED, "action" + std::to_string(i)));
+    }
+    EXPECT_EQ(eventBus_->publishBatch(std::move(batch)), 3u);
+
+    eventBus_->start();
+    eventBus_->stop();
+
+    // Then: 해제 이후에는 hook이 호출되지 않고, 이벤트는 정상 전달됨
+    EXPECT_EQ(observer->singlePublishes.load(), 1);
+    EXPECT_EQ(observer->batchesBefore.load(), 0);
+    EXPECT_EQ(observer->batchesAfter.load(), 0);
+    EXPECT_EQ(receivedCount.load(), 5);
+}
+
 } // namespace mxrc::core::event
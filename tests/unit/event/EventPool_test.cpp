@@ -0,0 +1,160 @@
+// EventPool_test.cpp - EventPool / EventIdGenerator 단위 테스트
+// Copyright (C) 2025 MXRC Project
+
+#include "gtest/gtest.h"
+#include "util/EventPool.h"
+#include "util/EventIdGenerator.h"
+#include "dto/DataStoreEvents.h"
+#include <thread>
+#include <vector>
+#include <set>
+#include <mutex>
+
+using namespace mxrc::core::event;
+
+namespace mxrc::core::event {
+
+// ===== EventIdGenerator 테스트 =====
+
+TEST(EventIdGeneratorTest, IdsAreUniqueAcrossThreads) {
+    constexpr int NUM_THREADS = 4;
+    constexpr int IDS_PER_THREAD = 10000;
+
+    std::vector<std::vector<uint64_t>> perThread(NUM_THREADS);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        threads.emplace_back([&, t]() {
+            perThread[t].reserve(IDS_PER_THREAD);
+            for (int i = 0; i < IDS_PER_THREAD; ++i) {
+                perThread[t].push_back(EventIdGenerator::next());
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    std::set<uint64_t> all;
+    for (const auto& ids : perThread) {
+        all.insert(ids.begin(), ids.end());
+    }
+    EXPECT_EQ(all.size(), static_cast<size_t>(NUM_THREADS * IDS_PER_THREAD));
+}
+
+TEST(EventIdGeneratorTest, IdCarriesProcessEpoch) {
+    uint64_t id = EventIdGenerator::next();
+    EXPECT_EQ(id >> EventIdGenerator::kCounterBits, EventIdGenerator::processEpoch());
+    EXPECT_NE(id & EventIdGenerator::kCounterMask, 0u);
+}
+
+TEST(EventIdGeneratorTest, StringFormat) {
+    EXPECT_EQ(EventIdGenerator::toString(0x1234), "evt_0000000000001234");
+
+    EventBase event(EventType::ACTION_STARTED, "action");
+    EXPECT_EQ(event.getEventId(), EventIdGenerator::toString(event.getNumericId()));
+}
+
+// ===== EventPool 테스트 =====
+
+TEST(EventPoolTest, MakeConstructsEvent) {
+    auto event = EventPool<DataStoreValueChangedEvent>::make(
+        "robot.position", "", "1.50", "double", "datastore");
+
+    ASSERT_NE(event, nullptr);
+    EXPECT_EQ(event->getType(), EventType::DATASTORE_VALUE_CHANGED);
+    EXPECT_EQ(event->key, "robot.position");
+    EXPECT_EQ(event->newValue, "1.50");
+    EXPECT_EQ(event.use_count(), 1);
+}
+
+TEST(EventPoolTest, ReleasedBlocksAreReused) {
+    constexpr int COUNT = 32;
+
+    // Given: 이벤트 생성 후 모두 해제
+    std::set<const void*> firstRound;
+    {
+        std::vector<std::shared_ptr<DataStoreValueChangedEvent>> events;
+        for (int i = 0; i < COUNT; ++i) {
+            events.push_back(EventPool<DataStoreValueChangedEvent>::make("k", "", "v", "int"));
+            firstRound.insert(events.back().get());
+        }
+    }
+
+    // When: 같은 수의 이벤트를 다시 생성
+    int reused = 0;
+    std::vector<std::shared_ptr<DataStoreValueChangedEvent>> events;
+    for (int i = 0; i < COUNT; ++i) {
+        events.push_back(EventPool<DataStoreValueChangedEvent>::make("k", "", "v", "int"));
+        if (firstRound.count(events.back().get())) {
+            reused++;
+        }
+    }
+
+    // Then: 모든 블록이 풀에서 재사용됨
+    EXPECT_EQ(reused, COUNT);
+}
+
+TEST(EventPoolTest, CrossThreadRelease) {
+    // 생산자 스레드에서 생성하고 소비자 스레드에서 해제 (EventBus dispatch 패턴)
+    constexpr int COUNT = 5000;
+    std::vector<std::shared_ptr<IEvent>> handoff;
+    std::mutex handoffMutex;
+
+    std::thread producer([&]() {
+        for (int i = 0; i < COUNT; ++i) {
+            auto event = EventPool<DataStoreValueChangedEvent>::make(
+                "key" + std::to_string(i), "", "v", "int");
+            std::lock_guard<std::mutex> lock(handoffMutex);
+            handoff.push_back(std::move(event));
+        }
+    });
+
+    int released = 0;
+    std::thread consumer([&]() {
+        while (released < COUNT) {
+            std::vector<std::shared_ptr<IEvent>> batch;
+            {
+                std::lock_guard<std::mutex> lock(handoffMutex);
+                batch.swap(handoff);
+            }
+            released += static_cast<int>(batch.size());
+        }
+    });
+
+    producer.join();
+    consumer.join();
+    EXPECT_EQ(released, COUNT);
+}
+
+TEST(EventPoolTest, ManyThreadsAllocateWithoutSharingBlocks) {
+    // 스레드별 free list: 동시 할당된 블록은 모두 달라야 하고, 스레드 종료 시 반환됨
+    constexpr int THREADS = 8;
+    constexpr int PER_THREAD = 200;
+    std::vector<std::vector<std::shared_ptr<DataStoreValueChangedEvent>>> live(THREADS);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&live, t]() {
+            for (int i = 0; i < PER_THREAD * 4; ++i) {
+                auto event = EventPool<DataStoreValueChangedEvent>::make("k", "", "v", "int");
+                if (i % 4 == 0) {
+                    live[t].push_back(std::move(event));  // 일부만 유지, 나머지는 즉시 해제
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::set<const void*> blocks;
+    for (const auto& events : live) {
+        for (const auto& event : events) {
+            EXPECT_EQ(event->key, "k");
+            blocks.insert(event.get());
+        }
+    }
+    EXPECT_EQ(blocks.size(), static_cast<size_t>(THREADS * PER_THREAD));
+}
+
+} // namespace mxrc::core::event
@@ -113,6 +113,24 @@ TEST_F(PrioritizedEventTest, SequenceOrdering_WithinSameTimestamp) {
     EXPECT_TRUE(second < first) << "Lower sequence number should be processed first";
 }
 
+TEST_F(PrioritizedEventTest, SequenceOrdering_UnstampedEventKeepsPublishOrder) {
+    // TTL 이벤트만 시각이 기록되므로 (timestamp_ns == 0) 발행 순서는 sequence로 유지되어야 함
+    PrioritizedEvent stamped{
+        .priority = EventPriority::NORMAL,
+        .timestamp_ns = 5000,
+        .sequence_num = 1
+    };
+
+    PrioritizedEvent unstamped{
+        .priority = EventPriority::NORMAL,
+        .timestamp_ns = 0,
+        .sequence_num = 2
+    };
+
+    EXPECT_TRUE(unstamped < stamped) << "Earlier published event should be processed first";
+    EXPECT_FALSE(stamped < unstamped);
+}
+
 // ============================================================================
 // Helper Function Tests
 // ============================================================================
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "core/event/core/PriorityQueue.h"
+#include <string>
 #include <thread>
 #include <vector>
 #include <atomic>
@@ -528,6 +529,91 @@ TEST_F(PriorityQueueTest, TTL_MixedEvents_OnlyExpiredSkipped) {
     EXPECT_EQ(queue_->metrics().events_popped.load(), 1u);    // Only 1 valid popped
 }
 
+TEST_F(PriorityQueueTest, TTL_DeadlineUsesMonotonicTimestamp) {
+    auto event = makePrioritizedEvent("test.deadline", EventPriority::NORMAL, 1, 1);
+    event.ttl = std::chrono::milliseconds(5);
+
+    EXPECT_EQ(event.deadlineNs(), event.timestamp_ns + 5'000'000u);
+    EXPECT_FALSE(event.isExpired(event.timestamp_ns + 5'000'000u));
+    EXPECT_TRUE(event.isExpired(event.timestamp_ns + 5'000'001u));
+
+    // Without TTL the deadline is unbounded
+    auto no_ttl = makePrioritizedEvent("test.no_deadline", EventPriority::NORMAL, 2, 2);
+    EXPECT_FALSE(no_ttl.isExpired(UINT64_MAX));
+}
+
+TEST_F(PriorityQueueTest, TTL_DiscardExpired_RemovesAllInOnePass) {
+    for (int i = 0; i < 10; ++i) {
+        auto event = makePrioritizedEvent("test.stale", EventPriority::LOW, i, i);
+        event.ttl = std::chrono::milliseconds(1);
+        queue_->push(std::move(event));
+    }
+    queue_->push(makePrioritizedEvent("test.keep", EventPriority::LOW, 100, 10));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    EXPECT_EQ(queue_->discardExpired(), 10u);
+    EXPECT_EQ(queue_->size(), 1u);
+    EXPECT_EQ(queue_->metrics().events_expired.load(), 10u);
+
+    // Nothing left to expire: no-op
+    EXPECT_EQ(queue_->discardExpired(), 0u);
+
+    auto popped = queue_->pop();
+    ASSERT_TRUE(popped.has_value());
+    EXPECT_EQ(std::get<int>(popped->payload), 100);
+}
+
+TEST_F(PriorityQueueTest, TTL_BacklogPushReclaimsExpiredSlots) {
+    // Fill to the 80% threshold with short-lived LOW events
+    for (int i = 0; i < 80; ++i) {
+        auto event = makePrioritizedEvent("test.stale", EventPriority::LOW, i, i);
+        event.ttl = std::chrono::milliseconds(1);
+        ASSERT_TRUE(queue_->push(std::move(event)));
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    // A fresh LOW event would be dropped at 80%, but expired slots are reclaimed first
+    EXPECT_TRUE(queue_->push(makePrioritizedEvent("test.fresh", EventPriority::LOW, 999, 80)));
+    EXPECT_EQ(queue_->size(), 1u);
+    EXPECT_EQ(queue_->metrics().events_expired.load(), 80u);
+    EXPECT_EQ(queue_->metrics().low_events_dropped.load(), 0u);
+}
+
+TEST_F(PriorityQueueTest, TTL_ExpiredCoalescedEvents_ReleaseKeys) {
+    // Distinct keys, all short-lived: expiry must not leave tracking entries behind
+    for (int i = 0; i < 20; ++i) {
+        auto event = makePrioritizedEvent("test.keyed", EventPriority::NORMAL, i, i);
+        event.coalescing_key = "sensor." + std::to_string(i);
+        event.ttl = std::chrono::milliseconds(1);
+        queue_->push(std::move(event));
+    }
+    auto live = makePrioritizedEvent("test.keyed", EventPriority::NORMAL, 100, 100);
+    live.coalescing_key = "sensor.live";
+    queue_->push(std::move(live));
+    EXPECT_EQ(queue_->coalescingKeyCount(), 21u);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    // Bulk discard path
+    EXPECT_EQ(queue_->discardExpired(), 20u);
+    EXPECT_EQ(queue_->coalescingKeyCount(), 1u);
+
+    auto stale = makePrioritizedEvent("test.keyed", EventPriority::NORMAL, 200, 200);
+    stale.coalescing_key = "sensor.stale";
+    stale.ttl = std::chrono::milliseconds(1);
+    queue_->push(std::move(stale));
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    // pop() skip path: live event first, then the expired one is dropped
+    auto popped = queue_->pop();
+    ASSERT_TRUE(popped.has_value());
+    EXPECT_EQ(std::get<int>(popped->payload), 100);
+    EXPECT_FALSE(queue_->pop().has_value());
+    EXPECT_EQ(queue_->coalescingKeyCount(), 0u);
+}
+
 // ============================================================================
 // Feature 019 - US3: Coalescing Policy Tests (T032, T035)
 // ============================================================================
@@ -608,4 +694,50 @@ TEST_F(PriorityQueueTest, Coalescing_NoKey_NoCoalescing) {
     EXPECT_EQ(queue_->metrics().events_popped.load(), 3u);
 }
 
+// ============================================================================
+// Batch Push/Pop Tests
+// ============================================================================
+
+TEST_F(PriorityQueueTest, PushBatch_AppliesBackpressurePerEvent) {
+    // Fill to 79 events, then push a batch of LOW events crossing the 80% threshold
+    for (int i = 0; i < 79; ++i) {
+        queue_->push(makePrioritizedEvent("fill", EventPriority::NORMAL, i, i));
+    }
+
+    std::vector<PrioritizedEvent> batch;
+    batch.push_back(makePrioritizedEvent("low.1", EventPriority::LOW, 1, 100));
+    batch.push_back(makePrioritizedEvent("low.2", EventPriority::LOW, 2, 101));
+    batch.push_back(makePrioritizedEvent("critical", EventPriority::CRITICAL, 3, 102));
+
+    std::vector<bool> accepted;
+    size_t count = queue_->pushBatch(std::move(batch), &accepted);
+
+    // First LOW fits (79 < 80), second LOW is dropped (80 >= 80), CRITICAL always accepted
+    EXPECT_EQ(count, 2u);
+    ASSERT_EQ(accepted.size(), 3u);
+    EXPECT_TRUE(accepted[0]);
+    EXPECT_FALSE(accepted[1]);
+    EXPECT_TRUE(accepted[2]);
+    EXPECT_EQ(queue_->size(), 81u);
+    EXPECT_EQ(queue_->metrics().low_events_dropped.load(), 1u);
+}
+
+TEST_F(PriorityQueueTest, PopBatch_ReturnsPriorityOrder) {
+    queue_->push(makePrioritizedEvent("low", EventPriority::LOW, 0, 0));
+    queue_->push(makePrioritizedEvent("normal", EventPriority::NORMAL, 1, 1));
+    queue_->push(makePrioritizedEvent("critical", EventPriority::CRITICAL, 2, 2));
+    queue_->push(makePrioritizedEvent("high", EventPriority::HIGH, 3, 3));
+
+    std::vector<PrioritizedEvent> out;
+    EXPECT_EQ(queue_->popBatch(out, 3), 3u);
+    ASSERT_EQ(out.size(), 3u);
+    EXPECT_EQ(out[0].type, "critical");
+    EXPECT_EQ(out[1].type, "high");
+    EXPECT_EQ(out[2].type, "normal");
+
+    EXPECT_EQ(queue_->popBatch(out, 10), 1u);
+    EXPECT_EQ(out.back().type, "low");
+    EXPECT_TRUE(queue_->empty());
+}
+
 // Main is provided by the run_tests executable
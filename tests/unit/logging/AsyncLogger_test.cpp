@@ -167,4 +167,100 @@ TEST_F(AsyncLoggerTest, Shutdown) {
     EXPECT_TRUE(log_file_contains("Message before shutdown"));
 }
 
+// hot-path 프런트엔드: 백엔드 스레드에서 포맷팅
+TEST_F(AsyncLoggerTest, FastLogFormatsOnBackend) {
+    // Given
+    initialize_async_logger();
+    enum class Mode : uint8_t { Idle = 3 };
+    std::string owned = "owned";
+    const char* null_str = nullptr;
+
+    // When
+    MXRC_LOG_INFO("fast {} {:.2f} {} {} {} {}", 42, 3.14159, owned, "literal", Mode::Idle, null_str);
+    MXRC_LOG_DEBUG("fast debug {}", std::string_view("view"));
+    spdlog::default_logger()->set_level(spdlog::level::info);
+    MXRC_LOG_DEBUG("filtered debug {}", 1);
+    shutdown_logger();  // 남은 레코드 출력 후 종료
+
+    // Then
+    EXPECT_TRUE(log_file_contains("fast 42 3.14 owned literal 3 (null)"));
+    EXPECT_TRUE(log_file_contains("fast debug view"));
+    EXPECT_FALSE(log_file_contains("filtered debug"));
+}
+
+// hot-path 프런트엔드: 여러 스레드의 메시지가 모두 출력됨
+TEST_F(AsyncLoggerTest, FastLogMultithreaded) {
+    // Given
+    initialize_async_logger();
+    uint64_t dropped_before = fast_log_dropped();
+
+    // When
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([i]() {
+            ASSERT_TRUE(register_log_thread(256));
+            for (int j = 0; j < 100; j++) {
+                MXRC_LOG_INFO("fast thread {} message {}", i, j);
+                if (j % 50 == 49) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    shutdown_logger();
+
+    // Then
+    EXPECT_EQ(fast_log_dropped(), dropped_before);
+    for (int i = 0; i < 4; i++) {
+        EXPECT_TRUE(log_file_contains(fmt::format("fast thread {} message 99", i)));
+    }
+}
+
+// hot-path 프런트엔드: shutdown_logger() 이후 백엔드가 자동 재시작되지 않음
+TEST_F(AsyncLoggerTest, FastLogDoesNotRestartAfterShutdown) {
+    // Given
+    initialize_async_logger();
+    MXRC_LOG_INFO("fast before shutdown {}", 1);
+    shutdown_logger();
+    ASSERT_FALSE(fastlog::Backend::instance().running());
+
+    // When: 새 스레드의 첫 호출 (링 등록 경로)
+    std::thread late([]() {
+        MXRC_LOG_INFO("fast after shutdown {}", 2);
+        EXPECT_TRUE(register_log_thread());
+    });
+    late.join();
+
+    // Then
+    EXPECT_FALSE(fastlog::Backend::instance().running());
+    EXPECT_TRUE(log_file_contains("fast before shutdown 1"));
+    EXPECT_FALSE(log_file_contains("fast after shutdown 2"));
+
+    // 명시적 초기화로는 다시 시작
+    initialize_async_logger();
+    EXPECT_TRUE(fastlog::Backend::instance().running());
+}
+
+// 링이 가득 차면 예약 실패 (호출자는 블록되지 않음)
+TEST(FastLogRingTest, FullRingRejectsWithoutBlocking) {
+    fastlog::LogRing ring(3);  // 4로 올림
+    EXPECT_EQ(ring.capacity(), 4u);
+
+    for (int i = 0; i < 4; i++) {
+        fastlog::Record* record = ring.reserve();
+        ASSERT_NE(record, nullptr);
+        record->timestamp_ns = i;
+        ring.commit();
+    }
+    EXPECT_EQ(ring.reserve(), nullptr);
+
+    ASSERT_NE(ring.front(), nullptr);
+    EXPECT_EQ(ring.front()->timestamp_ns, 0);
+    ring.pop();
+    EXPECT_NE(ring.reserve(), nullptr);
+}
+
 }  // namespace mxrc::core::logging
@@ -4,6 +4,7 @@
 #include <spdlog/spdlog.h>
 #include <filesystem>
 #include <fstream>
+#include <atomic>
 #include <thread>
 #include <chrono>
 
@@ -236,4 +237,87 @@ TEST_F(AsyncWriterTest, StatisticsTracking) {
     writer.stop();
 }
 
+// Test 9: 멀티 프로듀서 버스트 + 주기적 fdatasync (바이너리 포맷)
+TEST_F(AsyncWriterTest, MultiProducerBurstBinaryWithSync) {
+    // Given
+    const int threadCount = 4;
+    const int messagesPerThread = 2000;
+    AsyncWriter writer(testFile, threadCount * messagesPerThread, BagFormat::Binary);
+    writer.setSyncInterval(1);
+    writer.start();
+
+    // When - 모든 프로듀서가 동시에 큐를 채움
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+        threads.emplace_back([this, &writer, t, messagesPerThread]() {
+            for (int i = 0; i < messagesPerThread; i++) {
+                writer.tryPush(createTestMessage(1700000000000000000 + t * messagesPerThread + i,
+                                                 "producer_" + std::to_string(t)));
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    // Then - 유실 없이 모두 기록되어야 함
+    EXPECT_TRUE(writer.flush(5000));
+    EXPECT_EQ(writer.getDroppedCount(), 0);
+    EXPECT_EQ(writer.getWrittenCount(), threadCount * messagesPerThread);
+    EXPECT_EQ(fs::file_size(testFile), writer.getBytesWritten());
+
+    writer.stop();
+}
+
+// Test 10: 생산자가 큐를 계속 채워도 flush는 제시간에 반환
+TEST_F(AsyncWriterTest, FlushReturnsWhileProducerSaturatesQueue) {
+    // Given - 작은 큐를 쉬지 않고 채우는 생산자들 (드롭 경고 로그는 끔)
+    auto previousLevel = spdlog::get_level();
+    spdlog::set_level(spdlog::level::err);
+
+    AsyncWriter writer(testFile, 512);
+    writer.setSyncInterval(5);
+    writer.start();
+
+    std::atomic<bool> producing{true};
+    std::vector<std::thread> producers;
+    for (int t = 0; t < 4; t++) {
+        producers.emplace_back([this, &writer, &producing, t]() {
+            BagMessage msg = createTestMessage(1700000000000000000, "producer_" + std::to_string(t));
+            while (producing.load(std::memory_order_relaxed)) {
+                msg.timestamp_ns++;
+                writer.tryPush(msg);
+            }
+        });
+    }
+
+    // 큐가 가득 찰 때까지 대기
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (writer.getDroppedCount() == 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+
+    // When - 포화 상태에서 flush 반복
+    bool flushed = true;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 5; i++) {
+        flushed = flushed && writer.flush(2000);
+    }
+    auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start).count();
+
+    producing.store(false);
+    for (auto& th : producers) {
+        th.join();
+    }
+    writer.stop();
+    spdlog::set_level(previousLevel);
+
+    // Then - 큐가 빌 때까지 기다리지 않고 요청 시점까지의 메시지만 기록 후 반환
+    EXPECT_GT(writer.getDroppedCount(), 0u);
+    EXPECT_TRUE(flushed);
+    EXPECT_LT(elapsedMs, 2000);
+    EXPECT_GT(writer.getWrittenCount(), 0u);
+}
+
 } // namespace mxrc::core::logging
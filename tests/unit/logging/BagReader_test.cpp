@@ -2,8 +2,11 @@
 #include "core/logging/core/BagReader.h"
 #include "core/logging/core/SimpleBagWriter.h"
 #include "core/logging/dto/BagMessage.h"
+#include "core/logging/util/BinaryChunkWriter.h"
+#include "core/logging/util/ChunkCodec.h"
 #include <spdlog/spdlog.h>
 #include <filesystem>
+#include <fstream>
 #include <chrono>
 
 namespace fs = std::filesystem;
@@ -23,7 +26,7 @@ protected:
         fs::create_directories(testDir);
 
         // 테스트용 Bag 파일 생성
-        createTestBagFile();
+        testBagPath = createTestBagFile();
     }
 
     void TearDown() override {
@@ -36,10 +39,13 @@ protected:
      * @brief 테스트용 Bag 파일 생성
      *
      * 3개의 토픽, 총 10개의 메시지를 포함하는 Bag 파일 생성
+     *
+     * @param format 데이터 영역 포맷
+     * @return 생성된 파일 경로
      */
-    void createTestBagFile() {
+    std::string createTestBagFile(BagFormat format = BagFormat::Jsonl) {
         auto writer = std::make_shared<SimpleBagWriter>(
-            testDir.string(), "test", 1000);
+            testDir.string(), format == BagFormat::Binary ? "test_bin" : "test", 1000, format);
 
         writer->start();  // SimpleBagWriter 시작
 
@@ -78,7 +84,7 @@ protected:
         writer->flush(1000);
         writer->close();
 
-        testBagPath = writer->getCurrentFilePath();
+        return writer->getCurrentFilePath();
     }
 
     fs::path testDir;
@@ -344,4 +350,391 @@ TEST_F(BagReaderTest, EmptyBagFile) {
     EXPECT_FALSE(reader.hasNext());
 }
 
+// Test 13: 바이너리 포맷 왕복 (JSONL과 동일한 메시지)
+TEST_F(BagReaderTest, BinaryFormatRoundTrip) {
+    // Given
+    std::string binaryBagPath = createTestBagFile(BagFormat::Binary);
+    BagReader jsonlReader;
+    BagReader binaryReader;
+    ASSERT_TRUE(jsonlReader.open(testBagPath));
+    ASSERT_TRUE(binaryReader.open(binaryBagPath));
+
+    // Then - 메타데이터
+    EXPECT_EQ(binaryReader.getFooter().version, kBagVersionBinary);
+    EXPECT_EQ(binaryReader.getMessageCount(), 10);
+    EXPECT_EQ(binaryReader.getStartTimestamp(), jsonlReader.getStartTimestamp());
+    EXPECT_EQ(binaryReader.getEndTimestamp(), jsonlReader.getEndTimestamp());
+
+    // Then - 메시지 내용
+    size_t count = 0;
+    while (jsonlReader.hasNext()) {
+        auto expected = jsonlReader.readNext();
+        auto actual = binaryReader.readNext();
+        ASSERT_TRUE(expected.has_value());
+        ASSERT_TRUE(actual.has_value());
+        EXPECT_EQ(actual->timestamp_ns, expected->timestamp_ns);
+        EXPECT_EQ(actual->topic, expected->topic);
+        EXPECT_EQ(actual->data_type, expected->data_type);
+        EXPECT_EQ(nlohmann::json::parse(actual->serialized_value),
+                  nlohmann::json::parse(expected->serialized_value));
+        count++;
+    }
+
+    EXPECT_EQ(count, 10);
+    EXPECT_FALSE(binaryReader.hasNext());
+}
+
+// Test 14: 바이너리 포맷 다중 청크 탐색 및 필터링
+TEST_F(BagReaderTest, BinaryFormatSeekAcrossChunks) {
+    // Given - 작은 청크로 100개 메시지 기록 (청크 여러 개)
+    std::string path = (testDir / "chunked.bag").string();
+    {
+        std::ofstream ofs(path, std::ios::binary);
+        BinaryChunkWriter chunkWriter(256);
+        for (int i = 0; i < 100; i++) {
+            BagMessage msg;
+            msg.timestamp_ns = 1000 + i * 10;
+            msg.topic = (i % 2 == 0) ? "even" : "odd";
+            msg.data_type = DataType::Event;
+            msg.serialized_value = std::to_string(i);
+            ASSERT_TRUE(chunkWriter.append(msg, ofs));
+        }
+        ASSERT_TRUE(chunkWriter.flushChunk(ofs));
+        EXPECT_GT(chunkWriter.index().size(), 1);
+        ASSERT_TRUE(chunkWriter.index().writeToFile(ofs, chunkWriter.bytesWritten(),
+                                                    kBagVersionBinary, chunkWriter.messageCount()));
+    }
+
+    BagReader reader;
+    ASSERT_TRUE(reader.open(path));
+    EXPECT_EQ(reader.getMessageCount(), 100);
+    EXPECT_EQ(reader.getEndTimestamp(), 1000 + 99 * 10);
+
+    // When - 메시지 사이 타임스탬프로 탐색
+    ASSERT_TRUE(reader.seekToTimestamp(1000 + 57 * 10 - 5));
+    auto msg = reader.readNext();
+
+    // Then - 해당 타임스탬프 이상인 첫 메시지
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->timestamp_ns, 1000 + 57 * 10);
+    EXPECT_EQ(msg->topic, "odd");
+    EXPECT_EQ(msg->serialized_value, "57");
+
+    // When - 처음부터 토픽 필터링
+    reader.seekToStart();
+    reader.setTopicFilter("even");
+    size_t evenCount = 0;
+    while (reader.hasNext()) {
+        auto next = reader.readNext();
+        if (next) {
+            EXPECT_EQ(next->topic, "even");
+            evenCount++;
+        }
+    }
+
+    // Then
+    EXPECT_EQ(evenCount, 50);
+}
+
+// Test 15: 빈 바이너리 Bag 파일
+TEST_F(BagReaderTest, EmptyBinaryBagFile) {
+    // Given
+    auto writer = std::make_shared<SimpleBagWriter>(
+        testDir.string(), "empty_bin", 1000, BagFormat::Binary);
+    writer->start();
+    writer->close();
+
+    // When
+    BagReader reader;
+    bool opened = reader.open(writer->getCurrentFilePath());
+
+    // Then
+    EXPECT_TRUE(opened);
+    EXPECT_EQ(reader.getMessageCount(), 0);
+    EXPECT_FALSE(reader.hasNext());
+    EXPECT_FALSE(reader.readNext().has_value());
+}
+
+// Test 16: 압축 청크 왕복 및 탐색 (LZ4, zstd)
+TEST_F(BagReaderTest, BinaryFormatCompressedChunks) {
+    for (ChunkCompression compression : {ChunkCompression::Lz4, ChunkCompression::Zstd}) {
+        if (!ChunkCodec::isAvailable(compression)) {
+            continue;
+        }
+        SCOPED_TRACE(ChunkCodec::name(compression));
+
+        // Given - 천천히 변하는 센서 값 2000개 (압축/비압축 동일 내용)
+        auto writeBag = [&](const std::string& path, ChunkCompression mode) {
+            std::ofstream ofs(path, std::ios::binary);
+            BinaryChunkWriter chunkWriter(4096, mode);
+            for (int i = 0; i < 2000; i++) {
+                BagMessage msg;
+                msg.timestamp_ns = 1000000 + i * 1000;
+                msg.topic = "joint_position";
+                msg.data_type = DataType::Event;
+                msg.serialized_value = R"({"j0":)" + std::to_string(i / 100) + "}";
+                chunkWriter.append(msg, ofs);
+            }
+            chunkWriter.flushChunk(ofs);
+            chunkWriter.index().writeToFile(ofs, chunkWriter.bytesWritten(),
+                                            kBagVersionBinary, chunkWriter.messageCount());
+        };
+        std::string rawPath = (testDir / "raw.bag").string();
+        std::string compressedPath = (testDir / "compressed.bag").string();
+        writeBag(rawPath, ChunkCompression::None);
+        writeBag(compressedPath, compression);
+
+        // Then - 크기 감소
+        EXPECT_LT(fs::file_size(compressedPath) * 3, fs::file_size(rawPath));
+
+        // Then - 탐색 후 해당 청크만 해제하여 읽기
+        BagReader reader;
+        ASSERT_TRUE(reader.open(compressedPath));
+        EXPECT_EQ(reader.getMessageCount(), 2000);
+        ASSERT_TRUE(reader.seekToTimestamp(1000000 + 1234 * 1000));
+        auto msg = reader.readNext();
+        ASSERT_TRUE(msg.has_value());
+        EXPECT_EQ(msg->timestamp_ns, 1000000 + 1234 * 1000);
+        EXPECT_EQ(msg->serialized_value, R"({"j0":12})");
+
+        // Then - 전체 순차 읽기
+        reader.seekToStart();
+        size_t count = 0;
+        while (reader.hasNext()) {
+            if (reader.readNext()) {
+                count++;
+            }
+        }
+        EXPECT_EQ(count, 2000);
+    }
+}
+
+// Test 17: topic 인덱스 기반 필터 (드문 topic이 있는 청크만 읽기)
+TEST_F(BagReaderTest, BinaryFormatTopicIndexFilter) {
+    // Given - 고빈도 "imu" 1000개 사이에 저빈도 "alarm" 5개 (작은 청크)
+    std::string path = (testDir / "topics.bag").string();
+    size_t chunkCount = 0;
+    {
+        std::ofstream ofs(path, std::ios::binary);
+        BinaryChunkWriter chunkWriter(512);
+        for (int i = 0; i < 1000; i++) {
+            BagMessage msg;
+            msg.timestamp_ns = 1000 + i;
+            msg.topic = (i % 200 == 7) ? "alarm" : "imu";
+            msg.data_type = DataType::Event;
+            msg.serialized_value = std::to_string(i);
+            ASSERT_TRUE(chunkWriter.append(msg, ofs));
+        }
+        ASSERT_TRUE(chunkWriter.flushChunk(ofs));
+        chunkCount = chunkWriter.index().size();
+        ASSERT_TRUE(chunkWriter.index().writeToFile(ofs, chunkWriter.bytesWritten(),
+                                                    kBagVersionBinary, chunkWriter.messageCount()));
+    }
+
+    // When
+    BagReader reader;
+    ASSERT_TRUE(reader.open(path));
+    reader.setTopicFilter("alarm");
+
+    std::vector<int64_t> timestamps;
+    while (reader.hasNext()) {
+        auto msg = reader.readNext();
+        if (msg) {
+            EXPECT_EQ(msg->topic, "alarm");
+            timestamps.push_back(msg->timestamp_ns);
+        }
+    }
+
+    // Then
+    EXPECT_GT(chunkCount, 5);
+    EXPECT_EQ(timestamps, (std::vector<int64_t>{1007, 1207, 1407, 1607, 1807}));
+
+    // When - 인덱스에 없는 topic
+    reader.seekToStart();
+    reader.setTopicFilter("missing");
+
+    // Then
+    EXPECT_FALSE(reader.hasNext());
+    EXPECT_FALSE(reader.readNext().has_value());
+}
+
+// Test 18: 청크 체크섬 불일치 시 해당 청크만 건너뜀
+TEST_F(BagReaderTest, BinaryFormatCorruptedChunkSkipped) {
+    // Given - 여러 청크로 기록 후 두 번째 청크 payload 1바이트 변조
+    std::string path = (testDir / "corrupted.bag").string();
+    uint64_t corruptedOffset = 0;
+    {
+        std::ofstream ofs(path, std::ios::binary);
+        BinaryChunkWriter chunkWriter(256);
+        for (int i = 0; i < 100; i++) {
+            BagMessage msg;
+            msg.timestamp_ns = 1000 + i;
+            msg.topic = "data";
+            msg.data_type = DataType::Event;
+            msg.serialized_value = std::to_string(i);
+            ASSERT_TRUE(chunkWriter.append(msg, ofs));
+        }
+        ASSERT_TRUE(chunkWriter.flushChunk(ofs));
+        ASSERT_GT(chunkWriter.index().size(), 2);
+        corruptedOffset = chunkWriter.index().getEntries()[1].file_offset;
+        ASSERT_TRUE(chunkWriter.index().writeToFile(ofs, chunkWriter.bytesWritten(),
+                                                    kBagVersionBinary, chunkWriter.messageCount()));
+    }
+
+    ChunkHeader corruptedHeader;
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekg(static_cast<std::streamoff>(corruptedOffset));
+        file.read(reinterpret_cast<char*>(&corruptedHeader), sizeof(ChunkHeader));
+        ASSERT_TRUE(corruptedHeader.hasChecksum());
+
+        char byte = 0;
+        file.seekg(static_cast<std::streamoff>(corruptedOffset + sizeof(ChunkHeader) + 20));
+        file.read(&byte, 1);
+        byte ^= 0x5A;
+        file.seekp(static_cast<std::streamoff>(corruptedOffset + sizeof(ChunkHeader) + 20));
+        file.write(&byte, 1);
+    }
+
+    // When
+    BagReader reader;
+    ASSERT_TRUE(reader.open(path));
+
+    std::vector<int64_t> timestamps;
+    while (reader.hasNext()) {
+        auto msg = reader.readNext();
+        if (msg) {
+            timestamps.push_back(msg->timestamp_ns);
+        }
+    }
+
+    // Then - 변조된 청크의 메시지만 빠지고 이후 청크는 계속 읽힘
+    EXPECT_EQ(timestamps.size(), 100 - corruptedHeader.message_count);
+    ASSERT_FALSE(timestamps.empty());
+    EXPECT_EQ(timestamps.front(), 1000);
+    EXPECT_EQ(timestamps.back(), 1099);
+}
+
+// Test 19: Footer 없이 잘린 바이너리 파일 복구
+TEST_F(BagReaderTest, BinaryFormatRecoverTruncatedFile) {
+    // Given - Footer 없이 기록이 중단되고 마지막 청크가 잘린 파일
+    std::string path = (testDir / "truncated.bag").string();
+    uint64_t intactCount = 0;
+    {
+        std::ofstream ofs(path, std::ios::binary);
+        BinaryChunkWriter chunkWriter(256);
+        for (int i = 0; i < 100; i++) {
+            BagMessage msg;
+            msg.timestamp_ns = 1000 + i;
+            msg.topic = (i % 2 == 0) ? "even" : "odd";
+            msg.data_type = DataType::Event;
+            msg.serialized_value = std::to_string(i);
+            ASSERT_TRUE(chunkWriter.append(msg, ofs));
+        }
+        intactCount = chunkWriter.messageCount();
+        ASSERT_TRUE(chunkWriter.hasPendingChunk());
+        ASSERT_TRUE(chunkWriter.flushChunk(ofs));
+    }
+    fs::resize_file(path, fs::file_size(path) - 5);
+    ASSERT_GT(intactCount, 0);
+
+    // When
+    BagReader reader;
+    ASSERT_TRUE(reader.open(path));
+
+    // Then - 잘린 청크 이전의 모든 메시지를 순서대로 읽음
+    EXPECT_TRUE(reader.isRecovered());
+    EXPECT_EQ(reader.getMessageCount(), intactCount);
+
+    int64_t expected = 1000;
+    while (reader.hasNext()) {
+        auto msg = reader.readNext();
+        if (msg) {
+            EXPECT_EQ(msg->timestamp_ns, expected);
+            expected++;
+        }
+    }
+    EXPECT_EQ(static_cast<uint64_t>(expected - 1000), intactCount);
+
+    // 복구된 topic 인덱스로 필터링
+    reader.seekToStart();
+    reader.setTopicFilter("odd");
+    size_t oddCount = 0;
+    while (reader.hasNext()) {
+        auto msg = reader.readNext();
+        if (msg) {
+            EXPECT_EQ(msg->topic, "odd");
+            oddCount++;
+        }
+    }
+    EXPECT_EQ(oddCount, intactCount / 2);
+}
+
+// Test 20: 청크 시작 타임스탬프가 파일 순서대로 증가하지 않는 bag (여러 생산자)
+TEST_F(BagReaderTest, BinaryFormatSeekWithUnorderedChunks) {
+    // Given - 청크 범위: [1000..1009] a, [1100..1109] b, [1200..1209] a, [1050..1059] b
+    // (늦게 도착한 생산자의 청크가 마지막에 기록됨)
+    std::string path = (testDir / "unordered.bag").string();
+    {
+        std::ofstream ofs(path, std::ios::binary);
+        BinaryChunkWriter chunkWriter(1 << 20);
+        const std::vector<std::pair<int64_t, std::string>> chunks = {
+            {1000, "a"}, {1100, "b"}, {1200, "a"}, {1050, "b"}};
+        for (const auto& [start, topic] : chunks) {
+            for (int i = 0; i < 10; i++) {
+                BagMessage msg;
+                msg.timestamp_ns = start + i;
+                msg.topic = topic;
+                msg.data_type = DataType::Event;
+                msg.serialized_value = std::to_string(start + i);
+                ASSERT_TRUE(chunkWriter.append(msg, ofs));
+            }
+            ASSERT_TRUE(chunkWriter.flushChunk(ofs));
+        }
+        ASSERT_EQ(chunkWriter.index().size(), 4u);
+        ASSERT_TRUE(chunkWriter.index().writeToFile(ofs, chunkWriter.bytesWritten(),
+                                                    kBagVersionBinary, chunkWriter.messageCount()));
+    }
+
+    BagReader reader;
+    ASSERT_TRUE(reader.open(path));
+
+    // Then - 시간 범위는 파일 순서가 아닌 청크 [min, max] 기준
+    EXPECT_EQ(reader.getStartTimestamp(), 1000u);
+    EXPECT_EQ(reader.getEndTimestamp(), 1209u);
+
+    auto countFrom = [&reader](int64_t timestamp_ns) {
+        size_t count = 0;
+        while (reader.hasNext()) {
+            auto msg = reader.readNext();
+            if (msg && msg->timestamp_ns >= timestamp_ns) {
+                count++;
+            }
+        }
+        return count;
+    };
+
+    // When - 1055로 탐색
+    ASSERT_TRUE(reader.seekToTimestamp(1055));
+    auto first = reader.readNext();
+
+    // Then - 1055 이상인 첫 청크([1100..1109])부터 읽어 이후 메시지를 놓치지 않음
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(first->timestamp_ns, 1100);
+    EXPECT_EQ(1 + countFrom(1055), 25u);  // 1100..1109, 1200..1209, 1055..1059
+
+    // When - 토픽 필터와 함께 탐색
+    reader.setTopicFilter("b");
+    ASSERT_TRUE(reader.seekToTimestamp(1055));
+
+    // Then - 대상 topic 청크만 읽음 (1100..1109, 1055..1059)
+    EXPECT_EQ(countFrom(1055), 15u);
+
+    // When - 모든 메시지 이후로 탐색
+    ASSERT_TRUE(reader.seekToTimestamp(5000));
+
+    // Then
+    EXPECT_FALSE(reader.readNext().has_value());
+}
+
 } // namespace mxrc::core::logging
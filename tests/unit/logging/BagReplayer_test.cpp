@@ -2,6 +2,7 @@
 #include "core/logging/core/BagReplayer.h"
 #include "core/logging/core/SimpleBagWriter.h"
 #include "core/logging/dto/BagMessage.h"
+#include "core/rt/util/VirtualClock.h"
 #include <spdlog/spdlog.h>
 #include <filesystem>
 #include <chrono>
@@ -64,6 +65,30 @@ protected:
         testBagPath = writer->getCurrentFilePath();
     }
 
+    /**
+     * @brief 지정한 타임스탬프로 단일 토픽 Bag 파일 생성
+     *
+     * @return 생성된 파일 경로
+     */
+    std::string createBagFile(const std::string& baseName, const std::string& topic,
+                              const std::vector<uint64_t>& timestamps) {
+        auto writer = std::make_shared<SimpleBagWriter>(testDir.string(), baseName, 1000);
+        writer->start();
+
+        for (size_t i = 0; i < timestamps.size(); i++) {
+            BagMessage msg;
+            msg.timestamp_ns = timestamps[i];
+            msg.topic = topic;
+            msg.data_type = DataType::Event;
+            msg.serialized_value = R"({"seq":)" + std::to_string(i) + R"(})";
+            writer->append(msg);
+        }
+
+        writer->flush(1000);
+        writer->close();
+        return writer->getCurrentFilePath();
+    }
+
     fs::path testDir;
     std::string testBagPath;
 };
@@ -409,4 +434,89 @@ TEST_F(BagReplayerTest, ReplayWithoutCallback) {
     EXPECT_EQ(stats.messagesReplayed, 10);
 }
 
+// Test 13: 다중 파일 병합 재생 (타임스탬프 순서, 동일 시각은 파일 순서)
+TEST_F(BagReplayerTest, MultiFileMergedReplay) {
+    // Given - RT/NonRT 스트림을 별도 파일로 기록
+    std::string rtPath = createBagFile("rt", "rt_state", {100, 200, 300, 400, 500});
+    std::string nonrtPath = createBagFile("nonrt", "nonrt_state", {150, 300, 450});
+
+    BagReplayer replayer;
+    ASSERT_TRUE(replayer.open({rtPath, nonrtPath}));
+
+    std::vector<std::pair<int64_t, std::string>> replayed;
+    replayer.setMessageCallback([&](const BagMessage& msg) {
+        replayed.emplace_back(msg.timestamp_ns, msg.topic);
+    });
+
+    // When
+    replayer.start(ReplaySpeed::asFastAsPossible());
+    replayer.waitUntilFinished();
+
+    // Then
+    std::vector<std::pair<int64_t, std::string>> expected = {
+        {100, "rt_state"}, {150, "nonrt_state"}, {200, "rt_state"},
+        {300, "rt_state"}, {300, "nonrt_state"}, {400, "rt_state"},
+        {450, "nonrt_state"}, {500, "rt_state"}};
+    EXPECT_EQ(replayed, expected);
+
+    auto stats = replayer.getStats();
+    EXPECT_EQ(stats.messagesReplayed, 8);
+    EXPECT_GE(stats.progress, 0.99);
+}
+
+// Test 14: 가상 시간 구동 재생 (참여자와 메시지 순서가 결정적)
+TEST_F(BagReplayerTest, VirtualClockDeterministicReplay) {
+    // Given - 0.5초 주기로 깨어나는 참여자와 10개 메시지 (1초 간격)
+    rt::util::VirtualClock clock;
+    clock.attach();
+
+    std::atomic<int> delivered{0};
+    std::vector<std::pair<uint64_t, int>> ticks;  // (가상 시각, 그때까지 전달된 메시지 수)
+    std::thread participant([&]() {
+        if (!clock.waitForStart()) {
+            clock.detach();
+            return;
+        }
+        uint64_t next = clock.nowNs();
+        do {
+            ticks.emplace_back(clock.nowNs(), delivered.load());
+            next += 500000000;
+        } while (clock.waitUntil(next) == 0);
+        clock.detach();
+    });
+
+    uint64_t baseTimestamp = 1700000000000000000;
+    std::vector<uint64_t> timestamps;
+    for (uint64_t i = 0; i < 10; i++) {
+        timestamps.push_back(baseTimestamp + i * 1000000000ULL);
+    }
+
+    BagReplayer replayer;
+    ASSERT_TRUE(replayer.open(createBagFile("virtual", "state", timestamps)));
+    replayer.setVirtualClock(&clock);
+
+    bool clockMatches = true;
+    replayer.setMessageCallback([&](const BagMessage& msg) {
+        clockMatches = clockMatches && clock.nowNs() == static_cast<uint64_t>(msg.timestamp_ns);
+        delivered++;
+    });
+
+    // When
+    replayer.start(ReplaySpeed::asFastAsPossible());
+    replayer.waitUntilFinished();
+    participant.join();
+
+    // Then - 콜백 시점의 가상 시각 = 메시지 타임스탬프
+    EXPECT_TRUE(clockMatches);
+    EXPECT_EQ(delivered, 10);
+    EXPECT_TRUE(clock.isClosed());
+
+    // 시각 t의 참여자 실행은 t 이전 메시지 이후, t 메시지 이전에 일어남
+    ASSERT_EQ(ticks.size(), 19u);  // 0 ~ 9초, 0.5초 간격
+    for (size_t i = 0; i < ticks.size(); i++) {
+        EXPECT_EQ(ticks[i].first, baseTimestamp + i * 500000000);
+        EXPECT_EQ(ticks[i].second, static_cast<int>((i + 1) / 2));
+    }
+}
+
 } // namespace mxrc::core::logging
@@ -0,0 +1,233 @@
+#include "gtest/gtest.h"
+#include "core/logging/core/BagScanner.h"
+#include "core/logging/core/BagReader.h"
+#include "core/logging/core/SimpleBagWriter.h"
+#include "core/logging/dto/BagMessage.h"
+#include "core/logging/util/BinaryChunkWriter.h"
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+namespace mxrc::core::logging {
+
+/**
+ * @brief BagScanner 단위 테스트
+ *
+ * 인덱스 경계 범위 분할, 병렬 집계, 필터링 내보내기를 검증합니다.
+ */
+class BagScannerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        testDir = fs::temp_directory_path() / "mxrc_bagscanner_test";
+        fs::create_directories(testDir);
+    }
+
+    void TearDown() override {
+        if (fs::exists(testDir)) {
+            fs::remove_all(testDir);
+        }
+    }
+
+    /**
+     * @brief 작은 청크로 바이너리 Bag 파일 생성
+     *
+     * 메시지 i (first ≤ i < first + count)는 타임스탬프 1000 + i * 10,
+     * topic "even"/"odd", 값 i를 가집니다.
+     */
+    std::string createBinaryBag(const std::string& name, int first, int count) {
+        std::string path = (testDir / name).string();
+        std::ofstream ofs(path, std::ios::binary);
+        BinaryChunkWriter chunkWriter(256);
+        for (int i = first; i < first + count; i++) {
+            BagMessage msg;
+            msg.timestamp_ns = 1000 + i * 10;
+            msg.topic = (i % 2 == 0) ? "even" : "odd";
+            msg.data_type = DataType::Event;
+            msg.serialized_value = std::to_string(i);
+            EXPECT_TRUE(chunkWriter.append(msg, ofs));
+        }
+        EXPECT_TRUE(chunkWriter.flushChunk(ofs));
+        EXPECT_TRUE(chunkWriter.index().writeToFile(ofs, chunkWriter.bytesWritten(),
+                                                    kBagVersionBinary, chunkWriter.messageCount()));
+        return path;
+    }
+
+    fs::path testDir;
+};
+
+// Test 1: 범위는 인덱스 경계에 맞춰 데이터 영역을 빈틈없이 덮음
+TEST_F(BagScannerTest, SplitRangesCoverDataArea) {
+    // Given
+    std::string path = createBinaryBag("split.bag", 0, 200);
+    BagScanner scanner;
+    ASSERT_TRUE(scanner.open({path}));
+
+    // When
+    auto ranges = scanner.splitRanges(8);
+
+    // Then
+    ASSERT_GT(ranges.size(), 1);
+    BagReader reader;
+    ASSERT_TRUE(reader.open(path));
+    const auto& entries = reader.getIndex().getEntries();
+
+    EXPECT_EQ(ranges.front().beginOffset, 0);
+    EXPECT_EQ(ranges.back().endOffset, reader.getFooter().index_offset);
+    for (size_t i = 0; i < ranges.size(); i++) {
+        EXPECT_LT(ranges[i].beginOffset, ranges[i].endOffset);
+        if (i > 0) {
+            EXPECT_EQ(ranges[i].beginOffset, ranges[i - 1].endOffset);
+        }
+        bool aligned = std::any_of(entries.begin(), entries.end(), [&](const IndexEntry& e) {
+            return e.file_offset == ranges[i].beginOffset;
+        });
+        EXPECT_TRUE(aligned) << "range " << i << " not aligned to a chunk";
+    }
+}
+
+// Test 2: 로테이션된 바이너리 파일 병렬 집계 결과가 단일 스레드와 동일
+TEST_F(BagScannerTest, ParallelAggregateMatchesSingleThread) {
+    // Given - 파일 2개로 나뉜 메시지 0..299
+    std::string first = createBinaryBag("run_0.bag", 0, 150);
+    std::string second = createBinaryBag("run_1.bag", 150, 150);
+    BagScanner scanner;
+    ASSERT_TRUE(scanner.open({first, second}));
+    EXPECT_EQ(scanner.messageCount(), 300);
+
+    // When
+    ScanOptions serial;
+    serial.threads = 1;
+    ScanOptions parallel;
+    parallel.threads = 4;
+    ScanResult expected = scanner.aggregate(serial);
+    ScanResult result = scanner.aggregate(parallel);
+
+    // Then
+    ASSERT_TRUE(result.ok);
+    EXPECT_GT(result.rangeCount, 4);
+    EXPECT_EQ(result.messagesScanned, 300);
+    ASSERT_EQ(result.topics.size(), 2);
+
+    const TopicStats& even = result.topics.at("even");
+    EXPECT_EQ(even.count, 150);
+    EXPECT_EQ(even.numericCount, 150);
+    EXPECT_DOUBLE_EQ(even.min, 0.0);
+    EXPECT_DOUBLE_EQ(even.max, 298.0);
+    EXPECT_DOUBLE_EQ(even.mean(), 149.0);
+    EXPECT_EQ(even.firstTimestampNs, 1000);
+    EXPECT_EQ(even.lastTimestampNs, 1000 + 298 * 10);
+    EXPECT_DOUBLE_EQ(even.rateHz(), 149.0 / (2980.0 / 1e9));
+
+    for (const auto& [topic, stats] : expected.topics) {
+        const TopicStats& other = result.topics.at(topic);
+        EXPECT_EQ(other.count, stats.count);
+        EXPECT_DOUBLE_EQ(other.min, stats.min);
+        EXPECT_DOUBLE_EQ(other.max, stats.max);
+        EXPECT_DOUBLE_EQ(other.sum, stats.sum);
+    }
+}
+
+// Test 3: JSONL 파일 필드 집계 (토픽/시간 필터)
+TEST_F(BagScannerTest, JsonlFieldAggregateWithFilters) {
+    // Given - robot_position {"x": i, "y": 2i}, status 문자열 값
+    auto writer = std::make_shared<SimpleBagWriter>(testDir.string(), "scan", 1000);
+    writer->start();
+    for (int i = 0; i < 50; i++) {
+        BagMessage msg;
+        msg.timestamp_ns = 1000000 + i * 1000;
+        msg.topic = "robot_position";
+        msg.data_type = DataType::Event;
+        msg.serialized_value = R"({"x":)" + std::to_string(i) + R"(,"y":)" + std::to_string(i * 2) + "}";
+        writer->append(msg);
+
+        msg.topic = "status";
+        msg.serialized_value = R"("ok")";
+        writer->append(msg);
+    }
+    writer->flush(1000);
+    writer->close();
+
+    BagScanner scanner;
+    ASSERT_TRUE(scanner.open({writer->getCurrentFilePath()}));
+
+    // When - y 필드, 메시지 10..19 구간
+    ScanOptions options;
+    options.threads = 3;
+    options.topic = "robot_position";
+    options.field = "/y";
+    options.startTimeNs = 1000000 + 10 * 1000;
+    options.endTimeNs = 1000000 + 19 * 1000;
+    ScanResult result = scanner.aggregate(options);
+
+    // Then
+    ASSERT_TRUE(result.ok);
+    ASSERT_EQ(result.topics.size(), 1);
+    const TopicStats& stats = result.topics.at("robot_position");
+    EXPECT_EQ(stats.count, 10);
+    EXPECT_EQ(stats.numericCount, 10);
+    EXPECT_DOUBLE_EQ(stats.min, 20.0);
+    EXPECT_DOUBLE_EQ(stats.max, 38.0);
+    EXPECT_DOUBLE_EQ(stats.mean(), 29.0);
+
+    // When - 필터 없이: 숫자가 아닌 값은 count만 집계
+    ScanOptions all;
+    all.threads = 2;
+    ScanResult unfiltered = scanner.aggregate(all);
+
+    // Then
+    ASSERT_TRUE(unfiltered.ok);
+    EXPECT_EQ(unfiltered.messagesScanned, 100);
+    EXPECT_EQ(unfiltered.topics.at("status").count, 50);
+    EXPECT_EQ(unfiltered.topics.at("status").numericCount, 0);
+    EXPECT_EQ(unfiltered.topics.at("robot_position").numericCount, 0);
+}
+
+// Test 4: 필터링된 구간을 입력 순서대로 내보내기
+TEST_F(BagScannerTest, ExportFilteredPreservesOrder) {
+    // Given
+    std::string first = createBinaryBag("export_0.bag", 0, 100);
+    std::string second = createBinaryBag("export_1.bag", 100, 100);
+    BagScanner scanner;
+    ASSERT_TRUE(scanner.open({first, second}));
+
+    // When - odd 토픽, 메시지 51..169
+    ScanOptions options;
+    options.threads = 4;
+    options.topic = "odd";
+    options.startTimeNs = 1000 + 50 * 10;
+    options.endTimeNs = 1000 + 169 * 10;
+    std::string outPath = (testDir / "odd.bag").string();
+    uint64_t exported = 0;
+    ASSERT_TRUE(scanner.exportFiltered(outPath, options, ChunkCompression::None, &exported));
+
+    // Then
+    EXPECT_EQ(exported, 60);
+    BagReader reader;
+    ASSERT_TRUE(reader.open(outPath));
+    EXPECT_EQ(reader.getMessageCount(), 60);
+
+    int expected = 51;
+    while (auto msg = reader.readNext()) {
+        EXPECT_EQ(msg->topic, "odd");
+        EXPECT_EQ(msg->serialized_value, std::to_string(expected));
+        expected += 2;
+    }
+    EXPECT_EQ(expected, 171);
+}
+
+// Test 5: 잘못된 필드 포인터
+TEST_F(BagScannerTest, InvalidFieldPointerFails) {
+    std::string path = createBinaryBag("invalid.bag", 0, 10);
+    BagScanner scanner;
+    ASSERT_TRUE(scanner.open({path}));
+
+    ScanOptions options;
+    options.field = "x";  // '/'로 시작하지 않음
+    EXPECT_FALSE(scanner.aggregate(options).ok);
+
+    EXPECT_FALSE(scanner.open({(testDir / "missing.bag").string()}));
+    EXPECT_EQ(scanner.fileCount(), 0);
+}
+
+} // namespace mxrc::core::logging
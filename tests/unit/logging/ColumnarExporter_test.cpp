@@ -0,0 +1,195 @@
+#include "gtest/gtest.h"
+#include "core/logging/core/ColumnarExporter.h"
+#include "core/logging/core/ColumnarReader.h"
+#include "core/logging/dto/BagMessage.h"
+#include "core/logging/util/BinaryChunkWriter.h"
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+namespace mxrc::core::logging {
+
+/**
+ * @brief ColumnarExporter / ColumnarReader 단위 테스트
+ *
+ * 값 JSON의 타입 컬럼 변환, 정렬, 누락 필드, 파일 검증을 확인합니다.
+ */
+class ColumnarExporterTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        testDir = fs::temp_directory_path() / "mxrc_columnar_test";
+        fs::create_directories(testDir);
+        outPath = (testDir / "out.mxcol").string();
+    }
+
+    void TearDown() override {
+        if (fs::exists(testDir)) {
+            fs::remove_all(testDir);
+        }
+    }
+
+    static BagMessage makeMessage(int64_t ts, const std::string& topic, DataType type,
+                                  const std::string& value) {
+        BagMessage msg;
+        msg.timestamp_ns = ts;
+        msg.topic = topic;
+        msg.data_type = type;
+        msg.serialized_value = value;
+        return msg;
+    }
+
+    fs::path testDir;
+    std::string outPath;
+};
+
+// Test 1: 숫자 필드는 원래 타입 배열로 저장
+TEST_F(ColumnarExporterTest, NumericFieldsStoredNatively) {
+    // Given - Serializer 포맷: InterfaceData {"value": double}, RobotMode {"mode": int}
+    ColumnarExporter exporter;
+    for (int i = 0; i < 1000; i++) {
+        exporter.addMessage(makeMessage(1000 + i, "imu", DataType::InterfaceData,
+                                        R"({"value":)" + std::to_string(i * 0.5) +
+                                        R"(,"accel":{"x":)" + std::to_string(i) + "}}"));
+    }
+    for (int i = 0; i < 3; i++) {
+        exporter.addMessage(makeMessage(5000 + i, "mode", DataType::RobotMode,
+                                        R"({"mode":)" + std::to_string(i) + "}"));
+    }
+    EXPECT_EQ(exporter.rowCount(), 1003);
+    ASSERT_TRUE(exporter.write(outPath));
+
+    // When
+    ColumnarReader reader;
+    ASSERT_TRUE(reader.open(outPath));
+
+    // Then
+    EXPECT_EQ(reader.topics(), (std::vector<std::string>{"imu", "mode"}));
+    EXPECT_EQ(reader.rowCount("imu"), 1000);
+    EXPECT_EQ(reader.dataType("mode"), static_cast<uint32_t>(DataType::RobotMode));
+    EXPECT_EQ(reader.columnNames("imu"),
+              (std::vector<std::string>{kTimestampColumn, "accel.x", "value"}));
+
+    const uint64_t* ts = reader.timestamps("imu");
+    ASSERT_NE(ts, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ts) % kColumnAlignment, 0);
+    EXPECT_EQ(ts[0], 1000);
+    EXPECT_EQ(ts[999], 1999);
+
+    auto value = reader.column("imu", "value");
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ(value->type, ColumnType::Float64);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(value->data) % kColumnAlignment, 0);
+    EXPECT_DOUBLE_EQ(value->values<double>()[10], 5.0);
+    EXPECT_DOUBLE_EQ(value->values<double>()[999], 499.5);
+
+    auto accel = reader.column("imu", "accel.x");
+    ASSERT_TRUE(accel.has_value());
+    EXPECT_EQ(accel->type, ColumnType::Int64);
+    EXPECT_EQ(accel->values<int64_t>()[123], 123);
+    EXPECT_TRUE(accel->isValid(123));
+
+    auto mode = reader.column("mode", "mode");
+    ASSERT_TRUE(mode.has_value());
+    EXPECT_EQ(mode->type, ColumnType::Int64);
+    EXPECT_EQ(mode->values<int64_t>()[2], 2);
+}
+
+// Test 2: 누락 필드는 유효 플래그 0, 호환되지 않는 값은 타입 확장
+TEST_F(ColumnarExporterTest, MissingFieldsAndTypeWidening) {
+    ColumnarExporter exporter;
+    exporter.addMessage(makeMessage(1, "t", DataType::Event, R"({"a":1,"flag":true})"));
+    exporter.addMessage(makeMessage(2, "t", DataType::Event, R"({"a":2.5,"b":"x"})"));
+    exporter.addMessage(makeMessage(3, "t", DataType::Event, R"({"a":null,"b":7,"flag":false})"));
+    exporter.addMessage(makeMessage(4, "scalar", DataType::Event, R"("idle")"));
+    EXPECT_FALSE(exporter.addMessage(makeMessage(5, "t", DataType::Event, "not json")));
+    ASSERT_TRUE(exporter.write(outPath));
+
+    ColumnarReader reader;
+    ASSERT_TRUE(reader.open(outPath));
+    ASSERT_EQ(reader.rowCount("t"), 3);
+
+    // Int64 → Float64, null은 NaN + 유효 플래그 0
+    auto a = reader.column("t", "a");
+    ASSERT_TRUE(a.has_value());
+    EXPECT_EQ(a->type, ColumnType::Float64);
+    EXPECT_DOUBLE_EQ(a->values<double>()[0], 1.0);
+    EXPECT_DOUBLE_EQ(a->values<double>()[1], 2.5);
+    EXPECT_TRUE(std::isnan(a->values<double>()[2]));
+    EXPECT_FALSE(a->isValid(2));
+
+    // 첫 행에 없던 필드, 문자열과 숫자 혼합 → String
+    auto b = reader.column("t", "b");
+    ASSERT_TRUE(b.has_value());
+    EXPECT_EQ(b->type, ColumnType::String);
+    EXPECT_FALSE(b->isValid(0));
+    EXPECT_EQ(b->stringAt(1), "x");
+    EXPECT_EQ(b->stringAt(2), "7");
+
+    auto flag = reader.column("t", "flag");
+    ASSERT_TRUE(flag.has_value());
+    EXPECT_EQ(flag->type, ColumnType::Bool);
+    EXPECT_EQ(flag->values<uint8_t>()[0], 1);
+    EXPECT_FALSE(flag->isValid(1));
+    EXPECT_EQ(flag->values<uint8_t>()[2], 0);
+
+    auto scalar = reader.column("scalar", "value");
+    ASSERT_TRUE(scalar.has_value());
+    EXPECT_EQ(scalar->stringAt(0), "idle");
+}
+
+// Test 3: Bag 파일에서 토픽/시간 필터로 변환
+TEST_F(ColumnarExporterTest, ExportFromBagWithFilters) {
+    // Given
+    std::string bagPath = (testDir / "input.bag").string();
+    {
+        std::ofstream ofs(bagPath, std::ios::binary);
+        BinaryChunkWriter chunkWriter(512);
+        for (int i = 0; i < 200; i++) {
+            ASSERT_TRUE(chunkWriter.append(
+                makeMessage(1000 + i * 10, (i % 2 == 0) ? "even" : "odd", DataType::InterfaceData,
+                            R"({"value":)" + std::to_string(i) + "}"), ofs));
+        }
+        ASSERT_TRUE(chunkWriter.flushChunk(ofs));
+        ASSERT_TRUE(chunkWriter.index().writeToFile(ofs, chunkWriter.bytesWritten(),
+                                                    kBagVersionBinary, chunkWriter.messageCount()));
+    }
+
+    // When
+    ColumnarExporter exporter;
+    exporter.setTopicFilter("odd");
+    exporter.setTimeRange(1000 + 100 * 10, UINT64_MAX);
+    ASSERT_TRUE(exporter.addBag(bagPath));
+    EXPECT_FALSE(exporter.addBag((testDir / "missing.bag").string()));
+    ASSERT_TRUE(exporter.write(outPath));
+
+    // Then - 메시지 101, 103, ..., 199
+    ColumnarReader reader;
+    ASSERT_TRUE(reader.open(outPath));
+    EXPECT_EQ(reader.topics(), std::vector<std::string>{"odd"});
+    ASSERT_EQ(reader.rowCount("odd"), 50);
+    auto value = reader.column("odd", "value");
+    ASSERT_TRUE(value.has_value());
+    for (uint64_t row = 0; row < 50; row++) {
+        EXPECT_EQ(value->values<int64_t>()[row], static_cast<int64_t>(101 + row * 2));
+        EXPECT_EQ(reader.timestamps("odd")[row], 1000 + (101 + row * 2) * 10);
+    }
+}
+
+// Test 4: 잘린 파일은 열지 않음
+TEST_F(ColumnarExporterTest, TruncatedFileRejected) {
+    ColumnarExporter exporter;
+    for (int i = 0; i < 100; i++) {
+        exporter.addMessage(makeMessage(i, "t", DataType::Event, std::to_string(i)));
+    }
+    ASSERT_TRUE(exporter.write(outPath));
+    fs::resize_file(outPath, fs::file_size(outPath) - 100);
+
+    ColumnarReader reader;
+    EXPECT_FALSE(reader.open(outPath));
+    EXPECT_FALSE(reader.isOpen());
+    EXPECT_EQ(reader.timestamps("t"), nullptr);
+}
+
+} // namespace mxrc::core::logging
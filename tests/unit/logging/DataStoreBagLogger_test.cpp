@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 #include "core/DataStoreBagLogger.h"
 #include "core/SimpleBagWriter.h"
+#include "core/datastore/DataStore.h"
 #include "core/event/core/EventBus.h"
 #include "core/event/dto/DataStoreEvents.h"
 #include <spdlog/spdlog.h>
@@ -8,6 +9,8 @@
 #include <fstream>
 #include <thread>
 #include <chrono>
+#include <cmath>
+#include <map>
 
 namespace fs = std::filesystem;
 
@@ -279,4 +282,142 @@ TEST_F(DataStoreBagLoggerTest, PreventDoubleStart) {
     logger.stop();
 }
 
+// Test 9: DataStore 직접 캡처 (타입별 값 렌더링)
+TEST_F(DataStoreBagLoggerTest, CaptureDataStoreWritesDirectly) {
+    // Given
+    auto dataStore = DataStore::createForTest();
+    DataStoreBagLogger logger(eventBus, bagWriter);
+    logger.start();
+    EXPECT_FALSE(logger.attachDataStore(nullptr));
+    ASSERT_TRUE(logger.attachDataStore(dataStore, 64));
+    EXPECT_FALSE(logger.attachDataStore(dataStore));
+
+    // When
+    dataStore->set("robot.x", 1.5, ::DataType::InterfaceData);
+    dataStore->set("robot.mode", 42, ::DataType::RobotMode);
+    dataStore->set("mission.state", std::string("RUN \"A\""), ::DataType::MissionState);
+    dataStore->set("alarm.active", true, ::DataType::Alarm);
+    dataStore->setVersioned("robot.joints", std::vector<double>{1.0, -2.5}, ::DataType::InterfaceData);
+    std::string filepath = logger.getCurrentFilePath();
+    logger.stop();
+
+    // Then - 쓰기 순서대로, 타입에 맞는 JSON 값
+    std::ifstream ifs(filepath);
+    std::string line;
+    std::vector<std::pair<std::string, std::string>> values;
+    while (std::getline(ifs, line)) {
+        auto msg = BagMessage::fromJsonLine(line);
+        values.emplace_back(msg.topic, msg.serialized_value);
+    }
+    std::vector<std::pair<std::string, std::string>> expected = {
+        {"robot.x", "1.5"},
+        {"robot.mode", "42"},
+        {"mission.state", R"("RUN \"A\"")"},
+        {"alarm.active", "true"},
+        {"robot.joints", "[1,-2.5]"},
+    };
+    EXPECT_EQ(values, expected);
+
+    // 해제 후 쓰기는 기록되지 않음
+    dataStore->set("robot.x", 2.0, ::DataType::InterfaceData);
+    EXPECT_EQ(logger.getStats().messagesDropped, 0);
+}
+
+// Test 10: 캡처 버퍼가 가득 차면 드롭
+TEST_F(DataStoreBagLoggerTest, CaptureBufferOverflowDrops) {
+    // Given - drain 없이 버퍼만 사용
+    auto dataStore = DataStore::createForTest();
+    DataStoreCapture capture(4);
+    dataStore->setWriteTap(&capture);
+
+    // When
+    for (int i = 0; i < 10; i++) {
+        dataStore->set("counter", static_cast<int64_t>(i), ::DataType::Event);
+    }
+    dataStore->setWriteTap(nullptr);
+    dataStore->set("counter", static_cast<int64_t>(99), ::DataType::Event);
+
+    // Then
+    EXPECT_EQ(capture.capturedCount(), 4);
+    EXPECT_EQ(capture.droppedCount(), 6);
+
+    bagWriter->start();
+    EXPECT_EQ(capture.drain(*bagWriter), 4);
+    EXPECT_EQ(capture.drain(*bagWriter), 0);
+    EXPECT_TRUE(bagWriter->flush(5000));
+    EXPECT_EQ(bagWriter->getStats().messagesWritten, 4);
+    bagWriter->stop();
+
+    std::string out;
+    DataStoreCapture::renderValue(CapturedValueKind::Bytes, "\x01\xab", 2, out);
+    EXPECT_EQ(out, R"("01ab")");
+    double nan = std::nan("");
+    DataStoreCapture::renderValue(CapturedValueKind::Double, reinterpret_cast<const char*>(&nan),
+                                  sizeof(nan), out);
+    EXPECT_EQ(out, "null");
+}
+
+// Test 11: 여러 스레드의 긴 키를 topic ID로 intern, topic 한도 초과 드롭, 쓰기 중 탭 해제
+TEST_F(DataStoreBagLoggerTest, CaptureInternsTopicsAcrossThreads) {
+    // Given - 값 용량(8)보다 긴 키, topic 한도 4
+    auto dataStore = DataStore::createForTest();
+    DataStoreCapture capture(4096, 8, 4);
+    dataStore->setWriteTap(&capture);
+
+    constexpr int kThreads = 4;
+    constexpr int kWrites = 200;
+    std::vector<std::thread> writers;
+    for (int t = 0; t < kThreads; t++) {
+        writers.emplace_back([&dataStore, t]() {
+            std::string key = "robot.axis." + std::to_string(t) + ".position_feedback";
+            for (int i = 0; i < kWrites; i++) {
+                dataStore->set(key, static_cast<double>(i), ::DataType::InterfaceData);
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    dataStore->set("robot.extra", 1.0, ::DataType::InterfaceData);  // 5번째 키
+    dataStore->setWriteTap(nullptr);
+
+    // Then
+    EXPECT_EQ(capture.capturedCount(), kThreads * kWrites);
+    EXPECT_EQ(capture.droppedCount(), 1);
+
+    bagWriter->start();
+    EXPECT_EQ(capture.drain(*bagWriter), static_cast<size_t>(kThreads * kWrites));
+    EXPECT_TRUE(bagWriter->flush(5000));
+    std::string filepath = bagWriter->getCurrentFilePath();
+    bagWriter->stop();
+
+    std::map<std::string, int> perTopic;
+    std::ifstream ifs(filepath);
+    std::string line;
+    while (std::getline(ifs, line)) {
+        perTopic[BagMessage::fromJsonLine(line).topic]++;
+    }
+    ASSERT_EQ(perTopic.size(), static_cast<size_t>(kThreads));
+    for (int t = 0; t < kThreads; t++) {
+        EXPECT_EQ(perTopic["robot.axis." + std::to_string(t) + ".position_feedback"], kWrites);
+    }
+
+    // 쓰기가 진행 중일 때 탭을 해제하고 바로 파괴해도 안전 (해제가 진행 중 호출을 기다림)
+    auto transient = std::make_unique<DataStoreCapture>(64);
+    dataStore->setWriteTap(transient.get());
+    std::atomic<bool> running{true};
+    std::thread writer([&]() {
+        for (int i = 0; running.load(std::memory_order_relaxed); i++) {
+            dataStore->set("robot.busy", static_cast<double>(i), ::DataType::InterfaceData);
+        }
+    });
+    while (transient->capturedCount() + transient->droppedCount() == 0) {
+        std::this_thread::yield();
+    }
+    dataStore->setWriteTap(nullptr);
+    transient.reset();
+    running.store(false);
+    writer.join();
+}
+
 } // namespace mxrc::core::logging
@@ -192,6 +192,21 @@ TEST_F(IndexerTest, CRC32Checksum) {
     EXPECT_EQ(crc, crc2);
 }
 
+// Test 8-1: CRC32 표준 검증값 및 구간 연속 계산
+TEST_F(IndexerTest, CRC32KnownValueAndIncremental) {
+    // Given
+    std::string data = "123456789";
+    std::string longData(1000, 'x');
+
+    // Then - IEEE 802.3 CRC32 검증값
+    EXPECT_EQ(Indexer::crc32(data.data(), data.size()), 0xCBF43926u);
+
+    // 이어서 계산한 결과는 한 번에 계산한 결과와 같아야 함
+    uint32_t whole = Indexer::crc32(longData.data(), longData.size());
+    uint32_t first = Indexer::crc32(longData.data(), 333);
+    EXPECT_EQ(Indexer::crc32(longData.data() + 333, longData.size() - 333, first), whole);
+}
+
 // Test 9: 잘못된 파일 읽기
 TEST_F(IndexerTest, ReadInvalidFile) {
     // Given
@@ -222,4 +237,95 @@ TEST_F(IndexerTest, ClearEntries) {
     EXPECT_TRUE(indexer.empty());
 }
 
+// Test 11: Topic 인덱스 쓰기/읽기 (바이너리 포맷)
+TEST_F(IndexerTest, TopicIndexRoundTrip) {
+    // Given - 청크 3개, "fast"는 모든 청크, "slow"는 청크 1에만 존재
+    Indexer writer;
+    std::string filepath = (testDir / "topics.bag").string();
+    for (uint32_t chunk = 0; chunk < 3; chunk++) {
+        writer.addEntry(1000 * (chunk + 1), 256 * chunk);
+        writer.addTopicChunk(0, "fast", chunk, 100);
+    }
+    writer.addTopicChunk(1, "slow", 1, 2);
+
+    {
+        std::ofstream ofs(filepath, std::ios::binary);
+        ofs.write(std::string(768, '\0').data(), 768);  // 데이터 영역 대체
+        ASSERT_TRUE(writer.writeToFile(ofs, 768, kBagVersionBinary, 302));
+    }
+
+    // When
+    Indexer reader;
+    BagFooter footer = reader.readFromFile(filepath);
+
+    // Then
+    ASSERT_TRUE(footer.isValid());
+    EXPECT_EQ(footer.message_count, 302);
+    EXPECT_EQ(footer.topic_index_offset, 768 + 3 * sizeof(IndexEntry));
+    ASSERT_TRUE(reader.hasTopicIndex());
+
+    uint16_t topicId = 0;
+    const TopicIndex* slow = reader.findTopic("slow", topicId);
+    ASSERT_NE(slow, nullptr);
+    EXPECT_EQ(topicId, 1);
+    EXPECT_EQ(slow->chunks, std::vector<uint32_t>{1});
+    EXPECT_EQ(slow->message_count, 2);
+    EXPECT_EQ(reader.findTopic("missing", topicId), nullptr);
+
+    EXPECT_EQ(reader.getChunkTopics(0), std::vector<uint16_t>{0});
+    EXPECT_EQ(reader.getChunkTopics(1), (std::vector<uint16_t>{0, 1}));
+}
+
+// Test 12: 청크 범위는 인덱스 블록에서 로드 (청크 헤더를 읽지 않음)
+TEST_F(IndexerTest, ChunkRangesLoadedFromIndex) {
+    // Given - 청크 시작 순서와 끝 순서가 다른 청크 3개, 데이터 영역은 0 (유효한 청크 헤더 없음)
+    Indexer writer;
+    std::string filepath = (testDir / "ranges.bag").string();
+    writer.addChunk(1000, 5000, 0);
+    writer.addChunk(2000, 3000, 256);
+    writer.addChunk(4000, 9000, 512);
+    writer.addTopicChunk(0, "fast", 0, 1);
+
+    {
+        std::ofstream ofs(filepath, std::ios::binary);
+        ofs.write(std::string(768, '\0').data(), 768);
+        ASSERT_TRUE(writer.writeToFile(ofs, 768, kBagVersionBinary, 3));
+    }
+
+    // When
+    Indexer reader;
+    BagFooter footer = reader.readFromFile(filepath);
+
+    // Then
+    ASSERT_TRUE(footer.isValid());
+    EXPECT_EQ(footer.chunk_range_offset, 768 + 3 * sizeof(IndexEntry));
+    EXPECT_EQ(footer.topic_index_offset, footer.chunk_range_offset + 3 * sizeof(uint64_t));
+    ASSERT_TRUE(reader.hasChunkRanges());
+    ASSERT_EQ(reader.getChunkRanges().size(), 3u);
+    EXPECT_EQ(reader.getChunkRanges()[1].start_ns, 2000u);
+    EXPECT_EQ(reader.getChunkRanges()[1].end_ns, 3000u);
+    EXPECT_EQ(reader.getTimeRange().start_ns, 1000u);
+    EXPECT_EQ(reader.getTimeRange().end_ns, 9000u);
+    EXPECT_TRUE(reader.hasTopicIndex());
+
+    uint32_t chunk = 0;
+    ASSERT_TRUE(reader.findChunkByTimestamp(4500, chunk));
+    EXPECT_EQ(chunk, 0u);  // 청크 0이 5000까지 포함
+    ASSERT_TRUE(reader.findChunkByTimestamp(6000, chunk));
+    EXPECT_EQ(chunk, 2u);
+
+    // addEntry()만 사용한 인덱스 (JSONL, 이전 파일)는 블록 없음
+    Indexer legacy;
+    legacy.addEntry(1000, 0);
+    std::string legacyPath = (testDir / "legacy.bag").string();
+    {
+        std::ofstream ofs(legacyPath, std::ios::binary);
+        ofs.write(std::string(256, '\0').data(), 256);
+        ASSERT_TRUE(legacy.writeToFile(ofs, 256, kBagVersionBinary, 1));
+    }
+    Indexer legacyReader;
+    EXPECT_EQ(legacyReader.readFromFile(legacyPath).chunk_range_offset, 0u);
+    EXPECT_FALSE(legacyReader.hasChunkRanges());
+}
+
 } // namespace mxrc::core::logging
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include "core/rt/util/DCPhaseTracker.h"
+#include <cmath>
+#include <cstdint>
+
+using namespace mxrc::core::rt::util;
+
+// 위상 오차는 SYNC0 주기 내에서 [-T/2, T/2)로 wrap
+TEST(DCPhaseTrackerTest, PhaseErrorWrapsAroundSync0) {
+    DCPhaseConfig config;
+    config.sync0_cycle_ns = 1'000'000;
+    config.send_lead_ns = 100'000;  // 목표 위상 900us
+    DCPhaseTracker tracker(config);
+
+    // 위상 950us → 목표보다 50us 늦음 → 일찍 깨어남
+    tracker.update(0, 5'000'950'000);
+    EXPECT_EQ(50'000, tracker.getPhaseErrorNs());
+    EXPECT_LT(tracker.getCorrectionNs(), 0);
+
+    // 위상 100us → 목표(900us)보다 200us 앞섬 (다음 주기 기준 wrap)
+    tracker.reset();
+    tracker.update(0, 5'000'100'000);
+    EXPECT_EQ(200'000, tracker.getPhaseErrorNs());
+
+    // 위상 600us → 목표보다 300us 이름
+    tracker.reset();
+    tracker.update(0, 5'000'600'000);
+    EXPECT_EQ(-300'000, tracker.getPhaseErrorNs());
+    EXPECT_GT(tracker.getCorrectionNs(), 0);
+    EXPECT_LE(tracker.getCorrectionNs(), config.max_correction_ns);
+}
+
+// 폐루프: 50ppm drift + 임의 초기 위상에서 목표 위상으로 수렴, drift 추정
+TEST(DCPhaseTrackerTest, ConvergesUnderDrift) {
+    DCPhaseConfig config;
+    config.sync0_cycle_ns = 1'000'000;
+    config.sync0_shift_ns = 20'000;
+    config.send_lead_ns = 150'000;
+    DCPhaseTracker tracker(config);
+
+    const double drift_ppm = 50.0;
+    const int64_t initial_offset_ns = 123'456'789;
+
+    uint64_t local_ns = 10'000'000'000ULL;
+    const uint64_t start_ns = local_ns;
+    for (int cycle = 0; cycle < 20000; ++cycle) {
+        uint64_t reference_ns = local_ns + initial_offset_ns +
+            static_cast<int64_t>(static_cast<double>(local_ns - start_ns) * drift_ppm * 1e-6);
+        int64_t correction = tracker.update(local_ns, reference_ns);
+        local_ns += config.sync0_cycle_ns + correction;
+    }
+
+    EXPECT_NEAR(drift_ppm, tracker.getDriftPpm(), 0.5);
+    EXPECT_TRUE(tracker.isLocked(100));
+    // 정상 상태 보정은 drift feed-forward (-T * 50ppm = -50ns)
+    EXPECT_NEAR(-50.0, static_cast<double>(tracker.getCorrectionNs()), 2.0);
+    EXPECT_EQ(20000u, tracker.getSampleCount());
+}
@@ -177,3 +177,56 @@ TEST_F(RTDataStoreTest, ConcurrentWrites) {
     // 최소한 NUM_THREADS * WRITES_PER_THREAD 만큼 sequence가 증가해야 함
     EXPECT_GE(store_.getSeq(DataKey::ROBOT_X), NUM_THREADS * WRITES_PER_THREAD);
 }
+
+// Process image 뷰: 바인딩된 키는 image에서 직접 읽음
+TEST_F(RTDataStoreTest, ProcessImageViewReadsImage) {
+    ASSERT_EQ(0, store_.bindView(DataKey::ROBOT_X, 16, ImageFormat::INT32, 0.001));
+    ASSERT_EQ(0, store_.bindView(DataKey::ROBOT_Y, 20, ImageFormat::INT16));
+    ASSERT_EQ(0, store_.bindView(DataKey::ROBOT_SPEED, 24, ImageFormat::FLOAT));
+    EXPECT_TRUE(store_.isView(DataKey::ROBOT_X));
+    EXPECT_FALSE(store_.isView(DataKey::ROBOT_Z));
+
+    // 범위 밖 바인딩 거부
+    EXPECT_EQ(-1, store_.bindView(DataKey::ROBOT_Z, RTDataStore::PROCESS_IMAGE_SIZE - 2,
+                                  ImageFormat::INT32));
+
+    uint8_t domain[32] = {};
+    int32_t counts = 123456;
+    int16_t di = -7;
+    float speed = 1.5f;
+    std::memcpy(domain + 16, &counts, sizeof(counts));
+    std::memcpy(domain + 20, &di, sizeof(di));
+    std::memcpy(domain + 24, &speed, sizeof(speed));
+    uint64_t seq_before = store_.getSeq(DataKey::ROBOT_X);
+    ASSERT_EQ(0, store_.publishImage(domain, sizeof(domain)));
+    EXPECT_EQ(seq_before + 2, store_.getSeq(DataKey::ROBOT_X));
+
+    double position = 0.0;
+    ASSERT_EQ(0, store_.getDouble(DataKey::ROBOT_X, position));
+    EXPECT_DOUBLE_EQ(123.456, position);
+
+    int32_t di_value = 0;
+    ASSERT_EQ(0, store_.getInt32(DataKey::ROBOT_Y, di_value));
+    EXPECT_EQ(-7, di_value);
+    EXPECT_EQ(-1, store_.getInt32(DataKey::ROBOT_X, di_value));  // scale 적용 뷰
+
+    float speed_value = 0.0f;
+    ASSERT_EQ(0, store_.getFloat(DataKey::ROBOT_SPEED, speed_value));
+    EXPECT_FLOAT_EQ(1.5f, speed_value);
+    EXPECT_TRUE(store_.isFresh(DataKey::ROBOT_X, 1'000'000'000ULL));
+
+    // 뷰는 읽기 전용, 해제 후 일반 키로 복귀
+    EXPECT_EQ(-1, store_.setDouble(DataKey::ROBOT_X, 1.0));
+    ASSERT_EQ(0, store_.unbindView(DataKey::ROBOT_X));
+    EXPECT_EQ(0, store_.setDouble(DataKey::ROBOT_X, 1.0));
+    ASSERT_EQ(0, store_.getDouble(DataKey::ROBOT_X, position));
+    EXPECT_DOUBLE_EQ(1.0, position);
+
+    // image 직접 갱신 (외부 메모리 모드)
+    store_.beginImageUpdate();
+    di = 42;
+    std::memcpy(store_.processImage() + 20, &di, sizeof(di));
+    store_.endImageUpdate();
+    ASSERT_EQ(0, store_.getInt32(DataKey::ROBOT_Y, di_value));
+    EXPECT_EQ(42, di_value);
+}
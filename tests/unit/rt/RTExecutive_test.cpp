@@ -5,6 +5,8 @@
 #include "core/rt/ipc/SharedMemoryData.h"
 #include "core/rt/util/ScheduleCalculator.h"
 #include "core/rt/util/TimeUtils.h"
+#include "core/rt/util/VirtualClock.h"
+#include "core/rt/util/DCPhaseTracker.h"
 #include <thread>
 #include <atomic>
 
@@ -425,3 +427,83 @@ TEST_F(RTExecutiveTest, HeartbeatMonitoringDisabled) {
     // Monitoring이 비활성화되어 SAFE_MODE로 진입하지 않아야 함
     EXPECT_FALSE(entered_safe_mode);
 }
+
+// 가상 시간 구동: 주기 실행이 벽시계와 무관하게 가상 시간을 따름
+TEST_F(RTExecutiveTest, VirtualClockDrivesCycles) {
+    util::VirtualClock clock;  // exec보다 오래 유지
+    RTExecutive exec(10, 50);
+    exec.setVirtualClock(&clock);
+
+    std::vector<uint64_t> timestamps;
+    exec.registerAction("test", 10, [&timestamps](RTContext& ctx) {
+        timestamps.push_back(ctx.timestamp_ns);
+    });
+
+    std::thread exec_thread([&exec]() {
+        exec.run();
+    });
+
+    const uint64_t start_ns = 1'000'000'000;
+    clock.start(start_ns);
+    clock.advanceTo(start_ns + 95'000'000);  // 95ms → 0, 10, ..., 90ms 주기 실행
+
+    ASSERT_EQ(timestamps.size(), 10u);
+    for (size_t i = 0; i < timestamps.size(); i++) {
+        EXPECT_EQ(timestamps[i], start_ns + i * 10'000'000);
+    }
+
+    // clock 종료 시 run() 반환
+    clock.close();
+    exec_thread.join();
+    EXPECT_EQ(timestamps.size(), 10u);
+}
+
+// DC 위상 정렬: cycle 시작이 SYNC0보다 send_lead 앞서도록 wakeup 보정
+TEST_F(RTExecutiveTest, DCSyncAlignsCyclePhase) {
+    util::VirtualClock clock;  // exec보다 오래 유지
+    RTExecutive exec(10, 50);
+    exec.setVirtualClock(&clock);
+
+    std::vector<uint64_t> timestamps;
+    exec.registerAction("ethercat", 10, [&timestamps](RTContext& ctx) {
+        timestamps.push_back(ctx.timestamp_ns);
+    });
+
+    // reference clock = 로컬 + 3ms (이번 cycle 프레임 기준)
+    util::DCPhaseConfig config;
+    config.sync0_cycle_ns = 10'000'000;
+    config.send_lead_ns = 1'000'000;      // 목표 위상 9ms
+    config.kp = 0.5;
+    config.ki = 0.0;
+    config.max_correction_ns = 1'000'000;
+    exec.enableDCSync([&timestamps](uint64_t& reference_ns) {
+        if (timestamps.empty()) {
+            return -1;
+        }
+        reference_ns = timestamps.back() + 3'000'000;
+        return 0;
+    }, config);
+
+    std::thread exec_thread([&exec]() {
+        exec.run();
+    });
+
+    const uint64_t start_ns = 1'000'000'000;
+    clock.start(start_ns);
+    clock.advanceTo(start_ns + 300'000'000);
+    clock.close();
+    exec_thread.join();
+
+    // 초기 위상 3ms → 목표 9ms: 4ms 앞당김 (cycle당 최대 1ms)
+    ASSERT_GT(timestamps.size(), 20u);
+    EXPECT_EQ(timestamps[1] - timestamps[0], 9'000'000u);
+
+    const auto* tracker = exec.getDCPhaseTracker();
+    ASSERT_NE(nullptr, tracker);
+    EXPECT_TRUE(tracker->isLocked(1000));
+    uint64_t last_phase = (timestamps.back() + 3'000'000) % config.sync0_cycle_ns;
+    EXPECT_NEAR(9'000'000.0, static_cast<double>(last_phase), 1000.0);
+    EXPECT_NEAR(10'000'000.0,
+                static_cast<double>(timestamps.back() - timestamps[timestamps.size() - 2]),
+                1000.0);
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include "core/rt/util/VirtualClock.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace mxrc::core::rt::util;
+
+// advanceTo는 마감 순서대로 참여자를 실행하고, 모두 다시 대기한 뒤 반환
+TEST(VirtualClockTest, AdvanceRunsParticipantInDeadlineOrder) {
+    VirtualClock clock;
+    clock.attach();
+
+    std::vector<uint64_t> wakeups;
+    std::thread participant([&]() {
+        ASSERT_TRUE(clock.waitForStart());
+        uint64_t next = clock.nowNs();
+        do {
+            wakeups.push_back(clock.nowNs());
+            next += 10;
+        } while (clock.waitUntil(next) == 0);
+        clock.detach();
+    });
+
+    clock.start(100);
+    clock.advanceTo(135);
+
+    // advanceTo 반환 시점에 참여자는 130 주기까지 실행 완료
+    EXPECT_EQ(wakeups, (std::vector<uint64_t>{100, 110, 120, 130}));
+    EXPECT_EQ(clock.nowNs(), 135);
+
+    clock.advanceTo(140);
+    EXPECT_EQ(wakeups.back(), 140);
+
+    clock.close();
+    participant.join();
+    EXPECT_TRUE(clock.isClosed());
+}
+
+// 시간은 뒤로 가지 않음
+TEST(VirtualClockTest, AdvanceNeverMovesBackwards) {
+    VirtualClock clock;
+    clock.start(1000);
+
+    clock.advanceTo(500);
+    EXPECT_EQ(clock.nowNs(), 1000);
+
+    clock.advanceTo(2000);
+    EXPECT_EQ(clock.nowNs(), 2000);
+    EXPECT_EQ(clock.waitUntil(1500), 0);  // 이미 지난 시각은 즉시 반환
+}
+
+// close와 취소는 대기를 해제
+TEST(VirtualClockTest, CloseAndCancelReleaseWaiters) {
+    VirtualClock clock;
+    clock.start(0);
+
+    std::atomic<bool> running{true};
+    std::atomic<int> cancelled_result{0};
+    std::thread cancelled([&]() {
+        cancelled_result = clock.waitUntil(1000, &running);
+    });
+
+    std::atomic<int> closed_result{0};
+    std::thread closed([&]() {
+        closed_result = clock.waitUntil(1000);
+    });
+
+    running = false;
+    clock.wakeAll();
+    cancelled.join();
+    EXPECT_EQ(cancelled_result, -1);
+
+    clock.close();
+    closed.join();
+    EXPECT_EQ(closed_result, -1);
+    EXPECT_EQ(clock.waitUntil(2000), -1);
+}
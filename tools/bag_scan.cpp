@@ -0,0 +1,160 @@
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../src/core/logging/core/BagScanner.h"
+#include "../src/core/logging/core/ColumnarExporter.h"
+
+using namespace mxrc::core::logging;
+
+namespace {
+
+void printUsage(const char* argv0) {
+    std::cerr << "Usage: " << argv0 << " [options] <file.bag>...\n";
+    std::cerr << "Options:\n";
+    std::cerr << "  -j, --threads N       Worker threads (default: hardware concurrency)\n";
+    std::cerr << "  --topic NAME          Only scan this topic\n";
+    std::cerr << "  --field POINTER       JSON pointer of the numeric field (e.g. /x)\n";
+    std::cerr << "  --start NS            Start timestamp (ns, inclusive)\n";
+    std::cerr << "  --end NS              End timestamp (ns, inclusive)\n";
+    std::cerr << "  --export OUT.bag      Write filtered messages to a binary bag instead of aggregating\n";
+    std::cerr << "  --compression TYPE    Export chunk compression: none, lz4, zstd (default: none)\n";
+    std::cerr << "  --columnar OUT.mxcol  Write filtered messages to a typed columnar file\n";
+    std::cerr << "Example: " << argv0 << " -j 8 --topic robot_position --field /x run_0.bag run_1.bag\n";
+}
+
+bool parseCompression(const std::string& name, ChunkCompression& out) {
+    if (name == "none") {
+        out = ChunkCompression::None;
+    } else if (name == "lz4") {
+        out = ChunkCompression::Lz4;
+    } else if (name == "zstd") {
+        out = ChunkCompression::Zstd;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    ScanOptions options;
+    std::vector<std::string> files;
+    std::string exportPath;
+    std::string columnarPath;
+    ChunkCompression compression = ChunkCompression::None;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc) {
+                    throw std::invalid_argument("missing value for " + arg);
+                }
+                return argv[++i];
+            };
+
+            if (arg == "-h" || arg == "--help") {
+                printUsage(argv[0]);
+                return 0;
+            } else if (arg == "-j" || arg == "--threads") {
+                options.threads = static_cast<unsigned>(std::stoul(value()));
+            } else if (arg == "--topic") {
+                options.topic = value();
+            } else if (arg == "--field") {
+                options.field = value();
+            } else if (arg == "--start") {
+                options.startTimeNs = std::stoull(value());
+            } else if (arg == "--end") {
+                options.endTimeNs = std::stoull(value());
+            } else if (arg == "--export") {
+                exportPath = value();
+            } else if (arg == "--columnar") {
+                columnarPath = value();
+            } else if (arg == "--compression") {
+                const std::string name = value();
+                if (!parseCompression(name, compression)) {
+                    throw std::invalid_argument("unknown compression: " + name);
+                }
+            } else if (!arg.empty() && arg[0] == '-') {
+                throw std::invalid_argument("unknown option: " + arg);
+            } else {
+                files.push_back(arg);
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    if (files.empty()) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    // 컬럼 파일 변환 (파일 순서대로 순차 처리)
+    if (!columnarPath.empty()) {
+        ColumnarExporter exporter;
+        exporter.setTopicFilter(options.topic);
+        exporter.setTimeRange(options.startTimeNs, options.endTimeNs);
+        for (const auto& file : files) {
+            if (!exporter.addBag(file)) {
+                std::cerr << "Error: Cannot open bag file: " << file << "\n";
+                return 1;
+            }
+        }
+        if (!exporter.write(columnarPath)) {
+            std::cerr << "Error: Columnar export failed: " << columnarPath << "\n";
+            return 1;
+        }
+        std::cout << "Exported " << exporter.rowCount() << " rows in " << exporter.topicCount()
+                  << " topics to " << columnarPath << "\n";
+        return 0;
+    }
+
+    BagScanner scanner;
+    if (!scanner.open(files)) {
+        std::cerr << "Error: Cannot open bag files\n";
+        return 1;
+    }
+
+    // 필터링된 구간 내보내기
+    if (!exportPath.empty()) {
+        uint64_t exported = 0;
+        if (!scanner.exportFiltered(exportPath, options, compression, &exported)) {
+            std::cerr << "Error: Export failed: " << exportPath << "\n";
+            return 1;
+        }
+        std::cout << "Exported " << exported << " messages to " << exportPath << "\n";
+        return 0;
+    }
+
+    // topic별 집계
+    ScanResult result = scanner.aggregate(options);
+    if (!result.ok) {
+        std::cerr << "Error: Scan failed\n";
+        return 1;
+    }
+
+    std::printf("%-32s %12s %14s %14s %14s %12s\n",
+                "topic", "count", "min", "max", "mean", "rate(Hz)");
+    for (const auto& [topic, stats] : result.topics) {
+        if (stats.numericCount > 0) {
+            std::printf("%-32s %12llu %14.6g %14.6g %14.6g %12.3f\n", topic.c_str(),
+                        static_cast<unsigned long long>(stats.count),
+                        stats.min, stats.max, stats.mean(), stats.rateHz());
+        } else {
+            std::printf("%-32s %12llu %14s %14s %14s %12.3f\n", topic.c_str(),
+                        static_cast<unsigned long long>(stats.count),
+                        "-", "-", "-", stats.rateHz());
+        }
+    }
+
+    std::printf("\n%llu messages in %zu files, %zu ranges on %u threads, %.3f s\n",
+                static_cast<unsigned long long>(result.messagesScanned), scanner.fileCount(),
+                result.rangeCount, result.threads, result.elapsedSec);
+    return 0;
+}